@@ -30,7 +30,10 @@ public class JUSYNC : ModuleRules
             "SlateCore",
             "RenderCore",
             "RHI",
-            "GameplayTasks"
+            "GameplayTasks",
+            "MeshDescription",
+            "StaticMeshDescription",
+            "MeshConversion"
         });
 
         // Critical STL linking definitions
@@ -43,37 +43,43 @@ void UJUSYNCAsyncLoadUSD::Activate()
         return;
     }
 
-    // Perform async loading on background thread
-    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]()
+    UJUSYNCSubsystem* Subsystem = UJUSYNCBlueprintLibrary::GetJUSYNCSubsystem();
+    if (!Subsystem)
     {
-        TArray<FJUSYNCMeshData> MeshData;
-        FString Preview;
-        bool bSuccess = false;
-
-        // Broadcast initial progress
-        AsyncTask(ENamedThreads::GameThread, [this]()
-        {
-            BroadcastProgress(0.1f);
-        });
+        OnFailure.Broadcast(TArray<FJUSYNCMeshData>(), false);
+        SetReadyToDestroy();
+        return;
+    }
 
-        if (bIsFromDisk)
+    // Keep the node alive until the middleware reports back; progress is per stage and per mesh
+    RegisterWithGameInstance(Subsystem->GetGameInstance());
+    TWeakObjectPtr<UJUSYNCAsyncLoadUSD> WeakThis(this);
+    auto HandleProgress = [WeakThis](float Progress)
+    {
+        if (UJUSYNCAsyncLoadUSD* Action = WeakThis.Get())
         {
-            // Load from disk using your existing function
-            bSuccess = UJUSYNCBlueprintLibrary::LoadUSDFromDisk(FilePathData, MeshData, Preview);
+            Action->BroadcastProgress(Progress);
         }
-        else
+    };
+    auto HandleComplete = [WeakThis](bool bSuccess, TArray<FJUSYNCMeshData>&& MeshData)
+    {
+        if (UJUSYNCAsyncLoadUSD* Action = WeakThis.Get())
         {
-            // Load from buffer using your existing function
-            bSuccess = UJUSYNCBlueprintLibrary::LoadUSDFromBuffer(BufferData, FilenameData, MeshData, Preview);
+            Action->OnLoadComplete(bSuccess, MeshData);
         }
+    };
 
-        // Return to game thread for Blueprint callback
-        AsyncTask(ENamedThreads::GameThread, [this, bSuccess, MeshData]()
-        {
-            BroadcastProgress(1.0f);
-            OnLoadComplete(bSuccess, MeshData);
-        });
-    });
+    const int64 LoadId = bIsFromDisk
+        ? Subsystem->LoadUSDFromDiskAsync(FilePathData, HandleProgress, HandleComplete)
+        : Subsystem->LoadUSDFromBufferAsync(BufferData, FilenameData, HandleProgress, HandleComplete);
+
+    // The middleware holds its own copy from here on
+    BufferData.Empty();
+
+    if (LoadId == 0)
+    {
+        OnLoadComplete(false, TArray<FJUSYNCMeshData>());
+    }
 }
 
 void UJUSYNCAsyncLoadUSD::OnLoadComplete(bool bSuccess, const TArray<FJUSYNCMeshData>& MeshData)
@@ -137,6 +137,31 @@ bool UJUSYNCBlueprintLibrary::LoadUSDFromBuffer(const TArray<uint8>& Buffer, con
     return bResult;
 }
 
+bool UJUSYNCBlueprintLibrary::LoadUSDFromFileData(const FJUSYNCFileData& FileData, TArray<FJUSYNCMeshData>& OutMeshData)
+{
+    if (FileData.GetNumBytes() <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("LoadUSDFromFileData: File data is empty: %s"), *FileData.Filename);
+        return false;
+    }
+
+    UJUSYNCSubsystem* Subsystem = GetJUSYNCSubsystem();
+    if (!Subsystem)
+    {
+        UE_LOG(LogTemp, Error, TEXT("JUSYNC Subsystem not available for USD loading"));
+        return false;
+    }
+
+    return Subsystem->LoadUSDFromFileData(FileData, OutMeshData);
+}
+
+bool UJUSYNCBlueprintLibrary::GetFileDataBytes(const FJUSYNCFileData& FileData, TArray<uint8>& OutBytes)
+{
+    // Explicit copy for Blueprint nodes that need an owned byte array
+    OutBytes = TArray<uint8>(FileData.GetBytesView());
+    return OutBytes.Num() > 0;
+}
+
 bool UJUSYNCBlueprintLibrary::LoadUSDFromDisk(const FString& FilePath, TArray<FJUSYNCMeshData>& OutMeshData, FString& OutPreview)
 {
     if (!ValidateFilePath(FilePath, TEXT("LoadUSDFromDisk")))
@@ -185,6 +210,15 @@ bool UJUSYNCBlueprintLibrary::ValidateUSDFormat(const TArray<uint8>& Buffer, con
            Content.Contains(TEXT("over "));
 }
 
+void UJUSYNCBlueprintLibrary::SetJUSYNCInstancingEnabled(bool bEnable)
+{
+    UJUSYNCSubsystem* Subsystem = GetJUSYNCSubsystem();
+    if (Subsystem)
+    {
+        Subsystem->SetInstancingEnabled(bEnable);
+    }
+}
+
 // ========== TEXTURE PROCESSING ==========
 
 FJUSYNCTextureData UJUSYNCBlueprintLibrary::CreateTextureFromBuffer(const TArray<uint8>& Buffer)
@@ -402,8 +436,8 @@ bool UJUSYNCBlueprintLibrary::CheckForReceivedFiles(TArray<FJUSYNCFileData>& Out
         // Log received files for debugging
         for (const FJUSYNCFileData& FileData : ReceivedFiles)
         {
-            FString Message = FString::Printf(TEXT("Received File: %s (%d bytes, %s)"),
-                                            *FileData.Filename, FileData.Data.Num(), *FileData.FileType);
+            FString Message = FString::Printf(TEXT("Received File: %s (%lld bytes, %s)"),
+                                            *FileData.Filename, FileData.GetNumBytes(), *FileData.FileType);
             UE_LOG(LogTemp, Log, TEXT("%s"), *Message);
             //DisplayDebugMessage(Message, 5.0f, FLinearColor::Blue);
         }
@@ -797,72 +831,6 @@ void UJUSYNCBlueprintLibrary::ApplyEnhancedDefaultMaterial(URealtimeMeshComponen
     }
 }
 
-// Update the async internal function
-void UJUSYNCBlueprintLibrary::AsyncBatchSpawnInternal(
-    const TArray<FJUSYNCMeshData>& MeshDataArray,
-    const TArray<FVector>& SpawnLocations,
-    const TArray<FRotator>& SpawnRotations,
-    TSharedPtr<TArray<AActor*>> SharedResults,
-    int32 CurrentBatch,
-    int32 BatchSize,
-    float BatchDelay)
-{
-    UJUSYNCSubsystem* Subsystem = GetJUSYNCSubsystem();
-    if (!Subsystem)
-    {
-        UE_LOG(LogTemp, Error, TEXT("No subsystem for async spawn"));
-        return;
-    }
-
-    UWorld* World = Subsystem->GetWorld();
-    if (!World)
-    {
-        UE_LOG(LogTemp, Error, TEXT("No world for async spawn"));
-        return;
-    }
-
-    // Calculate batch range
-    int32 StartIndex = CurrentBatch * BatchSize;
-    int32 EndIndex = FMath::Min(StartIndex + BatchSize, MeshDataArray.Num());
-    
-    UE_LOG(LogTemp, Warning, TEXT("📦 Processing async batch %d: indices %d-%d with rotations"),
-           CurrentBatch, StartIndex, EndIndex - 1);
-
-    // Process current batch with rotations
-    for (int32 i = StartIndex; i < EndIndex; ++i)
-    {
-        FRotator UERotation = ConvertParaViewToUERotation(SpawnRotations[i]);
-        AActor* SpawnedActor = SpawnRealtimeMeshAtLocation(
-            MeshDataArray[i], SpawnLocations[i], UERotation);
-        
-        SharedResults->Add(SpawnedActor);
-        
-        if (SpawnedActor)
-        {
-            UE_LOG(LogTemp, Log, TEXT("✅ Async spawned mesh %d at %s with rotation %s"),
-                   i, *SpawnLocations[i].ToString(), *UERotation.ToString());
-        }
-    }
-
-    // Check if we're done
-    if (EndIndex >= MeshDataArray.Num())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("🎉 Async batch spawn complete: %d/%d successful"),
-               SharedResults->Num(), MeshDataArray.Num());
-        return;
-    }
-
-    // Schedule next batch
-    FTimerHandle TimerHandle;
-    World->GetTimerManager().SetTimer(TimerHandle,
-        FTimerDelegate::CreateLambda([=]()
-        {
-            AsyncBatchSpawnInternal(MeshDataArray, SpawnLocations, SpawnRotations, SharedResults,
-                                  CurrentBatch + 1, BatchSize, BatchDelay);
-        }),
-        BatchDelay, false);
-}
-
 // Add this function after your existing helper functions
 FString UJUSYNCBlueprintLibrary::DetectUSDContentType(const TArray<uint8>& Buffer)
 {
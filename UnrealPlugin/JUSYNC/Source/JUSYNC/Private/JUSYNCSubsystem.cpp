@@ -11,6 +11,17 @@
 #include "Engine/GameInstance.h"
 #include "Kismet/GameplayStatics.h"
 #include "RealtimeMeshSimple.h" 
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "MeshDescription.h"
+#include "MeshDescriptionBuilder.h"
+#include "StaticMeshAttributes.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Queue.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/Package.h"
 
 // Include the C-wrapper header
 #ifdef WITH_ANARI_USD_MIDDLEWARE
@@ -19,6 +30,10 @@ extern "C" {
 }
 #endif
 
+// Plugin-side work shows up in Unreal Insights when tracing with -trace=cpu,JUSYNC; the
+// middleware's own stages are exported separately through WriteStageTrace
+UE_TRACE_CHANNEL_DEFINE(JUSYNCChannel)
+
 // Global callback handlers for C interface
 static UJUSYNCSubsystem* g_SubsystemInstance = nullptr;
 
@@ -49,17 +64,25 @@ extern "C" void FileReceivedCallback_Static(const CFileData* file_data)
     
     UE_LOG(LogTemp, Log, TEXT("Creating async task for file processing..."));
     
-    // Create a copy of the data for the lambda
-    CFileData LocalData = *file_data;
-
-    if (file_data->data && file_data->data_size > 0) {
-        LocalData.data = new unsigned char[file_data->data_size];
-        std::memcpy(LocalData.data, file_data->data, file_data->data_size);
+    // Keep the middleware's buffer alive for the game thread instead of copying it
+    CFileData* Retained = RetainFileData_C(file_data);
+    if (!Retained)
+    {
+        UE_LOG(LogTemp, Error, TEXT("FileReceivedCallback_Static: failed to retain file data"));
+        return;
     }
 
-    
-    AsyncTask(ENamedThreads::GameThread, [LocalData]()
+    FJUSYNCFileData UEFileData;
+    UEFileData.Filename = FString(UTF8_TO_TCHAR(Retained->filename));
+    UEFileData.Hash = FString(UTF8_TO_TCHAR(Retained->hash));
+    UEFileData.FileType = FString(UTF8_TO_TCHAR(Retained->file_type));
+    UEFileData.Payload = MakeShared<FJUSYNCFilePayload, ESPMode::ThreadSafe>(
+        Retained->data, static_cast<int64>(Retained->data_size),
+        [Retained]() { ReleaseFileData_C(Retained); });
+
+    AsyncTask(ENamedThreads::GameThread, [UEFileData = MoveTemp(UEFileData)]()
     {
+        TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_FileReceived, JUSYNCChannel);
         UE_LOG(LogTemp, Warning, TEXT("=== ASYNC TASK EXECUTING ON GAME THREAD ==="));
         
         if (!g_SubsystemInstance)
@@ -68,19 +91,10 @@ extern "C" void FileReceivedCallback_Static(const CFileData* file_data)
             return;
         }
         
-        UE_LOG(LogTemp, Log, TEXT("Converting C data to UE format..."));
-        
-        FJUSYNCFileData UEFileData;
-        UEFileData.Filename = FString(UTF8_TO_TCHAR(LocalData.filename));
-        UEFileData.Hash = FString(UTF8_TO_TCHAR(LocalData.hash));
-        UEFileData.FileType = FString(UTF8_TO_TCHAR(LocalData.file_type));
-        UEFileData.Data.SetNum(LocalData.data_size);
-        FMemory::Memcpy(UEFileData.Data.GetData(), LocalData.data, LocalData.data_size);
-        
         UE_LOG(LogTemp, Warning, TEXT("Broadcasting to Blueprint events..."));
         UE_LOG(LogTemp, Warning, TEXT("  - UE Filename: %s"), *UEFileData.Filename);
         UE_LOG(LogTemp, Warning, TEXT("  - UE File Type: %s"), *UEFileData.FileType);
-        UE_LOG(LogTemp, Warning, TEXT("  - UE Data Size: %d"), UEFileData.Data.Num());
+        UE_LOG(LogTemp, Warning, TEXT("  - UE Data Size: %lld"), UEFileData.GetNumBytes());
         
         // Send to Blueprint Library FIRST
         g_SubsystemInstance->HandleFileReceivedForLibrary(UEFileData);
@@ -89,11 +103,6 @@ extern "C" void FileReceivedCallback_Static(const CFileData* file_data)
         g_SubsystemInstance->OnFileReceived.Broadcast(UEFileData);
         
         UE_LOG(LogTemp, Warning, TEXT("=== FILE PROCESSING COMPLETE ==="));
-
-        if (LocalData.data) {
-            delete[] LocalData.data;
-        }
-
     });
 }
 
@@ -129,6 +138,22 @@ extern "C" void MessageReceivedCallback_Static(const char* message)
     });
 }
 
+// Column-major column-vector matrices read straight into UE's row-vector FMatrix;
+// mirroring Y like the vertices negates every element with exactly one Y index
+static FTransform ConvertUsdMatrixToUE_Helper(const float* M)
+{
+    FMatrix Matrix;
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Col = 0; Col < 4; ++Col)
+        {
+            const bool bFlipY = (Row == 1) != (Col == 1);
+            Matrix.M[Row][Col] = bFlipY ? -M[Row * 4 + Col] : M[Row * 4 + Col];
+        }
+    }
+    return FTransform(Matrix);
+}
+
 // Helper function to convert C mesh data to UE format
 // Enhanced ConvertCMeshDataToUE_Helper with FORCED vertex interpolation while preserving all functionality
 static FJUSYNCMeshData ConvertCMeshDataToUE_Helper(const CMeshData& CMesh, bool bForceVertexInterpolation = true)
@@ -140,38 +165,34 @@ static FJUSYNCMeshData ConvertCMeshDataToUE_Helper(const CMeshData& CMesh, bool
     UEMesh.TypeName = FString(UTF8_TO_TCHAR(CMesh.type_name));
 
     // 2. Convert points (PRESERVED - flat array → FVector array)
+    // Arrays are sized once and written in place, since this runs for every received mesh
     size_t PointCount = CMesh.points_count / 3;
-    UEMesh.Vertices.Reserve(PointCount);
+    UEMesh.Vertices.SetNumUninitialized(static_cast<int32>(PointCount));
     for (size_t i = 0; i < PointCount; ++i)
     {
-        size_t idx = i * 3;
-        float x = CMesh.points[idx + 0];
-        float y = CMesh.points[idx + 1];
-        float z = CMesh.points[idx + 2];
+        const float* P = CMesh.points + i * 3;
         // Transform from right-handed Z-up (ParaView) to left-handed Z-up (UE)
-        UEMesh.Vertices.Add(FVector(x, -y, z));
+        UEMesh.Vertices[i] = FVector(P[0], -P[1], P[2]);
     }
 
     // 3. Convert triangle indices (PRESERVED)
+    static_assert(sizeof(int32) == sizeof(CMesh.indices[0]), "indices are copied as int32");
     size_t IndexCount = CMesh.indices_count;
-    UEMesh.Triangles.Reserve(IndexCount);
-    for (size_t i = 0; i < IndexCount; ++i)
+    UEMesh.Triangles.SetNumUninitialized(static_cast<int32>(IndexCount));
+    if (IndexCount > 0)
     {
-        UEMesh.Triangles.Add(static_cast<int32>(CMesh.indices[i]));
+        FMemory::Memcpy(UEMesh.Triangles.GetData(), CMesh.indices, IndexCount * sizeof(int32));
     }
 
     // 4. Convert normals if present (PRESERVED)
     if (CMesh.normals && CMesh.normals_count >= 3)
     {
         size_t NormalCount = CMesh.normals_count / 3;
-        UEMesh.Normals.Reserve(NormalCount);
+        UEMesh.Normals.SetNumUninitialized(static_cast<int32>(NormalCount));
         for (size_t i = 0; i < NormalCount; ++i)
         {
-            size_t idx = i * 3;
-            float nx = CMesh.normals[idx + 0];
-            float ny = CMesh.normals[idx + 1];
-            float nz = CMesh.normals[idx + 2];
-            UEMesh.Normals.Add(FVector(nx, -ny, nz).GetSafeNormal());
+            const float* N = CMesh.normals + i * 3;
+            UEMesh.Normals[i] = FVector(N[0], -N[1], N[2]).GetSafeNormal();
         }
     }
 
@@ -179,11 +200,10 @@ static FJUSYNCMeshData ConvertCMeshDataToUE_Helper(const CMeshData& CMesh, bool
     if (CMesh.uvs && CMesh.uvs_count >= 2)
     {
         size_t UVCount = CMesh.uvs_count / 2;
-        UEMesh.UVs.Reserve(UVCount);
+        UEMesh.UVs.SetNumUninitialized(static_cast<int32>(UVCount));
         for (size_t i = 0; i < UVCount; ++i)
         {
-            size_t idx = i * 2;
-            UEMesh.UVs.Add(FVector2D(CMesh.uvs[idx], CMesh.uvs[idx + 1]));
+            UEMesh.UVs[i] = FVector2D(CMesh.uvs[i * 2], CMesh.uvs[i * 2 + 1]);
         }
     }
 
@@ -197,9 +217,9 @@ static FJUSYNCMeshData ConvertCMeshDataToUE_Helper(const CMeshData& CMesh, bool
         bool bDetectedVertexInterp = (ColorCount == VertexCount);
         bool bDetectedUniformInterp = (ColorCount == FaceCount);
         
-        UE_LOG(LogTemp, Warning, TEXT("🎨 Color conversion: %d colors, %d vertices, %d faces"),
+        UE_LOG(LogTemp, Verbose, TEXT("🎨 Color conversion: %d colors, %d vertices, %d faces"),
                ColorCount, VertexCount, FaceCount);
-        UE_LOG(LogTemp, Warning, TEXT("🎨 Detected: %s | Force Vertex: %s"),
+        UE_LOG(LogTemp, Verbose, TEXT("🎨 Detected: %s | Force Vertex: %s"),
                bDetectedVertexInterp ? TEXT("VERTEX") : (bDetectedUniformInterp ? TEXT("UNIFORM") : TEXT("UNKNOWN")),
                bForceVertexInterpolation ? TEXT("YES") : TEXT("NO"));
 
@@ -208,21 +228,17 @@ static FJUSYNCMeshData ConvertCMeshDataToUE_Helper(const CMeshData& CMesh, bool
         if (bDetectedVertexInterp)
         {
             // ✅ CASE 1: Already vertex interpolation - direct mapping (PRESERVED)
-            UE_LOG(LogTemp, Warning, TEXT("🎨 Using direct VERTEX interpolation"));
-            for (int32 i = 0; i < VertexCount; ++i)
-            {
-                int64 idx = int64(i) * 4;
-                uint8 r = uint8(FMath::Clamp(CMesh.vertex_colors[idx + 0] * 255.0f, 0.0f, 255.0f));
-                uint8 g = uint8(FMath::Clamp(CMesh.vertex_colors[idx + 1] * 255.0f, 0.0f, 255.0f));
-                uint8 b = uint8(FMath::Clamp(CMesh.vertex_colors[idx + 2] * 255.0f, 0.0f, 255.0f));
-                uint8 a = uint8(FMath::Clamp(CMesh.vertex_colors[idx + 3] * 255.0f, 0.0f, 255.0f));
-                UEMesh.VertexColors.Add(FColor(r, g, b, a));
-            }
+            UE_LOG(LogTemp, Verbose, TEXT("🎨 Using direct VERTEX interpolation"));
+            // FColor is stored B, G, R, A, so the middleware can pack straight into the array
+            static_assert(sizeof(FColor) == 4, "FColor must be 4 packed bytes");
+            UEMesh.VertexColors.SetNumUninitialized(VertexCount);
+            PackVertexColors_C(CMesh.vertex_colors, static_cast<size_t>(VertexCount),
+                               reinterpret_cast<unsigned char*>(UEMesh.VertexColors.GetData()), 1);
         }
         else if (bDetectedUniformInterp && bForceVertexInterpolation)
         {
             // ✅ CASE 2: Uniform detected + Force Vertex = Convert uniform to smooth vertex interpolation
-            UE_LOG(LogTemp, Warning, TEXT("🎨 CONVERTING uniform to smooth VERTEX interpolation"));
+            UE_LOG(LogTemp, Verbose, TEXT("🎨 CONVERTING uniform to smooth VERTEX interpolation"));
             
             // Initialize vertex color accumulation arrays
             TArray<FLinearColor> AccumulatedColors;
@@ -284,13 +300,13 @@ static FJUSYNCMeshData ConvertCMeshDataToUE_Helper(const CMeshData& CMesh, bool
                 UEMesh.VertexColors.Add(FColor(r, g, b, a));
             }
             
-            UE_LOG(LogTemp, Warning, TEXT("✅ Converted uniform to smooth vertex interpolation: %d vertex colors"), 
+            UE_LOG(LogTemp, Verbose, TEXT("✅ Converted uniform to smooth vertex interpolation: %d vertex colors"), 
                    UEMesh.VertexColors.Num());
         }
         else if (bDetectedUniformInterp && !bForceVertexInterpolation)
         {
             // ✅ CASE 3: Keep original uniform behavior (PRESERVED for backwards compatibility)
-            UE_LOG(LogTemp, Warning, TEXT("🎨 Using original UNIFORM interpolation (flat shading)"));
+            UE_LOG(LogTemp, Verbose, TEXT("🎨 Using original UNIFORM interpolation (flat shading)"));
             UEMesh.VertexColors.Reserve(FaceCount * 3);
             
             for (int32 f = 0; f < FaceCount; ++f)
@@ -312,56 +328,251 @@ static FJUSYNCMeshData ConvertCMeshDataToUE_Helper(const CMeshData& CMesh, bool
         else
         {
             // ✅ CASE 4: Fallback behavior (PRESERVED)
-            UE_LOG(LogTemp, Warning, TEXT("🎨 Using fallback vertex interpolation"));
-            for (int32 i = 0; i < VertexCount; ++i)
+            UE_LOG(LogTemp, Verbose, TEXT("🎨 Using fallback vertex interpolation"));
+            int32 PackedCount = FMath::Min(VertexCount, ColorCount);
+            UEMesh.VertexColors.SetNumUninitialized(PackedCount);
+            PackVertexColors_C(CMesh.vertex_colors, static_cast<size_t>(PackedCount),
+                               reinterpret_cast<unsigned char*>(UEMesh.VertexColors.GetData()), 1);
+            for (int32 i = PackedCount; i < VertexCount; ++i)
             {
-                if (i < ColorCount)
-                {
-                    int64 idx = int64(i) * 4;
-                    uint8 r = uint8(FMath::Clamp(CMesh.vertex_colors[idx + 0] * 255.0f, 0.0f, 255.0f));
-                    uint8 g = uint8(FMath::Clamp(CMesh.vertex_colors[idx + 1] * 255.0f, 0.0f, 255.0f));
-                    uint8 b = uint8(FMath::Clamp(CMesh.vertex_colors[idx + 2] * 255.0f, 0.0f, 255.0f));
-                    uint8 a = uint8(FMath::Clamp(CMesh.vertex_colors[idx + 3] * 255.0f, 0.0f, 255.0f));
-                    UEMesh.VertexColors.Add(FColor(r, g, b, a));
-                }
-                else
-                {
-                    UEMesh.VertexColors.Add(FColor::White);
-                }
+                UEMesh.VertexColors.Add(FColor::White);
             }
         }
 
         // ✅ PRESERVED: Debug logging for color verification
-        UE_LOG(LogTemp, Warning, TEXT("🎨 Final vertex colors: %d"), UEMesh.VertexColors.Num());
+        UE_LOG(LogTemp, Verbose, TEXT("🎨 Final vertex colors: %d"), UEMesh.VertexColors.Num());
         
-        // ✅ PRESERVED: DEBUG dump first 20 different colours
-        TSet<FColor> Unique;
-        for (int32 i = 0; i < UEMesh.VertexColors.Num(); ++i)
+        // ✅ PRESERVED: DEBUG dump first 20 different colours (scans every vertex, so VeryVerbose only)
+#if !NO_LOGGING
+        if (UE_LOG_ACTIVE(LogTemp, VeryVerbose))
         {
-            const FColor& C = UEMesh.VertexColors[i];
-            if (!Unique.Contains(C))
+            TSet<FColor> Unique;
+            for (int32 i = 0; i < UEMesh.VertexColors.Num(); ++i)
             {
-                Unique.Add(C);
-                UE_LOG(LogTemp, Warning, TEXT("USD Color[%d] = (R=%d G=%d B=%d A=%d)"),
-                       i, C.R, C.G, C.B, C.A);
-                if (Unique.Num() == 20) break;
+                const FColor& C = UEMesh.VertexColors[i];
+                if (!Unique.Contains(C))
+                {
+                    Unique.Add(C);
+                    UE_LOG(LogTemp, VeryVerbose, TEXT("USD Color[%d] = (R=%d G=%d B=%d A=%d)"),
+                           i, C.R, C.G, C.B, C.A);
+                    if (Unique.Num() == 20) break;
+                }
             }
+            UE_LOG(LogTemp, VeryVerbose, TEXT("Total unique colours in first scan: %d"), Unique.Num());
+        }
+#endif
+    }
+
+    // 7. Placements (instancing or local-space mode only)
+    if (CMesh.instance_transforms && CMesh.instance_transforms_count >= 16)
+    {
+        size_t InstanceCount = CMesh.instance_transforms_count / 16;
+        UEMesh.InstanceTransforms.Reserve(InstanceCount);
+        for (size_t i = 0; i < InstanceCount; ++i)
+        {
+            UEMesh.InstanceTransforms.Add(ConvertUsdMatrixToUE_Helper(CMesh.instance_transforms + i * 16));
         }
-        UE_LOG(LogTemp, Warning, TEXT("Total unique colours in first scan: %d"), Unique.Num());
     }
 
     return UEMesh;
 }
 
+// Scene deltas borrow their meshes, so everything is converted here before hopping threads
+extern "C" void SceneDeltaCallback_Static(const CSceneDelta* delta)
+{
+    if (!delta || !g_SubsystemInstance)
+    {
+        return;
+    }
+
+    FJUSYNCSceneDelta UEDelta;
+    UEDelta.Filename = FString(UTF8_TO_TCHAR(delta->filename));
+    UEDelta.Revision = static_cast<int64>(delta->revision);
+    UEDelta.UnchangedCount = static_cast<int32>(delta->unchanged_count);
+
+    auto ConvertChanges = [](const CMeshChange* Changes, size_t Count, TArray<FJUSYNCMeshChange>& Out)
+    {
+        Out.Reserve(static_cast<int32>(Count));
+        for (size_t i = 0; i < Count; ++i)
+        {
+            FJUSYNCMeshChange& Change = Out.AddDefaulted_GetRef();
+            Change.Key = FString(UTF8_TO_TCHAR(Changes[i].key));
+            Change.Mesh = ConvertCMeshDataToUE_Helper(Changes[i].mesh);
+            Change.bGeometryChanged = Changes[i].geometry_changed != 0;
+        }
+    };
+    ConvertChanges(delta->added, delta->added_count, UEDelta.Added);
+    ConvertChanges(delta->changed, delta->changed_count, UEDelta.Changed);
+    for (size_t i = 0; i < delta->removed_count; ++i)
+    {
+        UEDelta.Removed.Add(FString(UTF8_TO_TCHAR(delta->removed[i])));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC scene delta %s r%lld: %d added, %d changed, %d removed"),
+           *UEDelta.Filename, UEDelta.Revision, UEDelta.Added.Num(), UEDelta.Changed.Num(), UEDelta.Removed.Num());
+
+    AsyncTask(ENamedThreads::GameThread, [UEDelta = MoveTemp(UEDelta)]()
+    {
+        if (!g_SubsystemInstance)
+        {
+            return;
+        }
+
+        if (g_SubsystemInstance->bAutoApplySceneDeltas)
+        {
+            g_SubsystemInstance->ApplySceneDelta(UEDelta);
+        }
+        g_SubsystemInstance->OnSceneDelta.Broadcast(UEDelta);
+    });
+}
+
+// LOD levels borrow their mesh as well; refinements arrive from the middleware's LOD thread
+extern "C" void MeshLodCallback_Static(const CMeshLod* lod)
+{
+    if (!lod || !g_SubsystemInstance)
+    {
+        return;
+    }
+
+    FJUSYNCMeshLod UELod;
+    UELod.Filename = FString(UTF8_TO_TCHAR(lod->filename));
+    UELod.Key = FString(UTF8_TO_TCHAR(lod->key));
+    UELod.Level = static_cast<int32>(lod->level);
+    UELod.LevelCount = static_cast<int32>(lod->level_count);
+    UELod.Mesh = ConvertCMeshDataToUE_Helper(lod->mesh);
+
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC mesh LOD %s|%s level %d/%d: %d triangles"),
+           *UELod.Filename, *UELod.Key, UELod.Level, UELod.LevelCount, UELod.Mesh.GetTriangleCount());
+
+    AsyncTask(ENamedThreads::GameThread, [UELod = MoveTemp(UELod)]()
+    {
+        if (!g_SubsystemInstance)
+        {
+            return;
+        }
+
+        if (g_SubsystemInstance->bAutoApplyMeshLods)
+        {
+            g_SubsystemInstance->ApplyMeshLod(UELod);
+        }
+        g_SubsystemInstance->OnMeshLod.Broadcast(UELod);
+    });
+}
+
+// Callbacks of one asynchronous load, owned by the middleware until the load ends
+struct FJUSYNCAsyncLoadContext
+{
+    UJUSYNCSubsystem::FUSDLoadProgress OnProgress;
+    UJUSYNCSubsystem::FUSDLoadComplete OnComplete;
+};
+
+// Progress arrives from the middleware's load threads in whole percent steps
+extern "C" void AsyncLoadProgress_Static(uint64_t load_id, float progress, const char* stage, void* user_data)
+{
+    FJUSYNCAsyncLoadContext* Context = static_cast<FJUSYNCAsyncLoadContext*>(user_data);
+    if (!Context || !Context->OnProgress)
+    {
+        return;
+    }
+
+    AsyncTask(ENamedThreads::GameThread, [OnProgress = Context->OnProgress, progress]()
+    {
+        OnProgress(progress);
+    });
+}
+
+// The finished meshes are borrowed, so they are converted on the load thread, not the game thread
+extern "C" void AsyncLoadComplete_Static(uint64_t load_id, CLoadState state, const CMeshData* meshes, size_t count,
+                                         void* user_data)
+{
+    TUniquePtr<FJUSYNCAsyncLoadContext> Context(static_cast<FJUSYNCAsyncLoadContext*>(user_data));
+    if (!Context)
+    {
+        return;
+    }
+
+    TArray<FJUSYNCMeshData> UEMeshes;
+    if (state == LOAD_STATE_COMPLETED && meshes)
+    {
+        UEMeshes.Reserve(static_cast<int32>(count));
+        for (size_t i = 0; i < count; ++i)
+        {
+            UEMeshes.Add(ConvertCMeshDataToUE_Helper(meshes[i]));
+        }
+    }
+    const bool bSuccess = UEMeshes.Num() > 0;
+
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC async load %llu finished: state %d, %d meshes"),
+           static_cast<unsigned long long>(load_id), static_cast<int32>(state), UEMeshes.Num());
+
+    if (!Context->OnComplete)
+    {
+        return;
+    }
+    AsyncTask(ENamedThreads::GameThread, [OnComplete = MoveTemp(Context->OnComplete), bSuccess,
+                                          UEMeshes = MoveTemp(UEMeshes)]() mutable
+    {
+        OnComplete(bSuccess, MoveTemp(UEMeshes));
+    });
+}
+
+// Shared by the buffer and disk variants; Submit queues the load with the given options
+static int64 StartAsyncLoad(UJUSYNCSubsystem::FUSDLoadProgress OnProgress, UJUSYNCSubsystem::FUSDLoadComplete OnComplete,
+                            TFunctionRef<uint64_t(const CAsyncLoadOptions&)> Submit)
+{
+    FJUSYNCAsyncLoadContext* Context = new FJUSYNCAsyncLoadContext{MoveTemp(OnProgress), MoveTemp(OnComplete)};
+
+    // A newer load of the same file makes this one pointless, so it is cancelled
+    CAsyncLoadOptions Options = {};
+    Options.on_complete = &AsyncLoadComplete_Static;
+    Options.on_progress = &AsyncLoadProgress_Static;
+    Options.user_data = Context;
+    Options.cancel_previous = 1;
+
+    const uint64_t LoadId = Submit(Options);
+    if (LoadId == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to queue asynchronous USD load"));
+        delete Context;
+        return 0;
+    }
+    return static_cast<int64>(LoadId);
+}
 
 #endif
 
+// One mesh queued by QueueRealtimeMeshes; Streams is filled on a worker thread, the rest is set on queueing
+struct FJUSYNCMeshBuild
+{
+    TWeakObjectPtr<URealtimeMeshComponent> Component;
+    FString ElementName;
+    RealtimeMesh::FRealtimeMeshStreamSet Streams;
+    double QueuedSeconds = 0.0;
+    uint32 Generation = 0;
+};
+
+// Shared with the conversion tasks, so they never touch the subsystem itself
+struct FJUSYNCMeshBuildQueue
+{
+    // Built meshes in completion order; produced by worker threads, consumed by the commit ticker
+    TQueue<TUniquePtr<FJUSYNCMeshBuild>, EQueueMode::Mpsc> Ready;
+    std::atomic<int32> ReadyCount{ 0 };
+    std::atomic<int32> Converting{ 0 };
+
+    // Bumped by CancelQueuedRealtimeMeshes; builds of an older generation are dropped
+    std::atomic<uint32> Generation{ 0 };
+};
+
 void UJUSYNCSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     
     // Set global instance for callbacks
     g_SubsystemInstance = this;
+
+    MeshBuildQueue = MakeShared<FJUSYNCMeshBuildQueue, ESPMode::ThreadSafe>();
+    MeshCommitTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UJUSYNCSubsystem::TickMeshCommits));
     
     UE_LOG(LogTemp, Warning, TEXT("=== JUSYNC SUBSYSTEM INITIALIZED ==="));
     UE_LOG(LogTemp, Warning, TEXT("Global instance set: %p"), g_SubsystemInstance);
@@ -373,6 +584,10 @@ void UJUSYNCSubsystem::Deinitialize()
     UE_LOG(LogTemp, Warning, TEXT("=== JUSYNC SUBSYSTEM DEINITIALIZING ==="));
     
     ShutdownMiddleware();
+
+    FTSTicker::GetCoreTicker().RemoveTicker(MeshCommitTickHandle);
+    CancelQueuedRealtimeMeshes();
+    MeshBuildQueue.Reset();
     
     // Clear global instance
     g_SubsystemInstance = nullptr;
@@ -413,6 +628,8 @@ bool UJUSYNCSubsystem::InitializeMiddleware(const FString& Endpoint)
     UE_LOG(LogTemp, Warning, TEXT("Registering ZMQ callbacks..."));
     RegisterUpdateCallback_C(FileReceivedCallback_Static);
     RegisterMessageCallback_C(MessageReceivedCallback_Static);
+    RegisterSceneDeltaCallback_C(bEnableSceneDeltas ? SceneDeltaCallback_Static : nullptr);
+    RegisterMeshLodCallback_C(bEnableProgressiveLods ? MeshLodCallback_Static : nullptr);
     UE_LOG(LogTemp, Warning, TEXT("✅ Callbacks registered"));
     
     // Initialize middleware using C interface
@@ -435,6 +652,9 @@ bool UJUSYNCSubsystem::InitializeMiddleware(const FString& Endpoint)
         // Get status info
         const char* StatusInfo = GetStatusInfo_C();
         UE_LOG(LogTemp, Warning, TEXT("Middleware status: %s"), UTF8_TO_TCHAR(StatusInfo));
+
+        SetLodOptions_C(static_cast<unsigned int>(FMath::Clamp(LodLevelCount, 1, 8)),
+                        static_cast<size_t>(FMath::Max(LodMinTriangles, 0)));
         
         UE_LOG(LogTemp, Log, TEXT("JUSYNC Middleware initialized successfully on %s"), *Endpoint);
     }
@@ -500,6 +720,64 @@ FString UJUSYNCSubsystem::GetStatusInfo() const
 #endif
 }
 
+TArray<FJUSYNCStageStats> UJUSYNCSubsystem::GetStageStats() const
+{
+    TArray<FJUSYNCStageStats> Result;
+
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    TArray<CStageStats> CStages;
+    CStages.SetNumZeroed(static_cast<int32>(GetStageStats_C(nullptr, 0)));
+    const size_t Count = FMath::Min(GetStageStats_C(CStages.GetData(), CStages.Num()), static_cast<size_t>(CStages.Num()));
+
+    Result.Reserve(static_cast<int32>(Count));
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const CStageStats& CStage = CStages[i];
+        FJUSYNCStageStats& Stage = Result.AddDefaulted_GetRef();
+        Stage.Stage = FString(UTF8_TO_TCHAR(CStage.name));
+        Stage.Count = static_cast<int64>(CStage.count);
+        Stage.MeanMs = CStage.count > 0 ? static_cast<float>(CStage.total_ns / 1e6 / CStage.count) : 0.0f;
+        Stage.P50Ms = static_cast<float>(CStage.p50_ns / 1e6);
+        Stage.P95Ms = static_cast<float>(CStage.p95_ns / 1e6);
+        Stage.P99Ms = static_cast<float>(CStage.p99_ns / 1e6);
+        Stage.MaxMs = static_cast<float>(CStage.max_ns / 1e6);
+    }
+#endif
+    return Result;
+}
+
+void UJUSYNCSubsystem::ResetStageStats()
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    ResetStageStats_C();
+#endif
+}
+
+void UJUSYNCSubsystem::SetStageTraceCapture(bool bEnable, int32 MaxEvents)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    if (MaxEvents <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid stage trace size: %d events"), MaxEvents);
+        return;
+    }
+
+    SetTraceCapture_C(bEnable ? 1 : 0, static_cast<size_t>(MaxEvents));
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC stage trace capture %s"), bEnable ? TEXT("enabled") : TEXT("disabled"));
+#endif
+}
+
+bool UJUSYNCSubsystem::WriteStageTrace(const FString& FilePath)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    const bool bWritten = WriteTrace_C(TCHAR_TO_UTF8(*FilePath)) != 0;
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC stage trace %s: %s"), bWritten ? TEXT("written") : TEXT("failed"), *FilePath);
+    return bWritten;
+#else
+    return false;
+#endif
+}
+
 bool UJUSYNCSubsystem::StartReceiving()
 {
     FScopeLock Lock(&MiddlewareMutex);
@@ -556,96 +834,440 @@ void UJUSYNCSubsystem::StopReceiving()
 #endif
 }
 
-void UJUSYNCSubsystem::HandleFileReceivedForLibrary(const FJUSYNCFileData& FileData)
+void UJUSYNCSubsystem::SetInstancingEnabled(bool bEnable)
 {
-    UE_LOG(LogTemp, Warning, TEXT("=== ADDING FILE TO BLUEPRINT LIBRARY ==="));
-    UE_LOG(LogTemp, Warning, TEXT("File: %s (%d bytes, %s)"), 
-           *FileData.Filename, FileData.Data.Num(), *FileData.FileType);
-    
-    FScopeLock Lock(&UJUSYNCBlueprintLibrary::DataMutex);
-    
-    int32 PreviousCount = UJUSYNCBlueprintLibrary::ReceivedFiles.Num();
-    UJUSYNCBlueprintLibrary::ReceivedFiles.Add(FileData);
-    int32 NewCount = UJUSYNCBlueprintLibrary::ReceivedFiles.Num();
-    
-    UE_LOG(LogTemp, Warning, TEXT("Blueprint Library file count: %d -> %d"), PreviousCount, NewCount);
-    UE_LOG(LogTemp, Warning, TEXT("✅ File added to Blueprint Library: %s"), *FileData.Filename);
-}
+    FScopeLock Lock(&MiddlewareMutex);
 
-void UJUSYNCSubsystem::HandleMessageReceivedForLibrary(const FString& Message)
-{
-    UE_LOG(LogTemp, Warning, TEXT("=== ADDING MESSAGE TO BLUEPRINT LIBRARY ==="));
-    UE_LOG(LogTemp, Warning, TEXT("Message: %s"), *Message);
-    
-    FScopeLock Lock(&UJUSYNCBlueprintLibrary::DataMutex);
-    
-    int32 PreviousCount = UJUSYNCBlueprintLibrary::ReceivedMessages.Num();
-    UJUSYNCBlueprintLibrary::ReceivedMessages.Add(Message);
-    int32 NewCount = UJUSYNCBlueprintLibrary::ReceivedMessages.Num();
-    
-    UE_LOG(LogTemp, Warning, TEXT("Blueprint Library message count: %d -> %d"), PreviousCount, NewCount);
-    UE_LOG(LogTemp, Log, TEXT("Message received for Blueprint Library: %s"), *Message);
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    SetInstancingEnabled_C(bEnable ? 1 : 0);
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC instancing output %s"), bEnable ? TEXT("enabled") : TEXT("disabled"));
+#endif
 }
 
-bool UJUSYNCSubsystem::LoadUSDFromBuffer(const TArray<uint8>& Buffer, const FString& Filename, TArray<FJUSYNCMeshData>& OutMeshData)
+bool UJUSYNCSubsystem::ConfigureMeshDiskCache(const FString& Directory, int64 MaxBytes)
 {
+    FScopeLock Lock(&MiddlewareMutex);
+
 #ifdef WITH_ANARI_USD_MIDDLEWARE
-    if (!bIsInitialized.load())
+    if (MaxBytes <= 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("JUSYNC Middleware not initialized"));
+        UE_LOG(LogTemp, Error, TEXT("Invalid mesh disk cache budget: %lld bytes"), MaxBytes);
         return false;
     }
-    
-    // Convert FString to C string
-    FTCHARToUTF8 FilenameConverter(*Filename);
-    const char* FilenameCStr = FilenameConverter.Get();
-    
-    CMeshData* CMeshes = nullptr;
-    size_t MeshCount = 0;
-    
-    // Call C interface
-    int Result = LoadUSDBuffer_C(Buffer.GetData(), Buffer.Num(), FilenameCStr, &CMeshes, &MeshCount);
-    
-    if (Result == 1 && CMeshes && MeshCount > 0)
-    {
-        OutMeshData.Empty();
-        OutMeshData.Reserve(MeshCount);
-        
-        // Convert C mesh data to UE format
-        for (size_t i = 0; i < MeshCount; ++i)
-        {
-            FJUSYNCMeshData UEMeshData = ConvertCMeshDataToUE_Helper(CMeshes[i]);
-            OutMeshData.Add(UEMeshData);
-        }
-        
-        // Free C memory
-        FreeMeshData_C(CMeshes, MeshCount);
-        
-        UE_LOG(LogTemp, Log, TEXT("Successfully loaded %d meshes from USD buffer"), OutMeshData.Num());
-        return true;
-    }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("Failed to load USD from buffer"));
-        if (CMeshes)
-        {
-            FreeMeshData_C(CMeshes, MeshCount);
-        }
-    }
-#endif
+
+    const bool bConfigured = ConfigureMeshDiskCache_C(TCHAR_TO_UTF8(*Directory), static_cast<uint64_t>(MaxBytes)) != 0;
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC mesh disk cache %s: %s"), bConfigured ? TEXT("configured") : TEXT("failed"),
+           Directory.IsEmpty() ? TEXT("(disabled)") : *Directory);
+    return bConfigured;
+#else
     return false;
+#endif
 }
 
-bool UJUSYNCSubsystem::LoadUSDFromDisk(const FString& FilePath, TArray<FJUSYNCMeshData>& OutMeshData)
+void UJUSYNCSubsystem::ClearMeshDiskCache()
 {
+    FScopeLock Lock(&MiddlewareMutex);
+
 #ifdef WITH_ANARI_USD_MIDDLEWARE
-    if (!bIsInitialized.load())
+    ClearMeshDiskCache_C();
+#endif
+}
+
+void UJUSYNCSubsystem::SetLocalSpaceEnabled(bool bEnable)
+{
+    FScopeLock Lock(&MiddlewareMutex);
+
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    SetLocalSpaceEnabled_C(bEnable ? 1 : 0);
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC local-space output %s"), bEnable ? TEXT("enabled") : TEXT("disabled"));
+#endif
+}
+
+void UJUSYNCSubsystem::SetMeshOptimizationEnabled(bool bEnable, float WeldEpsilon)
+{
+    FScopeLock Lock(&MiddlewareMutex);
+
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    SetWeldEpsilon_C(WeldEpsilon);
+    SetMeshOptimizationEnabled_C(bEnable ? 1 : 0);
+    UE_LOG(LogTemp, Log, TEXT("JUSYNC mesh optimization %s (weld epsilon %g)"),
+           bEnable ? TEXT("enabled") : TEXT("disabled"), WeldEpsilon);
+#endif
+}
+
+static FString MakeSceneMeshKey(const FString& Filename, const FString& Key)
+{
+    return Filename + TEXT("|") + Key;
+}
+
+void UJUSYNCSubsystem::BindSceneMeshComponent(const FString& Filename, const FString& Key, URealtimeMeshComponent* Component)
+{
+    if (!Component)
     {
-        UE_LOG(LogTemp, Error, TEXT("JUSYNC Middleware not initialized"));
-        return false;
+        SceneMeshComponents.Remove(MakeSceneMeshKey(Filename, Key));
+        return;
     }
-    
-    // Convert FString to C string
+    SceneMeshComponents.Add(MakeSceneMeshKey(Filename, Key), Component);
+}
+
+int32 UJUSYNCSubsystem::ApplySceneDelta(const FJUSYNCSceneDelta& Delta)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_ApplySceneDelta, JUSYNCChannel);
+    check(IsInGameThread());
+    int32 Touched = 0;
+
+    // A bound component is rebuilt in place (only its own section); unbound keys get a new actor.
+    // Added keys may already be bound after the middleware history was cleared.
+    // Local-space meshes carry their placement as a single transform, so a move only
+    // updates the component transform and leaves the mesh sections alone.
+    auto Upsert = [this, &Delta, &Touched](const FJUSYNCMeshChange& Change)
+    {
+        const bool bHasPlacement = Change.Mesh.InstanceTransforms.Num() == 1;
+        TWeakObjectPtr<URealtimeMeshComponent>* Bound = SceneMeshComponents.Find(MakeSceneMeshKey(Delta.Filename, Change.Key));
+        if (Bound && Bound->IsValid())
+        {
+            URealtimeMeshComponent* Component = Bound->Get();
+            if (bHasPlacement && !Change.bGeometryChanged)
+            {
+                Component->SetWorldTransform(Change.Mesh.InstanceTransforms[0]);
+                ++Touched;
+                return;
+            }
+            if (CreateRealtimeMeshFromJUSYNC(Change.Mesh, Component))
+            {
+                if (bHasPlacement)
+                {
+                    Component->SetWorldTransform(Change.Mesh.InstanceTransforms[0]);
+                }
+                ++Touched;
+            }
+            return;
+        }
+
+        AActor* Spawned = UJUSYNCBlueprintLibrary::SpawnRealtimeMeshAtLocation(Change.Mesh, FVector::ZeroVector);
+        URealtimeMeshComponent* Component = Spawned ? Cast<URealtimeMeshComponent>(Spawned->GetRootComponent()) : nullptr;
+        if (Component)
+        {
+            if (bHasPlacement)
+            {
+                Component->SetWorldTransform(Change.Mesh.InstanceTransforms[0]);
+            }
+            BindSceneMeshComponent(Delta.Filename, Change.Key, Component);
+            ++Touched;
+        }
+    };
+
+    for (const FJUSYNCMeshChange& Change : Delta.Changed)
+    {
+        Upsert(Change);
+    }
+    for (const FJUSYNCMeshChange& Change : Delta.Added)
+    {
+        Upsert(Change);
+    }
+
+    for (const FString& Key : Delta.Removed)
+    {
+        TWeakObjectPtr<URealtimeMeshComponent> Bound;
+        if (!SceneMeshComponents.RemoveAndCopyValue(MakeSceneMeshKey(Delta.Filename, Key), Bound) || !Bound.IsValid())
+        {
+            continue;
+        }
+
+        URealtimeMeshComponent* Component = Bound.Get();
+        AActor* Owner = Component->GetOwner();
+        if (Owner && Owner->GetRootComponent() == Component)
+        {
+            Owner->Destroy();
+        }
+        else
+        {
+            Component->DestroyComponent();
+        }
+        ++Touched;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Applied scene delta %s r%lld: %d meshes updated"), *Delta.Filename, Delta.Revision, Touched);
+    return Touched;
+}
+
+int32 UJUSYNCSubsystem::ApplySceneTransformsAtTime(const FJUSYNCFileData& FileData, float TimeCode)
+{
+    check(IsInGameThread());
+    int32 Moved = 0;
+
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    if (!bIsInitialized.load() || FileData.GetNumBytes() <= 0)
+    {
+        return 0;
+    }
+
+    FTCHARToUTF8 FilenameConverter(*FileData.Filename);
+    CMeshTransform* Transforms = nullptr;
+    size_t TransformCount = 0;
+    if (!EvaluateTransforms_C(FileData.GetBytes(), static_cast<size_t>(FileData.GetNumBytes()),
+                              FilenameConverter.Get(), TimeCode, &Transforms, &TransformCount))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to evaluate transforms of %s at time %f"), *FileData.Filename, TimeCode);
+        return 0;
+    }
+
+    // Only components bound through scene deltas are moved; no mesh section is touched
+    for (size_t i = 0; i < TransformCount; ++i)
+    {
+        const FString Key = UTF8_TO_TCHAR(Transforms[i].key);
+        TWeakObjectPtr<URealtimeMeshComponent>* Bound = SceneMeshComponents.Find(MakeSceneMeshKey(FileData.Filename, Key));
+        if (Bound && Bound->IsValid())
+        {
+            Bound->Get()->SetWorldTransform(ConvertUsdMatrixToUE_Helper(Transforms[i].matrix));
+            ++Moved;
+        }
+    }
+    FreeMeshTransforms_C(Transforms);
+#endif
+
+    return Moved;
+}
+
+bool UJUSYNCSubsystem::ApplyMeshLod(const FJUSYNCMeshLod& Lod)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_ApplyMeshLod, JUSYNCChannel);
+    check(IsInGameThread());
+    if (!Lod.Mesh.IsValid() || Lod.Level < 0 || Lod.Level >= FMath::Max(Lod.LevelCount, 1))
+    {
+        UE_LOG(LogTemp, Error, TEXT("❌ Invalid mesh LOD %s|%s level %d/%d"), *Lod.Filename, *Lod.Key, Lod.Level, Lod.LevelCount);
+        return false;
+    }
+
+    const FString MapKey = MakeSceneMeshKey(Lod.Filename, Lod.Key);
+
+    // Coarse levels are kept until level 0 arrives, so the final mesh carries the whole chain
+    TArray<FJUSYNCMeshData> Chain;
+    if (Lod.Level > 0)
+    {
+        TArray<FJUSYNCMeshData>& Pending = PendingMeshLods.FindOrAdd(MapKey);
+        if (Pending.Num() != Lod.LevelCount)
+        {
+            Pending.Reset();
+            Pending.SetNum(Lod.LevelCount);
+        }
+        Pending[Lod.Level] = Lod.Mesh;
+    }
+    else if (TArray<FJUSYNCMeshData>* Pending = PendingMeshLods.Find(MapKey))
+    {
+        Chain.Add(Lod.Mesh);
+        for (int32 Level = 1; Level < Pending->Num(); ++Level)
+        {
+            if ((*Pending)[Level].IsValid())
+            {
+                Chain.Add(MoveTemp((*Pending)[Level]));
+            }
+        }
+        PendingMeshLods.Remove(MapKey);
+    }
+
+    URealtimeMeshComponent* Component = nullptr;
+    TWeakObjectPtr<URealtimeMeshComponent>* Bound = SceneMeshComponents.Find(MapKey);
+    const bool bWasBound = Bound && Bound->IsValid();
+    if (bWasBound)
+    {
+        Component = Bound->Get();
+    }
+    else
+    {
+        AActor* Spawned = UJUSYNCBlueprintLibrary::SpawnRealtimeMeshAtLocation(Lod.Mesh, FVector::ZeroVector);
+        Component = Spawned ? Cast<URealtimeMeshComponent>(Spawned->GetRootComponent()) : nullptr;
+        if (!Component)
+        {
+            return false;
+        }
+        BindSceneMeshComponent(Lod.Filename, Lod.Key, Component);
+    }
+
+    // A freshly spawned component already shows Lod.Mesh unless a chain replaces it
+    const bool bBuilt = Chain.Num() > 1 ? CreateRealtimeMeshLODsFromJUSYNC(Chain, Component)
+                      : bWasBound ? CreateRealtimeMeshFromJUSYNC(Lod.Mesh, Component)
+                      : true;
+    if (bBuilt && Lod.Mesh.InstanceTransforms.Num() == 1)
+    {
+        Component->SetWorldTransform(Lod.Mesh.InstanceTransforms[0]);
+    }
+    return bBuilt;
+}
+
+void UJUSYNCSubsystem::ClearSceneHistory()
+{
+    // Bound components are kept: the next full version rebuilds them in place
+    PendingMeshLods.Empty();
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    ClearSceneHistory_C();
+#endif
+}
+
+void UJUSYNCSubsystem::HandleFileReceivedForLibrary(const FJUSYNCFileData& FileData)
+{
+    UE_LOG(LogTemp, Warning, TEXT("=== ADDING FILE TO BLUEPRINT LIBRARY ==="));
+    UE_LOG(LogTemp, Warning, TEXT("File: %s (%lld bytes, %s)"), 
+           *FileData.Filename, FileData.GetNumBytes(), *FileData.FileType);
+    
+    FScopeLock Lock(&UJUSYNCBlueprintLibrary::DataMutex);
+    
+    int32 PreviousCount = UJUSYNCBlueprintLibrary::ReceivedFiles.Num();
+    UJUSYNCBlueprintLibrary::ReceivedFiles.Add(FileData);
+    int32 NewCount = UJUSYNCBlueprintLibrary::ReceivedFiles.Num();
+    
+    UE_LOG(LogTemp, Warning, TEXT("Blueprint Library file count: %d -> %d"), PreviousCount, NewCount);
+    UE_LOG(LogTemp, Warning, TEXT("✅ File added to Blueprint Library: %s"), *FileData.Filename);
+}
+
+void UJUSYNCSubsystem::HandleMessageReceivedForLibrary(const FString& Message)
+{
+    UE_LOG(LogTemp, Warning, TEXT("=== ADDING MESSAGE TO BLUEPRINT LIBRARY ==="));
+    UE_LOG(LogTemp, Warning, TEXT("Message: %s"), *Message);
+    
+    FScopeLock Lock(&UJUSYNCBlueprintLibrary::DataMutex);
+    
+    int32 PreviousCount = UJUSYNCBlueprintLibrary::ReceivedMessages.Num();
+    UJUSYNCBlueprintLibrary::ReceivedMessages.Add(Message);
+    int32 NewCount = UJUSYNCBlueprintLibrary::ReceivedMessages.Num();
+    
+    UE_LOG(LogTemp, Warning, TEXT("Blueprint Library message count: %d -> %d"), PreviousCount, NewCount);
+    UE_LOG(LogTemp, Log, TEXT("Message received for Blueprint Library: %s"), *Message);
+}
+
+bool UJUSYNCSubsystem::LoadUSDFromBuffer(const TArray<uint8>& Buffer, const FString& Filename, TArray<FJUSYNCMeshData>& OutMeshData)
+{
+    return LoadUSDFromBytes(Buffer.GetData(), Buffer.Num(), Filename, OutMeshData);
+}
+
+bool UJUSYNCSubsystem::LoadUSDFromFileData(const FJUSYNCFileData& FileData, TArray<FJUSYNCMeshData>& OutMeshData)
+{
+    // Reads the shared payload in place, so received files are parsed without a copy
+    return LoadUSDFromBytes(FileData.GetBytes(), FileData.GetNumBytes(), FileData.Filename, OutMeshData);
+}
+
+bool UJUSYNCSubsystem::LoadUSDFromBytes(const uint8* Bytes, int64 NumBytes, const FString& Filename, TArray<FJUSYNCMeshData>& OutMeshData)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_LoadUSD, JUSYNCChannel);
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    if (!Bytes || NumBytes <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("LoadUSDFromBytes: empty buffer for %s"), *Filename);
+        return false;
+    }
+
+    if (!bIsInitialized.load())
+    {
+        UE_LOG(LogTemp, Error, TEXT("JUSYNC Middleware not initialized"));
+        return false;
+    }
+    
+    // Convert FString to C string
+    FTCHARToUTF8 FilenameConverter(*Filename);
+    const char* FilenameCStr = FilenameConverter.Get();
+    
+    CMeshData* CMeshes = nullptr;
+    size_t MeshCount = 0;
+    
+    // Call C interface
+    int Result = 0;
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_LoadUSDBuffer_C, JUSYNCChannel);
+        Result = LoadUSDBuffer_C(Bytes, static_cast<size_t>(NumBytes), FilenameCStr, &CMeshes, &MeshCount);
+    }
+    
+    if (Result == 1 && CMeshes && MeshCount > 0)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_ConvertMeshes, JUSYNCChannel);
+        OutMeshData.Empty();
+        OutMeshData.Reserve(MeshCount);
+        
+        // Convert C mesh data to UE format
+        for (size_t i = 0; i < MeshCount; ++i)
+        {
+            FJUSYNCMeshData UEMeshData = ConvertCMeshDataToUE_Helper(CMeshes[i]);
+            OutMeshData.Add(UEMeshData);
+        }
+        
+        // Free C memory
+        FreeMeshData_C(CMeshes, MeshCount);
+        
+        UE_LOG(LogTemp, Log, TEXT("Successfully loaded %d meshes from USD buffer"), OutMeshData.Num());
+        return true;
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to load USD from buffer"));
+        if (CMeshes)
+        {
+            FreeMeshData_C(CMeshes, MeshCount);
+        }
+    }
+#endif
+    return false;
+}
+
+int64 UJUSYNCSubsystem::LoadUSDFromBufferAsync(const TArray<uint8>& Buffer, const FString& Filename,
+                                               FUSDLoadProgress OnProgress, FUSDLoadComplete OnComplete)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    if (Buffer.Num() == 0 || !bIsInitialized.load())
+    {
+        UE_LOG(LogTemp, Error, TEXT("LoadUSDFromBufferAsync: %s"),
+               Buffer.Num() == 0 ? TEXT("empty buffer") : TEXT("JUSYNC Middleware not initialized"));
+        return 0;
+    }
+
+    FTCHARToUTF8 FilenameConverter(*Filename);
+    return StartAsyncLoad(MoveTemp(OnProgress), MoveTemp(OnComplete), [&](const CAsyncLoadOptions& Options)
+    {
+        // The middleware copies the buffer before returning
+        return LoadUSDBufferAsync_C(Buffer.GetData(), static_cast<size_t>(Buffer.Num()), FilenameConverter.Get(), &Options);
+    });
+#else
+    return 0;
+#endif
+}
+
+int64 UJUSYNCSubsystem::LoadUSDFromDiskAsync(const FString& FilePath, FUSDLoadProgress OnProgress,
+                                             FUSDLoadComplete OnComplete)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    if (!bIsInitialized.load())
+    {
+        UE_LOG(LogTemp, Error, TEXT("JUSYNC Middleware not initialized"));
+        return 0;
+    }
+
+    FTCHARToUTF8 FilePathConverter(*FilePath);
+    return StartAsyncLoad(MoveTemp(OnProgress), MoveTemp(OnComplete), [&](const CAsyncLoadOptions& Options)
+    {
+        return LoadUSDFromDiskAsync_C(FilePathConverter.Get(), &Options);
+    });
+#else
+    return 0;
+#endif
+}
+
+bool UJUSYNCSubsystem::CancelUSDLoad(int64 LoadId)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    return LoadId > 0 && CancelLoad_C(static_cast<uint64_t>(LoadId)) == 1;
+#else
+    return false;
+#endif
+}
+
+bool UJUSYNCSubsystem::LoadUSDFromDisk(const FString& FilePath, TArray<FJUSYNCMeshData>& OutMeshData)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    if (!bIsInitialized.load())
+    {
+        UE_LOG(LogTemp, Error, TEXT("JUSYNC Middleware not initialized"));
+        return false;
+    }
+    
+    // Convert FString to C string
     FTCHARToUTF8 FilePathConverter(*FilePath);
     const char* FilePathCStr = FilePathConverter.Get();
     
@@ -687,6 +1309,39 @@ bool UJUSYNCSubsystem::LoadUSDFromDisk(const FString& FilePath, TArray<FJUSYNCMe
 
 FJUSYNCTextureData UJUSYNCSubsystem::CreateTextureFromBuffer(const TArray<uint8>& Buffer)
 {
+    return CreateTextureFromBytes(Buffer.GetData(), Buffer.Num(), FString());
+}
+
+FJUSYNCTextureData UJUSYNCSubsystem::CreateTextureFromFileData(const FJUSYNCFileData& FileData)
+{
+    return CreateTextureFromBytes(FileData.GetBytes(), FileData.GetNumBytes(), FileData.Hash);
+}
+
+bool UJUSYNCSubsystem::ConfigureTextureCache(int32 MaxEntries, int64 MaxBytes, const FString& Directory)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    if (!bIsInitialized.load())
+    {
+        UE_LOG(LogTemp, Error, TEXT("JUSYNC Middleware not initialized"));
+        return false;
+    }
+
+    if (MaxEntries < 0 || MaxBytes < 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid texture cache limits: %d entries, %lld bytes"), MaxEntries, MaxBytes);
+        return false;
+    }
+
+    return ConfigureTextureCache_C(static_cast<size_t>(MaxEntries), static_cast<size_t>(MaxBytes),
+                                   TCHAR_TO_UTF8(*Directory)) != 0;
+#else
+    return false;
+#endif
+}
+
+FJUSYNCTextureData UJUSYNCSubsystem::CreateTextureFromBytes(const uint8* Bytes, int64 NumBytes, const FString& ContentHash)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_CreateTexture, JUSYNCChannel);
     FJUSYNCTextureData Result;
     
 #ifdef WITH_ANARI_USD_MIDDLEWARE
@@ -695,9 +1350,16 @@ FJUSYNCTextureData UJUSYNCSubsystem::CreateTextureFromBuffer(const TArray<uint8>
         UE_LOG(LogTemp, Error, TEXT("JUSYNC Middleware not initialized"));
         return Result;
     }
+
+    if (!Bytes || NumBytes <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("CreateTextureFromBytes: empty buffer"));
+        return Result;
+    }
     
     // Call C interface
-    CTextureData CTexture = CreateTextureFromBuffer_C(Buffer.GetData(), Buffer.Num());
+    CTextureData CTexture = CreateTextureFromBufferWithHash_C(Bytes, static_cast<size_t>(NumBytes),
+                                                              TCHAR_TO_UTF8(*ContentHash));
     
     if (CTexture.data && CTexture.data_size > 0)
     {
@@ -721,6 +1383,127 @@ FJUSYNCTextureData UJUSYNCSubsystem::CreateTextureFromBuffer(const TArray<uint8>
     return Result;
 }
 
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+static CTextureOptions MakeTextureOptions_Helper(bool bGenerateMips, bool bCompress, bool bSRGB)
+{
+    CTextureOptions Options = {};
+    Options.generate_mips = bGenerateMips ? 1 : 0;
+    Options.compression = bCompress ? TEXTURE_COMPRESSION_AUTO : TEXTURE_COMPRESSION_NONE;
+    Options.linear = bSRGB ? 0 : 1;
+    return Options;
+}
+
+// The middleware lays levels out like platform data, so each one is a single copy
+static UTexture2D* CreateUETextureFromGpuTexture_Helper(const CGpuTexture& GpuTexture, bool bSRGB)
+{
+    EPixelFormat PixelFormat = PF_R8G8B8A8;
+    switch (GpuTexture.format)
+    {
+    case TEXTURE_FORMAT_BC1: PixelFormat = PF_DXT1; break;
+    case TEXTURE_FORMAT_BC3: PixelFormat = PF_DXT5; break;
+    default: break;
+    }
+
+    UTexture2D* Texture = NewObject<UTexture2D>(GetTransientPackage(), NAME_None, RF_Transient);
+    if (!Texture)
+    {
+        return nullptr;
+    }
+
+    FTexturePlatformData* PlatformData = new FTexturePlatformData();
+    PlatformData->SizeX = GpuTexture.width;
+    PlatformData->SizeY = GpuTexture.height;
+    PlatformData->PixelFormat = PixelFormat;
+    for (size_t Level = 0; Level < GpuTexture.mip_count; ++Level)
+    {
+        const CTextureMip& Source = GpuTexture.mips[Level];
+        FTexture2DMipMap* Mip = new FTexture2DMipMap(Source.width, Source.height, 1);
+        PlatformData->Mips.Add(Mip);
+        Mip->BulkData.Lock(LOCK_READ_WRITE);
+        void* Dest = Mip->BulkData.Realloc(static_cast<int64>(Source.size));
+        FMemory::Memcpy(Dest, GpuTexture.data + Source.offset, Source.size);
+        Mip->BulkData.Unlock();
+    }
+
+    Texture->SetPlatformData(PlatformData);
+    Texture->SRGB = bSRGB;
+    Texture->UpdateResource();
+    return Texture;
+}
+#endif
+
+UTexture2D* UJUSYNCSubsystem::CreateGpuTextureFromBuffer(const TArray<uint8>& Buffer, bool bGenerateMips,
+                                                         bool bCompress, bool bSRGB)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    // Texture processing is stateless, so this works before InitializeMiddleware
+    const CTextureOptions Options = MakeTextureOptions_Helper(bGenerateMips, bCompress, bSRGB);
+    CGpuTexture GpuTexture = {};
+    if (!CreateGpuTexture_C(Buffer.GetData(), Buffer.Num(), &Options, &GpuTexture))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to create GPU texture from buffer"));
+        return nullptr;
+    }
+
+    UTexture2D* Texture = CreateUETextureFromGpuTexture_Helper(GpuTexture, bSRGB);
+    UE_LOG(LogTemp, Log, TEXT("Created GPU texture: %dx%d, %d mips, format %d"),
+           GpuTexture.width, GpuTexture.height, static_cast<int32>(GpuTexture.mip_count), static_cast<int32>(GpuTexture.format));
+    FreeGpuTexture_C(&GpuTexture);
+    return Texture;
+#else
+    return nullptr;
+#endif
+}
+
+void UJUSYNCSubsystem::CreateGpuTexturesAsync(TArray<TArray<uint8>>&& Buffers, bool bGenerateMips, bool bCompress,
+                                              bool bSRGB, FGpuTexturesComplete OnComplete)
+{
+#ifdef WITH_ANARI_USD_MIDDLEWARE
+    const CTextureOptions Options = MakeTextureOptions_Helper(bGenerateMips, bCompress, bSRGB);
+
+    // The batch blocks this task while the middleware's worker pool joins in
+    Async(EAsyncExecution::ThreadPool, [Buffers = MoveTemp(Buffers), Options, bSRGB, OnComplete = MoveTemp(OnComplete)]() mutable
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_CreateGpuTextures, JUSYNCChannel);
+        TArray<const unsigned char*> Data;
+        TArray<size_t> Sizes;
+        Data.Reserve(Buffers.Num());
+        Sizes.Reserve(Buffers.Num());
+        for (const TArray<uint8>& Buffer : Buffers)
+        {
+            Data.Add(Buffer.GetData());
+            Sizes.Add(static_cast<size_t>(Buffer.Num()));
+        }
+
+        TArray<CGpuTexture> GpuTextures;
+        GpuTextures.SetNumZeroed(Buffers.Num());
+        CreateGpuTextures_C(Data.GetData(), Sizes.GetData(), Buffers.Num(), &Options, 0, GpuTextures.GetData());
+        Buffers.Empty();
+
+        AsyncTask(ENamedThreads::GameThread, [GpuTextures = MoveTemp(GpuTextures), bSRGB, OnComplete = MoveTemp(OnComplete)]() mutable
+        {
+            TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_UploadGpuTextures, JUSYNCChannel);
+            TArray<UTexture2D*> Textures;
+            Textures.Reserve(GpuTextures.Num());
+            for (CGpuTexture& GpuTexture : GpuTextures)
+            {
+                Textures.Add(GpuTexture.data ? CreateUETextureFromGpuTexture_Helper(GpuTexture, bSRGB) : nullptr);
+                FreeGpuTexture_C(&GpuTexture);
+            }
+            if (OnComplete)
+            {
+                OnComplete(MoveTemp(Textures));
+            }
+        });
+    });
+#else
+    if (OnComplete)
+    {
+        OnComplete(TArray<UTexture2D*>());
+    }
+#endif
+}
+
 bool UJUSYNCSubsystem::WriteGradientLineAsPNG(const TArray<uint8>& Buffer, const FString& OutputPath)
 {
 #ifdef WITH_ANARI_USD_MIDDLEWARE
@@ -826,14 +1609,165 @@ void RecalculateNormals(FJUSYNCMeshData& MeshData)
     // Normalize accumulated normals
     for (int32 i = 0; i < MeshData.Normals.Num(); ++i)
     {
-        MeshData.Normals[i] = MeshData.Normals[i].GetSafeNormal();
-        if (MeshData.Normals[i].IsNearlyZero())
-        {
-            MeshData.Normals[i] = FVector::UpVector; // Fallback normal
-        }
+        MeshData.Normals[i] = MeshData.Normals[i].GetSafeNormal();
+        if (MeshData.Normals[i].IsNearlyZero())
+        {
+            MeshData.Normals[i] = FVector::UpVector; // Fallback normal
+        }
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("Recalculated normals with correct CCW winding"));
+}
+
+// Vertex-color material unless the component already has one (e.g. a texture material from Blueprint)
+static void ApplyJUSYNCFallbackMaterial(URealtimeMeshComponent* RealtimeMeshComponent)
+{
+    // Only apply vertex color material if no material is already set
+    if (!RealtimeMeshComponent->GetMaterial(0))
+    {
+        UMaterial* VertexColorMaterial = LoadObject<UMaterial>(nullptr, TEXT("/Game/Materials/M_VertexColor"));
+        if (VertexColorMaterial)
+        {
+            RealtimeMeshComponent->SetMaterial(0, VertexColorMaterial);
+            UE_LOG(LogTemp, Verbose, TEXT("✅ Applied M_VertexColor material as fallback"));
+        }
+        else
+        {
+            // Fallback to enhanced default material
+            UMaterial* DefaultMat = UMaterial::GetDefaultMaterial(MD_Surface);
+            if (DefaultMat)
+            {
+                auto* DynMat = UMaterialInstanceDynamic::Create(DefaultMat, RealtimeMeshComponent);
+                DynMat->SetScalarParameterValue(TEXT("UseVertexColor"), 1.0f);
+                RealtimeMeshComponent->SetMaterial(0, DynMat);
+                UE_LOG(LogTemp, Verbose, TEXT("✅ Applied enhanced default material as fallback"));
+            }
+        }
+    }
+    else
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("✅ Using provided material (preserving texture material from Blueprint)"));
+    }
+}
+
+// Fill RealtimeMesh streams from JUSYNC mesh data (vertex interpolation already done by the converter).
+// Touches no UObjects, so it is safe on worker threads; every stream is sized once and written in place
+static void BuildJUSYNCStreams(const FJUSYNCMeshData& MeshData, RealtimeMesh::FRealtimeMeshStreamSet& Streams)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_BuildStreams, JUSYNCChannel);
+    using namespace RealtimeMesh;
+    using FTangents = TRealtimeMeshTangents<FPackedNormal>;
+
+    const int32 FinalVertexCount = MeshData.Vertices.Num();
+    const int32 FinalTriCount = MeshData.Triangles.Num() / 3;
+
+    FRealtimeMeshStream& PositionStream = Streams.AddStream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3f>());
+    FRealtimeMeshStream& TangentStream = Streams.AddStream(FRealtimeMeshStreams::Tangents, GetRealtimeMeshBufferLayout<FTangents>());
+    FRealtimeMeshStream& TexCoordStream = Streams.AddStream(FRealtimeMeshStreams::TexCoords, GetRealtimeMeshBufferLayout<FVector2DHalf>());
+    FRealtimeMeshStream& ColorStream = Streams.AddStream(FRealtimeMeshStreams::Color, GetRealtimeMeshBufferLayout<FColor>());
+    PositionStream.SetNumUninitialized(FinalVertexCount);
+    TangentStream.SetNumUninitialized(FinalVertexCount);
+    TexCoordStream.SetNumUninitialized(FinalVertexCount);
+    ColorStream.SetNumUninitialized(FinalVertexCount);
+
+    const TArrayView<FVector3f> Positions = PositionStream.GetArrayView<FVector3f>();
+    for (int32 i = 0; i < FinalVertexCount; ++i)
+    {
+        Positions[i] = FVector3f(MeshData.Vertices[i]);
+    }
+
+    // Normals; missing ones face up
+    const TArrayView<FTangents> Tangents = TangentStream.GetArrayView<FTangents>();
+    const int32 NormalCount = FMath::Min(MeshData.Normals.Num(), FinalVertexCount);
+    FTangents Tangent;
+    for (int32 i = 0; i < FinalVertexCount; ++i)
+    {
+        Tangent.SetNormal(FVector3f(i < NormalCount ? MeshData.Normals[i] : FVector::UpVector));
+        Tangents[i] = Tangent;
+    }
+
+    const TArrayView<FVector2DHalf> TexCoords = TexCoordStream.GetArrayView<FVector2DHalf>();
+    const int32 UVCount = FMath::Min(MeshData.UVs.Num(), FinalVertexCount);
+    for (int32 i = 0; i < UVCount; ++i)
+    {
+        TexCoords[i] = FVector2DHalf(FVector2f(MeshData.UVs[i]));
+    }
+    for (int32 i = UVCount; i < FinalVertexCount; ++i)
+    {
+        TexCoords[i] = FVector2DHalf(FVector2f::ZeroVector);
+    }
+
+    // Colors are already FColor, so they are copied as a block; vertices without one stay white
+    const TArrayView<FColor> Colors = ColorStream.GetArrayView<FColor>();
+    const int32 ColorCount = FMath::Min(MeshData.VertexColors.Num(), FinalVertexCount);
+    if (ColorCount > 0)
+    {
+        FMemory::Memcpy(Colors.GetData(), MeshData.VertexColors.GetData(), ColorCount * sizeof(FColor));
+    }
+    for (int32 i = ColorCount; i < FinalVertexCount; ++i)
+    {
+        Colors[i] = FColor::White;
+    }
+
+    // Triangles, dropping any that reference missing vertices
+    FRealtimeMeshStream& TriangleStream = Streams.AddStream(FRealtimeMeshStreams::Triangles, GetRealtimeMeshBufferLayout<TIndex3<uint32>>());
+    TriangleStream.SetNumUninitialized(FinalTriCount);
+    const TArrayView<TIndex3<uint32>> Triangles = TriangleStream.GetArrayView<TIndex3<uint32>>();
+    const uint32 VertexLimit = static_cast<uint32>(FinalVertexCount);
+    int32 ValidTriCount = 0;
+    for (int32 Face = 0; Face < FinalTriCount; ++Face)
+    {
+        const uint32 i0 = static_cast<uint32>(MeshData.Triangles[Face * 3 + 0]);
+        const uint32 i1 = static_cast<uint32>(MeshData.Triangles[Face * 3 + 1]);
+        const uint32 i2 = static_cast<uint32>(MeshData.Triangles[Face * 3 + 2]);
+        if (i0 < VertexLimit && i1 < VertexLimit && i2 < VertexLimit)
+        {
+            Triangles[ValidTriCount++] = TIndex3<uint32>(i0, i1, i2);
+        }
+    }
+    if (ValidTriCount < FinalTriCount)
+    {
+        UE_LOG(LogTemp, Error, TEXT("❌ Dropped %d invalid triangles of '%s' (%d vertices)"),
+               FinalTriCount - ValidTriCount, *MeshData.ElementName, FinalVertexCount);
+        TriangleStream.SetNumUninitialized(ValidTriCount);
+    }
+
+    // Every triangle is in poly group 0
+    FRealtimeMeshStream& PolyGroupStream = Streams.AddStream(FRealtimeMeshStreams::PolyGroups, GetRealtimeMeshBufferLayout<uint16>());
+    PolyGroupStream.SetNumUninitialized(ValidTriCount);
+    if (ValidTriCount > 0)
+    {
+        FMemory::Memzero(PolyGroupStream.GetArrayView<uint16>().GetData(), ValidTriCount * sizeof(uint16));
+    }
+}
+
+// One visible, shadow-casting section holding all triangles of an LOD
+static void AddJUSYNCSectionGroup(URealtimeMeshSimple* RealtimeMesh, int32 LODIndex, RealtimeMesh::FRealtimeMeshStreamSet&& Streams)
+{
+    const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(LODIndex, TEXT("USDGroup"));
+    const FRealtimeMeshSectionKey SectionKey = FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0);
+    RealtimeMesh->CreateSectionGroup(GroupKey, MoveTemp(Streams));
+    FRealtimeMeshSectionConfig SectionConfig(0);
+    SectionConfig.bIsVisible = true;
+    SectionConfig.bCastsShadow = true;
+    RealtimeMesh->UpdateSectionConfig(SectionKey, SectionConfig);
+}
+
+// Game-thread half of mesh creation: hand prebuilt streams to a component as a single-LOD mesh
+static bool CommitJUSYNCStreams(URealtimeMeshComponent* RealtimeMeshComponent, RealtimeMesh::FRealtimeMeshStreamSet&& Streams)
+{
+    URealtimeMeshSimple* RealtimeMesh = RealtimeMeshComponent->InitializeRealtimeMesh<URealtimeMeshSimple>();
+    if (!RealtimeMesh)
+    {
+        UE_LOG(LogTemp, Error, TEXT("❌ Failed to initialize RealtimeMesh"));
+        return false;
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("Recalculated normals with correct CCW winding"));
+
+    RealtimeMesh->SetupMaterialSlot(0, TEXT("PrimaryMaterial"));
+    ApplyJUSYNCFallbackMaterial(RealtimeMeshComponent);
+    AddJUSYNCSectionGroup(RealtimeMesh, 0, MoveTemp(Streams));
+    RealtimeMeshComponent->MarkRenderStateDirty();
+    return true;
 }
 
 bool UJUSYNCSubsystem::CreateRealtimeMeshFromJUSYNC(
@@ -857,127 +1791,70 @@ bool UJUSYNCSubsystem::CreateRealtimeMeshFromJUSYNC(
     const int32 FinalVertexCount = MeshData.Vertices.Num();
     const int32 FinalTriCount = MeshData.Triangles.Num() / 3;
 
-    // Initialize RealtimeMesh builder
-    URealtimeMeshSimple* RealtimeMesh = RealtimeMeshComponent->InitializeRealtimeMesh<URealtimeMeshSimple>();
-    if (!RealtimeMesh)
+    RealtimeMesh::FRealtimeMeshStreamSet Streams;
+    BuildJUSYNCStreams(MeshData, Streams);
+    if (!CommitJUSYNCStreams(RealtimeMeshComponent, MoveTemp(Streams)))
     {
-        UE_LOG(LogTemp, Error, TEXT("❌ Failed to initialize RealtimeMesh"));
         return false;
     }
 
-    RealtimeMesh->SetupMaterialSlot(0, TEXT("PrimaryMaterial"));
+    UE_LOG(LogTemp, Warning, TEXT("🎨 === SMOOTH VERTEX INTERPOLATION MESH CREATION COMPLETE ==="));
+    UE_LOG(LogTemp, Log, TEXT("✅ CreateRealtimeMeshFromJUSYNC: Smooth mesh created '%s' (%d verts, %d tris)"),
+           *MeshData.ElementName, FinalVertexCount, FinalTriCount);
 
-    // Only apply vertex color material if no material is already set
-    if (!RealtimeMeshComponent->GetMaterial(0))
-    {
-        UMaterial* VertexColorMaterial = LoadObject<UMaterial>(nullptr, TEXT("/Game/Materials/M_VertexColor"));
-        if (VertexColorMaterial)
-        {
-            RealtimeMeshComponent->SetMaterial(0, VertexColorMaterial);
-            UE_LOG(LogTemp, Warning, TEXT("✅ Applied M_VertexColor material as fallback"));
-        }
-        else
-        {
-            // Fallback to enhanced default material
-            UMaterial* DefaultMat = UMaterial::GetDefaultMaterial(MD_Surface);
-            if (DefaultMat)
-            {
-                auto* DynMat = UMaterialInstanceDynamic::Create(DefaultMat, RealtimeMeshComponent);
-                DynMat->SetScalarParameterValue(TEXT("UseVertexColor"), 1.0f);
-                RealtimeMeshComponent->SetMaterial(0, DynMat);
-                UE_LOG(LogTemp, Warning, TEXT("✅ Applied enhanced default material as fallback"));
-            }
-        }
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("✅ Using provided material (preserving texture material from Blueprint)"));
-    }
+    return true;
+}
 
 
-    RealtimeMesh::FRealtimeMeshStreamSet Streams;
-    auto Builder = RealtimeMesh::TRealtimeMeshBuilderLocal<uint32>(Streams);
-    Builder.EnableTangents();
-    Builder.EnableTexCoords();
-    Builder.EnableColors();
-    Builder.EnablePolyGroups();
 
-    // Add vertices and attributes - SIMPLIFIED since vertex interpolation is already handled
-    for (int32 i = 0; i < FinalVertexCount; ++i)
+bool UJUSYNCSubsystem::CreateRealtimeMeshLODsFromJUSYNC(const TArray<FJUSYNCMeshData>& LODs, URealtimeMeshComponent* RealtimeMeshComponent)
+{
+    if (!RealtimeMeshComponent || LODs.Num() == 0)
     {
-        Builder.AddVertex(FVector3f(MeshData.Vertices[i]));
-
-        // Normals
-        FVector3f N = FVector3f(MeshData.Normals.IsValidIndex(i) ? MeshData.Normals[i] : FVector::UpVector);
-        Builder.SetNormal(i, N);
-
-        // UVs
-        if (MeshData.HasUVs() && MeshData.UVs.IsValidIndex(i))
-        {
-            Builder.SetTexCoord(i, 0, FVector2DHalf(FVector2f(MeshData.UVs[i])));
-        }
-        else
+        UE_LOG(LogTemp, Error, TEXT("❌ Invalid input to CreateRealtimeMeshLODsFromJUSYNC"));
+        return false;
+    }
+    for (const FJUSYNCMeshData& MeshData : LODs)
+    {
+        if (!MeshData.IsValid())
         {
-            Builder.SetTexCoord(i, 0, FVector2DHalf(FVector2f::ZeroVector));
+            UE_LOG(LogTemp, Error, TEXT("❌ Invalid LOD mesh '%s' in CreateRealtimeMeshLODsFromJUSYNC"), *MeshData.ElementName);
+            return false;
         }
+    }
 
-        // Colors - now using smooth vertex interpolation (already processed)
-        if (MeshData.HasVertexColors() && MeshData.VertexColors.IsValidIndex(i))
-        {
-            FColor VertexColor = MeshData.VertexColors[i];
-            Builder.SetColor(i, VertexColor);
-            
-            // Debug first few vertices
-            if (i < 6)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("🎨 Vertex %d: Smooth Color=(%d,%d,%d,%d)"), 
-                       i, VertexColor.R, VertexColor.G, VertexColor.B, VertexColor.A);
-            }
-        }
-        else
-        {
-            Builder.SetColor(i, FColor::White);
-        }
+    URealtimeMeshSimple* RealtimeMesh = RealtimeMeshComponent->InitializeRealtimeMesh<URealtimeMeshSimple>();
+    if (!RealtimeMesh)
+    {
+        UE_LOG(LogTemp, Error, TEXT("❌ Failed to initialize RealtimeMesh"));
+        return false;
     }
 
-    // Add triangles
-    for (int32 Face = 0; Face < FinalTriCount; ++Face)
+    RealtimeMesh->SetupMaterialSlot(0, TEXT("PrimaryMaterial"));
+    ApplyJUSYNCFallbackMaterial(RealtimeMeshComponent);
+
+    // LOD 0 exists after initialization; each further LOD takes over at half the screen size
+    float ScreenSize = 1.0f;
+    for (int32 LODIndex = 0; LODIndex < LODs.Num(); ++LODIndex)
     {
-        int32 i0 = MeshData.Triangles[Face*3 + 0];
-        int32 i1 = MeshData.Triangles[Face*3 + 1];
-        int32 i2 = MeshData.Triangles[Face*3 + 2];
-        
-        if (i0 < FinalVertexCount && i1 < FinalVertexCount && i2 < FinalVertexCount)
+        if (LODIndex > 0)
         {
-            Builder.AddTriangle(i0, i1, i2);
+            ScreenSize *= 0.5f;
+            RealtimeMesh->AddLOD(FRealtimeMeshLODConfig(ScreenSize));
         }
-        else
-        {
-            UE_LOG(LogTemp, Error, TEXT("❌ Invalid triangle %d: [%d,%d,%d] vs %d vertices"), 
-                   Face, i0, i1, i2, FinalVertexCount);
-        }
-    }
 
-    // Finalize the mesh section
-    const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, TEXT("USDGroup"));
-    const FRealtimeMeshSectionKey SectionKey = FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0);
-    RealtimeMesh->CreateSectionGroup(GroupKey, Streams);
-    FRealtimeMeshSectionConfig SectionConfig(0);
-    SectionConfig.bIsVisible = true;
-    SectionConfig.bCastsShadow = true;
-    RealtimeMesh->UpdateSectionConfig(SectionKey, SectionConfig);
+        RealtimeMesh::FRealtimeMeshStreamSet Streams;
+        BuildJUSYNCStreams(LODs[LODIndex], Streams);
+        AddJUSYNCSectionGroup(RealtimeMesh, LODIndex, MoveTemp(Streams));
+    }
 
     RealtimeMeshComponent->MarkRenderStateDirty();
-    
-    UE_LOG(LogTemp, Warning, TEXT("🎨 === SMOOTH VERTEX INTERPOLATION MESH CREATION COMPLETE ==="));
-    UE_LOG(LogTemp, Log, TEXT("✅ CreateRealtimeMeshFromJUSYNC: Smooth mesh created '%s' (%d verts, %d tris)"),
-           *MeshData.ElementName, FinalVertexCount, FinalTriCount);
 
+    UE_LOG(LogTemp, Log, TEXT("✅ CreateRealtimeMeshLODsFromJUSYNC: '%s' with %d LODs (%d to %d tris)"),
+           *LODs[0].ElementName, LODs.Num(), LODs[0].GetTriangleCount(), LODs.Last().GetTriangleCount());
     return true;
 }
 
-
-
 bool UJUSYNCSubsystem::BatchCreateRealtimeMeshesFromJUSYNC(const TArray<FJUSYNCMeshData>& MeshDataArray, const TArray<URealtimeMeshComponent*>& MeshComponents)
 {
     if (MeshDataArray.Num() != MeshComponents.Num())
@@ -986,12 +1863,23 @@ bool UJUSYNCSubsystem::BatchCreateRealtimeMeshesFromJUSYNC(const TArray<FJUSYNCM
         return false;
     }
     
+    // Streams are built on worker threads; only the commits run here
+    TArray<RealtimeMesh::FRealtimeMeshStreamSet> StreamSets;
+    StreamSets.SetNum(MeshDataArray.Num());
+    ParallelFor(MeshDataArray.Num(), [&MeshDataArray, &MeshComponents, &StreamSets](int32 i)
+    {
+        if (MeshComponents[i] && MeshDataArray[i].IsValid())
+        {
+            BuildJUSYNCStreams(MeshDataArray[i], StreamSets[i]);
+        }
+    });
+
     bool bAllSuccessful = true;
     int32 SuccessCount = 0;
     
     for (int32 i = 0; i < MeshDataArray.Num(); ++i)
     {
-        if (CreateRealtimeMeshFromJUSYNC(MeshDataArray[i], MeshComponents[i]))
+        if (MeshComponents[i] && MeshDataArray[i].IsValid() && CommitJUSYNCStreams(MeshComponents[i], MoveTemp(StreamSets[i])))
         {
             SuccessCount++;
         }
@@ -1006,49 +1894,195 @@ bool UJUSYNCSubsystem::BatchCreateRealtimeMeshesFromJUSYNC(const TArray<FJUSYNCM
     return bAllSuccessful;
 }
 
+int32 UJUSYNCSubsystem::QueueRealtimeMeshes(const TArray<FJUSYNCMeshData>& MeshDataArray, const TArray<URealtimeMeshComponent*>& MeshComponents)
+{
+    TArray<FJUSYNCMeshData> Copy = MeshDataArray;
+    return QueueOwnedRealtimeMeshes(MoveTemp(Copy), MeshComponents);
+}
 
-FJUSYNCRealtimeMeshData UJUSYNCSubsystem::ConvertToRealtimeMeshFormat(const FJUSYNCMeshData& StandardMesh)
+int32 UJUSYNCSubsystem::QueueOwnedRealtimeMeshes(TArray<FJUSYNCMeshData>&& MeshDataArray, const TArray<URealtimeMeshComponent*>& MeshComponents)
 {
-    FJUSYNCRealtimeMeshData RealtimeMesh;
-    RealtimeMesh.ElementName = StandardMesh.ElementName;
+    if (MeshDataArray.Num() != MeshComponents.Num())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Mesh data array and component array size mismatch"));
+        return 0;
+    }
+    if (!MeshBuildQueue)
+    {
+        UE_LOG(LogTemp, Error, TEXT("❌ QueueRealtimeMeshes: subsystem is not initialized"));
+        return 0;
+    }
 
-    // Convert flat arrays to structured vertices
-    RealtimeMesh.Vertices.Reserve(StandardMesh.GetVertexCount());
+    const double Now = FPlatformTime::Seconds();
+    const uint32 Generation = MeshBuildQueue->Generation.load();
+    TArray<TUniquePtr<FJUSYNCMeshBuild>> Builds;
+    TArray<FJUSYNCMeshData> Meshes;
+    Builds.Reserve(MeshDataArray.Num());
+    Meshes.Reserve(MeshDataArray.Num());
+    for (int32 i = 0; i < MeshDataArray.Num(); ++i)
+    {
+        // Invalid entries count as failures right away instead of occupying the queue
+        if (!MeshComponents[i] || !MeshDataArray[i].IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to queue RealtimeMesh %d: %s"), i, *MeshDataArray[i].ElementName);
+            ++MeshBuildStats.Failed;
+            continue;
+        }
+        TUniquePtr<FJUSYNCMeshBuild> Build = MakeUnique<FJUSYNCMeshBuild>();
+        Build->Component = MeshComponents[i];
+        Build->ElementName = MeshDataArray[i].ElementName;
+        Build->QueuedSeconds = Now;
+        Build->Generation = Generation;
+        Builds.Add(MoveTemp(Build));
+        Meshes.Add(MoveTemp(MeshDataArray[i]));
+    }
 
-    for (int32 i = 0; i < StandardMesh.GetVertexCount(); ++i)
+    const int32 QueuedCount = Builds.Num();
+    if (QueuedCount == 0)
     {
-        FJUSYNCRealtimeMeshVertex Vertex;
-        Vertex.Position = StandardMesh.Vertices[i];
+        return 0;
+    }
 
-        if (i < StandardMesh.Normals.Num())
+    MeshBuildQueue->Converting += QueuedCount;
+    Async(EAsyncExecution::ThreadPool,
+          [Queue = MeshBuildQueue, Builds = MoveTemp(Builds), Meshes = MoveTemp(Meshes)]() mutable
+    {
+        ParallelFor(Builds.Num(), [&Queue, &Builds, &Meshes](int32 i)
         {
-            Vertex.Normal = StandardMesh.Normals[i];
-        }
-        else
+            // Cancelled batches skip the work; the commit ticker drops anything that slips through
+            if (Builds[i]->Generation == Queue->Generation.load())
+            {
+                BuildJUSYNCStreams(Meshes[i], Builds[i]->Streams);
+                Meshes[i] = FJUSYNCMeshData();
+                Queue->Ready.Enqueue(MoveTemp(Builds[i]));
+                ++Queue->ReadyCount;
+            }
+            --Queue->Converting;
+        });
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("Queued %d RealtimeMeshes for frame-budgeted creation"), QueuedCount);
+    return QueuedCount;
+}
+
+int32 UJUSYNCSubsystem::CancelQueuedRealtimeMeshes()
+{
+    if (!MeshBuildQueue)
+    {
+        return 0;
+    }
+
+    ++MeshBuildQueue->Generation;
+    int32 Dropped = MeshBuildQueue->Converting.load();
+    TUniquePtr<FJUSYNCMeshBuild> Build;
+    while (MeshBuildQueue->Ready.Dequeue(Build))
+    {
+        --MeshBuildQueue->ReadyCount;
+        ++Dropped;
+    }
+    return Dropped;
+}
+
+FJUSYNCMeshBuildStats UJUSYNCSubsystem::GetMeshBuildStats() const
+{
+    FJUSYNCMeshBuildStats Stats = MeshBuildStats;
+    if (MeshBuildQueue)
+    {
+        Stats.Converting = MeshBuildQueue->Converting.load();
+        Stats.ReadyToCommit = MeshBuildQueue->ReadyCount.load();
+    }
+    return Stats;
+}
+
+void UJUSYNCSubsystem::ResetMeshBuildStats()
+{
+    MeshBuildStats = FJUSYNCMeshBuildStats();
+    MeshBuildLatencySumMs = 0.0;
+}
+
+bool UJUSYNCSubsystem::TickMeshCommits(float DeltaTime)
+{
+    if (!MeshBuildQueue || MeshBuildQueue->ReadyCount.load() == 0)
+    {
+        return true;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(JUSYNC_CommitMeshes, JUSYNCChannel);
+    const double StartSeconds = FPlatformTime::Seconds();
+    const double BudgetSeconds = FMath::Max(MeshCommitBudgetMs, 0.1f) * 0.001;
+    const uint32 Generation = MeshBuildQueue->Generation.load();
+    int32 Commits = 0;
+    TUniquePtr<FJUSYNCMeshBuild> Build;
+
+    // At least one commit per frame, so a mesh that alone exceeds the budget still gets through
+    while ((Commits == 0 || FPlatformTime::Seconds() - StartSeconds < BudgetSeconds) && MeshBuildQueue->Ready.Dequeue(Build))
+    {
+        --MeshBuildQueue->ReadyCount;
+        if (Build->Generation != Generation)
         {
-            Vertex.Normal = FVector::UpVector;
+            continue;
         }
+        ++Commits;
 
-        if (i < StandardMesh.UVs.Num())
+        URealtimeMeshComponent* Component = Build->Component.Get();
+        if (Component && CommitJUSYNCStreams(Component, MoveTemp(Build->Streams)))
         {
-            Vertex.UV = StandardMesh.UVs[i];
+            const double LatencyMs = (FPlatformTime::Seconds() - Build->QueuedSeconds) * 1000.0;
+            ++MeshBuildStats.Committed;
+            MeshBuildLatencySumMs += LatencyMs;
+            MeshBuildStats.AverageLatencyMs = static_cast<float>(MeshBuildLatencySumMs / MeshBuildStats.Committed);
+            MeshBuildStats.MaxLatencyMs = FMath::Max(MeshBuildStats.MaxLatencyMs, static_cast<float>(LatencyMs));
         }
         else
         {
-            Vertex.UV = FVector2D::ZeroVector;
+            UE_LOG(LogTemp, Warning, TEXT("Failed to commit queued RealtimeMesh '%s' (component destroyed?)"), *Build->ElementName);
+            ++MeshBuildStats.Failed;
         }
+    }
 
-        // ✅ NEW: Handle vertex colors
-        if (i < StandardMesh.VertexColors.Num())
-        {
-            Vertex.Color = StandardMesh.VertexColors[i];
-        }
-        else
+    if (Commits > 0)
+    {
+        const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+        MeshBuildStats.LastFrameCommitMs = static_cast<float>(ElapsedSeconds * 1000.0);
+        MeshBuildStats.LastFrameCommits = Commits;
+        if (ElapsedSeconds > BudgetSeconds)
         {
-            Vertex.Color = FColor::White;
+            ++MeshBuildStats.FramesOverBudget;
         }
+    }
+    return true;
+}
+
+
+FJUSYNCRealtimeMeshData UJUSYNCSubsystem::ConvertToRealtimeMeshFormat(const FJUSYNCMeshData& StandardMesh)
+{
+    FJUSYNCRealtimeMeshData RealtimeMesh;
+    RealtimeMesh.ElementName = StandardMesh.ElementName;
 
-        RealtimeMesh.Vertices.Add(Vertex);
+    // Convert flat arrays to structured vertices; attribute ranges are resolved once, not per vertex
+    const int32 VertexCount = StandardMesh.GetVertexCount();
+    const int32 NormalCount = FMath::Min(StandardMesh.Normals.Num(), VertexCount);
+    const int32 UVCount = FMath::Min(StandardMesh.UVs.Num(), VertexCount);
+    const int32 ColorCount = FMath::Min(StandardMesh.VertexColors.Num(), VertexCount);
+
+    // Defaults (up normal, zero UV, white) cover vertices past the end of an attribute array
+    RealtimeMesh.Vertices.SetNum(VertexCount);
+    FJUSYNCRealtimeMeshVertex* Vertices = RealtimeMesh.Vertices.GetData();
+    for (int32 i = 0; i < VertexCount; ++i)
+    {
+        Vertices[i].Position = StandardMesh.Vertices[i];
+    }
+    for (int32 i = 0; i < NormalCount; ++i)
+    {
+        Vertices[i].Normal = StandardMesh.Normals[i];
+    }
+    for (int32 i = 0; i < UVCount; ++i)
+    {
+        Vertices[i].UV = StandardMesh.UVs[i];
+    }
+    for (int32 i = 0; i < ColorCount; ++i)
+    {
+        Vertices[i].Color = StandardMesh.VertexColors[i];
     }
 
     RealtimeMesh.Triangles = StandardMesh.Triangles;
@@ -1165,6 +2199,138 @@ AActor* UJUSYNCBlueprintLibrary::SpawnRealtimeMeshAtActor(const FJUSYNCMeshData&
     return SpawnRealtimeMeshAtLocation(MeshData, SpawnLocation, SpawnRotation);
 }
 
+// Build a transient static mesh from the shared (local-space) geometry of an instanced mesh
+static UStaticMesh* BuildStaticMeshFromJUSYNC(const FJUSYNCMeshData& MeshData, UObject* Outer, UMaterialInterface* Material)
+{
+    FMeshDescription MeshDescription;
+    FStaticMeshAttributes Attributes(MeshDescription);
+    Attributes.Register();
+
+    FMeshDescriptionBuilder Builder;
+    Builder.SetMeshDescription(&MeshDescription);
+    Builder.EnablePolyGroups();
+    Builder.SetNumUVLayers(1);
+
+    TArray<FVertexID> VertexIDs;
+    VertexIDs.Reserve(MeshData.Vertices.Num());
+    for (const FVector& Vertex : MeshData.Vertices)
+    {
+        VertexIDs.Add(Builder.AppendVertex(Vertex));
+    }
+
+    const FName SlotName(TEXT("PrimaryMaterial"));
+    const FPolygonGroupID PolygonGroup = Builder.AppendPolygonGroup(SlotName);
+    const int32 VertexCount = MeshData.Vertices.Num();
+
+    for (int32 Face = 0; Face < MeshData.GetTriangleCount(); ++Face)
+    {
+        FVertexInstanceID Corners[3];
+        bool bValid = true;
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const int32 Index = MeshData.Triangles[Face * 3 + Corner];
+            if (Index < 0 || Index >= VertexCount)
+            {
+                bValid = false;
+                break;
+            }
+
+            Corners[Corner] = Builder.AppendInstance(VertexIDs[Index]);
+            Builder.SetInstanceNormal(Corners[Corner],
+                MeshData.Normals.IsValidIndex(Index) ? MeshData.Normals[Index] : FVector::UpVector);
+            Builder.SetInstanceUV(Corners[Corner],
+                MeshData.UVs.IsValidIndex(Index) ? MeshData.UVs[Index] : FVector2D::ZeroVector, 0);
+            Builder.SetInstanceColor(Corners[Corner], FVector4f(FLinearColor(
+                MeshData.VertexColors.IsValidIndex(Index) ? MeshData.VertexColors[Index] : FColor::White)));
+        }
+
+        if (!bValid)
+        {
+            UE_LOG(LogTemp, Error, TEXT("❌ Invalid triangle %d in instanced mesh '%s'"), Face, *MeshData.ElementName);
+            continue;
+        }
+        Builder.AppendTriangle(Corners[0], Corners[1], Corners[2], PolygonGroup);
+    }
+
+    UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Outer, NAME_None, RF_Transient);
+    StaticMesh->GetStaticMaterials().Add(FStaticMaterial(Material, SlotName));
+
+    UStaticMesh::FBuildMeshDescriptionsParams Params;
+    Params.bBuildSimpleCollision = false;
+    Params.bFastBuild = true;
+    if (!StaticMesh->BuildFromMeshDescriptions({ &MeshDescription }, Params))
+    {
+        return nullptr;
+    }
+    return StaticMesh;
+}
+
+AActor* UJUSYNCBlueprintLibrary::SpawnInstancedMeshAtLocation(const FJUSYNCMeshData& MeshData, const FVector& SpawnLocation, const FRotator& SpawnRotation, UMaterialInterface* Material)
+{
+    if (!MeshData.IsInstanced())
+    {
+        return SpawnRealtimeMeshAtLocation(MeshData, SpawnLocation, SpawnRotation);
+    }
+
+    if (!MeshData.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid mesh data for spawning"));
+        return nullptr;
+    }
+
+    UJUSYNCSubsystem* Subsystem = GetJUSYNCSubsystem();
+    UWorld* World = Subsystem ? Subsystem->GetWorld() : nullptr;
+    if (!World)
+    {
+        UE_LOG(LogTemp, Error, TEXT("No valid world context for spawning"));
+        return nullptr;
+    }
+
+    if (!Material)
+    {
+        Material = LoadObject<UMaterial>(nullptr, TEXT("/Game/Materials/M_VertexColor"));
+        if (!Material)
+        {
+            Material = UMaterial::GetDefaultMaterial(MD_Surface);
+        }
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    AActor* SpawnedActor = World->SpawnActor<AActor>(SpawnParams);
+    if (!SpawnedActor)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to spawn actor"));
+        return nullptr;
+    }
+
+    UStaticMesh* StaticMesh = BuildStaticMeshFromJUSYNC(MeshData, SpawnedActor, Material);
+    if (!StaticMesh)
+    {
+        SpawnedActor->Destroy();
+        UE_LOG(LogTemp, Error, TEXT("Failed to build static mesh for '%s', destroying actor"), *MeshData.ElementName);
+        return nullptr;
+    }
+
+    UHierarchicalInstancedStaticMeshComponent* InstancedComp = NewObject<UHierarchicalInstancedStaticMeshComponent>(SpawnedActor);
+    InstancedComp->SetStaticMesh(StaticMesh);
+    InstancedComp->SetMaterial(0, Material);
+    SpawnedActor->SetRootComponent(InstancedComp);
+    InstancedComp->RegisterComponent();
+
+    SpawnedActor->SetActorLocation(SpawnLocation);
+    SpawnedActor->SetActorRotation(SpawnRotation);
+
+    // Instance transforms are relative to the actor, like the vertices of the RealtimeMesh path
+    InstancedComp->AddInstances(MeshData.InstanceTransforms, false);
+
+    UE_LOG(LogTemp, Warning, TEXT("✅ Instanced mesh spawned: %s (%d verts, %d instances) at %s"),
+           *MeshData.ElementName, MeshData.GetVertexCount(), MeshData.InstanceTransforms.Num(),
+           *SpawnedActor->GetActorLocation().ToString());
+    return SpawnedActor;
+}
+
 TArray<AActor*> UJUSYNCBlueprintLibrary::BatchSpawnRealtimeMeshesAtLocations(
     const TArray<FJUSYNCMeshData>& MeshDataArray,
     const TArray<FVector>& SpawnLocations,
@@ -1207,15 +2373,46 @@ TArray<AActor*> UJUSYNCBlueprintLibrary::BatchSpawnRealtimeMeshesAtLocations(
         return BatchSpawnRealtimeMeshesAtLocationsSync(MeshDataArray, SpawnLocations, FinalRotations);
     }
 
-    // Async spawning logic
+    // Async: actors are spawned right away, their meshes appear as the subsystem's frame-budgeted queue commits them
     UE_LOG(LogTemp, Warning, TEXT("🚀 Starting ASYNC batch spawn with rotations"));
-    TSharedPtr<TArray<AActor*>> SharedSpawnedActors = MakeShared<TArray<AActor*>>();
-    SharedSpawnedActors->Reserve(MeshDataArray.Num());
+    UJUSYNCSubsystem* Subsystem = GetJUSYNCSubsystem();
+    UWorld* World = Subsystem ? Subsystem->GetWorld() : nullptr;
+    if (!World)
+    {
+        UE_LOG(LogTemp, Error, TEXT("No world for async spawn"));
+        return TArray<AActor*>();
+    }
+
+    TArray<AActor*> SpawnedActors;
+    TArray<FJUSYNCMeshData> QueuedMeshes;
+    TArray<URealtimeMeshComponent*> QueuedComponents;
+    SpawnedActors.Reserve(MeshDataArray.Num());
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    for (int32 i = 0; i < MeshDataArray.Num(); ++i)
+    {
+        AActor* SpawnedActor = MeshDataArray[i].IsValid() ? World->SpawnActor<AActor>(SpawnParams) : nullptr;
+        SpawnedActors.Add(SpawnedActor);
+        if (!SpawnedActor)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to spawn actor for mesh %d: %s"), i, *MeshDataArray[i].ElementName);
+            continue;
+        }
 
-    AsyncBatchSpawnInternal(MeshDataArray, SpawnLocations, FinalRotations, SharedSpawnedActors,
-                           0, BatchSize, BatchDelay);
+        URealtimeMeshComponent* MeshComp = NewObject<URealtimeMeshComponent>(SpawnedActor);
+        SpawnedActor->SetRootComponent(MeshComp);
+        MeshComp->RegisterComponent();
+        SpawnedActor->SetActorLocation(SpawnLocations[i]);
+        SpawnedActor->SetActorRotation(ConvertParaViewToUERotation(FinalRotations[i]));
+
+        QueuedMeshes.Add(MeshDataArray[i]);
+        QueuedComponents.Add(MeshComp);
+    }
 
-    return TArray<AActor*>();
+    const int32 QueuedCount = Subsystem->QueueOwnedRealtimeMeshes(MoveTemp(QueuedMeshes), QueuedComponents);
+    UE_LOG(LogTemp, Warning, TEXT("🎉 Async batch spawn: %d/%d meshes queued"), QueuedCount, MeshDataArray.Num());
+    return SpawnedActors;
 }
 
 
@@ -41,6 +41,14 @@ public:
     static bool LoadUSDFromBuffer(const TArray<uint8>& Buffer, const FString& Filename, 
                                   TArray<FJUSYNCMeshData>& OutMeshData, FString& OutPreview);
 
+    // Parses a received file in place without copying its bytes
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC|USD")
+    static bool LoadUSDFromFileData(const FJUSYNCFileData& FileData, TArray<FJUSYNCMeshData>& OutMeshData);
+
+    // Copies a received file's bytes into an array (for nodes that take TArray<uint8>)
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC|Reception")
+    static bool GetFileDataBytes(const FJUSYNCFileData& FileData, TArray<uint8>& OutBytes);
+
     UFUNCTION(BlueprintCallable, Category = "JUSYNC|USD", CallInEditor)
     static bool LoadUSDFromDisk(const FString& FilePath, 
                                 TArray<FJUSYNCMeshData>& OutMeshData, FString& OutPreview);
@@ -51,6 +59,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "JUSYNC|USD")
     static bool ValidateUSDFormat(const TArray<uint8>& Buffer, const FString& Filename);
 
+    // Loaded meshes then carry InstanceTransforms for geometry placed more than once
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC|USD")
+    static void SetJUSYNCInstancingEnabled(bool bEnable);
+
     // ========== TEXTURE PROCESSING ==========
     UFUNCTION(BlueprintCallable, Category = "JUSYNC|Texture", CallInEditor)
     static FJUSYNCTextureData CreateTextureFromBuffer(const TArray<uint8>& Buffer);
@@ -86,6 +98,14 @@ public:
     static AActor* SpawnRealtimeMeshAtActor(const FJUSYNCMeshData& MeshData, 
                                            AActor* TargetActor);
 
+    // Instanced meshes become one hierarchical instanced static mesh component;
+    // meshes without InstanceTransforms fall back to SpawnRealtimeMeshAtLocation
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC|RealtimeMesh Spawning", CallInEditor)
+    static AActor* SpawnInstancedMeshAtLocation(const FJUSYNCMeshData& MeshData,
+                                                const FVector& SpawnLocation,
+                                                const FRotator& SpawnRotation = FRotator::ZeroRotator,
+                                                UMaterialInterface* Material = nullptr);
+
 
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBatchSpawnProgress, 
 	const TArray<AActor*>&, SpawnedActors, float, Progress);
@@ -93,6 +113,8 @@ public:
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBatchSpawnComplete, 
 		const TArray<AActor*>&, SpawnedActors, bool, bSuccess);
 	
+	// Async spawning returns the actors right away and queues their meshes on the subsystem, which
+	// commits them within MeshCommitBudgetMs per frame; BatchSize and BatchDelay are no longer used
 	UFUNCTION(BlueprintCallable, Category = "JUSYNC|RealtimeMesh Spawning", CallInEditor)
 	static TArray<AActor*> BatchSpawnRealtimeMeshesAtLocations(
 		const TArray<FJUSYNCMeshData>& MeshDataArray,
@@ -199,14 +221,4 @@ private:
     static bool ValidateBufferSize(const TArray<uint8>& Buffer, const FString& Context);
     static bool ValidateFilePath(const FString& FilePath, const FString& Context);
     static FString ExtractUSDAPreview(const TArray<uint8>& Buffer, int32 MaxLines);
-
-	static void AsyncBatchSpawnInternal(
-			const TArray<FJUSYNCMeshData>& MeshDataArray,
-			const TArray<FVector>& SpawnLocations,
-			const TArray<FRotator>& SpawnRotations,
-			TSharedPtr<TArray<AActor*>> SharedResults,
-			int32 CurrentBatch,
-			int32 BatchSize,
-			float BatchDelay
-		);
 };
@@ -10,6 +10,7 @@
 #include "MaterialDomain.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/MaterialInterface.h"
+#include "Containers/Ticker.h"
 
 #ifdef WITH_ANARI_USD_MIDDLEWARE
 #include "AnariUsdMiddleware.h"
@@ -19,6 +20,7 @@
 
 // Forward declarations
 class URealtimeMeshComponent;
+struct FJUSYNCMeshBuildQueue;
 
 UCLASS()
 class JUSYNC_API UJUSYNCSubsystem : public UGameInstanceSubsystem
@@ -44,6 +46,21 @@ public:
     UFUNCTION(BlueprintPure, Category = "JUSYNC")
     FString GetStatusInfo() const;
 
+    // Latency percentiles of every middleware pipeline stage, from receive to file callbacks
+    UFUNCTION(BlueprintPure, Category = "JUSYNC")
+    TArray<FJUSYNCStageStats> GetStageStats() const;
+
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC")
+    void ResetStageStats();
+
+    // Record the middleware stages of every file; WriteStageTrace saves them as Chrome trace JSON
+    // for ui.perfetto.dev. Plugin-side work is on the JUSYNC Unreal Insights channel either way
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC")
+    void SetStageTraceCapture(bool bEnable, int32 MaxEvents = 100000);
+
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC")
+    bool WriteStageTrace(const FString& FilePath);
+
     // Data Reception
     UFUNCTION(BlueprintCallable, Category = "JUSYNC")
     bool StartReceiving();
@@ -64,23 +81,145 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "JUSYNC Events")
     FJUSYNCError OnError;
 
+    // Fired on the game thread after a received USD file was diffed against its previous version
+    UPROPERTY(BlueprintAssignable, Category = "JUSYNC Events")
+    FJUSYNCSceneDeltaReceived OnSceneDelta;
+
+    // Scene Deltas (read by InitializeMiddleware; the middleware then parses every received USD file)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JUSYNC Scene")
+    bool bEnableSceneDeltas = false;
+
+    // Apply each delta to the bound components before OnSceneDelta is broadcast
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JUSYNC Scene")
+    bool bAutoApplySceneDeltas = true;
+
+    // Rebuild changed meshes, spawn added ones and destroy removed ones; returns meshes touched
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Scene")
+    int32 ApplySceneDelta(const FJUSYNCSceneDelta& Delta);
+
+    // Track a component as the one showing Key of Filename, so deltas update it in place
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Scene")
+    void BindSceneMeshComponent(const FString& Filename, const FString& Key, URealtimeMeshComponent* Component);
+
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Scene")
+    void ClearSceneHistory();
+
+    // Move the bound components of FileData's meshes to their transforms at TimeCode without
+    // re-extracting geometry (meshes should be loaded in local-space mode); returns components moved
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Scene")
+    int32 ApplySceneTransformsAtTime(const FJUSYNCFileData& FileData, float TimeCode);
+
+    // Fired on the game thread for every level of a progressively delivered mesh
+    UPROPERTY(BlueprintAssignable, Category = "JUSYNC Events")
+    FJUSYNCMeshLodReceived OnMeshLod;
+
+    // Progressive LODs (read by InitializeMiddleware): large meshes arrive as a coarse
+    // vertex-clustered level first and are refined in the background
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JUSYNC LOD")
+    bool bEnableProgressiveLods = false;
+
+    // Levels per mesh including full resolution (1-8)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JUSYNC LOD", meta = (ClampMin = "1", ClampMax = "8"))
+    int32 LodLevelCount = 3;
+
+    // Meshes with fewer triangles are sent at full resolution only
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JUSYNC LOD", meta = (ClampMin = "0"))
+    int32 LodMinTriangles = 100000;
+
+    // Show each level on the bound component before OnMeshLod is broadcast
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JUSYNC LOD")
+    bool bAutoApplyMeshLods = true;
+
+    // Show a coarse level right away (spawning and binding a component if needed); the
+    // full-resolution level then replaces it with an LOD chain of all levels received
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC LOD")
+    bool ApplyMeshLod(const FJUSYNCMeshLod& Lod);
+
     // USD Processing
     UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
     bool LoadUSDFromBuffer(const TArray<uint8>& Buffer, const FString& Filename, TArray<FJUSYNCMeshData>& OutMeshData);
 
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
+    bool LoadUSDFromFileData(const FJUSYNCFileData& FileData, TArray<FJUSYNCMeshData>& OutMeshData);
+
     UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
     bool LoadUSDFromDisk(const FString& FilePath, TArray<FJUSYNCMeshData>& OutMeshData);
 
+    // Emit shared geometry once with InstanceTransforms instead of one baked copy per placement
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
+    void SetInstancingEnabled(bool bEnable);
+
+    // Keep points in local space and carry each mesh's placement as its single InstanceTransform,
+    // so scene deltas of moved prims only update component transforms
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
+    void SetLocalSpaceEnabled(bool bEnable);
+
+    // Weld duplicate vertices and reorder indices for the GPU vertex cache before meshes are handed over
+    // (WeldEpsilon 0 welds exact duplicates only); vertex and ACMR savings show up in GetStatusInfo
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
+    void SetMeshOptimizationEnabled(bool bEnable, float WeldEpsilon = 0.0f);
+
+    // Keep meshes extracted by LoadUSDFromDisk* in Directory so a restart skips the parse; keyed on the
+    // file's path, size and modification time (edits to referenced layers alone are not detected).
+    // An empty Directory disables the cache
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
+    bool ConfigureMeshDiskCache(const FString& Directory, int64 MaxBytes = 4294967296);
+
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
+    void ClearMeshDiskCache();
+
+    // Asynchronous loads run on the middleware's load threads; both callbacks are called on the game thread
+    using FUSDLoadProgress = TFunction<void(float Progress)>;
+    using FUSDLoadComplete = TFunction<void(bool bSuccess, TArray<FJUSYNCMeshData>&& Meshes)>;
+
+    // Queue a load without blocking; a newer load of the same file cancels this one (reported as failure).
+    // Returns the load id for CancelUSDLoad, 0 if the load could not be queued
+    int64 LoadUSDFromBufferAsync(const TArray<uint8>& Buffer, const FString& Filename,
+                                 FUSDLoadProgress OnProgress, FUSDLoadComplete OnComplete);
+
+    int64 LoadUSDFromDiskAsync(const FString& FilePath, FUSDLoadProgress OnProgress, FUSDLoadComplete OnComplete);
+
+    // Stop a queued or running asynchronous load at the next prim or mesh
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC USD")
+    bool CancelUSDLoad(int64 LoadId);
+
+    // Shared implementation for owned buffers and zero-copy received payloads
+    bool LoadUSDFromBytes(const uint8* Bytes, int64 NumBytes, const FString& Filename, TArray<FJUSYNCMeshData>& OutMeshData);
+
     // Texture Processing
     UFUNCTION(BlueprintCallable, Category = "JUSYNC Texture")
     FJUSYNCTextureData CreateTextureFromBuffer(const TArray<uint8>& Buffer);
 
+    // Decodes a received IMAGE file in place; its hash keys the middleware's texture cache,
+    // so identical textures from shared material libraries are decoded once
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Texture")
+    FJUSYNCTextureData CreateTextureFromFileData(const FJUSYNCFileData& FileData);
+
+    // MaxEntries 0 disables the memory cache; an empty Directory disables the disk cache
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Texture")
+    bool ConfigureTextureCache(int32 MaxEntries = 256, int64 MaxBytes = 268435456, const FString& Directory = TEXT(""));
+
+    // Shared implementation for owned buffers and zero-copy received payloads
+    FJUSYNCTextureData CreateTextureFromBytes(const uint8* Bytes, int64 NumBytes, const FString& ContentHash);
+
     UFUNCTION(BlueprintCallable, Category = "JUSYNC Texture")
     bool WriteGradientLineAsPNG(const TArray<uint8>& Buffer, const FString& OutputPath);
 
     UFUNCTION(BlueprintCallable, Category = "JUSYNC Texture")
     bool GetGradientLineAsPNGBuffer(const TArray<uint8>& Buffer, TArray<uint8>& OutPNGBuffer);
 
+    // Decode with an optional mip chain and BC1/BC3 compression (BC3 only when the image has alpha)
+    // and copy the levels straight into the texture's platform data; bSRGB false for data textures
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Texture")
+    UTexture2D* CreateGpuTextureFromBuffer(const TArray<uint8>& Buffer, bool bGenerateMips = true,
+                                           bool bCompress = true, bool bSRGB = true);
+
+    // Decode and compress several images in parallel off the game thread; the textures are created
+    // on the game thread and passed to OnComplete in buffer order (nullptr for images that failed)
+    using FGpuTexturesComplete = TFunction<void(TArray<UTexture2D*>&& Textures)>;
+    void CreateGpuTexturesAsync(TArray<TArray<uint8>>&& Buffers, bool bGenerateMips, bool bCompress, bool bSRGB,
+                                FGpuTexturesComplete OnComplete);
+
     // RealtimeMesh Integration
     UFUNCTION(BlueprintCallable, Category = "JUSYNC Mesh")
     bool CreateRealtimeMeshFromJUSYNC(
@@ -89,9 +228,35 @@ public:
     );
     
     
+    // Build one RealtimeMesh LOD per entry; LODs[0] is the finest, each next one is used at half the screen size
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Mesh")
+    bool CreateRealtimeMeshLODsFromJUSYNC(const TArray<FJUSYNCMeshData>& LODs, URealtimeMeshComponent* RealtimeMeshComponent);
+
     UFUNCTION(BlueprintCallable, Category = "JUSYNC Mesh")
     bool BatchCreateRealtimeMeshesFromJUSYNC(const TArray<FJUSYNCMeshData>& MeshDataArray, const TArray<URealtimeMeshComponent*>& MeshComponents);
 
+    // Frame-budgeted creation: streams are built on worker threads and committed on the game thread,
+    // MeshCommitBudgetMs per frame (at least one mesh per frame); returns the number of meshes queued
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Mesh")
+    int32 QueueRealtimeMeshes(const TArray<FJUSYNCMeshData>& MeshDataArray, const TArray<URealtimeMeshComponent*>& MeshComponents);
+
+    // QueueRealtimeMeshes taking over the mesh data instead of copying it
+    int32 QueueOwnedRealtimeMeshes(TArray<FJUSYNCMeshData>&& MeshDataArray, const TArray<URealtimeMeshComponent*>& MeshComponents);
+
+    // Drop every queued mesh that is not committed yet; returns the number dropped
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Mesh")
+    int32 CancelQueuedRealtimeMeshes();
+
+    UFUNCTION(BlueprintPure, Category = "JUSYNC Mesh")
+    FJUSYNCMeshBuildStats GetMeshBuildStats() const;
+
+    UFUNCTION(BlueprintCallable, Category = "JUSYNC Mesh")
+    void ResetMeshBuildStats();
+
+    // Game-thread time per frame for committing queued meshes
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JUSYNC Mesh", meta = (ClampMin = "0.1"))
+    float MeshCommitBudgetMs = 4.0f;
+
     // Conversion utilities for RealtimeMesh
     UFUNCTION(BlueprintCallable, Category = "JUSYNC Mesh")
     FJUSYNCRealtimeMeshData ConvertToRealtimeMeshFormat(const FJUSYNCMeshData& StandardMesh);
@@ -116,6 +281,20 @@ private:
     mutable FCriticalSection MiddlewareMutex;
     std::atomic<bool> bIsInitialized{ false };
 
+    // Components showing delta-tracked meshes, keyed "Filename|Key" (game thread only)
+    TMap<FString, TWeakObjectPtr<URealtimeMeshComponent>> SceneMeshComponents;
+
+    // Coarse levels received so far per "Filename|Key", indexed by level (game thread only)
+    TMap<FString, TArray<FJUSYNCMeshData>> PendingMeshLods;
+
+    // Frame-budgeted mesh creation; the queue is shared with the conversion tasks
+    TSharedPtr<FJUSYNCMeshBuildQueue, ESPMode::ThreadSafe> MeshBuildQueue;
+    FTSTicker::FDelegateHandle MeshCommitTickHandle;
+    FJUSYNCMeshBuildStats MeshBuildStats;   // game thread only, queue depths are filled in on read
+    double MeshBuildLatencySumMs = 0.0;
+
+    bool TickMeshCommits(float DeltaTime);
+
     // Legacy callback handlers (kept for compatibility)
     void HandleFileReceived(const anari_usd_middleware::AnariUsdMiddleware::FileData& FileData);
     void HandleMessageReceived(const std::string& Message);
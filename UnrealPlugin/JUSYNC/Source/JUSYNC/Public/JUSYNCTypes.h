@@ -8,6 +8,35 @@
 class UProceduralMeshComponent;
 class URealtimeMeshComponent;
 
+// Read-only bytes shared with the middleware; the release hook runs when the last reference goes away
+class FJUSYNCFilePayload
+{
+public:
+    FJUSYNCFilePayload(const uint8* InBytes, int64 InNumBytes, TFunction<void()> InOnRelease)
+        : Bytes(InBytes), NumBytes(InNumBytes), OnRelease(MoveTemp(InOnRelease))
+    {
+    }
+
+    ~FJUSYNCFilePayload()
+    {
+        if (OnRelease)
+        {
+            OnRelease();
+        }
+    }
+
+    FJUSYNCFilePayload(const FJUSYNCFilePayload&) = delete;
+    FJUSYNCFilePayload& operator=(const FJUSYNCFilePayload&) = delete;
+
+    const uint8* GetData() const { return Bytes; }
+    int64 Num() const { return NumBytes; }
+
+private:
+    const uint8* Bytes;
+    int64 NumBytes;
+    TFunction<void()> OnRelease;
+};
+
 USTRUCT(BlueprintType)
 struct JUSYNC_API FJUSYNCFileData
 {
@@ -16,9 +45,14 @@ struct JUSYNC_API FJUSYNCFileData
     UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
     FString Filename;
 
+    // Owned copy of the bytes. Empty for files received from the network, which are
+    // carried in Payload instead; use GetBytes()/GetNumBytes() to read either.
     UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
     TArray<uint8> Data;
 
+    // Zero-copy bytes received from the middleware (not exposed to Blueprint)
+    TSharedPtr<FJUSYNCFilePayload, ESPMode::ThreadSafe> Payload;
+
     UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
     FString Hash;
 
@@ -32,10 +66,25 @@ struct JUSYNC_API FJUSYNCFileData
         FileType = TEXT("");
     }
 
+    const uint8* GetBytes() const
+    {
+        return Payload.IsValid() ? Payload->GetData() : Data.GetData();
+    }
+
+    int64 GetNumBytes() const
+    {
+        return Payload.IsValid() ? Payload->Num() : Data.Num();
+    }
+
+    TArrayView64<const uint8> GetBytesView() const
+    {
+        return TArrayView64<const uint8>(GetBytes(), GetNumBytes());
+    }
+
     bool IsValid() const
     {
         return !Filename.IsEmpty() &&
-               Data.Num() > 0 &&
+               GetNumBytes() > 0 &&
                !Hash.IsEmpty() &&
                !FileType.IsEmpty();
     }
@@ -67,6 +116,10 @@ struct JUSYNC_API FJUSYNCMeshData
     UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
     TArray<FColor> VertexColors;  // ADD THIS LINE
 
+    // Instancing mode: one world transform per placement, vertices are then in local space
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    TArray<FTransform> InstanceTransforms;
+
     // Update validation and helper functions
     bool HasVertexColors() const {
         return VertexColors.Num() > 0;
@@ -91,6 +144,7 @@ struct JUSYNC_API FJUSYNCMeshData
 
     bool HasNormals() const { return Normals.Num() > 0; }
     bool HasUVs() const { return UVs.Num() > 0; }
+    bool IsInstanced() const { return InstanceTransforms.Num() > 0; }
 };
 
 // RealtimeMesh-specific vertex structure
@@ -189,7 +243,147 @@ struct JUSYNC_API FJUSYNCTextureData
     }
 };
 
+// One added or changed mesh of a scene delta
+USTRUCT(BlueprintType)
+struct JUSYNC_API FJUSYNCMeshChange
+{
+    GENERATED_BODY()
+
+    // Stable identity across versions: element name, "#n" appended to the n-th repeat
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    FString Key;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    FJUSYNCMeshData Mesh;
+
+    // False when only the instance transforms moved
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    bool bGeometryChanged = true;
+};
+
+// What changed between two versions of one received USD file
+USTRUCT(BlueprintType)
+struct JUSYNC_API FJUSYNCSceneDelta
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    FString Filename;
+
+    // 1 for the first version seen under this filename
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int64 Revision = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    TArray<FJUSYNCMeshChange> Added;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    TArray<FJUSYNCMeshChange> Changed;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    TArray<FString> Removed;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int32 UnchangedCount = 0;
+};
+
+// One level of detail of a received mesh; levels arrive coarsest first and level 0 last
+USTRUCT(BlueprintType)
+struct JUSYNC_API FJUSYNCMeshLod
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    FString Filename;
+
+    // Same key as the scene delta entry of the mesh
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    FString Key;
+
+    // 0 = full resolution, LevelCount - 1 = coarsest
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int32 Level = 0;
+
+    // 1 for meshes sent at full resolution only
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int32 LevelCount = 1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    FJUSYNCMeshData Mesh;
+};
+
+// Queue and timing counters of the frame-budgeted RealtimeMesh scheduler
+USTRUCT(BlueprintType)
+struct JUSYNC_API FJUSYNCMeshBuildStats
+{
+    GENERATED_BODY()
+
+    // Queued meshes whose streams are still being built on worker threads
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int32 Converting = 0;
+
+    // Built meshes waiting for their game-thread commit
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int32 ReadyToCommit = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int64 Committed = 0;
+
+    // Invalid mesh data or a component destroyed before its commit
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int64 Failed = 0;
+
+    // Game-thread time spent committing in the last frame that had work
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    float LastFrameCommitMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int32 LastFrameCommits = 0;
+
+    // Frames whose commits ran past MeshCommitBudgetMs (a single large mesh always commits)
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int64 FramesOverBudget = 0;
+
+    // Time from QueueRealtimeMeshes to the mesh being visible
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    float AverageLatencyMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    float MaxLatencyMs = 0.0f;
+};
+
+// Latency of one middleware pipeline stage; percentiles are within 12.5% of the exact value
+USTRUCT(BlueprintType)
+struct JUSYNC_API FJUSYNCStageStats
+{
+    GENERATED_BODY()
+
+    // e.g. "receive", "hash", "parse", "extract", "callback"
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    FString Stage;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    int64 Count = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    float MeanMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    float P50Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    float P95Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    float P99Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JUSYNC")
+    float MaxMs = 0.0f;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FJUSYNCFileReceived, const FJUSYNCFileData&, FileData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FJUSYNCMessageReceived, const FString&, Message);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FJUSYNCProcessingProgress, float, Progress, const FString&, Status);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FJUSYNCError, const FString&, ErrorType, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FJUSYNCSceneDeltaReceived, const FJUSYNCSceneDelta&, Delta);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FJUSYNCMeshLodReceived, const FJUSYNCMeshLod&, Lod);
@@ -24,10 +24,11 @@ extern "C" {
 // C-compatible structures (no STL)
 typedef struct {
     char filename[256];
-    unsigned char* data;
+    const unsigned char* data;  // Shared, read-only; valid during callback or until ReleaseFileData_C
     size_t data_size;
     char hash[64];
     char file_type[32];
+    void* payload;              // Opaque reference keeping data alive
 } CFileData;
 
 typedef struct {
@@ -41,6 +42,10 @@ typedef struct {
     size_t normals_count;
     float* uvs;                // Flat array: [u1,v1, u2,v2, ...]
     size_t uvs_count;
+    float* vertex_colors;      // Flat array: [r1,g1,b1,a1, ...] in [0, 1]
+    size_t vertex_colors_count;
+    float* instance_transforms; // Column-major 4x4 per placement (instancing mode), NULL otherwise
+    size_t instance_transforms_count;
 } CMeshData;
 
 typedef struct {
@@ -51,9 +56,114 @@ typedef struct {
     size_t data_size;
 } CTextureData;
 
+typedef enum {
+    TEXTURE_FORMAT_RGBA8 = 0,
+    TEXTURE_FORMAT_BC1 = 1,     // DXT1
+    TEXTURE_FORMAT_BC3 = 2      // DXT5
+} CTextureFormat;
+
+typedef enum {
+    TEXTURE_COMPRESSION_NONE = 0,
+    TEXTURE_COMPRESSION_BC1 = 1,
+    TEXTURE_COMPRESSION_BC3 = 2,
+    TEXTURE_COMPRESSION_AUTO = 3 // BC1 when opaque, BC3 otherwise
+} CTextureCompression;
+
+typedef struct {
+    int generate_mips;
+    CTextureCompression compression;
+    int linear;                 // Non-zero: mips filtered without sRGB decoding
+    int high_quality;
+} CTextureOptions;
+
+typedef struct {
+    int width;
+    int height;
+    size_t offset;              // Bytes within CGpuTexture::data
+    size_t size;
+} CTextureMip;
+
+typedef struct {
+    int width;
+    int height;
+    CTextureFormat format;
+    const CTextureMip* mips;    // Level 0 first
+    size_t mip_count;
+    const unsigned char* data;
+    size_t data_size;
+    void* internal;
+} CGpuTexture;
+
+typedef struct {
+    char key[256];              // Scene delta key of the mesh
+    float matrix[16];           // Column-major 4x4 world transform
+} CMeshTransform;
+
+typedef struct {
+    const char* key;            // Element name, "#n" appended to the n-th repeat
+    CMeshData mesh;             // Borrowed: valid only during the callback
+    int geometry_changed;       // 0 when only instance_transforms differ
+} CMeshChange;
+
+typedef struct {
+    const char* filename;
+    uint64_t revision;          // 1 for the first version of a filename
+    const CMeshChange* added;
+    size_t added_count;
+    const CMeshChange* changed;
+    size_t changed_count;
+    const char* const* removed; // Keys of meshes no longer present
+    size_t removed_count;
+    size_t unchanged_count;
+} CSceneDelta;
+
+typedef struct {
+    const char* filename;
+    const char* key;            // Scene delta key of the mesh
+    unsigned int level;         // 0 = full resolution, level_count - 1 = coarsest
+    unsigned int level_count;   // 1 for meshes sent at full resolution only
+    CMeshData mesh;             // Borrowed: valid only during the callback
+} CMeshLod;
+
+typedef enum {
+    LOAD_STATE_QUEUED = 0,
+    LOAD_STATE_RUNNING = 1,
+    LOAD_STATE_COMPLETED = 2,
+    LOAD_STATE_FAILED = 3,
+    LOAD_STATE_CANCELLED = 4    // Cancelled, superseded by a newer load of the file, or shutdown
+} CLoadState;
+
+typedef void (*LoadTask_C)(void* task_data);
+typedef void (*LoadExecutor_C)(LoadTask_C task, void* task_data, void* user_data);
+typedef void (*LoadProgressCallback_C)(uint64_t load_id, float progress, const char* stage, void* user_data);
+typedef void (*LoadCompleteCallback_C)(uint64_t load_id, CLoadState state,
+                                       const CMeshData* meshes, size_t count, void* user_data);
+typedef int (*MeshStreamCallback_C)(const CMeshData* mesh, void* user_data); // Borrowed; 0 stops the load
+
+typedef struct {
+    LoadCompleteCallback_C on_complete; // Meshes borrowed: valid only during the callback
+    LoadProgressCallback_C on_progress;
+    LoadExecutor_C executor;    // NULL calls both callbacks on the load thread
+    void* user_data;
+    int cancel_previous;        // Non-zero cancels unfinished loads of the same filename
+    MeshStreamCallback_C on_mesh; // Streams meshes on the load thread; on_complete then receives none
+} CAsyncLoadOptions;
+
+typedef struct {
+    char name[32];              // Pipeline stage, e.g. "parse"
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t p50_ns;
+    uint64_t p95_ns;
+    uint64_t p99_ns;
+} CStageStats;
+
 // Callback function types
 typedef void (*FileReceivedCallback_C)(const CFileData* file_data);
 typedef void (*MessageReceivedCallback_C)(const char* message);
+typedef void (*SceneDeltaCallback_C)(const CSceneDelta* delta);
+typedef void (*MeshLodCallback_C)(const CMeshLod* lod);
 
 // Core middleware functions
 ANARI_USD_MIDDLEWARE_C_API int InitializeMiddleware_C(const char* endpoint);
@@ -74,10 +184,56 @@ ANARI_USD_MIDDLEWARE_C_API int LoadUSDFromDisk_C(const char* filepath,
                                                   CMeshData** out_meshes,
                                                   size_t* out_count);
 
+ANARI_USD_MIDDLEWARE_C_API uint64_t LoadUSDBufferAsync_C(const unsigned char* buffer,
+                                                        size_t buffer_size,
+                                                        const char* filename,
+                                                        const CAsyncLoadOptions* options);
+ANARI_USD_MIDDLEWARE_C_API uint64_t LoadUSDFromDiskAsync_C(const char* filepath,
+                                                          const CAsyncLoadOptions* options);
+ANARI_USD_MIDDLEWARE_C_API int CancelLoad_C(uint64_t load_id);
+
+ANARI_USD_MIDDLEWARE_C_API void SetInstancingEnabled_C(int enable);
+ANARI_USD_MIDDLEWARE_C_API void SetLocalSpaceEnabled_C(int enable);
+ANARI_USD_MIDDLEWARE_C_API void SetMeshOptimizationEnabled_C(int enable);
+ANARI_USD_MIDDLEWARE_C_API void SetWeldEpsilon_C(float epsilon);
+ANARI_USD_MIDDLEWARE_C_API void SetTimeCode_C(double time_code);
+
+ANARI_USD_MIDDLEWARE_C_API int EvaluateTransforms_C(const unsigned char* buffer,
+                                                    size_t buffer_size,
+                                                    const char* filename,
+                                                    double time_code,
+                                                    CMeshTransform** out_transforms,
+                                                    size_t* out_count);
+
+ANARI_USD_MIDDLEWARE_C_API void PackVertexColors_C(const float* rgba, size_t count,
+                                                   unsigned char* out_bytes, int bgra);
+
 // Texture processing functions
 ANARI_USD_MIDDLEWARE_C_API CTextureData CreateTextureFromBuffer_C(const unsigned char* buffer,
                                                                    size_t buffer_size);
 
+ANARI_USD_MIDDLEWARE_C_API CTextureData CreateTextureFromBufferWithHash_C(const unsigned char* buffer,
+                                                                           size_t buffer_size,
+                                                                           const char* content_hash);
+
+ANARI_USD_MIDDLEWARE_C_API int ConfigureTextureCache_C(size_t max_entries, size_t max_bytes, const char* directory);
+
+ANARI_USD_MIDDLEWARE_C_API int ConfigureMeshDiskCache_C(const char* directory, uint64_t max_bytes);
+ANARI_USD_MIDDLEWARE_C_API void ClearMeshDiskCache_C(void);
+
+// Stage latency and trace export
+ANARI_USD_MIDDLEWARE_C_API size_t GetStageStats_C(CStageStats* out_stats, size_t capacity);
+ANARI_USD_MIDDLEWARE_C_API void ResetStageStats_C(void);
+ANARI_USD_MIDDLEWARE_C_API void SetTraceCapture_C(int enable, size_t max_events);
+ANARI_USD_MIDDLEWARE_C_API int WriteTrace_C(const char* path);
+
+ANARI_USD_MIDDLEWARE_C_API int CreateGpuTexture_C(const unsigned char* buffer, size_t buffer_size,
+                                                   const CTextureOptions* options, CGpuTexture* out_texture);
+ANARI_USD_MIDDLEWARE_C_API size_t CreateGpuTextures_C(const unsigned char* const* buffers,
+                                                       const size_t* buffer_sizes, size_t count,
+                                                       const CTextureOptions* options, size_t thread_count,
+                                                       CGpuTexture* out_textures);
+
 ANARI_USD_MIDDLEWARE_C_API int WriteGradientLineAsPNG_C(const unsigned char* buffer,
                                                          size_t buffer_size,
                                                          const char* output_path);
@@ -89,13 +245,21 @@ ANARI_USD_MIDDLEWARE_C_API int GetGradientLineAsPNGBuffer_C(const unsigned char*
 
 // Memory management functions
 ANARI_USD_MIDDLEWARE_C_API void FreeMeshData_C(CMeshData* meshes, size_t count);
+ANARI_USD_MIDDLEWARE_C_API void FreeMeshTransforms_C(CMeshTransform* transforms);
 ANARI_USD_MIDDLEWARE_C_API void FreeTextureData_C(CTextureData* texture);
+ANARI_USD_MIDDLEWARE_C_API void FreeGpuTexture_C(CGpuTexture* texture);
 ANARI_USD_MIDDLEWARE_C_API void FreeBuffer_C(unsigned char* buffer);
     ANARI_USD_MIDDLEWARE_C_API void FreeFileData_C(CFileData* file_data);
+ANARI_USD_MIDDLEWARE_C_API CFileData* RetainFileData_C(const CFileData* file_data);
+ANARI_USD_MIDDLEWARE_C_API void ReleaseFileData_C(CFileData* file_data);
 
 // Callback registration
 ANARI_USD_MIDDLEWARE_C_API void RegisterUpdateCallback_C(FileReceivedCallback_C callback);
 ANARI_USD_MIDDLEWARE_C_API void RegisterMessageCallback_C(MessageReceivedCallback_C callback);
+ANARI_USD_MIDDLEWARE_C_API void RegisterSceneDeltaCallback_C(SceneDeltaCallback_C callback);
+ANARI_USD_MIDDLEWARE_C_API void ClearSceneHistory_C(void);
+ANARI_USD_MIDDLEWARE_C_API void RegisterMeshLodCallback_C(MeshLodCallback_C callback);
+ANARI_USD_MIDDLEWARE_C_API void SetLodOptions_C(unsigned int level_count, size_t min_triangles);
 
 #ifdef __cplusplus
 }
@@ -107,8 +107,8 @@ public:
 
     /**
      * Initializes the ZeroMQ connection with enhanced error handling and fallback endpoints.
-     * @param endpoint The ZeroMQ endpoint to bind to (e.g., "tcp://*:13456").
-     *                 If null, defaults to "tcp://*:5556".
+     * @param endpoint The ZeroMQ endpoint to bind to (e.g., "tcp://0.0.0.0:13456").
+     *                 If null, binds port 5556 on all interfaces.
      * @param timeoutMs Connection timeout in milliseconds (default: 5000ms)
      * @return True if initialization was successful, false otherwise.
      */
@@ -12,6 +12,8 @@
 #include <chrono>
 
 #include "MiddlewareLogging.h"
+#include "FilePayload.h"
+#include "StageProfiler.h"
 
 #ifndef ANARI_USD_MIDDLEWARE_API
 #ifdef _WIN32
@@ -36,7 +38,7 @@ public:
     // File data structure with validation
     struct FileData {
         std::string filename;
-        std::vector<uint8_t> data;
+        FilePayload data;           // Shared, read-only bytes of the received content frame
         std::string hash;
         std::string fileType;
 
@@ -44,7 +46,7 @@ public:
         bool isValid() const {
             return !filename.empty() &&
                    !data.empty() &&
-                   data.size() <= safety::MAX_BUFFER_SIZE &&
+                   data.size() <= safety::MAX_STREAMED_FILE_SIZE &&
                    !hash.empty() &&
                    !fileType.empty();
         }
@@ -52,7 +54,7 @@ public:
         // Clear all data safely
         void clear() {
             filename.clear();
-            data.clear();
+            data.reset();
             hash.clear();
             fileType.clear();
         }
@@ -67,6 +69,8 @@ public:
         std::vector<float> normals;   // Flat array: [nx1,ny1,nz1, nx2,ny2,nz2, ...]
         std::vector<float> uvs;       // Flat array: [u1,v1, u2,v2, ...]
         std::vector<float> vertex_colors; // (r,g,b,a,r,g,b,a...)
+        std::vector<float> instance_transforms; // Instancing/local-space mode: 16 floats (column-major 4x4) per
+                                                // placement; empty when the points are already in world space
 
         // Validation method
         bool isValid() const {
@@ -77,7 +81,8 @@ public:
                    (indices.size() % 3 == 0) &&
                    (normals.empty() || normals.size() % 3 == 0) &&
                    (uvs.empty() || uvs.size() % 2 == 0) &&
-                   (vertex_colors.empty() || vertex_colors.size() % 4 == 0);
+                   (vertex_colors.empty() || vertex_colors.size() % 4 == 0) &&
+                   (instance_transforms.size() % 16 == 0);
         }
 
         size_t getVertexCount() const {
@@ -88,6 +93,10 @@ public:
             return indices.size() / 3;
         }
 
+        size_t getInstanceCount() const {
+            return instance_transforms.size() / 16;
+        }
+
         // Clear all data safely
         void clear() {
             elementName.clear();
@@ -97,6 +106,7 @@ public:
             normals.clear();
             uvs.clear();
             vertex_colors.clear();
+            instance_transforms.clear();
         }
     };
 
@@ -125,9 +135,153 @@ public:
         }
     };
 
+    // Where one mesh's attributes live inside a MeshArena. Offsets are bytes from
+    // MeshArena::data, counts are elements in the same flat layout as MeshData.
+    struct ArenaMesh {
+        std::string elementName;
+        std::string typeName;
+        size_t pointsOffset = 0;
+        size_t pointsCount = 0;       // floats (vertices * 3)
+        size_t indicesOffset = 0;
+        size_t indicesCount = 0;      // uint32 indices (triangles * 3)
+        size_t normalsOffset = 0;
+        size_t normalsCount = 0;      // floats (vertices * 3), 0 if absent
+        size_t uvsOffset = 0;
+        size_t uvsCount = 0;          // floats (vertices * 2), 0 if absent
+        size_t colorsOffset = 0;
+        size_t colorsCount = 0;       // floats (vertices * 4), 0 if absent
+        size_t instancesOffset = 0;
+        size_t instancesCount = 0;    // floats (instances * 16), 0 if not instanced
+    };
+
+    // All meshes of one load in a single caller-owned allocation. Attribute blocks are
+    // ARENA_ALIGNMENT-aligned relative to data; the first headerBytes are left for the caller.
+    struct MeshArena {
+        uint8_t* data = nullptr;
+        size_t size = 0;
+        size_t headerBytes = 0;
+        std::vector<ArenaMesh> meshes;
+
+        template <typename T>
+        T* at(size_t offset) const { return reinterpret_cast<T*>(data + offset); }
+    };
+
+    static constexpr size_t ARENA_ALIGNMENT = 16;
+
+    // Called once per load with the total arena size; returns nullptr on failure.
+    // Memory should be at least ARENA_ALIGNMENT-aligned (malloc/FMemory::Malloc are).
+    using ArenaAllocator = std::function<void*(size_t bytes)>;
+
+    // Receives each mesh of a streaming load as soon as it is ready; the mesh may be moved
+    // from. Calls are serialized but may come from extraction threads. Return false to stop.
+    using MeshStreamCallback = std::function<bool(MeshData&& mesh)>;
+
+    // Dedup, mesh and texture cache counters (copyable snapshot)
+    struct CacheStats {
+        uint64_t dedupHits = 0;       // Received files skipped as duplicates
+        uint64_t dedupMisses = 0;
+        uint64_t dedupEvictions = 0;
+        size_t dedupEntries = 0;
+        uint64_t meshHits = 0;        // LoadUSDBuffer calls answered without parsing
+        uint64_t meshMisses = 0;
+        uint64_t meshEvictions = 0;
+        size_t meshEntries = 0;
+        size_t meshBytes = 0;         // Approximate memory held by cached meshes
+        uint64_t textureHits = 0;     // CreateTextureFromBuffer calls answered from memory
+        uint64_t textureMisses = 0;   // Includes lookups then answered from disk
+        uint64_t textureDiskHits = 0; // Decodes avoided by the texture cache directory
+        uint64_t textureEvictions = 0;
+        size_t textureEntries = 0;
+        size_t textureBytes = 0;      // Decoded pixels held in memory
+        uint64_t textureBytesSaved = 0; // Decoded bytes served from memory or disk instead of decoding
+        uint64_t meshDiskHits = 0;    // LoadUSDFromDisk* calls answered from the mesh disk cache
+        uint64_t meshDiskMisses = 0;
+        uint64_t meshDiskStores = 0;
+        uint64_t meshDiskEvictions = 0;
+        size_t meshDiskEntries = 0;
+        uint64_t meshDiskBytes = 0;   // Size of the mesh disk cache directory
+    };
+
+    // Received traffic of one endpoint or one sender identity (copyable snapshot)
+    struct ThroughputStats {
+        std::string name;             // Endpoint address, or sender identity (hex when not printable)
+        std::string endpoint;         // Endpoint a sender was last seen on (empty for endpoints)
+        uint64_t messages = 0;
+        uint64_t bytes = 0;
+        double bytesPerSecond = 0.0;  // Average since the first message or the last stats reset
+    };
+
+    // World transform of one mesh prim, keyed like SceneDelta entries
+    struct MeshTransform {
+        std::string key;     // elementName, with "#n" appended for the n-th repeat
+        float matrix[16];    // Column-major 4x4
+    };
+
+    // One mesh of a SceneDelta. Keys are element names; repeated names are told apart by
+    // their order in the stage ("Mesh", "Mesh#1", ...), so keys are stable between versions.
+    struct MeshChange {
+        std::string key;
+        MeshData mesh;
+        bool geometryChanged = true;  // False when only instance_transforms differ
+    };
+
+    // Difference between the current and the previous version of one file
+    struct SceneDelta {
+        std::string filename;
+        uint64_t revision = 0;              // 1 for the first version seen under this filename
+        std::vector<MeshChange> added;      // Meshes absent from the previous version
+        std::vector<MeshChange> changed;    // Meshes whose content hash differs
+        std::vector<std::string> removed;   // Keys of meshes no longer present (sorted)
+        size_t unchangedCount = 0;
+
+        bool empty() const {
+            return added.empty() && changed.empty() && removed.empty();
+        }
+    };
+
+    // One level of detail of a received mesh. Levels of a file arrive coarsest first;
+    // level 0 is the full-resolution mesh and always comes last.
+    struct MeshLod {
+        std::string filename;
+        std::string key;          // Same key as the mesh's SceneDelta entries
+        uint32_t level = 0;       // 0 = full resolution, levelCount - 1 = coarsest
+        uint32_t levelCount = 1;  // 1 for meshes sent at full resolution only
+        MeshData mesh;
+    };
+
+    // Handle of an asynchronous load; 0 is never a valid id
+    using LoadId = uint64_t;
+
+    enum class LoadState {
+        Queued = 0,     // Waiting for a load worker
+        Running = 1,
+        Completed = 2,  // Meshes are ready
+        Failed = 3,
+        Cancelled = 4   // cancelLoad, superseded by a newer load of the same file, or shutdown
+    };
+
+    // Runs a task on a thread of the caller's choosing, e.g. by posting it to a game thread
+    // queue. Every task has to be run exactly once; tasks of one load are posted in order.
+    using Executor = std::function<void(std::function<void()> task)>;
+
+    // Meshes may be moved out of the vector; they are then no longer returned by takeLoadResult
+    using LoadCompletionCallback = std::function<void(LoadId id, LoadState state, std::vector<MeshData>& meshes)>;
+    using LoadProgressCallback = std::function<void(LoadId id, float progress, const std::string& stage)>;
+
+    struct AsyncLoadOptions {
+        LoadCompletionCallback onComplete;  // Called once when the load completes, fails or is cancelled
+        LoadProgressCallback onProgress;    // Called in whole percent steps, from 0 to 1
+        Executor executor;                  // Runs both callbacks; empty runs them on the load worker
+        MeshStreamCallback onMesh;          // Optional; meshes are streamed to it on the load worker
+                                            // and onComplete receives none. Returning false fails the load.
+        bool cancelPrevious = true;         // Cancel unfinished loads of the same fileName
+    };
+
     // Safe callback types with exception handling
     using FileUpdateCallback = std::function<void(const FileData&)>;
     using MessageCallback = std::function<void(const std::string&)>;
+    using SceneDeltaCallback = std::function<void(const SceneDelta&)>;
+    using MeshLodCallback = std::function<void(const MeshLod&)>;
 
     // Constructor and destructor
     AnariUsdMiddleware();
@@ -139,7 +293,9 @@ public:
 
     /**
      * Initialize the middleware with enhanced error checking
-     * @param endpoint The ZeroMQ endpoint to bind to (e.g., "tcp://*:13456")
+     * @param endpoint The ZeroMQ endpoint to bind to (e.g., "tcp://0.0.0.0:13456"), or a comma-separated
+     *                 list such as "tcp://0.0.0.0:5556,ipc:///tmp/jusync,inproc://jusync" to receive on
+     *                 several endpoints at once
      * @return True if initialization was successful, false otherwise
      */
     bool initialize(const char* endpoint = nullptr);
@@ -181,6 +337,82 @@ public:
      */
     void unregisterMessageCallback(int callbackId);
 
+    /**
+     * Register a callback that receives what changed whenever a USD file arrives (thread-safe)
+     * While any delta callback is registered, received USD files are parsed by the pipeline
+     * workers (through the mesh cache) and compared with the previous version of the same filename
+     * @param callback The callback function to register
+     * @return A unique identifier for the callback, -1 on failure
+     */
+    int registerSceneDeltaCallback(SceneDeltaCallback callback);
+
+    /**
+     * Unregister a previously registered scene delta callback (thread-safe)
+     * @param callbackId The identifier of the callback to unregister
+     */
+    void unregisterSceneDeltaCallback(int callbackId);
+
+    /**
+     * Compare meshes loaded by the caller with the previous version of the same file and
+     * remember them as the new version (thread-safe). Shares history with received files.
+     * @param fileName File the meshes were loaded from
+     * @param meshes Meshes of the new version
+     * @param outDelta Receives the change set
+     * @return True on success, false otherwise
+     */
+    bool computeSceneDelta(const std::string& fileName, const std::vector<MeshData>& meshes,
+                           SceneDelta& outDelta);
+
+    /**
+     * Forget the previous versions used for scene deltas (thread-safe)
+     * The next version of every file is reported as all added
+     */
+    void clearSceneHistory();
+
+    /**
+     * Register a callback that receives the meshes of every received USD file level by level (thread-safe)
+     * The coarsest level of each large mesh is sent as soon as the file is parsed; finer levels
+     * are built on a background thread and delivered as they complete. Work left for an older
+     * version of a file is dropped when a newer one arrives.
+     * @param callback The callback function to register
+     * @return A unique identifier for the callback, -1 on failure
+     */
+    int registerMeshLodCallback(MeshLodCallback callback);
+
+    /**
+     * Unregister a previously registered LOD callback (thread-safe)
+     * @param callbackId The identifier of the callback to unregister
+     */
+    void unregisterMeshLodCallback(int callbackId);
+
+    /**
+     * Configure progressive LOD delivery (thread-safe)
+     * Each level holds about a quarter of the triangles of the next finer one
+     * @param levelCount Levels per mesh including full resolution (1-8, default 3; 1 disables simplification)
+     * @param minTriangles Meshes with fewer triangles are sent at full resolution only (default 100000)
+     */
+    void setLodOptions(uint32_t levelCount, size_t minTriangles);
+
+    /**
+     * Simplify a mesh by vertex clustering
+     * Attributes are averaged per cluster; instance transforms are copied unchanged
+     * @param mesh Input mesh
+     * @param targetTriangles Desired triangle count (approximate)
+     * @param outMesh Simplified mesh
+     * @return True if a non-empty simplified mesh was produced, false otherwise
+     */
+    static bool SimplifyMesh(const MeshData& mesh, size_t targetTriangles, MeshData& outMesh);
+
+    /**
+     * Encode meshes as a binary mesh container (".jmesh", see MeshContainer.h)
+     * Received containers are loaded by LoadUSDBuffer without parsing. Per-face attributes
+     * are not stored
+     * @param meshes Meshes to encode
+     * @param outBuffer Receives the container
+     * @return True on success, false if a mesh is invalid
+     */
+    static bool EncodeMeshContainer(const std::vector<MeshData>& meshes, std::vector<uint8_t>& outBuffer);
+
     /**
      * Start receiving data (non-blocking, thread-safe)
      * @return True if the receiver thread was started successfully, false otherwise
@@ -192,6 +424,126 @@ public:
      */
     void stopReceiving();
 
+    /**
+     * Set how many queued messages the receiver drains per wakeup before polling again (thread-safe)
+     * Higher values favour sustained throughput, lower values favour shutdown responsiveness
+     * @param maxMessages Maximum messages handled per wakeup (1-10000, default 64)
+     */
+    void setMaxMessagesPerWakeup(size_t maxMessages);
+
+    /**
+     * Get the current per-wakeup drain limit
+     * @return Maximum messages handled per receiver wakeup
+     */
+    size_t getMaxMessagesPerWakeup() const;
+
+    /**
+     * Set the number of ZeroMQ I/O threads (thread-safe). Takes effect on the next initialize()
+     * Roughly one thread per GB/s of tcp traffic; many concurrent senders benefit from more than one
+     * @param threads I/O threads (1-64, default 1)
+     */
+    void setReceiveIoThreads(int threads);
+
+    /**
+     * Set the send and receive high water mark of every endpoint socket (thread-safe)
+     * Takes effect on the next initialize()
+     * @param messages Messages queued per sender before it is pushed back (1-1000000, default 1000)
+     */
+    void setReceiveHighWaterMark(int messages);
+
+    /**
+     * Get received traffic per bound endpoint, in binding order
+     * @return Snapshot of endpoint statistics
+     */
+    std::vector<ThroughputStats> getEndpointStats() const;
+
+    /**
+     * Get received traffic per sender identity, most bytes first, e.g. to find a saturating rank
+     * @return Snapshot of sender statistics (the least recently seen senders are dropped past 256)
+     */
+    std::vector<ThroughputStats> getClientStats() const;
+
+    /**
+     * Set the number of worker threads that verify and dispatch received data (thread-safe)
+     * Callbacks stay serialized; with more than one worker files may complete out of arrival order.
+     * Takes effect on the next startReceiving()
+     * @param workerCount Number of pipeline workers (1-64, default 2)
+     */
+    void setPipelineWorkers(size_t workerCount);
+
+    /**
+     * Set how many threads extract meshes from a loaded USD stage (thread-safe)
+     * Mesh order in the output does not depend on the thread count
+     * @param threadCount Number of extraction threads (1-64, default 4)
+     */
+    void setUsdWorkerThreads(size_t threadCount);
+
+    /**
+     * Emit geometry shared by several placements once, with per-instance transforms
+     * (MeshData::instance_transforms) instead of one world-space copy per placement (thread-safe)
+     * Clears the parsed-mesh cache, whose entries depend on this mode
+     * @param enable True to enable instancing output (default false)
+     */
+    void setInstancingEnabled(bool enable);
+
+    /**
+     * Keep mesh points in local space and report each mesh's world matrix as a single
+     * instance_transforms entry (thread-safe). A prim that only moved then shows up in
+     * scene deltas with geometryChanged == false. Clears the parsed-mesh cache
+     * @param enable True to enable local-space output (default false)
+     */
+    void setLocalSpaceEnabled(bool enable);
+
+    /**
+     * Weld equal vertices of parsed meshes and reorder their indices for the GPU vertex cache,
+     * overdraw and vertex fetch (thread-safe). The effect on vertex count and ACMR is reported
+     * by getStatusInfo(). Clears the parsed-mesh cache
+     * @param enable True to enable the optimization stage (default false)
+     */
+    void setMeshOptimizationEnabled(bool enable);
+
+    /**
+     * Set the welding tolerance of the optimization stage (thread-safe)
+     * @param epsilon 0 welds exactly equal vertices only; otherwise attributes are snapped to
+     *                multiples of epsilon before comparing (must be finite and >= 0, default 0)
+     */
+    void setWeldEpsilon(float epsilon);
+
+    /**
+     * Set the time at which time-sampled xformOps are evaluated by LoadUSDBuffer (thread-safe)
+     * Clears the parsed-mesh cache when the value changes
+     * @param timeCode Stage time code (NaN selects the default, non-animated values)
+     */
+    void setTimeCode(double timeCode);
+
+    /**
+     * Evaluate the world transform of every mesh prim without extracting geometry
+     * The parsed stage is cached on content, so scrubbing the same file re-evaluates only
+     * its animated xformOps. Keys match SceneDelta keys of LoadUSDBuffer results when
+     * instancing is off
+     * @param data Raw USD data (must stay valid for the duration of the call)
+     * @param size Size of data in bytes
+     * @param fileName Original filename (used for format detection)
+     * @param timeCode Stage time code (NaN selects the default values)
+     * @param outTransforms Output transforms in traversal order
+     * @return True if evaluation was successful, false otherwise
+     */
+    bool EvaluateTransforms(const uint8_t* data, size_t size, const std::string& fileName,
+                            double timeCode, std::vector<MeshTransform>& outTransforms);
+
+    /**
+     * Set how many received messages may wait for a worker before the receiver applies backpressure
+     * Takes effect on the next startReceiving()
+     * @param capacity Queue slots, rounded up to a power of two (1-65536, default 64)
+     */
+    void setPipelineQueueCapacity(size_t capacity);
+
+    /**
+     * Set how long the receiver waits for a free queue slot before dropping a message
+     * @param timeoutMs Stall timeout in milliseconds (0-60000, default 5000; 0 drops immediately)
+     */
+    void setPipelineStallTimeout(int timeoutMs);
+
     /**
      * Create texture from raw buffer data with bounds checking
      * @param buffer Raw image data buffer
@@ -199,8 +551,20 @@ public:
      */
     TextureData CreateTextureFromBuffer(const std::vector<uint8_t>& buffer);
 
+    /**
+     * Create texture from borrowed image bytes, e.g. FileData::data of a received IMAGE file
+     * Identical content is decoded once and then served from the texture cache
+     * @param data Raw image data
+     * @param size Size of data in bytes
+     * @param contentHash Hash frame of the content (FileData::hash); empty to hash the bytes
+     * @return TextureData structure containing the processed texture
+     */
+    TextureData CreateTextureFromBuffer(const uint8_t* data, size_t size, const std::string& contentHash = "");
+
     /**
      * Load USD data from buffer with comprehensive validation (RealtimeMesh ready)
+     * Binary mesh containers (EncodeMeshContainer) are recognized by content and copied out
+     * without parsing; for in-place access use container::parse() on the received bytes
      * @param buffer Raw USD data buffer
      * @param fileName Original filename (used for format detection)
      * @param outMeshData Output vector to store the extracted mesh data
@@ -209,14 +573,159 @@ public:
     bool LoadUSDBuffer(const std::vector<uint8_t>& buffer, const std::string& fileName,
                        std::vector<MeshData>& outMeshData);
 
+    /**
+     * Load USD data from a caller-owned byte range without copying it
+     * @param data Raw USD data (must stay valid for the duration of the call)
+     * @param size Size of data in bytes
+     * @param fileName Original filename (used for format detection)
+     * @param outMeshData Output vector to store the extracted mesh data
+     * @return True if loading was successful, false otherwise
+     */
+    bool LoadUSDBuffer(const uint8_t* data, size_t size, const std::string& fileName,
+                       std::vector<MeshData>& outMeshData);
+
     /**
      * Load USD data directly from disk with file validation (RealtimeMesh ready)
+     * The file is memory-mapped and parsed in place
      * @param filePath Path to the USD file
      * @param outMeshData Output vector to store the extracted mesh data
      * @return True if loading was successful, false otherwise
      */
     bool LoadUSDFromDisk(const std::string& filePath, std::vector<MeshData>& outMeshData);
 
+    /**
+     * Load USD data and hand every mesh to a callback as soon as it is extracted, in traversal
+     * order, so consumers can upload meshes while the rest are still being processed and the
+     * full mesh list is never held. With instancing enabled the meshes arrive at the end.
+     * @param data Raw USD data or mesh container (must stay valid for the duration of the call)
+     * @param size Size of data in bytes
+     * @param fileName Original filename (used for format detection)
+     * @param onMesh Receives each mesh; returning false stops the load
+     * @return True if loading was successful, false on failure or when onMesh stopped it
+     */
+    bool LoadUSDBufferStreaming(const uint8_t* data, size_t size, const std::string& fileName,
+                                const MeshStreamCallback& onMesh);
+
+    /**
+     * Load a USD file from disk with per-mesh delivery, see LoadUSDBufferStreaming
+     * @param filePath Path to the USD file
+     * @param onMesh Receives each mesh; returning false stops the load
+     * @return True if loading was successful, false on failure or when onMesh stopped it
+     */
+    bool LoadUSDFromDiskStreaming(const std::string& filePath, const MeshStreamCallback& onMesh);
+
+    /**
+     * Load USD data from buffer, writing every mesh straight into one allocation (SoA, flat)
+     * @param buffer Raw USD data buffer
+     * @param fileName Original filename (used for format detection)
+     * @param allocate Allocator called exactly once on success; the caller owns the memory
+     * @param outArena Receives the allocation and per-mesh offsets
+     * @param headerBytesPerMesh Bytes per mesh to reserve at the start of the arena (e.g. for C headers)
+     * @return True if loading was successful, false otherwise (nothing allocated)
+     */
+    bool LoadUSDBufferToArena(const std::vector<uint8_t>& buffer, const std::string& fileName,
+                              const ArenaAllocator& allocate, MeshArena& outArena,
+                              size_t headerBytesPerMesh = 0);
+
+    /**
+     * Arena load from a caller-owned byte range without copying it, see LoadUSDBufferToArena
+     * @param data Raw USD data (must stay valid for the duration of the call)
+     * @param size Size of data in bytes
+     * @param fileName Original filename (used for format detection)
+     * @param allocate Allocator called exactly once on success; the caller owns the memory
+     * @param outArena Receives the allocation and per-mesh offsets
+     * @param headerBytesPerMesh Bytes per mesh to reserve at the start of the arena
+     * @return True if loading was successful, false otherwise (nothing allocated)
+     */
+    bool LoadUSDBufferToArena(const uint8_t* data, size_t size, const std::string& fileName,
+                              const ArenaAllocator& allocate, MeshArena& outArena,
+                              size_t headerBytesPerMesh = 0);
+
+    /**
+     * Load a USD file from disk into one allocation, see LoadUSDBufferToArena
+     * @param filePath Path to the USD file
+     * @param allocate Allocator called exactly once on success; the caller owns the memory
+     * @param outArena Receives the allocation and per-mesh offsets
+     * @param headerBytesPerMesh Bytes per mesh to reserve at the start of the arena
+     * @return True if loading was successful, false otherwise (nothing allocated)
+     */
+    bool LoadUSDFromDiskToArena(const std::string& filePath, const ArenaAllocator& allocate,
+                                MeshArena& outArena, size_t headerBytesPerMesh = 0);
+
+    /**
+     * Queue a load on the middleware's load workers and return immediately (thread-safe)
+     * Loads run concurrently up to the worker count. Loads still pending at shutdown are
+     * cancelled without calling onComplete.
+     * @param buffer USD or mesh container bytes; shared, so received payloads are not copied
+     *               (use FilePayload::fromVector to hand over a vector)
+     * @param fileName Original filename (used for format detection and cancelPrevious)
+     * @param options Completion and progress callbacks, the executor they run on, and
+     *                whether unfinished loads of the same file are cancelled
+     * @return Id for the load functions below, 0 if the load could not be queued
+     */
+    LoadId LoadUSDBufferAsync(FilePayload buffer, const std::string& fileName,
+                              const AsyncLoadOptions& options);
+
+    /**
+     * Queue a load of a USD file from disk, see LoadUSDBufferAsync
+     * The file is mapped on the load worker, so the call does not touch the disk
+     * @param filePath Path to the USD file
+     * @param options Completion and progress callbacks, see LoadUSDBufferAsync
+     * @return Id of the load, 0 if the load could not be queued
+     */
+    LoadId LoadUSDFromDiskAsync(const std::string& filePath,
+                                const AsyncLoadOptions& options);
+
+    /**
+     * Poll an asynchronous load (thread-safe)
+     * @param id Load id
+     * @param outState Current state
+     * @param outProgress Progress from 0 to 1
+     * @return False if the id is unknown (never issued, released or evicted)
+     */
+    bool getLoadStatus(LoadId id, LoadState& outState, float& outProgress) const;
+
+    /**
+     * Block until an asynchronous load completes, fails or is cancelled (thread-safe)
+     * The completion callback may still be pending on its executor when this returns.
+     * @param id Load id
+     * @param timeoutMs Maximum time to wait in milliseconds, negative waits indefinitely
+     * @return True if the load has finished, false on timeout or unknown id
+     */
+    bool waitForLoad(LoadId id, int timeoutMs = -1);
+
+    /**
+     * Move the meshes of a completed load out and forget the load (thread-safe)
+     * @param id Load id
+     * @param outMeshData Receives the meshes
+     * @return True if the load completed successfully, false if it is unfinished, failed,
+     *         was cancelled or is unknown (finished loads are forgotten either way)
+     */
+    bool takeLoadResult(LoadId id, std::vector<MeshData>& outMeshData);
+
+    /**
+     * Cancel an asynchronous load (thread-safe)
+     * A running load stops at the next prim or mesh it visits; onComplete is called with
+     * LoadState::Cancelled.
+     * @param id Load id
+     * @return True if the load was queued or running, false if it had finished or is unknown
+     */
+    bool cancelLoad(LoadId id);
+
+    /**
+     * Forget an asynchronous load; an unfinished load is cancelled first (thread-safe)
+     * The 64 most recent finished loads are kept until taken or released.
+     * @param id Load id
+     */
+    void releaseLoad(LoadId id);
+
+    /**
+     * Set how many asynchronous loads run at the same time (thread-safe)
+     * Takes effect when the load workers start with the first asynchronous load
+     * @param workerCount Number of load worker threads (1-64, default 2)
+     */
+    void setAsyncLoadWorkers(size_t workerCount);
+
     /**
      * Write gradient line as PNG with error handling
      * @param buffer Raw image data buffer
@@ -233,6 +742,90 @@ public:
      */
     bool GetGradientLineAsPNGBuffer(const std::vector<uint8_t>& buffer, std::vector<uint8_t>& outPngBuffer);
 
+    /**
+     * Set how many received files are remembered for duplicate detection (thread-safe)
+     * The least recently seen content is forgotten first
+     * @param entries Dedup cache capacity (default 10000)
+     */
+    void setDedupCacheCapacity(size_t entries);
+
+    /**
+     * Limit the cache of parsed LoadUSDBuffer results (thread-safe)
+     * Stages that reference, payload or clip other layers are never cached
+     * @param maxEntries Maximum cached buffers (0 disables the cache, default 32)
+     * @param maxBytes Approximate memory budget for cached meshes (default 512MB)
+     */
+    void setMeshCacheLimits(size_t maxEntries, size_t maxBytes);
+
+    /**
+     * Limit the in-memory cache of decoded CreateTextureFromBuffer results (thread-safe)
+     * @param maxEntries Maximum cached textures (0 disables the memory cache, default 256)
+     * @param maxBytes Memory budget for decoded pixels (default 256MB)
+     */
+    void setTextureCacheLimits(size_t maxEntries, size_t maxBytes);
+
+    /**
+     * Keep decoded textures in a directory as well, so they survive restarts (thread-safe)
+     * Files are named after the content digest and never evicted; remove the directory to reset it
+     * @param directory Cache directory, created if missing (empty disables the disk cache)
+     * @return False if the directory cannot be created
+     */
+    bool setTextureCacheDirectory(const std::string& directory);
+
+    /**
+     * Keep the meshes extracted by LoadUSDFromDisk* in a directory, so a restarted process maps
+     * them instead of parsing again (thread-safe). Entries are keyed on the file's path, size and
+     * modification time plus the extraction settings (instancing, local space, optimization, weld
+     * epsilon, time code); edits to referenced layers alone are not detected, so clear the cache
+     * after changing them. The least recently used entries are deleted beyond maxBytes.
+     * @param directory Cache directory, created if missing (empty disables the cache)
+     * @param maxBytes Size budget of the directory (e.g. 4GB)
+     * @return False if the directory cannot be used (the cache is then disabled)
+     */
+    bool setMeshDiskCache(const std::string& directory, uint64_t maxBytes);
+
+    /**
+     * Delete every entry of the mesh disk cache (thread-safe)
+     */
+    void clearMeshDiskCache();
+
+    /**
+     * Forget all duplicate-detection state and cached meshes and textures in memory (thread-safe)
+     */
+    void clearCaches();
+
+    /**
+     * Get dedup, mesh and texture cache counters
+     * @return Snapshot of cache statistics
+     */
+    CacheStats getCacheStats() const;
+
+    /**
+     * Get latency percentiles of every pipeline stage, from receive to file callbacks
+     * @return One entry per stage in pipeline order; stages that never ran have a zero count
+     */
+    std::vector<profiling::StageProfiler::StageStats> getStageStats() const;
+
+    /**
+     * Clear the stage latency histograms (thread-safe)
+     */
+    void resetStageStats();
+
+    /**
+     * Start or stop recording individual stage events for writeTrace() (thread-safe)
+     * Enabling discards the previous trace; the oldest events are overwritten once maxEvents are held
+     * @param enable True to capture
+     * @param maxEvents Events kept (default 100000, about 10 MB)
+     */
+    void setTraceCapture(bool enable, size_t maxEvents = profiling::StageProfiler::DEFAULT_TRACE_EVENTS);
+
+    /**
+     * Write the captured stage events as Chrome trace JSON, for chrome://tracing or ui.perfetto.dev
+     * @param path Output file, replaced if present
+     * @return True on success
+     */
+    bool writeTrace(const std::string& path) const;
+
     /**
      * Get current status information for debugging
      * @return Status string with connection and processing information
@@ -27,14 +27,17 @@ extern "C" {
 
 /**
  * File data structure for C interface
- * Contains received file information and binary data
+ * Contains received file information and binary data.
+ * data points straight into the received network buffer and is read-only; it stays valid
+ * during the callback, or until ReleaseFileData_C for a struct returned by RetainFileData_C.
  */
 typedef struct {
     char filename[256];          // Original filename (null-terminated)
-    unsigned char* data;         // Binary file data (dynamically allocated)
+    const unsigned char* data;   // Binary file data (shared, read-only)
     size_t data_size;           // Size of data in bytes
     char hash[64];              // SHA256 hash (null-terminated hex string)
-    char file_type[32];         // File type identifier (e.g., "USD", "IMAGE")
+    char file_type[32];         // File type identifier (e.g., "USD", "IMAGE", "MESH")
+    void* payload;               // Opaque reference keeping data alive (do not touch)
 } CFileData;
 
 /**
@@ -66,6 +69,11 @@ typedef struct {
     // Values are in range [0.0, 1.0]
     float* vertex_colors;
     size_t vertex_colors_count;  // Total number of floats (vertices * 4)
+
+    // Instancing mode only: column-major 4x4 world transforms, one per placement.
+    // When set, points/normals are in the mesh's local space. NULL/0 otherwise.
+    float* instance_transforms;
+    size_t instance_transforms_count; // Total number of floats (instances * 16)
 } CMeshData;
 
 /**
@@ -80,14 +88,222 @@ typedef struct {
     size_t data_size;           // Size of pixel data in bytes
 } CTextureData;
 
+/**
+ * Pixel layout of a GPU-ready texture
+ */
+typedef enum {
+    TEXTURE_FORMAT_RGBA8 = 0,    // 4 bytes per pixel
+    TEXTURE_FORMAT_BC1 = 1,      // 8 bytes per 4x4 block (DXT1), opaque
+    TEXTURE_FORMAT_BC3 = 2       // 16 bytes per 4x4 block (DXT5), with alpha
+} CTextureFormat;
+
+/**
+ * Block compression requested for GPU-ready textures
+ */
+typedef enum {
+    TEXTURE_COMPRESSION_NONE = 0,
+    TEXTURE_COMPRESSION_BC1 = 1,
+    TEXTURE_COMPRESSION_BC3 = 2,
+    TEXTURE_COMPRESSION_AUTO = 3 // BC1 when opaque, BC3 when any pixel has alpha
+} CTextureCompression;
+
+typedef struct {
+    int generate_mips;                // Non-zero for a full mip chain down to 1x1
+    CTextureCompression compression;
+    int linear;                       // Non-zero for data textures (mips filtered without sRGB decoding)
+    int high_quality;                 // Non-zero for the slower BCn endpoint search
+} CTextureOptions;
+
+/**
+ * One level of a GPU-ready texture; offset and size are bytes within CGpuTexture::data
+ */
+typedef struct {
+    int width;
+    int height;
+    size_t offset;
+    size_t size;
+} CTextureMip;
+
+/**
+ * Decoded texture laid out for direct upload: all levels back to back, level 0 first
+ */
+typedef struct {
+    int width;
+    int height;
+    CTextureFormat format;
+    const CTextureMip* mips;
+    size_t mip_count;
+    const unsigned char* data;
+    size_t data_size;
+    void* internal;              // Owns mips and data; released by FreeGpuTexture_C
+} CGpuTexture;
+
+/**
+ * Dedup, mesh and texture cache counters
+ */
+typedef struct {
+    uint64_t dedup_hits;         // Received files skipped as duplicates
+    uint64_t dedup_misses;
+    uint64_t dedup_evictions;
+    size_t dedup_entries;
+    uint64_t mesh_hits;          // LoadUSDBuffer_C calls answered without parsing
+    uint64_t mesh_misses;
+    uint64_t mesh_evictions;
+    size_t mesh_entries;
+    size_t mesh_bytes;           // Approximate memory held by cached meshes
+    uint64_t texture_hits;       // CreateTextureFromBuffer_C calls answered from memory
+    uint64_t texture_misses;     // Includes lookups then answered from disk
+    uint64_t texture_disk_hits;  // Decodes avoided by the texture cache directory
+    uint64_t texture_evictions;
+    size_t texture_entries;
+    size_t texture_bytes;        // Decoded pixels held in memory
+    uint64_t texture_bytes_saved; // Decoded bytes served from memory or disk instead of decoding
+    uint64_t mesh_disk_hits;     // LoadUSDFromDisk*_C calls answered from the mesh disk cache
+    uint64_t mesh_disk_misses;
+    uint64_t mesh_disk_stores;
+    uint64_t mesh_disk_evictions;
+    size_t mesh_disk_entries;
+    uint64_t mesh_disk_bytes;    // Size of the mesh disk cache directory
+} CCacheStats;
+
+/**
+ * Latency of one pipeline stage; percentiles are within 12.5% of the exact value
+ */
+typedef struct {
+    char name[32];               // "receive", "queue_wait", "decompress", "hash", "preprocess", "parse",
+                                 // "traverse", "extract", "references", "convert", "callback"
+    uint64_t count;              // Times the stage ran
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t p50_ns;
+    uint64_t p95_ns;
+    uint64_t p99_ns;
+} CStageStats;
+
+/**
+ * Received traffic of one endpoint or one sender identity
+ */
+typedef struct {
+    char name[256];              // Endpoint address or sender identity (null-terminated, may be truncated)
+    char endpoint[256];          // Endpoint a sender was last seen on (empty for endpoints)
+    uint64_t messages;
+    uint64_t bytes;
+    double bytes_per_second;     // Average since the first message or the last stats reset
+} CThroughputStats;
+
+/**
+ * World transform of one mesh prim, as returned by EvaluateTransforms_C
+ */
+typedef struct {
+    char key[256];               // Scene delta key of the mesh (null-terminated)
+    float matrix[16];            // Column-major 4x4 world transform
+} CMeshTransform;
+
+/**
+ * One added or changed mesh of a scene delta
+ * Keys are element names, with "#n" appended to the n-th repeat of a name
+ */
+typedef struct {
+    const char* key;             // Stable identity of the mesh across versions
+    CMeshData mesh;              // Borrowed: arrays are valid only during the callback
+    int geometry_changed;        // 0 when only instance_transforms differ
+} CMeshChange;
+
+/**
+ * Difference between the current and the previous version of one received file
+ */
+typedef struct {
+    const char* filename;
+    uint64_t revision;           // 1 for the first version seen under this filename
+    const CMeshChange* added;    // Meshes absent from the previous version
+    size_t added_count;
+    const CMeshChange* changed;  // Meshes whose content hash differs
+    size_t changed_count;
+    const char* const* removed;  // Keys of meshes no longer present
+    size_t removed_count;
+    size_t unchanged_count;
+} CSceneDelta;
+
+/**
+ * One level of detail of a received mesh
+ * Levels of a file arrive coarsest first; level 0 is full resolution and comes last
+ */
+typedef struct {
+    const char* filename;
+    const char* key;             // Scene delta key of the mesh
+    unsigned int level;          // 0 = full resolution, level_count - 1 = coarsest
+    unsigned int level_count;    // 1 for meshes sent at full resolution only
+    CMeshData mesh;              // Borrowed: arrays are valid only during the callback
+} CMeshLod;
+
 // ============================================================================
 // CALLBACK FUNCTION TYPES
 // ============================================================================
 
+/**
+ * State of an asynchronous load, see GetLoadStatus_C
+ */
+typedef enum {
+    LOAD_STATE_QUEUED = 0,       // Waiting for a load thread
+    LOAD_STATE_RUNNING = 1,
+    LOAD_STATE_COMPLETED = 2,    // Meshes are ready
+    LOAD_STATE_FAILED = 3,
+    LOAD_STATE_CANCELLED = 4     // CancelLoad_C, superseded by a newer load of the same file, or shutdown
+} CLoadState;
+
+/**
+ * Task handed to a LoadExecutor_C; must be called exactly once with its task_data
+ */
+typedef void (*LoadTask_C)(void* task_data);
+
+/**
+ * Runs load callbacks on a thread of the caller's choosing (e.g. queues them for a game thread)
+ * @param task Task to call exactly once, on any thread
+ * @param task_data Argument for task
+ * @param user_data Value from CAsyncLoadOptions
+ */
+typedef void (*LoadExecutor_C)(LoadTask_C task, void* task_data, void* user_data);
+
+/**
+ * Progress of an asynchronous load, in whole percent steps from 0 to 1
+ * @param stage Null-terminated stage description (valid only during callback)
+ */
+typedef void (*LoadProgressCallback_C)(uint64_t load_id, float progress, const char* stage, void* user_data);
+
+/**
+ * End of an asynchronous load, called once whether it completed, failed or was cancelled
+ * @param meshes Borrowed meshes (valid only during callback; NULL unless completed).
+ *               TakeLoadResult_C still returns them afterwards.
+ */
+typedef void (*LoadCompleteCallback_C)(uint64_t load_id, CLoadState state,
+                                       const CMeshData* meshes, size_t count, void* user_data);
+
+/**
+ * One mesh of a streaming load, delivered as soon as it is extracted and in traversal order
+ * Calls are serialized but may come from extraction threads.
+ * @param mesh Borrowed mesh (valid only during callback; copy what is needed)
+ * @param user_data Value passed to the streaming loader
+ * @return Non-zero to continue, 0 to stop the load
+ */
+typedef int (*MeshStreamCallback_C)(const CMeshData* mesh, void* user_data);
+
+/**
+ * Options of LoadUSDBufferAsync_C and LoadUSDFromDiskAsync_C; all members may be zero
+ */
+typedef struct {
+    LoadCompleteCallback_C on_complete;
+    LoadProgressCallback_C on_progress;
+    LoadExecutor_C executor;     // Runs both callbacks; NULL calls them on the load thread
+    void* user_data;             // Passed to all callbacks
+    int cancel_previous;         // Non-zero cancels unfinished loads of the same filename
+    MeshStreamCallback_C on_mesh; // Streams meshes on the load thread; on_complete then receives none
+} CAsyncLoadOptions;
+
 /**
  * Callback function type for file reception notifications
  * Called when a new file is received via ZeroMQ
- * @param file_data Pointer to received file data (valid only during callback)
+ * @param file_data Pointer to received file data (valid only during callback; use
+ *                  RetainFileData_C to keep it longer without copying)
  */
 typedef void (*FileReceivedCallback_C)(const CFileData* file_data);
 
@@ -98,6 +314,20 @@ typedef void (*FileReceivedCallback_C)(const CFileData* file_data);
  */
 typedef void (*MessageReceivedCallback_C)(const char* message);
 
+/**
+ * Callback function type for scene delta notifications
+ * Called after a received USD file has been parsed and compared with its previous version
+ * @param delta Change set (valid only during callback; copy what must outlive it)
+ */
+typedef void (*SceneDeltaCallback_C)(const CSceneDelta* delta);
+
+/**
+ * Callback function type for progressive LOD delivery
+ * Called from middleware threads, once per mesh and level
+ * @param lod Mesh level (valid only during callback; copy what must outlive it)
+ */
+typedef void (*MeshLodCallback_C)(const CMeshLod* lod);
+
 // ============================================================================
 // CORE MIDDLEWARE FUNCTIONS
 // ============================================================================
@@ -105,7 +335,8 @@ typedef void (*MessageReceivedCallback_C)(const char* message);
 /**
  * Initialize the middleware with ZeroMQ endpoint
  * Must be called before any other operations
- * @param endpoint ZeroMQ endpoint string (e.g., "tcp://*:5556") or NULL for default
+ * @param endpoint ZeroMQ endpoint string (e.g., "tcp://0.0.0.0:5556"), a comma-separated list
+ *                 (e.g., "tcp://0.0.0.0:5556,ipc:///tmp/jusync") or NULL for port 5556 on all interfaces
  * @return 1 on success, 0 on failure
  */
 ANARI_USD_MIDDLEWARE_C_API int InitializeMiddleware_C(const char* endpoint);
@@ -141,18 +372,179 @@ ANARI_USD_MIDDLEWARE_C_API int StartReceiving_C(void);
  */
 ANARI_USD_MIDDLEWARE_C_API void StopReceiving_C(void);
 
+/**
+ * Set how many queued messages the receiver drains per wakeup before polling again
+ * @param max_messages Maximum messages handled per wakeup (1-10000, default 64)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetMaxMessagesPerWakeup_C(size_t max_messages);
+
+/**
+ * Configure the receive sockets; call before InitializeMiddleware_C, which applies the values
+ * @param io_threads ZeroMQ I/O threads (1-64, default 1), or 0 to keep the current value
+ * @param high_water_mark Messages queued per sender (1-1000000, default 1000), or 0 to keep the current value
+ */
+ANARI_USD_MIDDLEWARE_C_API void ConfigureReceiveSockets_C(int io_threads, int high_water_mark);
+
+/**
+ * Get received traffic per bound endpoint, in binding order
+ * @param out_stats Array receiving up to capacity entries (may be NULL when capacity is 0)
+ * @param capacity Number of entries out_stats can hold
+ * @return Number of endpoints available (may exceed capacity)
+ */
+ANARI_USD_MIDDLEWARE_C_API size_t GetEndpointStats_C(CThroughputStats* out_stats, size_t capacity);
+
+/**
+ * Get received traffic per sender identity, most bytes first
+ * @param out_stats Array receiving up to capacity entries (may be NULL when capacity is 0)
+ * @param capacity Number of entries out_stats can hold
+ * @return Number of senders available (may exceed capacity)
+ */
+ANARI_USD_MIDDLEWARE_C_API size_t GetClientStats_C(CThroughputStats* out_stats, size_t capacity);
+
+/**
+ * Configure the worker pipeline that verifies and dispatches received data
+ * Worker count and capacity take effect on the next StartReceiving_C()
+ * @param workers Number of pipeline workers (1-64, default 2)
+ * @param queue_capacity Messages that may wait for a worker (1-65536, default 64)
+ * @param stall_timeout_ms Time to wait for a free slot before dropping (0-60000, default 5000)
+ */
+ANARI_USD_MIDDLEWARE_C_API void ConfigurePipeline_C(size_t workers, size_t queue_capacity, int stall_timeout_ms);
+
+/**
+ * Set how many threads extract meshes from a loaded USD stage
+ * @param thread_count Number of extraction threads (1-64, default 4)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetUsdWorkerThreads_C(size_t thread_count);
+
+/**
+ * Emit geometry shared by several placements once with CMeshData::instance_transforms
+ * instead of baking one world-space copy per placement
+ * @param enable Non-zero to enable instancing output (default 0)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetInstancingEnabled_C(int enable);
+
+/**
+ * Keep points in local space and report each mesh's world matrix as its single
+ * instance_transforms entry, so a moved prim is a transform-only scene delta change
+ * @param enable Non-zero to enable local-space output (default 0)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetLocalSpaceEnabled_C(int enable);
+
+/**
+ * Weld equal vertices and reorder indices of parsed meshes for the GPU vertex cache,
+ * overdraw and vertex fetch; vertex counts and ACMR appear in GetStatusInfo_C
+ * @param enable Non-zero to enable the optimization stage (default 0)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetMeshOptimizationEnabled_C(int enable);
+
+/**
+ * @param epsilon Welding tolerance: 0 welds exactly equal vertices only (default 0)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetWeldEpsilon_C(float epsilon);
+
+/**
+ * Set the time at which LoadUSDBuffer_C evaluates time-sampled xformOps
+ * @param time_code Stage time code (NaN selects the default values)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetTimeCode_C(double time_code);
+
+/**
+ * Configure the duplicate-detection and parsed-mesh caches
+ * @param dedup_entries Received files remembered for duplicate detection (default 10000)
+ * @param mesh_entries Parsed buffers kept by LoadUSDBuffer_C (0 disables, default 32)
+ * @param mesh_max_bytes Approximate memory budget for cached meshes (default 512MB)
+ */
+ANARI_USD_MIDDLEWARE_C_API void ConfigureCaches_C(size_t dedup_entries, size_t mesh_entries, size_t mesh_max_bytes);
+
+/**
+ * Get dedup and mesh cache counters
+ * @param out_stats Pointer to receive the counters
+ * @return 1 on success, 0 on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API int GetCacheStats_C(CCacheStats* out_stats);
+
+/**
+ * Configure the cache of decoded textures
+ * @param max_entries Textures kept in memory (0 disables the memory cache, default 256)
+ * @param max_bytes Memory budget for decoded pixels (default 256MB)
+ * @param directory Directory keeping decoded textures across sessions (NULL or "" disables)
+ * @return 1 on success, 0 if the directory cannot be created
+ */
+ANARI_USD_MIDDLEWARE_C_API int ConfigureTextureCache_C(size_t max_entries, size_t max_bytes, const char* directory);
+
+/**
+ * Keep meshes extracted by LoadUSDFromDisk*_C in a directory across restarts. Entries are
+ * keyed on the file's path, size and modification time plus the extraction settings; edits
+ * to referenced layers alone are not detected.
+ * @param directory Cache directory, created if missing (NULL or "" disables)
+ * @param max_bytes Size budget; least recently used entries are deleted beyond it
+ * @return 1 on success, 0 if the directory cannot be used
+ */
+ANARI_USD_MIDDLEWARE_C_API int ConfigureMeshDiskCache_C(const char* directory, uint64_t max_bytes);
+
+/**
+ * Delete every entry of the mesh disk cache
+ */
+ANARI_USD_MIDDLEWARE_C_API void ClearMeshDiskCache_C(void);
+
+/**
+ * Forget all duplicate-detection state and cached meshes and textures in memory
+ */
+ANARI_USD_MIDDLEWARE_C_API void ClearCaches_C(void);
+
+/**
+ * Get latency percentiles of every pipeline stage, from receive to file callbacks
+ * @param out_stats Array receiving up to capacity entries (may be NULL when capacity is 0)
+ * @param capacity Number of entries out_stats can hold
+ * @return Number of stages available (may exceed capacity)
+ */
+ANARI_USD_MIDDLEWARE_C_API size_t GetStageStats_C(CStageStats* out_stats, size_t capacity);
+
+/**
+ * Clear the stage latency histograms
+ */
+ANARI_USD_MIDDLEWARE_C_API void ResetStageStats_C(void);
+
+/**
+ * Start or stop recording individual stage events for WriteTrace_C
+ * @param enable Non-zero to capture; enabling discards the previous trace
+ * @param max_events Events kept, the oldest are overwritten (0 selects the default of 100000)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetTraceCapture_C(int enable, size_t max_events);
+
+/**
+ * Write the captured stage events as Chrome trace JSON, for chrome://tracing or ui.perfetto.dev
+ * @param path Output file, replaced if present
+ * @return 1 on success, 0 on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API int WriteTrace_C(const char* path);
+
+/**
+ * Forget the previous file versions used for scene deltas
+ */
+ANARI_USD_MIDDLEWARE_C_API void ClearSceneHistory_C(void);
+
+/**
+ * Configure progressive LOD delivery
+ * Each level holds about a quarter of the triangles of the next finer one
+ * @param level_count Levels per mesh including full resolution (1-8, default 3)
+ * @param min_triangles Meshes with fewer triangles are sent at full resolution only (default 100000)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetLodOptions_C(unsigned int level_count, size_t min_triangles);
+
 // ============================================================================
 // USD PROCESSING FUNCTIONS
 // ============================================================================
 
 /**
  * Load USD data from memory buffer and extract mesh geometry
- * Supports .usd, .usda, .usdc, and .usdz formats
+ * Supports .usd, .usda, .usdc, and .usdz formats, and binary .jmesh mesh containers
  * Extracts vertex positions, indices, normals, UVs, and vertex colors
  * @param buffer Raw USD file data
  * @param buffer_size Size of buffer in bytes
  * @param filename Original filename (used for format detection)
- * @param out_meshes Pointer to receive array of extracted meshes (caller must free)
+ * The mesh array and all attribute arrays share one allocation
+ * @param out_meshes Pointer to receive array of extracted meshes (free with FreeMeshData_C)
  * @param out_count Pointer to receive number of extracted meshes
  * @return 1 on success, 0 on failure
  */
@@ -166,7 +558,7 @@ ANARI_USD_MIDDLEWARE_C_API int LoadUSDBuffer_C(const unsigned char* buffer,
  * Load USD data directly from disk file
  * Wrapper around LoadUSDBuffer_C with file I/O handling
  * @param filepath Path to USD file on disk
- * @param out_meshes Pointer to receive array of extracted meshes (caller must free)
+ * @param out_meshes Pointer to receive array of extracted meshes (free with FreeMeshData_C)
  * @param out_count Pointer to receive number of extracted meshes
  * @return 1 on success, 0 on failure
  */
@@ -174,6 +566,178 @@ ANARI_USD_MIDDLEWARE_C_API int LoadUSDFromDisk_C(const char* filepath,
                                                  CMeshData** out_meshes,
                                                  size_t* out_count);
 
+/**
+ * Load USD data from memory and hand each mesh to a callback as soon as it is extracted
+ * No mesh list is built, so memory stays at the meshes in flight. With instancing enabled
+ * the meshes arrive at the end of the load.
+ * @param buffer Raw USD file data or mesh container
+ * @param buffer_size Size of buffer in bytes
+ * @param filename Original filename (used for format detection)
+ * @param on_mesh Callback receiving each mesh
+ * @param user_data Passed to on_mesh
+ * @return 1 on success, 0 on failure or when on_mesh stopped the load
+ */
+ANARI_USD_MIDDLEWARE_C_API int LoadUSDBufferStreaming_C(const unsigned char* buffer,
+                                                       size_t buffer_size,
+                                                       const char* filename,
+                                                       MeshStreamCallback_C on_mesh,
+                                                       void* user_data);
+
+/**
+ * Load a USD file from disk with per-mesh delivery, see LoadUSDBufferStreaming_C
+ * @param filepath Path to USD file on disk
+ * @param on_mesh Callback receiving each mesh
+ * @param user_data Passed to on_mesh
+ * @return 1 on success, 0 on failure or when on_mesh stopped the load
+ */
+ANARI_USD_MIDDLEWARE_C_API int LoadUSDFromDiskStreaming_C(const char* filepath,
+                                                         MeshStreamCallback_C on_mesh,
+                                                         void* user_data);
+
+/**
+ * Allocation callback for the *WithAllocator_C loaders
+ * Called once per load with the total size; must return memory aligned to at least 16 bytes
+ * @param size Bytes required for the mesh headers and all attribute arrays
+ * @param user_data Value passed through from the loader call
+ * @return Allocated memory, or NULL to abort the load
+ */
+typedef void* (*MeshArenaAllocator_C)(size_t size, void* user_data);
+
+/**
+ * Load USD data from memory into a single caller-provided allocation
+ * Same as LoadUSDBuffer_C, but the memory comes from allocator and belongs to the caller
+ * (do not pass it to FreeMeshData_C). A NULL allocator uses malloc.
+ * @param buffer Raw USD file data
+ * @param buffer_size Size of buffer in bytes
+ * @param filename Original filename (used for format detection)
+ * @param allocator Allocation callback
+ * @param user_data Passed to allocator
+ * @param out_meshes Pointer to receive array of extracted meshes (start of the allocation)
+ * @param out_count Pointer to receive number of extracted meshes
+ * @return 1 on success, 0 on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API int LoadUSDBufferWithAllocator_C(const unsigned char* buffer,
+                                                           size_t buffer_size,
+                                                           const char* filename,
+                                                           MeshArenaAllocator_C allocator,
+                                                           void* user_data,
+                                                           CMeshData** out_meshes,
+                                                           size_t* out_count);
+
+/**
+ * Load a USD file from disk into a single caller-provided allocation
+ * See LoadUSDBufferWithAllocator_C for ownership rules
+ * @param filepath Path to USD file on disk
+ * @param allocator Allocation callback
+ * @param user_data Passed to allocator
+ * @param out_meshes Pointer to receive array of extracted meshes (start of the allocation)
+ * @param out_count Pointer to receive number of extracted meshes
+ * @return 1 on success, 0 on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API int LoadUSDFromDiskWithAllocator_C(const char* filepath,
+                                                             MeshArenaAllocator_C allocator,
+                                                             void* user_data,
+                                                             CMeshData** out_meshes,
+                                                             size_t* out_count);
+
+/**
+ * Queue a load on the middleware's load threads and return immediately
+ * The buffer is copied, so it may be freed as soon as the call returns
+ * @param buffer Raw USD file data or mesh container
+ * @param buffer_size Size of buffer in bytes
+ * @param filename Original filename (used for format detection and cancel_previous)
+ * @param options Callbacks and executor, or NULL to poll with GetLoadStatus_C
+ * @return Load id, 0 on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API uint64_t LoadUSDBufferAsync_C(const unsigned char* buffer,
+                                                        size_t buffer_size,
+                                                        const char* filename,
+                                                        const CAsyncLoadOptions* options);
+
+/**
+ * Queue a load of a USD file from disk, see LoadUSDBufferAsync_C
+ * @param filepath Path to USD file on disk
+ * @param options Callbacks and executor, or NULL to poll with GetLoadStatus_C
+ * @return Load id, 0 on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API uint64_t LoadUSDFromDiskAsync_C(const char* filepath,
+                                                          const CAsyncLoadOptions* options);
+
+/**
+ * Poll an asynchronous load
+ * @param load_id Load id
+ * @param out_state Receives the state (may be NULL)
+ * @param out_progress Receives the progress from 0 to 1 (may be NULL)
+ * @return 1 if the load is known, 0 otherwise (released, taken or evicted)
+ */
+ANARI_USD_MIDDLEWARE_C_API int GetLoadStatus_C(uint64_t load_id, CLoadState* out_state, float* out_progress);
+
+/**
+ * Block until an asynchronous load completes, fails or is cancelled
+ * @param load_id Load id
+ * @param timeout_ms Maximum wait in milliseconds, negative waits indefinitely
+ * @return 1 if the load has finished, 0 on timeout or unknown id
+ */
+ANARI_USD_MIDDLEWARE_C_API int WaitForLoad_C(uint64_t load_id, int timeout_ms);
+
+/**
+ * Get the meshes of a completed load and forget the load
+ * @param load_id Load id
+ * @param out_meshes Pointer to receive array of extracted meshes (free with FreeMeshData_C)
+ * @param out_count Pointer to receive number of extracted meshes
+ * @return 1 on success, 0 if the load is unfinished, failed, was cancelled or is unknown
+ */
+ANARI_USD_MIDDLEWARE_C_API int TakeLoadResult_C(uint64_t load_id, CMeshData** out_meshes, size_t* out_count);
+
+/**
+ * Cancel an asynchronous load; a running load stops at the next prim or mesh
+ * @param load_id Load id
+ * @return 1 if the load was queued or running, 0 otherwise
+ */
+ANARI_USD_MIDDLEWARE_C_API int CancelLoad_C(uint64_t load_id);
+
+/**
+ * Forget an asynchronous load, cancelling it if unfinished
+ * @param load_id Load id
+ */
+ANARI_USD_MIDDLEWARE_C_API void ReleaseLoad_C(uint64_t load_id);
+
+/**
+ * Set how many asynchronous loads run at the same time; takes effect with the first load
+ * @param worker_count Number of load threads (1-64, default 2)
+ */
+ANARI_USD_MIDDLEWARE_C_API void SetAsyncLoadWorkers_C(size_t worker_count);
+
+/**
+ * Evaluate the world transform of every mesh prim without extracting geometry
+ * Repeated calls on the same content reuse the parsed stage and re-evaluate only
+ * time-sampled xformOps
+ * @param buffer Raw USD file data
+ * @param buffer_size Size of buffer in bytes
+ * @param filename Original filename (used for format detection)
+ * @param time_code Stage time code (NaN selects the default values)
+ * @param out_transforms Pointer to receive the transforms (free with FreeMeshTransforms_C)
+ * @param out_count Pointer to receive the number of transforms
+ * @return 1 on success, 0 on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API int EvaluateTransforms_C(const unsigned char* buffer,
+                                                   size_t buffer_size,
+                                                   const char* filename,
+                                                   double time_code,
+                                                   CMeshTransform** out_transforms,
+                                                   size_t* out_count);
+
+/**
+ * Convert float RGBA colors (e.g. CMeshData::vertex_colors) to 8 bits per channel
+ * Values are clamped to [0, 1] and scaled by 255; uses SIMD where available
+ * @param rgba Input colors (count * 4 floats)
+ * @param count Number of colors
+ * @param out_bytes Output buffer of count * 4 bytes
+ * @param bgra Non-zero to write b, g, r, a order (Unreal FColor layout), zero for r, g, b, a
+ */
+ANARI_USD_MIDDLEWARE_C_API void PackVertexColors_C(const float* rgba, size_t count,
+                                                  unsigned char* out_bytes, int bgra);
+
 // ============================================================================
 // TEXTURE PROCESSING FUNCTIONS
 // ============================================================================
@@ -189,6 +753,46 @@ ANARI_USD_MIDDLEWARE_C_API int LoadUSDFromDisk_C(const char* filepath,
 ANARI_USD_MIDDLEWARE_C_API CTextureData CreateTextureFromBuffer_C(const unsigned char* buffer,
                                                                   size_t buffer_size);
 
+/**
+ * Create texture data, looking the content up in the texture cache by its hash frame
+ * @param buffer Raw image file data, e.g. CFileData::data of a received IMAGE file
+ * @param buffer_size Size of buffer in bytes
+ * @param content_hash Hash frame of the content (CFileData::hash); NULL or "" hashes the buffer
+ * @return Texture data structure (caller must free with FreeTextureData_C)
+ */
+ANARI_USD_MIDDLEWARE_C_API CTextureData CreateTextureFromBufferWithHash_C(const unsigned char* buffer,
+                                                                          size_t buffer_size,
+                                                                          const char* content_hash);
+
+/**
+ * Decode an image into a GPU-ready texture, optionally with mips and BC1/BC3 compression.
+ * Does not require InitializeMiddleware_C.
+ * @param buffer Encoded image (PNG, JPEG, ...)
+ * @param buffer_size Size of buffer in bytes
+ * @param options Processing options (NULL = RGBA8 without mips)
+ * @param out_texture Receives the texture (release with FreeGpuTexture_C)
+ * @return 1 on success, 0 on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API int CreateGpuTexture_C(const unsigned char* buffer, size_t buffer_size,
+                                                  const CTextureOptions* options, CGpuTexture* out_texture);
+
+/**
+ * Process several images in parallel on the middleware's worker pool, one image per
+ * thread at a time
+ * @param buffers Encoded images
+ * @param buffer_sizes Size of each image in bytes
+ * @param count Number of images
+ * @param options Processing options shared by all images (NULL = RGBA8 without mips)
+ * @param thread_count Threads working on the batch at most, including the caller (0 = the whole pool)
+ * @param out_textures Array of count textures; failed images are zeroed.
+ *                     Release each with FreeGpuTexture_C
+ * @return Number of images processed successfully
+ */
+ANARI_USD_MIDDLEWARE_C_API size_t CreateGpuTextures_C(const unsigned char* const* buffers,
+                                                      const size_t* buffer_sizes, size_t count,
+                                                      const CTextureOptions* options, size_t thread_count,
+                                                      CGpuTexture* out_textures);
+
 /**
  * Extract gradient line from image and write as PNG file
  * Specialized function for gradient/colormap processing
@@ -221,18 +825,30 @@ ANARI_USD_MIDDLEWARE_C_API int GetGradientLineAsPNGBuffer_C(const unsigned char*
 
 /**
  * Free mesh data array allocated by LoadUSDBuffer_C or LoadUSDFromDisk_C
- * Safely deallocates all internal arrays and the main array
+ * The array and its attribute data are one allocation, released in a single call
  * @param meshes Pointer to mesh array to free
- * @param count Number of meshes in array
+ * @param count Number of meshes in array (unused, kept for compatibility)
  */
 ANARI_USD_MIDDLEWARE_C_API void FreeMeshData_C(CMeshData* meshes, size_t count);
 
+/**
+ * Free a transform array returned by EvaluateTransforms_C
+ * @param transforms Pointer to the array to free
+ */
+ANARI_USD_MIDDLEWARE_C_API void FreeMeshTransforms_C(CMeshTransform* transforms);
+
 /**
  * Free texture data allocated by CreateTextureFromBuffer_C
  * @param texture Pointer to texture data to free
  */
 ANARI_USD_MIDDLEWARE_C_API void FreeTextureData_C(CTextureData* texture);
 
+/**
+ * Free a texture created by CreateGpuTexture_C or CreateGpuTextures_C
+ * @param texture Texture to free (zeroed afterwards)
+ */
+ANARI_USD_MIDDLEWARE_C_API void FreeGpuTexture_C(CGpuTexture* texture);
+
 /**
  * Free generic buffer allocated by middleware functions
  * @param buffer Pointer to buffer to free
@@ -240,11 +856,28 @@ ANARI_USD_MIDDLEWARE_C_API void FreeTextureData_C(CTextureData* texture);
 ANARI_USD_MIDDLEWARE_C_API void FreeBuffer_C(unsigned char* buffer);
 
 /**
- * Free file data structure (for callback cleanup if needed)
- * @param file_data Pointer to file data to free
+ * Free file data structure (deprecated)
+ * File data is owned by the middleware, so this only clears the data fields.
+ * Use RetainFileData_C / ReleaseFileData_C to control payload lifetime.
+ * @param file_data Pointer to file data to clear
  */
 ANARI_USD_MIDDLEWARE_C_API void FreeFileData_C(CFileData* file_data);
 
+/**
+ * Take a reference to received file data so it outlives the callback
+ * The returned struct shares the same bytes; nothing is copied.
+ * @param file_data File data passed to the callback (or a previously retained struct)
+ * @return New struct to pass to ReleaseFileData_C, or NULL on failure
+ */
+ANARI_USD_MIDDLEWARE_C_API CFileData* RetainFileData_C(const CFileData* file_data);
+
+/**
+ * Drop a reference taken with RetainFileData_C and free the struct
+ * The bytes are freed once no references remain.
+ * @param file_data Struct returned by RetainFileData_C (NULL is ignored)
+ */
+ANARI_USD_MIDDLEWARE_C_API void ReleaseFileData_C(CFileData* file_data);
+
 // ============================================================================
 // CALLBACK REGISTRATION FUNCTIONS
 // ============================================================================
@@ -263,6 +896,22 @@ ANARI_USD_MIDDLEWARE_C_API void RegisterUpdateCallback_C(FileReceivedCallback_C
  */
 ANARI_USD_MIDDLEWARE_C_API void RegisterMessageCallback_C(MessageReceivedCallback_C callback);
 
+/**
+ * Register callback function for scene delta notifications
+ * Only one delta callback can be registered at a time; register before InitializeMiddleware_C.
+ * While set, every received USD file is also parsed by the middleware.
+ * @param callback Function pointer to call with each change set (NULL disables deltas)
+ */
+ANARI_USD_MIDDLEWARE_C_API void RegisterSceneDeltaCallback_C(SceneDeltaCallback_C callback);
+
+/**
+ * Register callback function for progressive LOD delivery
+ * Only one LOD callback can be registered at a time; register before InitializeMiddleware_C.
+ * While set, every received USD file is parsed and its large meshes are sent coarsest level first.
+ * @param callback Function pointer to call with each mesh level (NULL disables LOD delivery)
+ */
+ANARI_USD_MIDDLEWARE_C_API void RegisterMeshLodCallback_C(MeshLodCallback_C callback);
+
 #ifdef __cplusplus
 }
 #endif
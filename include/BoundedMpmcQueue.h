@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace anari_usd_middleware {
+
+/**
+ * Fixed-capacity lock-free multi-producer/multi-consumer queue (Vyukov ring).
+ * tryPush/tryPop never block and never allocate; callers build their own waiting
+ * policy on top. Capacity is rounded up to the next power of two.
+ */
+template <typename T>
+class BoundedMpmcQueue {
+public:
+    /**
+     * @param requestedCapacity Minimum number of slots (at least 2)
+     */
+    explicit BoundedMpmcQueue(size_t requestedCapacity)
+        : capacityValue(roundUpToPowerOfTwo(requestedCapacity < 2 ? 2 : requestedCapacity)),
+          mask(capacityValue - 1),
+          cells(new Cell[capacityValue]) {
+        for (size_t i = 0; i < capacityValue; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~BoundedMpmcQueue() {
+        T discarded;
+        while (tryPop(discarded)) {
+        }
+    }
+
+    BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+    BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+    /**
+     * Enqueue an item if a slot is free
+     * @param item Item to move into the queue (left untouched on failure)
+     * @return True if enqueued, false if the queue is full
+     */
+    bool tryPush(T&& item) {
+        Cell* cell = nullptr;
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Full
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (&cell->storage) T(std::move(item));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Dequeue the oldest item if one is available
+     * @param out Receives the dequeued item
+     * @return True if an item was dequeued, false if the queue is empty
+     */
+    bool tryPop(T& out) {
+        Cell* cell = nullptr;
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Empty
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* stored = std::launder(reinterpret_cast<T*>(&cell->storage));
+        out = std::move(*stored);
+        stored->~T();
+        cell->sequence.store(pos + capacityValue, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Approximate number of queued items (exact when no push/pop is in flight)
+     */
+    size_t sizeApprox() const {
+        size_t tail = enqueuePos.load(std::memory_order_acquire);
+        size_t head = dequeuePos.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool emptyApprox() const { return sizeApprox() == 0; }
+
+    size_t capacity() const { return capacityValue; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Keep producer and consumer cursors on separate cache lines
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    const size_t capacityValue;
+    const size_t mask;
+    std::unique_ptr<Cell[]> cells;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos{0};
+};
+
+} // namespace anari_usd_middleware
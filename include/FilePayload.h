@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace anari_usd_middleware {
+
+/**
+ * Immutable, reference-counted view of a received file's bytes.
+ * Copies share the underlying buffer (normally the ZeroMQ message the file arrived in),
+ * so handing a payload to callbacks never duplicates the data. The bytes stay valid
+ * for as long as any copy is alive.
+ */
+class FilePayload {
+public:
+    FilePayload() = default;
+
+    /**
+     * Wrap memory whose lifetime is bound to an owning object
+     * @param keepAlive Object that owns the bytes (released when the last copy goes away)
+     * @param bytes Pointer to the first byte, valid while keepAlive lives
+     * @param size Number of bytes
+     */
+    FilePayload(std::shared_ptr<const void> keepAlive, const uint8_t* bytes, size_t size)
+        : owner(std::move(keepAlive)), bytesPtr(bytes), length(size) {}
+
+    /**
+     * Take ownership of a vector without copying its contents
+     * @param buffer Bytes to adopt
+     * @return Payload sharing the moved vector's storage
+     */
+    static FilePayload fromVector(std::vector<uint8_t> buffer) {
+        auto holder = std::make_shared<const std::vector<uint8_t>>(std::move(buffer));
+        return FilePayload(holder, holder->data(), holder->size());
+    }
+
+    const uint8_t* data() const { return bytesPtr; }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    const uint8_t* begin() const { return bytesPtr; }
+    const uint8_t* end() const { return bytesPtr + length; }
+    uint8_t operator[](size_t index) const { return bytesPtr[index]; }
+
+    /**
+     * Copy the bytes into owned storage, for APIs that still take a vector
+     * @return New vector holding a copy of the payload
+     */
+    std::vector<uint8_t> toVector() const { return std::vector<uint8_t>(begin(), end()); }
+
+    /**
+     * Number of payloads currently sharing this buffer (0 when empty)
+     */
+    long useCount() const { return owner.use_count(); }
+
+    // Drop this reference; the buffer is freed once no copies remain
+    void reset() {
+        owner.reset();
+        bytesPtr = nullptr;
+        length = 0;
+    }
+
+private:
+    std::shared_ptr<const void> owner;
+    const uint8_t* bytesPtr = nullptr;
+    size_t length = 0;
+};
+
+} // namespace anari_usd_middleware
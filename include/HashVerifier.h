@@ -1,21 +1,112 @@
 #pragma once
 
+#include <array>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <memory>
 #include <atomic>
 #include <functional>
-#include <mutex>
 #include "MiddlewareLogging.h"
 
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+struct evp_md_ctx_st;
+
 namespace anari_usd_middleware {
 
+/**
+ * Binary 32-byte content digest used as a cache key
+ */
+using ContentDigest = std::array<uint8_t, 32>;
+
+struct ContentDigestHash {
+    size_t operator()(const ContentDigest& digest) const {
+        // Digest bytes are already uniformly distributed
+        size_t value;
+        std::memcpy(&value, digest.data(), sizeof(value));
+        return value;
+    }
+};
+
 /**
  * Thread-safe utility class for verifying SHA256 hashes with comprehensive error handling
  * and memory safety features for Unreal Engine 5.5 compatibility.
  */
-class HashVerifier {
+class ANARI_USD_MIDDLEWARE_API HashVerifier {
 public:
+    /**
+     * Digest algorithms a sender may pick. The hash frame names the algorithm as a
+     * "<name>:" prefix; an untagged frame is SHA256, which is what older senders send.
+     * BLAKE2b is considerably faster in software and is meant for trusted networks.
+     */
+    enum class HashAlgorithm {
+        Sha256,
+        Blake2b512
+    };
+
+    /**
+     * Incremental digest over data that arrives in pieces (e.g. chunked transfers).
+     * Each instance owns its EVP context, so updates take no global lock, and the
+     * context can be reused for another digest via reset().
+     */
+    class StreamingHash {
+    public:
+        explicit StreamingHash(HashAlgorithm algorithm = HashAlgorithm::Sha256);
+        ~StreamingHash();
+
+        StreamingHash(const StreamingHash&) = delete;
+        StreamingHash& operator=(const StreamingHash&) = delete;
+        StreamingHash(StreamingHash&& other) noexcept;
+        StreamingHash& operator=(StreamingHash&& other) noexcept;
+
+        /**
+         * @return True if the digest context was initialized and not yet finalized
+         */
+        bool isValid() const;
+
+        /**
+         * Start a new digest on the existing context
+         * @param newAlgorithm Algorithm for the next digest
+         * @return True if the context is ready for updates
+         */
+        bool reset(HashAlgorithm newAlgorithm);
+        bool reset() { return reset(hashAlgorithm); }
+
+        /**
+         * Feed the next piece of data
+         * @param data Pointer to the bytes
+         * @param size Number of bytes
+         * @return True on success, false if the context is invalid or the update failed
+         */
+        bool update(const uint8_t* data, size_t size);
+
+        /**
+         * Finish the digest; no further updates are accepted until reset()
+         * @return Digest as lowercase hex string, empty string on failure
+         */
+        std::string finalizeHex();
+
+        /**
+         * @return Total number of bytes fed so far
+         */
+        uint64_t bytesHashed() const { return totalBytes; }
+
+        HashAlgorithm algorithm() const { return hashAlgorithm; }
+
+    private:
+        evp_md_ctx_st* context = nullptr;
+        HashAlgorithm hashAlgorithm = HashAlgorithm::Sha256;
+        uint64_t totalBytes = 0;
+        bool finalized = false;
+    };
+
     /**
      * Verify a SHA256 hash against provided data with bounds checking
      * @param data The data buffer to verify (must not exceed safety limits)
@@ -24,6 +115,15 @@ public:
      */
     static bool verifyHash(const std::vector<uint8_t>& data, const std::string& expectedHash);
 
+    /**
+     * Verify a hash frame against a borrowed byte range (no copy is made)
+     * @param data Pointer to the first byte
+     * @param size Number of bytes (must not exceed safety limits)
+     * @param expectedHash Hash frame: bare SHA256 hex, or "<algorithm>:<hex>" (see parseHashFrame)
+     * @return True if hash matches and verification succeeds, false otherwise
+     */
+    static bool verifyHash(const uint8_t* data, size_t size, const std::string& expectedHash);
+
     /**
      * Calculate SHA256 hash from data buffer with memory safety
      * @param data The data buffer to hash (must not exceed safety limits)
@@ -31,10 +131,71 @@ public:
      */
     static std::string calculateHash(const std::vector<uint8_t>& data);
 
+    /**
+     * Calculate SHA256 hash of a borrowed byte range
+     * @param data Pointer to the first byte
+     * @param size Number of bytes (must not exceed safety limits)
+     * @return SHA256 hash as lowercase hex string, empty string on failure
+     */
+    static std::string calculateHash(const uint8_t* data, size_t size);
+
+    /**
+     * Calculate a digest of a borrowed byte range with the given algorithm
+     * @param data Pointer to the first byte
+     * @param size Number of bytes (must not exceed safety limits)
+     * @param algorithm Digest algorithm
+     * @return Digest as lowercase hex string (untagged), empty string on failure
+     */
+    static std::string calculateHash(const uint8_t* data, size_t size, HashAlgorithm algorithm);
+
+    /**
+     * Compute the binary SHA256 digest of a byte range
+     * @param data Pointer to the first byte
+     * @param size Number of bytes (must not exceed safety limits)
+     * @param digest Output digest
+     * @return True on success, false otherwise
+     */
+    static bool calculateDigest(const uint8_t* data, size_t size, ContentDigest& digest);
+
+    /**
+     * Derive a content digest from a hash frame without touching the data
+     * @param frame Hash frame (see parseHashFrame); longer digests are truncated to 32 bytes
+     * @param digest Output digest
+     * @return True if the frame parsed, false otherwise
+     */
+    static bool digestFromHashFrame(const std::string& frame, ContentDigest& digest);
+
+    /**
+     * Split a hash frame into algorithm and hex digest
+     * @param frame "<hex>" (SHA256) or "<algorithm>:<hex>", e.g. "blake2b512:..."
+     * @param algorithm Output algorithm
+     * @param hexDigest Output digest, validated for the algorithm's length
+     * @return True if the frame names a supported algorithm with a well-formed digest
+     */
+    static bool parseHashFrame(const std::string& frame, HashAlgorithm& algorithm, std::string& hexDigest);
+
+    /**
+     * Build the hash frame a sender would transmit
+     * @param algorithm Digest algorithm
+     * @param hexDigest Hex digest
+     * @return Untagged digest for SHA256, "<algorithm>:<hex>" otherwise
+     */
+    static std::string formatHashFrame(HashAlgorithm algorithm, const std::string& hexDigest);
+
+    /**
+     * @return Frame prefix name of an algorithm ("sha256", "blake2b512")
+     */
+    static const char* algorithmName(HashAlgorithm algorithm);
+
+    /**
+     * @return Length of a hex digest produced by the algorithm
+     */
+    static size_t digestHexLength(HashAlgorithm algorithm);
+
     /**
      * Verify hash with streaming support for large files
      * @param data The data buffer to verify
-     * @param expectedHash The expected hash
+     * @param expectedHash Hash frame: bare SHA256 hex, or "<algorithm>:<hex>" (see parseHashFrame)
      * @param chunkSize Size of chunks to process (default 1MB)
      * @return True if verification succeeds, false otherwise
      */
@@ -53,13 +214,13 @@ public:
 
     /**
      * Validate hash string format
-     * @param hashString The hash string to validate
-     * @return True if valid SHA256 format (64 hex characters), false otherwise
+     * @param hashString Hash frame to validate (see parseHashFrame)
+     * @return True if the digest has the hex length of the frame's algorithm, false otherwise
      */
     static bool isValidHashFormat(const std::string& hashString);
 
     /**
-     * Compare two hash strings safely
+     * Compare two hex digests of the same algorithm safely (case-insensitive, constant time)
      * @param hash1 First hash string
      * @param hash2 Second hash string
      * @return True if hashes match, false otherwise
@@ -70,23 +231,21 @@ public:
      * Get the maximum safe buffer size for hash operations
      * @return Maximum buffer size in bytes
      */
-    static constexpr size_t getMaxSafeBufferSize() {
-        return safety::MAX_BUFFER_SIZE;
+    static constexpr uint64_t getMaxSafeBufferSize() {
+        return safety::MAX_STREAMED_FILE_SIZE;
     }
 
 private:
-    // Thread safety for OpenSSL operations
-    static std::mutex opensslMutex;
-
     // Internal validation helpers
     static bool validateInputData(const std::vector<uint8_t>& data, const std::string& context);
-    static bool validateHashString(const std::string& hash, const std::string& context);
+    static bool validateInputData(const uint8_t* data, size_t size, const std::string& context);
+
+    // One-shot digest on this thread's reusable context; OpenSSL needs no external locking
+    static std::string performHashOperation(const uint8_t* data, size_t size,
+                                            HashAlgorithm algorithm,
+                                            const std::string& context);
 
-    // OpenSSL wrapper with error handling
-    static bool performHashOperation(const std::vector<uint8_t>& data,
-                                   unsigned char* hash,
-                                   unsigned int* hashLen,
-                                   const std::string& context);
+    static bool isHexString(const std::string& value);
 
     // Safe hex conversion
     static std::string bytesToHexString(const unsigned char* bytes, unsigned int length);
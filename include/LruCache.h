@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace anari_usd_middleware {
+
+/**
+ * Fixed-capacity least-recently-used map. Each entry carries a cost (1 by default);
+ * inserting evicts from the cold end until both the entry limit and the cost budget hold.
+ * Not internally synchronized: callers guard it with their own mutex.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t totalCost = 0;
+    };
+
+    /**
+     * @param maxEntries Maximum number of entries (0 disables the cache)
+     * @param maxCost Maximum summed cost of all entries
+     */
+    explicit LruCache(size_t maxEntries, size_t maxCost = std::numeric_limits<size_t>::max())
+        : entryLimit(maxEntries), costLimit(maxCost) {}
+
+    /**
+     * Look up an entry and mark it most recently used
+     * @param key Key to look up
+     * @return Pointer to the cached value (valid until the next mutation), nullptr on miss
+     */
+    Value* find(const Key& key) {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            ++counters.misses;
+            return nullptr;
+        }
+        ++counters.hits;
+        entries.splice(entries.begin(), entries, it->second);
+        return &it->second->value;
+    }
+
+    /**
+     * Insert or replace an entry as most recently used, evicting cold entries as needed
+     * @param key Key to store
+     * @param value Value to store
+     * @param cost Cost charged against the budget
+     * @return False if the entry can never fit (cache disabled or cost above budget)
+     */
+    bool insert(const Key& key, Value value, size_t cost = 1) {
+        if (entryLimit == 0 || cost > costLimit) {
+            return false;
+        }
+
+        auto it = index.find(key);
+        if (it != index.end()) {
+            currentCost -= it->second->cost;
+            it->second->value = std::move(value);
+            it->second->cost = cost;
+            currentCost += cost;
+            entries.splice(entries.begin(), entries, it->second);
+        } else {
+            entries.push_front(Entry{key, std::move(value), cost});
+            index.emplace(key, entries.begin());
+            currentCost += cost;
+        }
+
+        enforceLimits();
+        return true;
+    }
+
+    /**
+     * Remove an entry if present (not counted as an eviction)
+     */
+    void erase(const Key& key) {
+        auto it = index.find(key);
+        if (it != index.end()) {
+            currentCost -= it->second->cost;
+            entries.erase(it->second);
+            index.erase(it);
+        }
+    }
+
+    void clear() {
+        entries.clear();
+        index.clear();
+        currentCost = 0;
+    }
+
+    /**
+     * Change the limits, evicting immediately if the cache is now over budget
+     */
+    void setLimits(size_t maxEntries, size_t maxCost = std::numeric_limits<size_t>::max()) {
+        entryLimit = maxEntries;
+        costLimit = maxCost;
+        enforceLimits();
+    }
+
+    size_t maxEntries() const { return entryLimit; }
+    size_t maxCost() const { return costLimit; }
+    size_t size() const { return index.size(); }
+
+    Stats getStats() const {
+        Stats snapshot = counters;
+        snapshot.entries = index.size();
+        snapshot.totalCost = currentCost;
+        return snapshot;
+    }
+
+    void resetStats() {
+        counters = Stats{};
+    }
+
+private:
+    struct Entry {
+        Key key;
+        Value value;
+        size_t cost;
+    };
+
+    void enforceLimits() {
+        while (!entries.empty() && (index.size() > entryLimit || currentCost > costLimit)) {
+            const Entry& coldest = entries.back();
+            currentCost -= coldest.cost;
+            index.erase(coldest.key);
+            entries.pop_back();
+            ++counters.evictions;
+        }
+    }
+
+    std::list<Entry> entries; // Most recently used first
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> index;
+    size_t entryLimit;
+    size_t costLimit;
+    size_t currentCost = 0;
+    Stats counters;
+};
+
+} // namespace anari_usd_middleware
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace anari_usd_middleware {
+
+/**
+ * Read-only memory mapping of a whole file (POSIX mmap / Win32 MapViewOfFile).
+ * Pages are faulted in on demand, so large files can be consumed without first
+ * reading them into a heap buffer.
+ */
+class MappedFile {
+public:
+    /**
+     * Map a file read-only
+     * @param path File to map (must exist and be non-empty)
+     * @param removeOnClose Delete the file once the mapping is released (for spool files)
+     * @return Shared mapping, or nullptr on failure (logged)
+     */
+    static std::shared_ptr<MappedFile> open(const std::string& path, bool removeOnClose = false);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Ask the OS to start reading a range into the page cache ahead of use (a hint only)
+     * @param offset First byte of the range
+     * @param bytes Length of the range (clamped to the file size)
+     */
+    void prefetch(size_t offset, size_t bytes) const;
+
+    const uint8_t* data() const { return bytes; }
+    size_t size() const { return length; }
+    const std::string& path() const { return filePath; }
+
+private:
+    MappedFile() = default;
+
+    std::string filePath;
+    const uint8_t* bytes = nullptr;
+    size_t length = 0;
+    bool removeFile = false;
+
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+} // namespace anari_usd_middleware
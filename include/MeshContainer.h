@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Binary container for pre-triangulated meshes (".jmesh"), for producers that already hold
+ * geometry in memory. Attributes are stored as flat little-endian blocks in the same layout
+ * as MeshData, each aligned to BLOCK_ALIGNMENT, so a received buffer is read in place.
+ *
+ * Layout (all integers little-endian, offsets are bytes from the start of the file):
+ *   Header, HEADER_SIZE bytes:
+ *     0  char[4] magic "JMSH"      4  u16 version          6  u16 header size
+ *     8  u32 mesh count           12  u32 flags (0)       16  u64 file size
+ *    24  u64 mesh table offset    32  reserved (0) up to the header size
+ *   Mesh table: mesh count records of RECORD_SIZE bytes:
+ *     0  u64 name offset           8  u32 name length     12  u32 type name length
+ *    16  u64 type name offset     24  u64 vertex count    32  u64 index count
+ *    40  u64 instance count       48  u64 points offset   56  u64 indices offset
+ *    64  u64 normals offset       72  u64 uvs offset      80  u64 colors offset
+ *    88  u64 instances offset     96  reserved (0) up to the record size
+ *   Blocks: points (xyz), indices (u32, three per triangle), normals (xyz), uvs (uv),
+ *   colors (rgba) and instance transforms (16 floats, column-major). Optional blocks have
+ *   offset 0 when absent. Names are UTF-8 without terminator.
+ */
+namespace container {
+
+constexpr char MAGIC[4] = {'J', 'M', 'S', 'H'};
+constexpr uint16_t VERSION = 1;
+constexpr size_t HEADER_SIZE = 64;
+constexpr size_t RECORD_SIZE = 128;
+constexpr size_t BLOCK_ALIGNMENT = 16;
+constexpr size_t MAX_MESHES = 1u << 20;
+constexpr size_t MAX_NAME_LENGTH = 1024;
+
+/**
+ * File extension used for type detection of received files
+ */
+constexpr const char* FILE_EXTENSION = ".jmesh";
+
+/**
+ * One mesh of a container. Returned by parse() pointing into the container; passed to
+ * encode() pointing at the producer's arrays. Optional attributes are nullptr when absent.
+ */
+struct MeshView {
+    std::string_view elementName;
+    std::string_view typeName;
+    const float* points = nullptr;     ///< vertexCount * 3 floats
+    size_t vertexCount = 0;
+    const uint32_t* indices = nullptr; ///< indexCount indices, three per triangle
+    size_t indexCount = 0;
+    const float* normals = nullptr;    ///< vertexCount * 3 floats
+    const float* uvs = nullptr;        ///< vertexCount * 2 floats
+    const float* colors = nullptr;     ///< vertexCount * 4 floats
+    const float* instanceTransforms = nullptr; ///< instanceCount * 16 floats
+    size_t instanceCount = 0;
+};
+
+/**
+ * Cheap check of the magic and version, e.g. for content sniffing
+ * @param data Buffer to check
+ * @param size Size of data in bytes
+ * @return True if data starts with a supported container header
+ */
+ANARI_USD_MIDDLEWARE_API bool isContainer(const uint8_t* data, size_t size);
+
+/**
+ * Validate a container and describe its meshes without copying them. Every offset and
+ * count is bounds-checked and every index is checked against the vertex count.
+ * @param data Container bytes; must stay alive while the views are used and be at least
+ *             4-byte aligned (received frames, mappings and malloc'd buffers are)
+ * @param size Size of data in bytes
+ * @param out Receives one view per mesh, in file order
+ * @return False if the container is malformed (out is cleared)
+ */
+ANARI_USD_MIDDLEWARE_API bool parse(const uint8_t* data, size_t size, std::vector<MeshView>& out);
+
+/**
+ * Size of the container encode() would produce
+ * @param meshes Meshes to encode
+ * @param count Number of meshes
+ * @return Size in bytes, 0 if a mesh is invalid
+ */
+ANARI_USD_MIDDLEWARE_API size_t encodedSize(const MeshView* meshes, size_t count);
+
+/**
+ * Encode meshes into caller-owned memory (e.g. a message frame allocated with encodedSize())
+ * @param meshes Meshes to encode
+ * @param count Number of meshes
+ * @param out Destination buffer
+ * @param capacity Size of out in bytes
+ * @return Bytes written, 0 on invalid input or insufficient capacity
+ */
+ANARI_USD_MIDDLEWARE_API size_t encode(const MeshView* meshes, size_t count, uint8_t* out, size_t capacity);
+
+/**
+ * Encode meshes into a new buffer
+ * @param meshes Meshes to encode
+ * @param count Number of meshes
+ * @param out Receives the container
+ * @return True on success, false on invalid input
+ */
+ANARI_USD_MIDDLEWARE_API bool encode(const MeshView* meshes, size_t count, std::vector<uint8_t>& out);
+
+} // namespace container
+} // namespace anari_usd_middleware
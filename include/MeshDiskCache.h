@@ -0,0 +1,106 @@
+#pragma once
+
+#include "HashVerifier.h"
+#include "MappedFile.h"
+#include "MeshContainer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace anari_usd_middleware {
+
+/**
+ * Directory of extracted mesh sets stored as .jmesh containers, so a restarted process maps
+ * earlier results instead of parsing the USD again. Entries are keyed on the source path,
+ * size and modification time plus a fingerprint of the processing options, and evicted
+ * least recently used first once the directory exceeds its size budget. Recency is kept in
+ * the files' modification times, so it survives restarts. Thread-safe.
+ * The key covers no other file, so stages that reference, payload or clip other layers
+ * must not be stored.
+ */
+class MeshDiskCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t stores = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        uint64_t bytes = 0;
+    };
+
+    /// Folded into every key; bump when extraction output changes so old entries are never read
+    static constexpr uint32_t FORMAT_VERSION = 2;
+    static constexpr uint64_t DEFAULT_MAX_BYTES = 4ull * 1024 * 1024 * 1024;
+
+    MeshDiskCache() = default;
+
+    MeshDiskCache(const MeshDiskCache&) = delete;
+    MeshDiskCache& operator=(const MeshDiskCache&) = delete;
+
+    /**
+     * Use a cache directory, indexing the entries already in it
+     * @param directory Directory to use, created if missing (empty disables the cache)
+     * @param maxBytes Size budget of the directory; older entries are evicted immediately
+     * @return False if the directory cannot be created or read (the cache is then disabled)
+     */
+    bool setDirectory(const std::string& directory, uint64_t maxBytes = DEFAULT_MAX_BYTES);
+
+    bool isEnabled() const;
+
+    /**
+     * Derive the key of a source file without reading it
+     * @param sourcePath File being loaded
+     * @param optionsFingerprint Hash of every setting that changes the extracted meshes
+     * @param key Receives the key
+     * @return False if the file cannot be inspected
+     */
+    static bool makeKey(const std::string& sourcePath, uint64_t optionsFingerprint, ContentDigest& key);
+
+    /**
+     * Map a cached mesh set and mark it most recently used
+     * @param key Key from makeKey()
+     * @return Mapping of a .jmesh container, nullptr on miss
+     */
+    std::shared_ptr<MappedFile> find(const ContentDigest& key);
+
+    /**
+     * Write a mesh set, replacing any entry with the same key, and evict over budget
+     * @param key Key from makeKey()
+     * @param meshes Meshes to store
+     * @param count Number of meshes
+     * @return False if the meshes cannot be encoded or written
+     */
+    bool store(const ContentDigest& key, const container::MeshView* meshes, size_t count);
+
+    /**
+     * Delete every entry in the directory
+     */
+    void clear();
+
+    Stats getStats() const;
+
+private:
+    struct Entry {
+        uint64_t size = 0;
+        std::filesystem::file_time_type lastUse;
+    };
+
+    static std::string fileName(const ContentDigest& key);
+    bool indexDirectory(const std::filesystem::path& directory);
+    void evictLocked();
+
+    mutable std::mutex mutex;
+    std::filesystem::path root;     // Empty when disabled
+    uint64_t byteLimit = DEFAULT_MAX_BYTES;
+    uint64_t totalBytes = 0;
+    std::unordered_map<std::string, Entry> entries; // Keyed on file name
+    Stats counters;
+};
+
+} // namespace anari_usd_middleware
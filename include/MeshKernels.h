@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Batch kernels for the per-vertex loops of mesh extraction. Each kernel has a scalar
+ * reference implementation plus SSE2/AVX2 (x86) or NEON (ARM64) variants; the widest
+ * variant the CPU supports is selected on first use. All vector data is tightly packed
+ * (xyz triples, rgba quadruples) and matrices are 4x4 column-major, as laid out by glm.
+ */
+namespace kernels {
+
+enum class InstructionSet {
+    Scalar,
+    Sse2,
+    Avx2,
+    Neon
+};
+
+/**
+ * Get the instruction set the kernels currently dispatch to
+ * @return Active instruction set
+ */
+ANARI_USD_MIDDLEWARE_API InstructionSet activeInstructionSet();
+
+/**
+ * Force a specific kernel variant (for comparisons and debugging)
+ * @param isa Instruction set to use
+ * @return False if the CPU or build does not support it (selection unchanged)
+ */
+ANARI_USD_MIDDLEWARE_API bool setInstructionSet(InstructionSet isa);
+
+/**
+ * @param isa Instruction set
+ * @return Human-readable name ("Scalar", "SSE2", "AVX2", "NEON")
+ */
+ANARI_USD_MIDDLEWARE_API const char* instructionSetName(InstructionSet isa);
+
+/**
+ * Check that no value is NaN or infinite
+ * @param values Values to check
+ * @param count Number of floats
+ * @return True if every value is finite
+ */
+ANARI_USD_MIDDLEWARE_API bool allFinite(const float* values, size_t count);
+
+/**
+ * Apply an affine transform to packed xyz points (w = 1)
+ * @param matrix 4x4 column-major matrix
+ * @param in Input points (count * 3 floats)
+ * @param out Output points (count * 3 floats, may be the same buffer as in)
+ * @param count Number of points
+ */
+ANARI_USD_MIDDLEWARE_API void transformPoints(const float* matrix, const float* in, float* out, size_t count);
+
+/**
+ * Transform packed xyz normals by the upper 3x3 of a matrix and renormalize them.
+ * Normals that collapse to zero length become (0, 1, 0).
+ * @param matrix 4x4 column-major matrix
+ * @param in Input normals (count * 3 floats)
+ * @param out Output normals (count * 3 floats, may be the same buffer as in)
+ * @param count Number of normals
+ */
+ANARI_USD_MIDDLEWARE_API void transformNormals(const float* matrix, const float* in, float* out, size_t count);
+
+/**
+ * Order of the channels written by packColors
+ */
+enum class ColorOrder {
+    Rgba,   ///< r, g, b, a bytes
+    Bgra    ///< b, g, r, a bytes (Unreal FColor / D3D layout)
+};
+
+/**
+ * Convert float RGBA colors to 8 bits per channel: clamp(v * 255, 0, 255), truncated.
+ * NaN channels become 0.
+ * @param rgba Input colors (count * 4 floats)
+ * @param out Output bytes (count * 4)
+ * @param count Number of colors
+ * @param order Byte order of the output
+ */
+ANARI_USD_MIDDLEWARE_API void packColors(const float* rgba, uint8_t* out, size_t count,
+                                         ColorOrder order = ColorOrder::Rgba);
+
+} // namespace kernels
+} // namespace anari_usd_middleware
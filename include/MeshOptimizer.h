@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Index and vertex buffer optimization for extracted triangle meshes: welding of equal
+ * vertices, post-transform vertex cache ordering (Tipsify, Sander et al. 2007), overdraw
+ * ordering of the resulting triangle clusters and vertex fetch remapping. Every pass is
+ * linear or near-linear in the mesh size. Vertex attributes are packed float streams as
+ * elsewhere (xyz, uv, rgba); indices must be below vertexCount unless stated otherwise.
+ */
+namespace optimize {
+
+/**
+ * Vertices dropped by a remap (unreferenced after optimizeVertexFetch)
+ */
+constexpr uint32_t INVALID_INDEX = 0xffffffffu;
+
+/**
+ * FIFO cache size used for ordering and ACMR reporting; matches common GPU behaviour
+ */
+constexpr size_t DEFAULT_CACHE_SIZE = 16;
+
+/**
+ * One per-vertex attribute array compared by weldVertices
+ */
+struct VertexStream {
+    const float* data = nullptr;  ///< vertexCount * components floats
+    size_t components = 0;        ///< Floats per vertex (1-4)
+};
+
+/**
+ * Find vertices that are equal in every stream
+ * @param streams Attribute streams of the mesh (positions and any per-vertex attributes)
+ * @param streamCount Number of streams
+ * @param vertexCount Number of vertices
+ * @param epsilon 0 for exact equality (+0 and -0 are equal); otherwise values are snapped to
+ *                multiples of epsilon before comparing
+ * @param remap Receives vertexCount entries: the welded index of each vertex, numbered in
+ *              order of first occurrence
+ * @return Number of unique vertices (0 on invalid input)
+ */
+ANARI_USD_MIDDLEWARE_API size_t weldVertices(const VertexStream* streams, size_t streamCount, size_t vertexCount,
+                                             float epsilon, uint32_t* remap);
+
+/**
+ * Replace every index by remap[index]
+ * @param indices Index buffer to rewrite
+ * @param indexCount Number of indices
+ * @param remap Remap table from weldVertices or optimizeVertexFetch
+ */
+ANARI_USD_MIDDLEWARE_API void remapIndices(uint32_t* indices, size_t indexCount, const uint32_t* remap);
+
+/**
+ * Move vertex attributes to their remapped positions. When several vertices share a
+ * slot, the first of them supplies the values.
+ * @param in Source stream (vertexCount * components floats)
+ * @param components Floats per vertex
+ * @param vertexCount Number of source vertices
+ * @param remap Remap table (INVALID_INDEX entries are dropped)
+ * @param out Destination stream, sized for the remapped vertex count (must not alias in)
+ */
+ANARI_USD_MIDDLEWARE_API void remapVertexStream(const float* in, size_t components, size_t vertexCount,
+                                                const uint32_t* remap, float* out);
+
+/**
+ * Remove triangles that reference the same vertex twice (e.g. after welding)
+ * @param indices Index buffer, compacted in place
+ * @param indexCount Number of indices (multiple of 3)
+ * @return New number of indices
+ */
+ANARI_USD_MIDDLEWARE_API size_t removeDegenerateTriangles(uint32_t* indices, size_t indexCount);
+
+/**
+ * Reorder triangles for the post-transform vertex cache (Tipsify)
+ * @param indices Index buffer, reordered in place
+ * @param indexCount Number of indices (multiple of 3)
+ * @param vertexCount Number of vertices
+ * @param cacheSize Simulated FIFO cache size
+ * @return False on invalid input (buffer unchanged)
+ */
+ANARI_USD_MIDDLEWARE_API bool optimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount,
+                                                  size_t cacheSize = DEFAULT_CACHE_SIZE);
+
+/**
+ * Reorder the clusters of a cache-optimized index buffer so outward-facing surfaces are
+ * drawn first. Clusters start where the simulated cache runs cold, so their order barely
+ * affects the cache hit rate.
+ * @param indices Index buffer from optimizeVertexCache, reordered in place
+ * @param indexCount Number of indices (multiple of 3)
+ * @param points Vertex positions (vertexCount * 3 floats)
+ * @param vertexCount Number of vertices
+ * @param cacheSize Simulated FIFO cache size
+ * @return False on invalid input (buffer unchanged)
+ */
+ANARI_USD_MIDDLEWARE_API bool optimizeOverdraw(uint32_t* indices, size_t indexCount, const float* points,
+                                               size_t vertexCount, size_t cacheSize = DEFAULT_CACHE_SIZE);
+
+/**
+ * Renumber vertices in the order the index buffer first uses them, so vertex fetches
+ * walk memory linearly
+ * @param indices Index buffer, rewritten in place
+ * @param indexCount Number of indices
+ * @param vertexCount Number of vertices
+ * @param remap Receives vertexCount entries (INVALID_INDEX for unreferenced vertices)
+ * @return Number of referenced vertices (0 on invalid input)
+ */
+ANARI_USD_MIDDLEWARE_API size_t optimizeVertexFetch(uint32_t* indices, size_t indexCount, size_t vertexCount,
+                                                    uint32_t* remap);
+
+/**
+ * Simulate a FIFO post-transform cache; ACMR is the result divided by the triangle count
+ * @param indices Index buffer (out-of-range indices are ignored)
+ * @param indexCount Number of indices
+ * @param vertexCount Number of vertices
+ * @param cacheSize Simulated FIFO cache size
+ * @return Number of vertex shader invocations
+ */
+ANARI_USD_MIDDLEWARE_API size_t countCacheMisses(const uint32_t* indices, size_t indexCount, size_t vertexCount,
+                                                 size_t cacheSize = DEFAULT_CACHE_SIZE);
+
+} // namespace optimize
+} // namespace anari_usd_middleware
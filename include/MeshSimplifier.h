@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Level-of-detail generation by vertex clustering. Vertices are snapped to a uniform grid
+ * over the mesh bounds, every occupied cell becomes one vertex carrying the average of its
+ * members' attributes, and triangles that collapse inside a cell are dropped. The cost is
+ * linear in the mesh size, so a coarse level can be produced before the full mesh is sent.
+ * Attribute layout matches the mesh arrays elsewhere: packed xyz, uv and rgba floats.
+ */
+namespace lod {
+
+/**
+ * Borrowed view of an indexed triangle mesh; optional attributes are nullptr when absent
+ */
+struct MeshView {
+    const float* points = nullptr;     ///< vertexCount * 3 floats
+    size_t vertexCount = 0;
+    const uint32_t* indices = nullptr; ///< indexCount indices, three per triangle
+    size_t indexCount = 0;
+    const float* normals = nullptr;    ///< vertexCount * 3 floats
+    const float* uvs = nullptr;        ///< vertexCount * 2 floats
+    const float* colors = nullptr;     ///< vertexCount * 4 floats
+};
+
+/**
+ * Output of a simplification; attribute vectors are empty when the input had none
+ */
+struct SimplifiedMesh {
+    std::vector<float> points;
+    std::vector<uint32_t> indices;
+    std::vector<float> normals;
+    std::vector<float> uvs;
+    std::vector<float> colors;
+
+    size_t vertexCount() const { return points.size() / 3; }
+    size_t triangleCount() const { return indices.size() / 3; }
+};
+
+/**
+ * Largest number of cells along the longest bounding box axis
+ */
+constexpr size_t MAX_GRID_RESOLUTION = (1u << 21) - 1;
+
+/**
+ * Cluster vertices on a grid with a fixed resolution
+ * @param mesh Input mesh (out-of-range triangles are skipped)
+ * @param gridResolution Cells along the longest axis of the bounds (2 to MAX_GRID_RESOLUTION)
+ * @param out Simplified mesh (cleared first)
+ * @return False if the input is invalid or no triangle survives
+ */
+ANARI_USD_MIDDLEWARE_API bool clusterVertices(const MeshView& mesh, size_t gridResolution, SimplifiedMesh& out);
+
+/**
+ * Cluster vertices choosing the grid resolution so the result has roughly targetTriangles
+ * triangles. One counting pass calibrates the estimate, then the mesh is clustered once.
+ * @param mesh Input mesh
+ * @param targetTriangles Desired triangle count (approximate)
+ * @param out Simplified mesh (cleared first)
+ * @return False if the input is invalid or no triangle survives
+ */
+ANARI_USD_MIDDLEWARE_API bool simplifyToTarget(const MeshView& mesh, size_t targetTriangles, SimplifiedMesh& out);
+
+} // namespace lod
+} // namespace anari_usd_middleware
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Fan triangulation of USD polygon faces in one fused sweep. A planning pass takes an exact
+ * prefix sum over faceVertexCounts, so the index buffer is allocated once at its final size
+ * and split into face ranges with known input and output offsets. The sweep then
+ * triangulates, checks every index against the vertex count and accumulates face normals
+ * in the same pass; ranges are independent and can run on separate threads.
+ */
+namespace triangulate {
+
+/**
+ * Faces with more corners are skipped as malformed
+ */
+constexpr int32_t MAX_FACE_VERTICES = 100;
+
+/**
+ * Face normals shorter than this are degenerate and not accumulated (safety::EPSILON)
+ */
+constexpr float DEGENERATE_LENGTH = 1e-10f;
+
+/**
+ * Contiguous faces triangulated by one sweep
+ */
+struct FaceRange {
+    size_t firstFace = 0;
+    size_t faceCount = 0;
+    size_t firstCorner = 0;   ///< Offset of the range's first corner in faceVertexIndices
+    size_t firstIndex = 0;    ///< Where the range's triangles start in the index buffer
+    size_t indexCount = 0;    ///< Triangulated indices of the range, before bounds checks
+};
+
+struct Plan {
+    std::vector<FaceRange> ranges;
+    size_t indexCount = 0;    ///< Exact size of the index buffer
+    size_t skippedFaces = 0;  ///< Faces with fewer than 3 or more than MAX_FACE_VERTICES corners
+    bool truncated = false;   ///< Corner data ended early; later faces were dropped
+};
+
+/**
+ * Size a triangulation and split it into ranges of about equal face count
+ * @param faceCounts Corners per face (faceVertexCounts)
+ * @param faceCount Number of faces
+ * @param cornerCount Size of faceVertexIndices
+ * @param rangeCount Number of ranges wanted (at least 1)
+ * @param out Receives the plan (ranges are never empty; there may be fewer than requested)
+ */
+ANARI_USD_MIDDLEWARE_API void planFaceRanges(const int32_t* faceCounts, size_t faceCount, size_t cornerCount,
+                                             size_t rangeCount, Plan& out);
+
+/**
+ * Triangulate one range, dropping triangles with an index at or above vertexCount
+ * @param faceCounts Corners per face
+ * @param faceIndices Corner vertex indices (faceVertexIndices)
+ * @param range Range from planFaceRanges()
+ * @param points Vertex positions (vertexCount * 3 floats); only read when normalSums is set
+ * @param vertexCount Number of vertices
+ * @param outIndices Index buffer of Plan::indexCount entries; the range writes from firstIndex
+ * @param normalSums vertexCount * 3 floats receiving the sum of unit face normals of the
+ *                   triangles around each vertex, or nullptr; not shared between threads
+ * @return Indices written, packed from range.firstIndex (fewer than indexCount if triangles were dropped)
+ */
+ANARI_USD_MIDDLEWARE_API size_t sweepFaceRange(const int32_t* faceCounts, const int32_t* faceIndices,
+                                               const FaceRange& range, const float* points, size_t vertexCount,
+                                               uint32_t* outIndices, float* normalSums);
+
+/**
+ * Close the gaps left by dropped triangles
+ * @param indices Index buffer written by sweepFaceRange()
+ * @param ranges Ranges of the plan
+ * @param written Return value of sweepFaceRange() for each range
+ * @param rangeCount Number of ranges
+ * @return Number of valid indices, packed from the start of the buffer
+ */
+ANARI_USD_MIDDLEWARE_API size_t compactRanges(uint32_t* indices, const FaceRange* ranges, const size_t* written,
+                                              size_t rangeCount);
+
+/**
+ * Normalize accumulated vertex normals in place; zero sums (unreferenced vertices) become (0, 1, 0)
+ * @param normals count * 3 floats
+ * @param count Number of normals
+ */
+ANARI_USD_MIDDLEWARE_API void normalizeNormals(float* normals, size_t count);
+
+} // namespace triangulate
+} // namespace anari_usd_middleware
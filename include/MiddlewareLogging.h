@@ -89,6 +89,8 @@
 namespace anari_usd_middleware {
     namespace safety {
         static constexpr size_t MAX_BUFFER_SIZE = 500000000;        // 500MB
+        // Chunked transfers and mapped files are never held in one heap buffer
+        static constexpr uint64_t MAX_STREAMED_FILE_SIZE = 64ull * 1024 * 1024 * 1024; // 64GB
         static constexpr size_t MAX_VECTOR_SIZE = 100000000;        // 100M elements
         static constexpr size_t MAX_STRING_SIZE = 10000000;         // 10MB
         static constexpr size_t MAX_MESH_VERTICES = 10000000;       // 10M vertices
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Monotonic memory resource for the transient data of one load. Allocations bump a pointer
+ * through a list of chunks and deallocation is a no-op; reset() frees everything in one shot
+ * but keeps up to RETAINED_BYTES of chunks, so a reused arena serves the next load without
+ * touching the heap. Not thread-safe: one arena is used by one thread at a time.
+ */
+class ANARI_USD_MIDDLEWARE_API ScratchArena final : public std::pmr::memory_resource {
+public:
+    struct Stats {
+        uint64_t bytesAllocated = 0;   ///< Bytes handed out, including alignment padding
+        uint64_t peakBytes = 0;        ///< Most bytes in use between two resets
+        uint64_t chunkAllocations = 0; ///< Chunks taken from the heap
+        uint64_t allocatorTimeNs = 0;  ///< Time spent allocating and freeing chunks
+    };
+
+    static constexpr size_t MIN_CHUNK_BYTES = 64 * 1024;
+    static constexpr size_t MAX_CHUNK_BYTES = 8 * 1024 * 1024;  ///< Growth limit; larger requests get a chunk of their own
+    static constexpr size_t RETAINED_BYTES = 16 * 1024 * 1024;  ///< Chunks kept by reset()
+
+    ScratchArena() = default;
+    ~ScratchArena() override;
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    /**
+     * Release every allocation at once. Objects still referring to the arena must be dead.
+     */
+    void reset();
+
+    size_t bytesInUse() const { return inUse; }
+    size_t retainedBytes() const;
+
+    /**
+     * Counters since the previous call, which clears them
+     * @return Usage of the arena
+     */
+    Stats takeStats();
+
+private:
+    struct Chunk {
+        std::byte* data;
+        size_t size;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    void* allocateFromChunk(size_t bytes, size_t alignment);
+    void* refill(size_t bytes, size_t alignment);
+
+    std::vector<Chunk> chunks;  // Chunks after `current` are retained and unused
+    size_t current = 0;
+    size_t offset = 0;          // Bump position in chunks[current]
+    size_t inUse = 0;
+    Stats counters;
+};
+
+/**
+ * Arenas shared by the threads of all loads. A thread leases one for the duration of its
+ * work and hands it back reset, so worker threads that come and go still reuse warm chunks.
+ * Thread-safe.
+ */
+class ANARI_USD_MIDDLEWARE_API ScratchArenaPool {
+public:
+    struct Stats {
+        uint64_t leases = 0;
+        uint64_t bytesAllocated = 0;
+        uint64_t peakBytes = 0;        ///< Largest single-lease peak
+        uint64_t chunkAllocations = 0;
+        uint64_t allocatorTimeNs = 0;
+        size_t idleArenas = 0;
+        uint64_t retainedBytes = 0;    ///< Chunks held by idle arenas
+    };
+
+    /**
+     * Exclusive use of one arena; returns it to the pool, reset, when destroyed
+     */
+    class ANARI_USD_MIDDLEWARE_API Lease {
+    public:
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&&) = delete;
+        ~Lease();
+
+        ScratchArena& arena() { return *leased; }
+        std::pmr::memory_resource* resource() { return leased.get(); }
+
+    private:
+        friend class ScratchArenaPool;
+        Lease(ScratchArenaPool* owner, std::unique_ptr<ScratchArena> arena);
+
+        ScratchArenaPool* pool;
+        std::unique_ptr<ScratchArena> leased;
+    };
+
+    static constexpr size_t MAX_IDLE_ARENAS = 64;
+
+    ScratchArenaPool() = default;
+    ScratchArenaPool(const ScratchArenaPool&) = delete;
+    ScratchArenaPool& operator=(const ScratchArenaPool&) = delete;
+
+    /**
+     * Lease an idle arena, or a new one if none is idle
+     * @return Lease, valid until destroyed; must not outlive the pool
+     */
+    Lease acquire();
+
+    Stats getStats() const;
+    void resetStats();
+
+private:
+    void release(std::unique_ptr<ScratchArena> arena);
+
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<ScratchArena>> idle;
+    Stats totals;
+};
+
+} // namespace anari_usd_middleware
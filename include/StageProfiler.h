@@ -0,0 +1,215 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Latency instrumentation of the receive and load pipeline: every stage of a file feeds a
+ * lock-free histogram, and an opt-in trace keeps individual stage events for a timeline view
+ */
+namespace profiling {
+
+enum class Stage : uint8_t {
+    Receive,    ///< Reading a file message off the socket
+    QueueWait,  ///< Waiting in the pipeline queue for a worker
+    Decompress, ///< Wire payload decompression
+    Hash,       ///< Content hash verification
+    Preprocess, ///< USDA token fixes before parsing
+    Parse,      ///< tinyusdz stage load
+    Traverse,   ///< Prim traversal collecting mesh work
+    Extract,    ///< Mesh extraction, all workers
+    References, ///< Referenced layer resolution
+    Convert,    ///< Extracted meshes to the public or C layout
+    Callback,   ///< File callbacks
+    Count
+};
+
+constexpr size_t STAGE_COUNT = static_cast<size_t>(Stage::Count);
+
+/**
+ * @param stage Pipeline stage
+ * @return Stable display name, e.g. "parse"
+ */
+ANARI_USD_MIDDLEWARE_API const char* stageName(Stage stage);
+
+/**
+ * Log-linear histogram of nanosecond durations. Each power of two is split into
+ * SUB_BUCKETS buckets, so a percentile is reported within 1/SUB_BUCKETS of the true
+ * value. Recording is a few relaxed atomic adds; concurrent snapshots may be torn by
+ * at most the samples recorded while they run.
+ */
+class ANARI_USD_MIDDLEWARE_API LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 3;
+    static constexpr uint64_t SUB_BUCKETS = uint64_t{1} << SUB_BUCKET_BITS;
+    static constexpr int MAX_EXPONENT = 40;  ///< Samples from 2^41 ns (about 36 min) share the last bucket
+    static constexpr size_t BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+    struct Snapshot {
+        uint64_t count = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+        uint64_t p50Ns = 0;
+        uint64_t p95Ns = 0;
+        uint64_t p99Ns = 0;
+    };
+
+    LatencyHistogram();
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(uint64_t durationNs);
+    Snapshot snapshot() const;
+    void reset();
+
+    static size_t bucketIndex(uint64_t durationNs);
+    static uint64_t bucketUpperBound(size_t index);
+
+private:
+    static uint64_t percentile(const uint64_t* counts, uint64_t total, uint64_t maxSample, double fraction);
+
+    std::atomic<uint64_t> buckets[BUCKET_COUNT];  // The count is their sum
+    std::atomic<uint64_t> totalNs{0};
+    std::atomic<uint64_t> maxNs{0};
+};
+
+/**
+ * Per-stage histograms plus an optional bounded trace of stage events. The histograms are
+ * always on; the trace takes a mutex per event and is only filled while capture is enabled.
+ */
+class ANARI_USD_MIDDLEWARE_API StageProfiler {
+public:
+    struct StageStats {
+        Stage stage = Stage::Receive;
+        const char* name = "";
+        uint64_t count = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+        uint64_t p50Ns = 0;
+        uint64_t p95Ns = 0;
+        uint64_t p99Ns = 0;
+    };
+
+    struct TraceEvent {
+        Stage stage = Stage::Receive;
+        uint32_t thread = 0;      ///< Small per-process thread number
+        uint64_t startNs = 0;     ///< Since the profiling epoch, see now()
+        uint64_t durationNs = 0;
+        std::string detail;       ///< File name, if known
+    };
+
+    static constexpr size_t DEFAULT_TRACE_EVENTS = 100000;
+
+    StageProfiler() = default;
+    StageProfiler(const StageProfiler&) = delete;
+    StageProfiler& operator=(const StageProfiler&) = delete;
+
+    /**
+     * @return Nanoseconds since the process-wide profiling epoch (steady clock)
+     */
+    static uint64_t now();
+
+    /**
+     * Record one completed stage
+     * @param stage Pipeline stage
+     * @param startNs Start time from now()
+     * @param durationNs Stage duration
+     * @param detail File name for the trace, ignored unless capture is enabled
+     */
+    void record(Stage stage, uint64_t startNs, uint64_t durationNs, std::string_view detail = {});
+
+    /**
+     * @return Histogram summary of every stage, in Stage order
+     */
+    std::vector<StageStats> getSnapshot() const;
+
+    /**
+     * Clear the histograms; the trace is left alone
+     */
+    void reset();
+
+    /**
+     * Start or stop keeping trace events. Enabling clears the previous trace; once
+     * maxEvents are held the oldest are overwritten.
+     * @param enable True to capture
+     * @param maxEvents Events kept, at least 1
+     */
+    void setTraceCapture(bool enable, size_t maxEvents = DEFAULT_TRACE_EVENTS);
+    bool isTraceCaptureEnabled() const { return tracing.load(std::memory_order_relaxed); }
+
+    /**
+     * @return Captured events, oldest first
+     */
+    std::vector<TraceEvent> getTraceEvents() const;
+
+    /**
+     * Write the captured events in the Chrome trace event format, which chrome://tracing
+     * and ui.perfetto.dev open directly
+     * @param path Output file, replaced if present
+     * @return True on success
+     */
+    bool writeChromeTrace(const std::string& path) const;
+
+private:
+    LatencyHistogram histograms[STAGE_COUNT];
+
+    std::atomic<bool> tracing{false};
+    mutable std::mutex traceMutex;
+    std::vector<TraceEvent> traceEvents;  // Ring buffer once full
+    size_t traceCapacity = DEFAULT_TRACE_EVENTS;
+    size_t traceNext = 0;
+    uint64_t traceOverwritten = 0;
+};
+
+/**
+ * Times the enclosing scope as one stage. A null profiler makes the timer a no-op, so
+ * call sites need no checks. The detail view must outlive the timer.
+ */
+class StageTimer {
+public:
+    StageTimer(StageProfiler* profiler, Stage stage, std::string_view detail = {})
+        : profiler(profiler), stage(stage), detail(detail), startNs(profiler ? StageProfiler::now() : 0) {}
+    ~StageTimer() { stop(); }
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+    /**
+     * Record the stage now instead of at scope exit
+     */
+    void stop() {
+        if (profiler) {
+            profiler->record(stage, startNs, StageProfiler::now() - startNs, detail);
+            profiler = nullptr;
+        }
+    }
+
+    /**
+     * Drop the measurement, e.g. when the stage turned out to have nothing to do
+     */
+    void cancel() { profiler = nullptr; }
+
+private:
+    StageProfiler* profiler;
+    Stage stage;
+    std::string_view detail;
+    uint64_t startNs;
+};
+
+} // namespace profiling
+} // namespace anari_usd_middleware
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Texture decode pipeline producing GPU-ready data. Images are decoded to RGBA8 (libspng
+ * for PNG and libjpeg-turbo for JPEG when the build found them, stb_image otherwise),
+ * optionally reduced to a full mip chain and block-compressed to BC1/BC3. The result is
+ * one buffer holding every level back to back, each tightly packed in the layout of the
+ * matching GPU format (PF_R8G8B8A8, PF_DXT1, PF_DXT5 in Unreal), so it can be copied
+ * straight into texture platform data.
+ */
+namespace texture {
+
+constexpr uint32_t MAX_DIMENSION = 16384;
+
+/**
+ * Layout of the encoded levels
+ */
+enum class PixelFormat : uint8_t {
+    RGBA8 = 0, ///< 4 bytes per pixel, rows tightly packed
+    BC1 = 1,   ///< 8 bytes per 4x4 block, opaque
+    BC3 = 2    ///< 16 bytes per 4x4 block, interpolated alpha
+};
+
+/**
+ * Requested block compression. It needs a level 0 size that is a multiple of 4 (a GPU
+ * requirement for BCn); other images stay RGBA8.
+ */
+enum class Compression : uint8_t {
+    None = 0,
+    BC1 = 1,
+    BC3 = 2,
+    Auto = 3   ///< BC1 for opaque images, BC3 when any pixel has alpha below 255
+};
+
+struct Options {
+    bool generateMips = false;
+    Compression compression = Compression::None;
+    bool srgb = true;           ///< Filter mips in linear light (colour textures); false for data textures
+    bool highQuality = false;   ///< Slower, more accurate BCn endpoint search
+};
+
+/**
+ * One level of an encoded texture; offsets are bytes from the start of Texture::data
+ */
+struct MipLevel {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    size_t offset = 0;
+    size_t size = 0;
+};
+
+struct Texture {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    PixelFormat format = PixelFormat::RGBA8;
+    std::vector<MipLevel> mips;   ///< Level 0 is full resolution
+    std::vector<uint8_t> data;    ///< All levels, back to back
+
+    bool isValid() const { return width > 0 && height > 0 && !mips.empty() && !data.empty(); }
+};
+
+/**
+ * Encoded image to process, e.g. a received PNG
+ */
+struct Source {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+/**
+ * Number of levels of a full mip chain down to 1x1
+ * @param width Level 0 width
+ * @param height Level 0 height
+ * @return Level count, 0 for an empty image
+ */
+ANARI_USD_MIDDLEWARE_API uint32_t mipCount(uint32_t width, uint32_t height);
+
+/**
+ * Size of one level in a pixel format
+ * @param format Pixel format
+ * @param width Level width
+ * @param height Level height
+ * @return Size in bytes (BCn levels are rounded up to whole blocks)
+ */
+ANARI_USD_MIDDLEWARE_API size_t levelSize(PixelFormat format, uint32_t width, uint32_t height);
+
+/**
+ * Decode a PNG, JPEG or other stb_image-supported image to RGBA8
+ * @param data Encoded image
+ * @param size Size of data in bytes
+ * @param out Receives width * height * 4 bytes (decoded in place where the decoder allows)
+ * @param width Receives the image width
+ * @param height Receives the image height
+ * @return False if the image could not be decoded or exceeds MAX_DIMENSION
+ */
+ANARI_USD_MIDDLEWARE_API bool decodeRGBA8(const uint8_t* data, size_t size, std::vector<uint8_t>& out,
+                                          uint32_t& width, uint32_t& height);
+
+/**
+ * Build mips and compress decoded pixels
+ * @param rgba Level 0 pixels (width * height * 4 bytes); taken over so uncompressed
+ *             textures reuse the allocation
+ * @param width Image width
+ * @param height Image height
+ * @param options Mip and compression options
+ * @param out Receives the encoded texture
+ * @return False on invalid input
+ */
+ANARI_USD_MIDDLEWARE_API bool encode(std::vector<uint8_t>&& rgba, uint32_t width, uint32_t height,
+                                     const Options& options, Texture& out);
+
+/**
+ * Decode and encode one image
+ * @param data Encoded image
+ * @param size Size of data in bytes
+ * @param options Mip and compression options
+ * @param out Receives the encoded texture
+ * @return False if decoding failed
+ */
+ANARI_USD_MIDDLEWARE_API bool process(const uint8_t* data, size_t size, const Options& options, Texture& out);
+
+/**
+ * Decode and encode several images in parallel on the shared worker pool, one image per
+ * thread at a time
+ * @param sources Encoded images
+ * @param count Number of images
+ * @param options Mip and compression options, shared by all images
+ * @param out Array of count textures; failed images are left empty
+ * @param threads Threads working on the batch at most, including the caller
+ *                (0 = the whole pool), capped at count
+ * @return Number of images processed successfully
+ */
+ANARI_USD_MIDDLEWARE_API size_t processBatch(const Source* sources, size_t count, const Options& options,
+                                             Texture* out, size_t threads = 0);
+
+} // namespace texture
+} // namespace anari_usd_middleware
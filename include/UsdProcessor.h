@@ -3,10 +3,13 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <memory_resource>
 #include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <functional>
+#include <limits>
+#include <unordered_map>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include "MiddlewareLogging.h"
@@ -28,6 +31,10 @@ namespace tinyusdz {
 
 namespace anari_usd_middleware {
 
+namespace profiling {
+class StageProfiler;
+}
+
 /**
  * Thread-safe USD processing engine with comprehensive error handling and memory safety
  * features for Unreal Engine 5.5 compatibility. Handles USD file conversion, mesh extraction,
@@ -46,8 +53,10 @@ public:
         std::vector<glm::vec3> normals; ///< Normal vectors (normalized)
         std::vector<glm::vec2> uvs;     ///< Texture coordinates (clamped)
         std::vector<glm::vec4> vertex_colors; ///vertex colors
+        std::vector<glm::mat4> instanceTransforms; ///< Instancing/local-space mode: world transform per placement, geometry in local space (empty: geometry in world space)
+        bool geometryValidated = false; ///< Set by ExtractMeshData, which validates while building; reset when editing geometry
 
-        // Validation methods
+        // Validation methods; the full geometry scan is skipped for meshes validated while built
         bool isValid() const {
             return !elementName.empty() &&
                    points.size() <= safety::MAX_MESH_VERTICES &&
@@ -55,7 +64,7 @@ public:
                    normals.size() <= safety::MAX_MESH_VERTICES &&
                    uvs.size() <= safety::MAX_MESH_VERTICES &&
                    (indices.size() % 3 == 0) &&
-                   validateGeometry();
+                   (geometryValidated || validateGeometry());
         }
 
         size_t getVertexCount() const { return points.size(); }
@@ -77,6 +86,7 @@ public:
             indices.clear();
             normals.clear();
             uvs.clear();
+            geometryValidated = false;
         }
     };
 
@@ -123,6 +133,19 @@ public:
         std::atomic<uint64_t> referencesResolved{0};
         std::atomic<uint64_t> processingErrors{0};
         std::atomic<uint64_t> totalBytesProcessed{0};
+        std::atomic<uint64_t> filesPreprocessed{0};    // Text layers that needed patching
+        std::atomic<uint64_t> preprocessTimeUs{0};     // Time spent in preprocessing (including skips)
+        std::atomic<uint64_t> layerCacheHits{0};       // Referenced layers served without parsing
+        std::atomic<uint64_t> layerCacheMisses{0};
+        std::atomic<uint64_t> instancesDeduplicated{0};  // Placements served by an already emitted mesh
+        std::atomic<uint64_t> transformEvaluations{0};   // EvaluateTransforms calls
+        std::atomic<uint64_t> transformStageHits{0};     // ... answered from an already parsed stage
+        std::atomic<uint64_t> meshesOptimized{0};        // Meshes run through the optimization stage
+        std::atomic<uint64_t> optimizedVerticesIn{0};    // Their vertex counts before welding
+        std::atomic<uint64_t> optimizedVerticesOut{0};   // ... and after welding and fetch remapping
+        std::atomic<uint64_t> optimizedTriangles{0};
+        std::atomic<uint64_t> cacheMissesBefore{0};      // Simulated vertex cache misses (ACMR = misses / triangles)
+        std::atomic<uint64_t> cacheMissesAfter{0};
 
         // Delete copy constructor and assignment operator since atomics can't be copied
         ProcessingStats() = default;
@@ -137,6 +160,19 @@ public:
             referencesResolved.store(other.referencesResolved.load());
             processingErrors.store(other.processingErrors.load());
             totalBytesProcessed.store(other.totalBytesProcessed.load());
+            filesPreprocessed.store(other.filesPreprocessed.load());
+            preprocessTimeUs.store(other.preprocessTimeUs.load());
+            layerCacheHits.store(other.layerCacheHits.load());
+            layerCacheMisses.store(other.layerCacheMisses.load());
+            instancesDeduplicated.store(other.instancesDeduplicated.load());
+            transformEvaluations.store(other.transformEvaluations.load());
+            transformStageHits.store(other.transformStageHits.load());
+            meshesOptimized.store(other.meshesOptimized.load());
+            optimizedVerticesIn.store(other.optimizedVerticesIn.load());
+            optimizedVerticesOut.store(other.optimizedVerticesOut.load());
+            optimizedTriangles.store(other.optimizedTriangles.load());
+            cacheMissesBefore.store(other.cacheMissesBefore.load());
+            cacheMissesAfter.store(other.cacheMissesAfter.load());
         }
 
         ProcessingStats& operator=(ProcessingStats&& other) noexcept {
@@ -147,6 +183,19 @@ public:
                 referencesResolved.store(other.referencesResolved.load());
                 processingErrors.store(other.processingErrors.load());
                 totalBytesProcessed.store(other.totalBytesProcessed.load());
+                filesPreprocessed.store(other.filesPreprocessed.load());
+                preprocessTimeUs.store(other.preprocessTimeUs.load());
+                layerCacheHits.store(other.layerCacheHits.load());
+                layerCacheMisses.store(other.layerCacheMisses.load());
+                instancesDeduplicated.store(other.instancesDeduplicated.load());
+                transformEvaluations.store(other.transformEvaluations.load());
+                transformStageHits.store(other.transformStageHits.load());
+                meshesOptimized.store(other.meshesOptimized.load());
+                optimizedVerticesIn.store(other.optimizedVerticesIn.load());
+                optimizedVerticesOut.store(other.optimizedVerticesOut.load());
+                optimizedTriangles.store(other.optimizedTriangles.load());
+                cacheMissesBefore.store(other.cacheMissesBefore.load());
+                cacheMissesAfter.store(other.cacheMissesAfter.load());
             }
             return *this;
         }
@@ -158,6 +207,19 @@ public:
             referencesResolved.store(0);
             processingErrors.store(0);
             totalBytesProcessed.store(0);
+            filesPreprocessed.store(0);
+            preprocessTimeUs.store(0);
+            layerCacheHits.store(0);
+            layerCacheMisses.store(0);
+            instancesDeduplicated.store(0);
+            transformEvaluations.store(0);
+            transformStageHits.store(0);
+            meshesOptimized.store(0);
+            optimizedVerticesIn.store(0);
+            optimizedVerticesOut.store(0);
+            optimizedTriangles.store(0);
+            cacheMissesBefore.store(0);
+            cacheMissesAfter.store(0);
         }
 
         // Create a copyable snapshot for returning from functions
@@ -168,6 +230,26 @@ public:
             uint64_t referencesResolved;
             uint64_t processingErrors;
             uint64_t totalBytesProcessed;
+            uint64_t filesPreprocessed;
+            uint64_t preprocessTimeUs;
+            uint64_t layerCacheHits;
+            uint64_t layerCacheMisses;
+            uint64_t instancesDeduplicated;
+            uint64_t transformEvaluations;
+            uint64_t transformStageHits;
+            uint64_t meshesOptimized;
+            uint64_t optimizedVerticesIn;
+            uint64_t optimizedVerticesOut;
+            uint64_t optimizedTriangles;
+            uint64_t cacheMissesBefore;
+            uint64_t cacheMissesAfter;
+            // Scratch arenas backing the transient data of loads (from the arena pool)
+            uint64_t arenaLeases;
+            uint64_t arenaBytesAllocated;
+            uint64_t arenaPeakBytes;         // Largest footprint of one arena lease
+            uint64_t arenaChunkAllocations;  // Heap allocations made by the arenas
+            uint64_t arenaTimeUs;            // Time those allocations and their release took
+            uint64_t arenaRetainedBytes;     // Held by idle arenas for the next load
         };
 
         Snapshot getSnapshot() const {
@@ -177,16 +259,44 @@ public:
                 texturesProcessed.load(),
                 referencesResolved.load(),
                 processingErrors.load(),
-                totalBytesProcessed.load()
+                totalBytesProcessed.load(),
+                filesPreprocessed.load(),
+                preprocessTimeUs.load(),
+                layerCacheHits.load(),
+                layerCacheMisses.load(),
+                instancesDeduplicated.load(),
+                transformEvaluations.load(),
+                transformStageHits.load(),
+                meshesOptimized.load(),
+                optimizedVerticesIn.load(),
+                optimizedVerticesOut.load(),
+                optimizedTriangles.load(),
+                cacheMissesBefore.load(),
+                cacheMissesAfter.load(),
+                0, 0, 0, 0, 0, 0
             };
         }
     };
 
+    /**
+     * World transform of one mesh prim, as reported by EvaluateTransforms
+     */
+    struct PrimTransform {
+        std::string elementName;
+        glm::mat4 worldTransform{1.0f};
+    };
+
     /**
      * Progress callback for long-running operations
      */
     using ProgressCallback = std::function<void(float progress, const std::string& status)>;
 
+    /**
+     * Consumer of meshes streamed by StreamUSDBuffer; the mesh may be moved from
+     * Calls are serialized but may come from extraction threads. Return false to stop the load.
+     */
+    using MeshSink = std::function<bool(MeshData&& mesh)>;
+
     /**
      * Constructor with enhanced initialization
      */
@@ -210,29 +320,105 @@ public:
     TextureData CreateTextureFromBuffer(const std::vector<uint8_t>& buffer,
                                        const std::string& expectedFormat = "");
 
+    /**
+     * Create texture from borrowed image bytes, e.g. a received payload
+     * @param data Raw image data (size-limited)
+     * @param size Size of data in bytes
+     * @param expectedFormat Expected image format for validation (optional)
+     * @return TextureData structure containing the processed texture
+     */
+    TextureData CreateTextureFromBuffer(const uint8_t* data, size_t size,
+                                       const std::string& expectedFormat = "");
+
     /**
      * Load USD data from buffer with comprehensive error handling
      * @param buffer Raw USD data buffer (validated)
      * @param fileName Original filename for format detection (validated)
      * @param outMeshData Output vector for extracted mesh data (cleared first)
      * @param progressCallback Optional progress callback
+     * @param cancelFlag Optional flag; once set the load stops at the next prim or mesh and fails
      * @return True if loading was successful, false otherwise
      */
     bool LoadUSDBuffer(const std::vector<uint8_t>& buffer,
                       const std::string& fileName,
                       std::vector<MeshData>& outMeshData,
-                      ProgressCallback progressCallback = nullptr);
+                      ProgressCallback progressCallback = nullptr,
+                      const std::atomic<bool>* cancelFlag = nullptr);
+
+    /**
+     * Load USD data from a caller-owned byte range (e.g. a memory-mapped file) without copying it
+     * @param data Raw USD data (must stay valid for the duration of the call)
+     * @param size Size of data in bytes
+     * @param fileName Original filename for format detection (validated)
+     * @param outMeshData Output vector for extracted mesh data (cleared first)
+     * @param progressCallback Optional progress callback. Calls are serialized but may come
+     *                         from extraction threads when more than one worker is configured
+     * @param cancelFlag Optional flag; once set the load stops at the next prim or mesh and fails
+     * @param usesExternalLayers Optional; set to whether the stage references, payloads or clips
+     *                           other layers, so the meshes depend on more than these bytes
+     * @return True if loading was successful, false otherwise
+     */
+    bool LoadUSDBuffer(const uint8_t* data,
+                      size_t size,
+                      const std::string& fileName,
+                      std::vector<MeshData>& outMeshData,
+                      ProgressCallback progressCallback = nullptr,
+                      const std::atomic<bool>* cancelFlag = nullptr,
+                      bool* usesExternalLayers = nullptr);
+
+    /**
+     * Load USD data and hand every valid mesh to a sink as soon as it is extracted, in
+     * traversal order, so the full mesh list is never held at once. With instancing enabled
+     * prototypes can only be merged once all are extracted, so the meshes arrive at the end.
+     * @param data Raw USD data (must stay valid for the duration of the call)
+     * @param size Size of data in bytes
+     * @param fileName Original filename for format detection (validated)
+     * @param sink Receives each mesh; returning false stops the load
+     * @param progressCallback Optional progress callback
+     * @param cancelFlag Optional flag; once set the load stops at the next prim or mesh and fails
+     * @param usesExternalLayers Optional; set to whether the stage references, payloads or clips
+     *                           other layers, so the meshes depend on more than these bytes
+     * @return True if loading was successful, false on failure, cancellation or a stopping sink
+     */
+    bool StreamUSDBuffer(const uint8_t* data,
+                         size_t size,
+                         const std::string& fileName,
+                         const MeshSink& sink,
+                         ProgressCallback progressCallback = nullptr,
+                         const std::atomic<bool>* cancelFlag = nullptr,
+                         bool* usesExternalLayers = nullptr);
 
     /**
      * Load USD data directly from disk with file validation
+     * The file is memory-mapped and parsed in place
      * @param filePath Path to the USD file (validated)
      * @param outMeshData Output vector for extracted mesh data
      * @param progressCallback Optional progress callback
+     * @param cancelFlag Optional flag; once set the load stops at the next prim or mesh and fails
      * @return True if loading was successful, false otherwise
      */
     bool LoadUSDFromDisk(const std::string& filePath,
                         std::vector<MeshData>& outMeshData,
-                        ProgressCallback progressCallback = nullptr);
+                        ProgressCallback progressCallback = nullptr,
+                        const std::atomic<bool>* cancelFlag = nullptr);
+
+    /**
+     * Evaluate the world transform of every mesh prim without extracting any geometry
+     * The parsed stage is cached, as are world matrices of prims with no time-sampled
+     * xformOps on their parent chain, so repeated calls on the same content only
+     * re-evaluate the animated ops
+     * @param data Raw USD data (must stay valid for the duration of the call)
+     * @param size Size of data in bytes
+     * @param fileName Original filename for format detection (validated)
+     * @param timeCode Time at which time-sampled xformOps are evaluated (NaN: default values)
+     * @param outTransforms Output transforms in traversal order (cleared first)
+     * @return True if evaluation was successful, false otherwise
+     */
+    bool EvaluateTransforms(const uint8_t* data,
+                            size_t size,
+                            const std::string& fileName,
+                            double timeCode,
+                            std::vector<PrimTransform>& outTransforms);
 
     /**
      * Set maximum recursion depth for USD hierarchy processing
@@ -248,6 +434,7 @@ public:
 
     /**
      * Set memory limit for processing operations
+     * A quarter of it bounds the cache of parsed referenced layers
      * @param limitMB Memory limit in megabytes (1-4096, default 1024)
      */
     void setMemoryLimit(size_t limitMB);
@@ -270,6 +457,86 @@ public:
      */
     bool isReferenceResolutionEnabled() const;
 
+    /**
+     * Set how many threads extract mesh data once the prim hierarchy has been walked
+     * Output order does not depend on the thread count
+     * @param threadCount Number of extraction threads (1-64, default 1)
+     */
+    void setWorkerThreads(size_t threadCount);
+
+    /**
+     * Get current number of mesh extraction threads
+     * @return Number of extraction threads
+     */
+    size_t getWorkerThreads() const;
+
+    /**
+     * Emit repeated geometry once with per-instance transforms instead of baking every copy
+     * Meshes placed only once are still baked into world space
+     * @param enable True to enable instancing output (default false)
+     */
+    void setInstancingEnabled(bool enable);
+
+    /**
+     * Check if instancing output is enabled
+     * @return True if enabled, false otherwise
+     */
+    bool isInstancingEnabled() const;
+
+    /**
+     * Keep every mesh in its local space and report its world matrix in instanceTransforms
+     * (a single entry unless instancing merged several placements), so a transform-only
+     * change needs no vertex work
+     * @param enable True to enable local-space output (default false)
+     */
+    void setLocalSpaceEnabled(bool enable);
+
+    /**
+     * Check if local-space output is enabled
+     * @return True if enabled, false otherwise
+     */
+    bool isLocalSpaceEnabled() const;
+
+    /**
+     * Weld equal vertices and reorder every extracted mesh for the post-transform vertex
+     * cache, overdraw and vertex fetch. Meshes with attributes that are not per-vertex
+     * (e.g. uniform or faceVarying colors) are left as extracted.
+     * @param enable True to enable the optimization stage (default false)
+     */
+    void setMeshOptimizationEnabled(bool enable);
+
+    /**
+     * Check if the mesh optimization stage is enabled
+     * @return True if enabled, false otherwise
+     */
+    bool isMeshOptimizationEnabled() const;
+
+    /**
+     * Set the tolerance used when welding vertices
+     * @param epsilon 0 welds only exactly equal vertices; otherwise attributes are snapped to
+     *                multiples of epsilon before comparing (must be finite and >= 0, default 0)
+     */
+    void setWeldEpsilon(float epsilon);
+
+    /**
+     * Set the time at which LoadUSDBuffer evaluates time-sampled xformOps
+     * @param timeCode Stage time code (NaN selects the default, non-animated values)
+     */
+    void setTimeCode(double timeCode);
+
+    /**
+     * Get the time code used by LoadUSDBuffer
+     * @return Stage time code (NaN: default values)
+     */
+    double getTimeCode() const;
+
+    /**
+     * Feed the preprocess, parse, traversal, extraction and reference stages of every load
+     * into a profiler
+     * @param profiler Profiler that outlives every load, or nullptr to stop timing
+     */
+    void setStageProfiler(profiling::StageProfiler* profiler);
+
     /**
      * Get processing statistics - FIXED VERSION
      * @return Snapshot of current processing statistics (copyable)
@@ -281,6 +548,11 @@ public:
      */
     void resetProcessingStats();
 
+    /**
+     * Drop all cached referenced layers (files are re-read on next use)
+     */
+    void clearLayerCache();
+
     /**
      * Validate USD file format and structure
      * @param buffer USD data buffer
@@ -316,40 +588,155 @@ private:
     std::atomic<int32_t> maxRecursionDepth{safety::MAX_RECURSION_DEPTH};
     std::atomic<size_t> memoryLimitMB{1024};
     std::atomic<bool> referenceResolutionEnabled{true};
+    std::atomic<size_t> workerThreads{1};
+    std::atomic<bool> instancingEnabled{false};
+    std::atomic<bool> localSpaceEnabled{false};
+    std::atomic<bool> meshOptimizationEnabled{false};
+    std::atomic<float> weldEpsilon{0.0f};
+    std::atomic<double> timeCode{std::numeric_limits<double>::quiet_NaN()};
+    std::atomic<profiling::StageProfiler*> stageProfiler{nullptr};
+
+    static constexpr size_t MAX_WORKER_THREADS = 64;
+
+    /**
+     * Mesh found while walking the hierarchy, extracted in a later pass
+     */
+    struct MeshWorkItem {
+        void* mesh = nullptr;           ///< tinyusdz::GeomMesh owned by the stage
+        std::string elementName;
+        std::string typeName;
+        glm::mat4 worldTransform{1.0f};
+    };
 
     // Statistics - using the fixed version
     ProcessingStats stats;
 
     /**
-     * Process a USD primitive and its children recursively with safety checks
+     * Walk a USD primitive and its children recursively with safety checks,
+     * collecting every mesh together with its world transform
      * @param prim Pointer to the USD primitive (validated)
-     * @param meshDataArray Output array for mesh data
+     * @param workItems Output list of meshes to extract, in traversal order
      * @param parentTransform Parent transformation matrix (validated)
      * @param depth Current recursion depth (limited)
+     * @param cancelFlag Optional cancellation flag of the load
      * @return True if processing succeeded, false otherwise
      */
     bool ProcessPrim(void* prim,
-                    std::vector<MeshData>& meshDataArray,
+                    std::vector<MeshWorkItem>& workItems,
                     const glm::mat4& parentTransform,
-                    int32_t depth);
+                    int32_t depth,
+                    const std::atomic<bool>* cancelFlag = nullptr);
+
+    /**
+     * Extract collected meshes, in parallel when more than one worker thread is configured
+     * @param workItems Meshes collected by ProcessPrim
+     * @param meshDataArray Output array; valid meshes are appended in work item order
+     * @param cancelFlag Optional cancellation flag of the load
+     * @param progressCallback Optional callback receiving the extracted fraction in whole percent
+     *                         steps; calls are serialized across the extraction threads
+     * @return Number of meshes appended
+     */
+    size_t ExtractMeshWorkItems(const std::vector<MeshWorkItem>& workItems,
+                                std::vector<MeshData>& meshDataArray,
+                                const std::atomic<bool>* cancelFlag = nullptr,
+                                const ProgressCallback& progressCallback = nullptr);
+
+    /**
+     * Extract collected meshes and hand each to a sink once all earlier work items are done
+     * Only meshes still in flight are held, so memory stays bounded by the thread count
+     * @param workItems Meshes collected by ProcessPrim
+     * @param sink Receives valid meshes in work item order; returning false stops extraction
+     * @param cancelFlag Optional cancellation flag of the load
+     * @param progressCallback Optional callback receiving the extracted fraction in whole percent
+     *                         steps; calls are serialized across the extraction threads
+     * @param stopped Optional; set to true if the sink stopped extraction
+     * @return Number of meshes the sink accepted
+     */
+    size_t ExtractMeshWorkItems(const std::vector<MeshWorkItem>& workItems,
+                                const MeshSink& sink,
+                                const std::atomic<bool>* cancelFlag,
+                                const ProgressCallback& progressCallback,
+                                bool* stopped = nullptr);
+
+    /**
+     * Check whether a load has to stop
+     * @param cancelFlag Optional cancellation flag of the load
+     * @return True on shutdown or once the flag is set
+     */
+    bool isCancelled(const std::atomic<bool>* cancelFlag) const;
+
+    /**
+     * Merge extracted prototypes with identical geometry and attach their placements
+     * @param prototypes Extracted local-space meshes (consumed)
+     * @param extracted Non-zero for each prototype that extracted successfully; its
+     *                  allocator's resource also backs the merge bookkeeping
+     * @param placements World transforms of every occurrence, per prototype (consumed)
+     * @param meshDataArray Output array the merged meshes are appended to
+     * @return Number of meshes appended
+     */
+    size_t AppendInstancedMeshes(std::vector<MeshData>& prototypes,
+                                 const std::pmr::vector<uint8_t>& extracted,
+                                 std::vector<std::vector<glm::mat4>>& placements,
+                                 std::vector<MeshData>& meshDataArray);
 
     /**
      * Extract mesh data from USD mesh primitive with validation
      * @param mesh Pointer to the USD mesh (validated)
      * @param outMeshData Output mesh data structure
      * @param worldTransform World transformation matrix (validated)
+     * @param threads Threads that may triangulate a large mesh by face ranges
+     * @param scratch Arena for per-mesh temporaries, owned by the calling thread (nullptr: heap)
      * @return True if extraction succeeded, false otherwise
      */
     bool ExtractMeshData(void* mesh,
                         MeshData& outMeshData,
-                        const glm::mat4& worldTransform);
+                        const glm::mat4& worldTransform,
+                        size_t threads = 1,
+                        std::pmr::memory_resource* scratch = nullptr);
+
+    /**
+     * Load a USD stage from memory after running the content preprocessor
+     * @param data Raw USD data
+     * @param size Size of data in bytes
+     * @param fileName Original filename for format detection
+     * @param stage Output stage
+     * @param patchedBuffer Receives the preprocessed content when it had to be patched
+     * @param progressCallback Optional progress callback
+     * @return True if the stage was loaded, false otherwise
+     */
+    bool ParseStage(const uint8_t* data,
+                    size_t size,
+                    const std::string& fileName,
+                    tinyusdz::Stage& stage,
+                    std::pmr::vector<uint8_t>& patchedBuffer,
+                    ProgressCallback progressCallback);
+
+    /**
+     * Walk a primitive and its children computing world transforms only
+     * @param prim Pointer to the USD primitive (validated)
+     * @param parentTransform Parent world matrix
+     * @param parentAnimated True if any ancestor has time-sampled xformOps
+     * @param depth Current recursion depth (limited)
+     * @param timeCode Time at which time-sampled xformOps are evaluated
+     * @param staticWorld Cache of world matrices for prims with a fully static parent chain
+     * @param outTransforms Output transforms of mesh prims, in traversal order
+     */
+    void CollectTransforms(const void* prim,
+                           const glm::mat4& parentTransform,
+                           bool parentAnimated,
+                           int32_t depth,
+                           double timeCode,
+                           std::unordered_map<const void*, glm::mat4>& staticWorld,
+                           std::vector<PrimTransform>& outTransforms);
 
     /**
      * Get local transformation matrix with validation
      * @param prim Pointer to the USD primitive (validated)
+     * @param timeCode Time at which time-sampled xformOps are evaluated (NaN: default values)
+     * @param animated Optional; set to true if any xformOp of the prim is time-sampled
      * @return Local transformation matrix (validated for finite values)
      */
-    glm::mat4 GetLocalTransform(void* prim);
+    glm::mat4 GetLocalTransform(void* prim, double timeCode, bool* animated = nullptr);
 
     /**
      * Extract reference paths from USD stage with validation
@@ -357,14 +744,24 @@ private:
      * @param outReferencePaths Output vector for reference paths
      */
     void ExtractReferencePaths(const tinyusdz::Stage& stage,
-                              std::vector<std::string>& outReferencePaths);
+                              std::pmr::vector<std::pmr::string>& outReferencePaths);
 
     /**
      * Extract clips from raw USD content with pattern matching
      * @param buffer Raw USD content buffer
-     * @return Vector of clip paths found
+     * @param outClipPaths Clip paths found are appended here
+     */
+    void ExtractClipsFromRawContent(const std::vector<uint8_t>& buffer,
+                                    std::pmr::vector<std::pmr::string>& outClipPaths);
+
+    /**
+     * Extract clips from a raw USD byte range (binary crates yield none)
+     * @param data Raw USD content
+     * @param size Size of data in bytes
+     * @param outClipPaths Clip paths found are appended here
      */
-    std::vector<std::string> ExtractClipsFromRawContent(const std::vector<uint8_t>& buffer);
+    void ExtractClipsFromRawContent(const uint8_t* data, size_t size,
+                                    std::pmr::vector<std::pmr::string>& outClipPaths);
 
     /**
      * Extract reference paths from primitive recursively
@@ -372,7 +769,7 @@ private:
      * @param outReferencePaths Output vector for reference paths
      */
     void ExtractReferencePathsFromPrim(const tinyusdz::Prim& prim,
-                                      std::vector<std::string>& outReferencePaths);
+                                      std::pmr::vector<std::pmr::string>& outReferencePaths);
 
     /**
      * List primitive hierarchy for debugging
@@ -398,6 +795,7 @@ private:
 
     /**
      * Preprocess USD content to fix common issues
+     * Binary USDC/USDZ and layers carrying geometry are returned unchanged
      * @param buffer Input USD content buffer
      * @return Preprocessed USD content buffer
      */
@@ -417,23 +815,11 @@ private:
     void normalizeUVCoordinates(std::vector<glm::vec2>& uvs);
 
     /**
-     * Validate and fix mesh indices
-     * @param indices Input/output mesh indices
-     * @param vertexCount Number of vertices for validation
-     * @return True if indices are valid, false otherwise
+     * Weld, cache-order and fetch-remap one extracted mesh in place (optimization stage)
+     * @param meshData Mesh to optimize; unchanged if its attributes are not per-vertex
+     * @return True if the mesh was optimized
      */
-    bool validateMeshIndices(std::vector<uint32_t>& indices, size_t vertexCount);
-
-    /**
-     * Calculate and validate mesh normals
-     * @param points Vertex positions
-     * @param indices Triangle indices
-     * @param outNormals Output normal vectors
-     * @return True if normals calculated successfully, false otherwise
-     */
-    bool calculateMeshNormals(const std::vector<glm::vec3>& points,
-                             const std::vector<uint32_t>& indices,
-                             std::vector<glm::vec3>& outNormals);
+    bool optimizeMeshData(MeshData& meshData);
 
     /**
      * Extract UV coordinates from mesh with validation
@@ -442,27 +828,26 @@ private:
      */
     void extractUVCoordinates(tinyusdz::GeomMesh* mesh, MeshData& meshData);
 
-    /**
-     * Check if mesh data has empty geometry
-     * @param meshData Vector of mesh data to check
-     * @return True if any mesh has empty geometry
-     */
-    bool hasEmptyGeometry(const std::vector<MeshData>& meshData) const;
-
     /**
      * Resolve USD references with progress tracking
      * @param stage USD stage
-     * @param buffer Raw USD buffer
+     * @param data Raw USD content
+     * @param size Size of data in bytes
      * @param fileName Original filename
      * @param outMeshData Output mesh data
      * @param progressCallback Progress callback
+     * @param cancelFlag Optional cancellation flag, checked between references
+     * @param scratch Arena of the load for the reference path lists (nullptr: heap)
      * @return True if successful
      */
     bool resolveReferences(const tinyusdz::Stage& stage,
-                          const std::vector<uint8_t>& buffer,
+                          const uint8_t* data,
+                          size_t size,
                           const std::string& fileName,
                           std::vector<MeshData>& outMeshData,
-                          ProgressCallback progressCallback);
+                          ProgressCallback progressCallback,
+                          const std::atomic<bool>* cancelFlag = nullptr,
+                          std::pmr::memory_resource* scratch = nullptr);
 
     /**
      * Load referenced file and extract meshes
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace anari_usd_middleware {
+
+/**
+ * Decoding of compressed transfers. A sender that compresses a file adds an encoding
+ * frame "<codec>:<raw_size>" to the message; the hash frame always describes the
+ * uncompressed bytes. Codecs use their standard frame formats (zstd frames, LZ4 frame
+ * format), so the reference Python bindings produce compatible data. Support for each
+ * codec is compiled in when the build finds its library (JUSYNC_WITH_ZSTD, JUSYNC_WITH_LZ4).
+ */
+namespace compression {
+
+enum class Codec {
+    None,
+    Zstd,
+    Lz4
+};
+
+/**
+ * @param codec Codec
+ * @return Name used in encoding frames ("identity", "zstd", "lz4")
+ */
+const char* codecName(Codec codec);
+
+/**
+ * Check whether this build can decode a codec
+ * @param codec Codec to check (None is always available)
+ * @return True if supported
+ */
+bool isCodecAvailable(Codec codec);
+
+/**
+ * Codecs this build can decode, most preferred first
+ * @return JSON array body, e.g. "\"zstd\", \"lz4\"" (empty when none)
+ */
+std::string availableCodecList();
+
+/**
+ * Parse an encoding frame of the form "<codec>:<raw_size>"
+ * @param frame Frame contents
+ * @param codec Output codec (the name must be known, not necessarily available)
+ * @param rawSize Output size of the decoded data (> 0)
+ * @return False if the frame is malformed
+ */
+bool parseEncodingFrame(const std::string& frame, Codec& codec, uint64_t& rawSize);
+
+/**
+ * Incremental decoder for one compressed stream; input may be split at any byte
+ */
+class StreamDecoder {
+public:
+    // Receives decoded bytes; returning false stops decoding with an error
+    using Sink = std::function<bool(const uint8_t* data, size_t size)>;
+
+    StreamDecoder();
+    ~StreamDecoder();
+
+    StreamDecoder(const StreamDecoder&) = delete;
+    StreamDecoder& operator=(const StreamDecoder&) = delete;
+    StreamDecoder(StreamDecoder&&) noexcept;
+    StreamDecoder& operator=(StreamDecoder&&) noexcept;
+
+    /**
+     * Start a new stream
+     * @param codec Codec of the stream
+     * @return False if the codec is not available in this build
+     */
+    bool reset(Codec codec);
+
+    /**
+     * Decode input straight into a caller-owned buffer
+     * @param in Compressed bytes
+     * @param inSize Number of compressed bytes
+     * @param out Destination buffer
+     * @param outCapacity Space left in out
+     * @param produced Output number of bytes written to out
+     * @return False on corrupt input or if the decoded data does not fit
+     */
+    bool decodeInto(const uint8_t* in, size_t inSize, uint8_t* out, size_t outCapacity, size_t& produced);
+
+    /**
+     * Decode input through an internal block buffer
+     * @param in Compressed bytes
+     * @param inSize Number of compressed bytes
+     * @param sink Called with each decoded block
+     * @return False on corrupt input or if the sink rejected a block
+     */
+    bool decode(const uint8_t* in, size_t inSize, const Sink& sink);
+
+    /**
+     * @return True once the end of the compressed stream has been decoded
+     */
+    bool finished() const;
+
+private:
+    struct State;
+    std::unique_ptr<State> state;
+};
+
+/**
+ * Decode a whole compressed buffer into a buffer of exactly the expected size
+ * @param codec Codec of the input
+ * @param in Compressed bytes
+ * @param inSize Number of compressed bytes
+ * @param out Destination buffer
+ * @param outSize Expected decoded size
+ * @return False if decoding fails or the result is not exactly outSize bytes
+ */
+bool decompress(Codec codec, const uint8_t* in, size_t inSize, uint8_t* out, size_t outSize);
+
+} // namespace compression
+} // namespace anari_usd_middleware
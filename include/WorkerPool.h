@@ -0,0 +1,75 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "BoundedMpmcQueue.h"
+
+#ifndef ANARI_USD_MIDDLEWARE_API
+#ifdef _WIN32
+#define ANARI_USD_MIDDLEWARE_API __declspec(dllexport)
+#else
+#define ANARI_USD_MIDDLEWARE_API __attribute__((visibility("default")))
+#endif
+#endif
+
+namespace anari_usd_middleware {
+
+/**
+ * Fixed set of worker threads for the fork-join work inside a load (mesh extraction,
+ * triangulation). parallelFor() also runs on the calling thread and takes over every index
+ * no worker has picked up, so a busy pool only costs parallelism: nested calls from pool
+ * threads cannot deadlock, and the number of OS threads never grows with the load count.
+ */
+class ANARI_USD_MIDDLEWARE_API WorkerPool {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+    static constexpr size_t QUEUE_CAPACITY = 1024;
+
+    /**
+     * @param threadCount Worker threads in addition to callers (clamped to 1-MAX_THREADS)
+     */
+    explicit WorkerPool(size_t threadCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Pool shared by all loads of the process, one thread less than the hardware has
+     * (the caller is the last one). Created on first use.
+     */
+    static WorkerPool& shared();
+
+    size_t threadCount() const { return threads.size(); }
+
+    /**
+     * Call body(i) for every i in [0, count) on the calling thread and up to
+     * maxParallelism - 1 pool threads, and wait for all calls to finish. After an
+     * exception no further indices are started; the first one is rethrown here once the
+     * calls already running have returned.
+     * @param count Number of indices
+     * @param maxParallelism Threads working on the indices at most, including the caller
+     * @param body Work for one index
+     */
+    void parallelFor(size_t count, size_t maxParallelism, const std::function<void(size_t)>& body);
+
+private:
+    struct Job;
+
+    void workerLoop();
+    static void help(Job& job);
+
+    BoundedMpmcQueue<std::shared_ptr<Job>> queue{QUEUE_CAPACITY};
+    std::mutex mutex;
+    std::condition_variable available;
+    bool stopping = false;
+    std::vector<std::thread> threads;
+};
+
+} // namespace anari_usd_middleware
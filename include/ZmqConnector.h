@@ -6,8 +6,11 @@
 #include <atomic>
 #include <mutex>
 #include <chrono>
+#include <map>
 #include <zmq.hpp>
 #include "MiddlewareLogging.h"
+#include "FilePayload.h"
+#include "WireCompression.h"
 
 namespace anari_usd_middleware {
 
@@ -38,6 +41,13 @@ public:
         std::atomic<uint64_t> totalBytesReceived{0};
         std::atomic<uint64_t> failedReceives{0};
         std::atomic<uint64_t> hashMismatches{0};
+        std::atomic<uint64_t> chunksReceived{0};
+        std::atomic<uint64_t> chunkedFilesReceived{0};
+        std::atomic<uint64_t> transfersResumed{0};
+        std::atomic<uint64_t> compressedFilesReceived{0};
+        std::atomic<uint64_t> compressedBytesReceived{0};
+        std::atomic<uint64_t> decompressedBytes{0};
+        std::atomic<uint64_t> decompressionFailures{0};
         std::chrono::steady_clock::time_point lastMessageTime;
 
         // Delete copy constructor and assignment operator since atomics can't be copied
@@ -52,6 +62,13 @@ public:
             totalBytesReceived.store(other.totalBytesReceived.load());
             failedReceives.store(other.failedReceives.load());
             hashMismatches.store(other.hashMismatches.load());
+            chunksReceived.store(other.chunksReceived.load());
+            chunkedFilesReceived.store(other.chunkedFilesReceived.load());
+            transfersResumed.store(other.transfersResumed.load());
+            compressedFilesReceived.store(other.compressedFilesReceived.load());
+            compressedBytesReceived.store(other.compressedBytesReceived.load());
+            decompressedBytes.store(other.decompressedBytes.load());
+            decompressionFailures.store(other.decompressionFailures.load());
             lastMessageTime = other.lastMessageTime;
         }
 
@@ -62,6 +79,13 @@ public:
                 totalBytesReceived.store(other.totalBytesReceived.load());
                 failedReceives.store(other.failedReceives.load());
                 hashMismatches.store(other.hashMismatches.load());
+                chunksReceived.store(other.chunksReceived.load());
+                chunkedFilesReceived.store(other.chunkedFilesReceived.load());
+                transfersResumed.store(other.transfersResumed.load());
+                compressedFilesReceived.store(other.compressedFilesReceived.load());
+                compressedBytesReceived.store(other.compressedBytesReceived.load());
+                decompressedBytes.store(other.decompressedBytes.load());
+                decompressionFailures.store(other.decompressionFailures.load());
                 lastMessageTime = other.lastMessageTime;
             }
             return *this;
@@ -73,6 +97,13 @@ public:
             totalBytesReceived.store(0);
             failedReceives.store(0);
             hashMismatches.store(0);
+            chunksReceived.store(0);
+            chunkedFilesReceived.store(0);
+            transfersResumed.store(0);
+            compressedFilesReceived.store(0);
+            compressedBytesReceived.store(0);
+            decompressedBytes.store(0);
+            decompressionFailures.store(0);
             lastMessageTime = std::chrono::steady_clock::now();
         }
 
@@ -83,6 +114,13 @@ public:
             uint64_t totalBytesReceived;
             uint64_t failedReceives;
             uint64_t hashMismatches;
+            uint64_t chunksReceived;
+            uint64_t chunkedFilesReceived;
+            uint64_t transfersResumed;
+            uint64_t compressedFilesReceived;
+            uint64_t compressedBytesReceived;
+            uint64_t decompressedBytes;
+            uint64_t decompressionFailures;
             std::chrono::steady_clock::time_point lastMessageTime;
         };
 
@@ -93,11 +131,97 @@ public:
                 totalBytesReceived.load(),
                 failedReceives.load(),
                 hashMismatches.load(),
+                chunksReceived.load(),
+                chunkedFilesReceived.load(),
+                transfersResumed.load(),
+                compressedFilesReceived.load(),
+                compressedBytesReceived.load(),
+                decompressedBytes.load(),
+                decompressionFailures.load(),
                 lastMessageTime
             };
         }
     };
 
+    /**
+     * Received traffic of one bound endpoint or one client identity (copyable snapshot)
+     */
+    struct ThroughputStats {
+        std::string name;               // Endpoint address, or client identity (hex when not printable)
+        std::string endpoint;           // Endpoint a client was last seen on (empty for endpoints)
+        uint64_t messages = 0;          // Complete multipart messages
+        uint64_t bytes = 0;             // Frame bytes after the identity
+        double bytesPerSecond = 0.0;    // Average since the first message or the last stats reset
+        std::chrono::steady_clock::time_point lastMessageTime;
+    };
+
+    /**
+     * Outcome of receiveNext()
+     */
+    enum class ReceiveResult {
+        Nothing,            // No complete message was available, or it was rejected
+        File,               // A file is ready (single-frame or reassembled chunked transfer)
+        Message,            // A generic text message is ready
+        TransferProgress    // A protocol control frame (chunked transfer, capability query) was handled
+    };
+
+    /**
+     * Outcome of waitForMessage()
+     */
+    enum class WaitResult {
+        Ready,              // A message is ready on a ROUTER socket
+        Timeout,            // Timed out or woken up by wakeup()
+        Disconnected,       // Not connected; waiting again returns at once until reconnected
+        Terminated          // The ZeroMQ context was terminated; no message will ever arrive
+    };
+
+    /**
+     * Result data filled by receiveNext()
+     */
+    struct IncomingMessage {
+        std::string filename;
+        FilePayload data;
+        std::string hash;
+        bool hashVerified = false;  // Already checked against hash while the chunks arrived
+        std::string text;           // Set for ReceiveResult::Message
+        compression::Codec codec = compression::Codec::None; // data is still compressed unless None
+        uint64_t rawSize = 0;       // Decoded size when codec is not None
+    };
+
+    // Optional last frame of a file message or chunked BEGIN: "<codec>:<raw_size>", e.g.
+    // "zstd:1048576". Content (or the chunk stream) is then compressed with that codec and
+    // the hash frame describes the decoded bytes. Senders negotiate by sending the single
+    // frame CAPABILITIES_TAG, answered with {"status":"ok","codecs":["zstd","lz4"]}.
+    static constexpr const char* CAPABILITIES_TAG = "JUSYNC_CAPABILITIES";
+
+    // Chunked transfer protocol (first frame after the identity is the tag):
+    //   [BEGIN][transfer_id][filename][total_size][hash][chunk_size]([encoding]) -> {"status":"ready",...}
+    //   [CHUNK][transfer_id][seq][payload]                             -> {"status":"ack"|"nack","next_chunk":N}
+    //   [END][transfer_id]                                             -> "RECEIVED" or "ERROR: ..."
+    //   [ABORT][transfer_id]                                           -> {"status":"aborted"}
+    // Repeating BEGIN with the same transfer_id and file description resumes at next_chunk.
+    // With an encoding frame, total_size and chunk sizes refer to the compressed stream.
+    static constexpr const char* CHUNK_BEGIN_TAG = "JUSYNC_CHUNK_BEGIN";
+    static constexpr const char* CHUNK_DATA_TAG = "JUSYNC_CHUNK";
+    static constexpr const char* CHUNK_END_TAG = "JUSYNC_CHUNK_END";
+    static constexpr const char* CHUNK_ABORT_TAG = "JUSYNC_CHUNK_ABORT";
+
+    static constexpr size_t MIN_CHUNK_SIZE = 4096;                          // 4KB
+    static constexpr size_t MAX_CHUNK_SIZE = 64ull * 1024 * 1024;           // 64MB
+    static constexpr uint64_t MAX_CHUNKED_FILE_SIZE = safety::MAX_STREAMED_FILE_SIZE;
+    static constexpr size_t MAX_ACTIVE_TRANSFERS = 64;
+    static constexpr size_t MAX_CHUNK_WINDOW = 256;
+    static constexpr std::chrono::minutes TRANSFER_IDLE_TIMEOUT{30};
+
+    // Largest frame count receiveNext() accepts after the identity
+    static constexpr size_t MAX_MESSAGE_PARTS = 8;
+
+    static constexpr size_t MAX_ENDPOINTS = 16;
+    static constexpr int MAX_IO_THREADS = 64;
+    static constexpr int MAX_HIGH_WATER_MARK = 1000000;
+    // Client identities tracked for getClientStats(); the least recently seen is dropped first
+    static constexpr size_t MAX_TRACKED_CLIENTS = 256;
+
     ZmqConnector();
     ~ZmqConnector();
 
@@ -107,13 +231,48 @@ public:
 
     /**
      * Initializes the ZeroMQ connection with enhanced error handling and fallback endpoints.
-     * @param endpoint The ZeroMQ endpoint to bind to (e.g., "tcp://*:13456").
-     *                 If null, defaults to "tcp://*:5556".
+     * @param endpoint The ZeroMQ endpoint to bind to (e.g., "tcp://0.0.0.0:13456"), or a comma-separated
+     *                 list such as "tcp://0.0.0.0:5556,ipc:///tmp/jusync". If null, binds port 5556 on all
+     *                 interfaces.
      * @param timeoutMs Connection timeout in milliseconds (default: 5000ms)
      * @return True if initialization was successful, false otherwise.
      */
     bool initialize(const char* endpoint = nullptr, int timeoutMs = 5000);
 
+    /**
+     * Initializes the connection on several endpoints, each with its own ROUTER socket.
+     * The receiver serves the sockets round-robin, so one busy endpoint cannot starve the
+     * others. An endpoint that cannot be bound (after trying tcp fallbacks) is skipped.
+     * @param endpoints Endpoints to bind (1-MAX_ENDPOINTS; tcp, ipc and inproc may be mixed)
+     * @param timeoutMs Connection timeout in milliseconds
+     * @return True if at least one endpoint was bound, false otherwise.
+     */
+    bool initialize(const std::vector<std::string>& endpoints, int timeoutMs = 5000);
+
+    /**
+     * Set the number of ZeroMQ I/O threads. Takes effect on the next initialize()
+     * @param threads I/O threads (1-MAX_IO_THREADS, default 1); about one per GB/s of tcp traffic
+     */
+    void setIoThreads(int threads);
+
+    /**
+     * Get the configured number of ZeroMQ I/O threads
+     * @return I/O thread count used by the next initialize()
+     */
+    int getIoThreads() const;
+
+    /**
+     * Set the send and receive high water mark of every socket. Takes effect on the next initialize()
+     * @param messages Messages queued per peer before ZeroMQ pushes back (1-MAX_HIGH_WATER_MARK, default 1000)
+     */
+    void setHighWaterMark(int messages);
+
+    /**
+     * Get the configured high water mark
+     * @return Messages queued per peer before ZeroMQ pushes back
+     */
+    int getHighWaterMark() const;
+
     /**
      * Disconnects and cleans up the ZeroMQ connection safely.
      * @param gracefulTimeoutMs Time to wait for graceful shutdown (default: 1000ms)
@@ -136,12 +295,12 @@ public:
      * Receives a file from a client with comprehensive validation.
      * Expects a multi-part message: [Identity] [Filename] [Content] [Hash]
      * @param filename Output parameter for the received filename (validated for safety)
-     * @param data Output parameter for the received file data (size-limited)
+     * @param data Output parameter for the received file data; shares the content frame, no copy
      * @param hash Output parameter for the received file hash (format-validated)
      * @param timeoutMs Receive timeout in milliseconds (default: 100ms)
      * @return True if a file was successfully received and validated, false otherwise.
      */
-    bool receiveFile(std::string& filename, std::vector<uint8_t>& data,
+    bool receiveFile(std::string& filename, FilePayload& data,
                      std::string& hash, int timeoutMs = 100);
 
     bool validateFilenamePermissive(const std::string &filename) const;
@@ -155,12 +314,55 @@ public:
      */
     bool receiveAnyMessage(int timeoutMs = 100);
 
+    /**
+     * Receives the next queued message without blocking and dispatches on its frame layout:
+     * a single frame is a generic message, [Filename][Content][Hash]([Encoding]) is a file,
+     * and frames starting with a chunk tag drive a chunked transfer. Compressed single-frame
+     * files are returned still compressed (see decompressPayload()); chunked transfers are
+     * decoded into the spool file as the chunks arrive. Every message is read completely,
+     * so no frames are left behind for the next call.
+     * @param out Output parameter for the received file or message
+     * @return What was received (see ReceiveResult)
+     */
+    ReceiveResult receiveNext(IncomingMessage& out);
+
+    /**
+     * Decodes a compressed file payload from receiveNext() (thread-safe, meant for worker threads).
+     * The output buffer is allocated once at the announced size and decoding stops if the
+     * data would grow past it.
+     * @param codec Codec from IncomingMessage::codec (None leaves data untouched)
+     * @param rawSize Announced decoded size from IncomingMessage::rawSize
+     * @param data Compressed payload, replaced by the decoded bytes on success
+     * @return True if data now holds exactly rawSize decoded bytes, false otherwise.
+     */
+    bool decompressPayload(compression::Codec codec, uint64_t rawSize, FilePayload& data);
+
     /**
      * Gets the raw socket handle for polling operations (thread-safe).
-     * @return The raw ZeroMQ socket handle, or nullptr if not connected.
+     * @return The raw ZeroMQ socket handle of the first endpoint, or nullptr if not connected.
      */
     void* getSocket() const;
 
+    /**
+     * Blocks until any ROUTER socket has input or wakeup() is signalled.
+     * Pending wakeup signals are consumed, so only the receiving thread may call this.
+     * Only Ready and Timeout block; callers must back off or stop on the other results.
+     * @param timeoutMs Maximum time to block in milliseconds (-1 blocks indefinitely)
+     * @return Ready if a message is ready on a ROUTER socket, see WaitResult otherwise.
+     */
+    WaitResult waitForMessage(int timeoutMs);
+
+    /**
+     * Interrupts a thread blocked in waitForMessage() (thread-safe).
+     */
+    void wakeup();
+
+    /**
+     * Checks without blocking whether another message is queued on any ROUTER socket.
+     * @return True if the next receive will not block, false otherwise.
+     */
+    bool hasPendingMessage() const;
+
     /**
      * Gets the last received message as a string (thread-safe).
      * @return The last received message (copy for thread safety).
@@ -169,10 +371,28 @@ public:
 
     /**
      * Get current endpoint information
-     * @return Current bound endpoint string
+     * @return First bound endpoint string
      */
     std::string getCurrentEndpoint() const;
 
+    /**
+     * Get all bound endpoints
+     * @return Bound endpoint strings, in binding order
+     */
+    std::vector<std::string> getEndpoints() const;
+
+    /**
+     * Get received traffic per bound endpoint (thread-safe)
+     * @return One entry per endpoint, in binding order
+     */
+    std::vector<ThroughputStats> getEndpointStats() const;
+
+    /**
+     * Get received traffic per client identity (thread-safe), e.g. to find a saturating rank
+     * @return Up to MAX_TRACKED_CLIENTS entries, most bytes first
+     */
+    std::vector<ThroughputStats> getClientStats() const;
+
     /**
      * Get message statistics for monitoring - FIXED VERSION
      * @return Snapshot of current message statistics (copyable)
@@ -202,13 +422,64 @@ public:
      */
     size_t getMaxMessageSize() const;
 
+    /**
+     * Set the directory chunked transfers are spooled to while in flight
+     * @param directory Spool directory (created on demand); defaults to <temp>/jusync-spool
+     */
+    void setChunkSpoolDirectory(const std::string& directory);
+
+    /**
+     * Get the chunked transfer spool directory
+     * @return Current spool directory
+     */
+    std::string getChunkSpoolDirectory() const;
+
+    /**
+     * Set how many chunks a sender may have in flight before waiting for acks
+     * @param chunks Credit advertised in the BEGIN reply (1-MAX_CHUNK_WINDOW)
+     */
+    void setChunkWindow(size_t chunks);
+
+    /**
+     * Get the advertised chunk window
+     * @return Chunks a sender may have in flight
+     */
+    size_t getChunkWindow() const;
+
+    /**
+     * Get the number of chunked transfers currently in progress
+     * @return Active transfer count
+     */
+    size_t getActiveTransferCount() const;
+
 private:
+    struct ChunkedTransfer;
+    struct BoundSocket;
+    struct ClientTraffic;
     // ZeroMQ components with RAII wrappers
     std::unique_ptr<zmq::context_t> zmqContext;
-    std::unique_ptr<zmq::socket_t> zmqSocket;
+    std::vector<std::unique_ptr<BoundSocket>> boundSockets;
+    std::atomic<int> ioThreads{1};
+    std::atomic<int> highWaterMark{1000};
+
+    // Socket of the message being received and answered (receiving thread only)
+    zmq::socket_t* activeSocket = nullptr;
+    size_t activeSocketIndex = 0;
+    // Fair-queue cursor: the next receive starts at this socket
+    size_t nextSocketIndex = 0;
+    std::vector<zmq::pollitem_t> pollItems; // Every socket, then the wakeup receiver
+
+    // Per-identity traffic, bounded by MAX_TRACKED_CLIENTS
+    std::map<std::string, ClientTraffic> clientTraffic;
+    mutable std::mutex clientMutex;
+    std::chrono::steady_clock::time_point statsSince;
+
+    // Inproc PAIR used to interrupt a blocking poll (e.g. on shutdown)
+    std::unique_ptr<zmq::socket_t> wakeupReceiver;
+    std::unique_ptr<zmq::socket_t> wakeupSender;
+    std::mutex wakeupMutex;
 
     // Connection state management
-    std::string currentEndpoint;
     mutable std::mutex connectionMutex;
     std::atomic<ConnectionStatus> connectionStatus{ConnectionStatus::Disconnected};
     std::atomic<bool> shutdownRequested{false};
@@ -219,6 +490,12 @@ private:
     MessageStats messageStats;
     std::atomic<size_t> maxMessageSize{safety::MAX_BUFFER_SIZE};
 
+    // Chunked transfers in progress, keyed by transfer id so a reconnecting sender can resume
+    std::map<std::string, std::unique_ptr<ChunkedTransfer>> activeTransfers;
+    mutable std::mutex transferMutex;
+    std::string chunkSpoolDirectory;
+    std::atomic<size_t> chunkWindow{8};
+
     // Timing and health monitoring
     std::chrono::steady_clock::time_point lastHealthCheck;
     std::atomic<bool> healthCheckEnabled{true};
@@ -228,6 +505,17 @@ private:
      */
     void cleanup();
 
+    /**
+     * Create the inproc wakeup socket pair on the current context.
+     * @return True if both ends were created and connected, false otherwise.
+     */
+    bool createWakeupPair();
+
+    /**
+     * Close the inproc wakeup socket pair if it exists.
+     */
+    void closeWakeupPair();
+
     /**
      * Helper method to send a reply to a client with validation.
      * @param identity The client's identity frame (validated)
@@ -254,10 +542,41 @@ private:
 
     /**
      * Try binding to alternative endpoints if primary fails
+     * @param socket Socket to bind
      * @param primaryEndpoint Primary endpoint that failed
-     * @return True if successfully bound to alternative, false otherwise
+     * @return Endpoint that was bound, empty if every alternative failed
+     */
+    std::string tryAlternativeEndpoints(zmq::socket_t& socket, const std::string& primaryEndpoint);
+
+    /**
+     * Create a configured ROUTER socket and bind it, falling back to alternative tcp endpoints
+     * @param endpoint Endpoint to bind
+     * @param timeoutMs Send/receive timeout in milliseconds
+     * @return True if the socket was bound and added to boundSockets, false otherwise
+     */
+    bool bindEndpoint(const std::string& endpoint, int timeoutMs);
+
+    /**
+     * Wait for input on any bound socket
+     * @param timeoutMs Maximum time to block in milliseconds
+     * @return Number of readable sockets, 0 on timeout, negative on error
+     */
+    int pollSockets(int timeoutMs);
+
+    /**
+     * Receive the identity frame of the next message, starting at the socket after the one
+     * served last, and make that socket the active one (receiving thread only)
+     * @param identity Output identity frame
+     * @return True if a message was available on any socket, false otherwise
+     */
+    bool receiveIdentity(zmq::message_t& identity);
+
+    /**
+     * Account a complete message to the active endpoint and to the sender's identity
+     * @param identity Sender identity
+     * @param bytes Frame bytes after the identity
      */
-    bool tryAlternativeEndpoints(const std::string& primaryEndpoint);
+    void recordTraffic(const zmq::message_t& identity, size_t bytes);
 
     /**
      * Drain any remaining message parts to prevent state corruption
@@ -285,6 +604,38 @@ private:
      * @return True if hash is valid format, false otherwise
      */
     bool validateHashFormat(const std::string& hash) const;
+
+    /**
+     * Handle a chunked transfer control or data message (caller holds no locks)
+     * @param identity Sender identity for the reply
+     * @param parts Frames after the identity; parts[0] is the chunk tag
+     * @param out Filled when an END completes a transfer
+     * @return File when a transfer completed, TransferProgress or Nothing otherwise
+     */
+    ReceiveResult handleChunkedMessage(zmq::message_t& identity, std::vector<zmq::message_t>& parts,
+                                       IncomingMessage& out);
+
+    ReceiveResult handleChunkBegin(zmq::message_t& identity, std::vector<zmq::message_t>& parts);
+    ReceiveResult handleChunkData(zmq::message_t& identity, std::vector<zmq::message_t>& parts);
+    ReceiveResult handleChunkEnd(zmq::message_t& identity, std::vector<zmq::message_t>& parts,
+                                 IncomingMessage& out);
+    ReceiveResult handleChunkAbort(zmq::message_t& identity, std::vector<zmq::message_t>& parts);
+
+    /**
+     * Drop a transfer and delete its spool file (transferMutex must be held)
+     * @param transferId Transfer to discard
+     */
+    void discardTransfer(const std::string& transferId);
+
+    /**
+     * Discard transfers that have been idle longer than TRANSFER_IDLE_TIMEOUT (transferMutex must be held)
+     */
+    void expireIdleTransfers();
+
+    /**
+     * Discard all in-flight transfers and their spool files
+     */
+    void discardAllTransfers();
 };
 
 } // namespace anari_usd_middleware
@@ -3,23 +3,95 @@
 #include "HashVerifier.h"
 #include "UsdProcessor.h"
 #include "MiddlewareLogging.h"
-
+#include "BoundedMpmcQueue.h"
+#include "LruCache.h"
+#include "MappedFile.h"
+#include "MeshSimplifier.h"
+#include "MeshContainer.h"
+#include "MeshDiskCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <memory>
 #include <thread>
+#include <unordered_map>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <optional>
 #include <sstream>
+#include <system_error>
 #include <regex>
-#include <unordered_set>
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include <stb_image_write.h>
 
 namespace anari_usd_middleware {
 
+// Describe meshes for container::encode. The container stores per-vertex attributes only;
+// other layouts are dropped, or refused when lossless is set (the disk cache must round-trip).
+static bool describeMeshes(const std::vector<AnariUsdMiddleware::MeshData>& meshes, bool lossless,
+                           std::vector<container::MeshView>& views) {
+    views.clear();
+    views.reserve(meshes.size());
+    for (const auto& mesh : meshes) {
+        if (!mesh.isValid()) {
+            MIDDLEWARE_LOG_ERROR("Cannot encode invalid mesh %s", mesh.elementName.c_str());
+            return false;
+        }
+
+        const size_t vertexCount = mesh.getVertexCount();
+        const bool perVertex = (mesh.normals.empty() || mesh.normals.size() == vertexCount * 3) &&
+                               (mesh.uvs.empty() || mesh.uvs.size() == vertexCount * 2) &&
+                               (mesh.vertex_colors.empty() || mesh.vertex_colors.size() == vertexCount * 4);
+        if (lossless && !perVertex) {
+            return false;
+        }
+
+        container::MeshView view;
+        view.elementName = mesh.elementName;
+        view.typeName = mesh.typeName;
+        view.points = mesh.points.data();
+        view.vertexCount = vertexCount;
+        view.indices = mesh.indices.data();
+        view.indexCount = mesh.indices.size();
+        view.normals = mesh.normals.size() == vertexCount * 3 ? mesh.normals.data() : nullptr;
+        view.uvs = mesh.uvs.size() == vertexCount * 2 ? mesh.uvs.data() : nullptr;
+        view.colors = mesh.vertex_colors.size() == vertexCount * 4 ? mesh.vertex_colors.data() : nullptr;
+        if (!mesh.instance_transforms.empty()) {
+            view.instanceTransforms = mesh.instance_transforms.data();
+            view.instanceCount = mesh.getInstanceCount();
+        }
+        views.push_back(view);
+    }
+    return true;
+}
+
+// Duplicate detection key: the same content under another filename is a different file
+struct ProcessedFileKey {
+    ContentDigest digest;
+    std::string filename;
+
+    bool operator==(const ProcessedFileKey& other) const {
+        return digest == other.digest && filename == other.filename;
+    }
+};
+
+struct ProcessedFileKeyHash {
+    size_t operator()(const ProcessedFileKey& key) const {
+        return ContentDigestHash()(key.digest) ^ (std::hash<std::string>()(key.filename) * 31);
+    }
+};
+
 // Implementation class with all required methods
 class AnariUsdMiddleware::Impl {
+    // Declared first so it outlives the processor and threads that record into it
+    profiling::StageProfiler stageProfiler;
+
     // Core components
     ZmqConnector zmqConnector;
     std::unique_ptr<UsdProcessor> usdProcessor;
@@ -27,6 +99,10 @@ class AnariUsdMiddleware::Impl {
     // Callback management
     std::map<int, AnariUsdMiddleware::FileUpdateCallback> updateCallbacks;
     std::map<int, AnariUsdMiddleware::MessageCallback> messageCallbacks;
+    std::map<int, AnariUsdMiddleware::SceneDeltaCallback> sceneDeltaCallbacks;
+    std::atomic<size_t> sceneDeltaCallbackCount{0};
+    std::map<int, AnariUsdMiddleware::MeshLodCallback> meshLodCallbacks;
+    std::atomic<size_t> meshLodCallbackCount{0};
     std::mutex callbackMutex;
     std::atomic<int> nextCallbackId{1};
 
@@ -35,27 +111,198 @@ class AnariUsdMiddleware::Impl {
     std::atomic<bool> running{false};
     std::atomic<bool> shutdownRequested{false};
 
+    // Receive batching: messages drained per poll wakeup before re-polling
+    static constexpr size_t MAX_MESSAGES_PER_WAKEUP_LIMIT = 10000;
+    std::atomic<size_t> maxMessagesPerWakeup{64};
+
+    // Processing pipeline: the receiver thread only pulls messages off the socket and
+    // queues them; workers do hash verification, type detection and callback dispatch
+    struct PipelineItem {
+        enum class Kind { File, Message };
+        Kind kind = Kind::File;
+        AnariUsdMiddleware::FileData fileData;
+        bool hashVerified = false; // Chunked transfers are verified while they are reassembled
+        compression::Codec codec = compression::Codec::None; // fileData.data still compressed unless None
+        uint64_t rawSize = 0;
+        std::string message;
+        uint64_t enqueuedNs = 0; // StageProfiler::now() when the receiver queued it
+    };
+
+    struct PipelineStats {
+        std::atomic<uint64_t> enqueued{0};
+        std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> stallCount{0};
+        std::atomic<uint64_t> totalStallMicros{0};
+        std::atomic<size_t> queueDepth{0};
+        std::atomic<size_t> peakQueueDepth{0};
+
+        PipelineStats() = default;
+        PipelineStats(const PipelineStats&) = delete;
+        PipelineStats& operator=(const PipelineStats&) = delete;
+
+        void reset() {
+            enqueued.store(0);
+            processed.store(0);
+            dropped.store(0);
+            stallCount.store(0);
+            totalStallMicros.store(0);
+            queueDepth.store(0);
+            peakQueueDepth.store(0);
+        }
+
+        struct Snapshot {
+            uint64_t enqueued;
+            uint64_t processed;
+            uint64_t dropped;
+            uint64_t stallCount;
+            uint64_t totalStallMicros;
+            size_t queueDepth;
+            size_t peakQueueDepth;
+        };
+
+        Snapshot getSnapshot() const {
+            return {
+                enqueued.load(),
+                processed.load(),
+                dropped.load(),
+                stallCount.load(),
+                totalStallMicros.load(),
+                queueDepth.load(),
+                peakQueueDepth.load()
+            };
+        }
+    };
+
+    static constexpr size_t MAX_PIPELINE_WORKERS = 64;
+    static constexpr size_t MAX_PIPELINE_QUEUE_CAPACITY = 65536;
+    static constexpr int MAX_PIPELINE_STALL_TIMEOUT_MS = 60000;
+    std::atomic<size_t> pipelineWorkerCount{2};
+    std::atomic<size_t> pipelineQueueCapacity{64};
+    std::atomic<int> pipelineStallTimeoutMs{5000};
+    std::atomic<size_t> usdWorkerThreads{4};
+    std::atomic<bool> usdInstancing{false};
+    std::atomic<bool> usdLocalSpace{false};
+    std::atomic<bool> usdMeshOptimization{false};
+    std::atomic<float> usdWeldEpsilon{0.0f};
+    std::atomic<double> usdTimeCode{std::numeric_limits<double>::quiet_NaN()};
+
+    std::unique_ptr<BoundedMpmcQueue<std::unique_ptr<PipelineItem>>> pipelineQueue;
+    std::vector<std::thread> pipelineWorkers;
+    std::atomic<bool> pipelineRunning{false};
+    std::atomic<size_t> activeWorkerCount{0};
+    std::atomic<size_t> activeQueueCapacity{0};
+    std::mutex pipelineMutex;
+    std::condition_variable itemAvailable;
+    std::condition_variable spaceAvailable;
+    PipelineStats pipelineStats;
+
     // Initialization
     std::mutex initMutex;
     std::atomic<bool> initialized{false};
     std::chrono::steady_clock::time_point initializationTime;
 
-    // File tracking for duplicate prevention
-    std::unordered_set<std::string> processedFiles;
-    std::mutex processedFilesMutex;
-    std::chrono::steady_clock::time_point lastCleanup;
-    std::atomic<size_t> maxTrackedFiles{10000};
+    // File tracking for duplicate prevention, keyed on content digest and filename, so a
+    // rename of known content is still dispatched. The value is unused.
+    static constexpr size_t DEFAULT_DEDUP_CACHE_ENTRIES = 10000;
+    LruCache<ProcessedFileKey, char, ProcessedFileKeyHash> processedFiles{DEFAULT_DEDUP_CACHE_ENTRIES};
+    mutable std::mutex processedFilesMutex;
+
+    // Parsed LoadUSDBuffer results, keyed on the digest of the buffer. Cost is the
+    // approximate size of the cached meshes in bytes.
+    using CachedMeshes = std::shared_ptr<const std::vector<AnariUsdMiddleware::MeshData>>;
+    static constexpr size_t DEFAULT_MESH_CACHE_ENTRIES = 32;
+    static constexpr size_t DEFAULT_MESH_CACHE_BYTES = 512ull * 1024 * 1024;
+    LruCache<ContentDigest, CachedMeshes, ContentDigestHash> meshCache{DEFAULT_MESH_CACHE_ENTRIES,
+                                                                       DEFAULT_MESH_CACHE_BYTES};
+    mutable std::mutex meshCacheMutex;
+
+    // Decoded CreateTextureFromBuffer results, keyed on content digest so shared material
+    // libraries decode once. Cost is the pixel bytes; the directory (if set) backs it on disk.
+    using CachedTexture = std::shared_ptr<const AnariUsdMiddleware::TextureData>;
+    static constexpr size_t DEFAULT_TEXTURE_CACHE_ENTRIES = 256;
+    static constexpr size_t DEFAULT_TEXTURE_CACHE_BYTES = 256ull * 1024 * 1024;
+    LruCache<ContentDigest, CachedTexture, ContentDigestHash> textureCache{DEFAULT_TEXTURE_CACHE_ENTRIES,
+                                                                           DEFAULT_TEXTURE_CACHE_BYTES};
+    std::filesystem::path textureCacheDirectory;
+    uint64_t textureDiskHits = 0;
+    uint64_t textureBytesSaved = 0;
+    mutable std::mutex textureCacheMutex;
+
+    // Extracted meshes of LoadUSDFromDisk* kept across restarts (disabled until a directory is set)
+    MeshDiskCache meshDiskCache;
+
+    // Content hashes of the last version of each file, for scene deltas
+    struct MeshSignature {
+        uint64_t geometry = 0;
+        uint64_t transforms = 0;
+    };
+    struct SceneSnapshot {
+        uint64_t revision = 0;
+        std::unordered_map<std::string, MeshSignature> meshes;
+    };
+    static constexpr size_t DEFAULT_SCENE_HISTORY_ENTRIES = 256;
+    LruCache<std::string, SceneSnapshot> sceneHistory{DEFAULT_SCENE_HISTORY_ENTRIES};
+    std::mutex sceneHistoryMutex;
+
+    // Progressive LOD delivery: the coarsest level is sent by the pipeline worker that parsed
+    // the file, finer levels are built on one background thread so the next file is not held up
+    static constexpr uint32_t MAX_LOD_LEVELS = 8;
+    static constexpr double LOD_TRIANGLE_RATIO = 0.25; // Triangles of a level relative to the next finer one
+    struct LodJob {
+        std::string filename;
+        uint64_t generation = 0;
+        uint32_t levelCount = 1;
+        std::vector<std::string> keys;
+        std::vector<AnariUsdMiddleware::MeshData> meshes; // Full resolution, levels below levelCount - 1 pending
+    };
+    std::atomic<uint32_t> lodLevelCount{3};
+    std::atomic<size_t> lodMinTriangles{100000};
+    std::deque<LodJob> lodJobs;
+    std::unordered_map<std::string, uint64_t> lodGenerations; // Latest dispatched version per filename
+    std::thread lodWorker;
+    bool lodWorkerRunning = false;
+    std::mutex lodMutex;
+    std::condition_variable lodAvailable;
+
+    // Asynchronous loads run on their own pool: the pipeline workers only exist while
+    // receiving, and a long load there would hold up received files. Finished loads stay
+    // queryable until taken or released, the oldest beyond MAX_FINISHED_LOADS are dropped.
+    static constexpr size_t MAX_LOAD_WORKERS = 64;
+    static constexpr size_t MAX_FINISHED_LOADS = 64;
+    struct LoadJob {
+        AnariUsdMiddleware::LoadId id = 0;
+        std::string fileName;
+        FilePayload buffer;             // Empty for loads from disk
+        bool fromDisk = false;
+        AnariUsdMiddleware::AsyncLoadOptions options;
+        std::atomic<bool> cancelled{false};
+        std::atomic<AnariUsdMiddleware::LoadState> state{AnariUsdMiddleware::LoadState::Queued};
+        std::atomic<float> progress{0.0f};
+        int reportedPercent = -1;       // Progress calls are serialized by the processor
+        std::vector<AnariUsdMiddleware::MeshData> meshes; // Set under loadMutex with the final state
+    };
+    std::atomic<size_t> asyncLoadWorkerCount{2};
+    AnariUsdMiddleware::LoadId nextLoadId = 1;
+    std::map<AnariUsdMiddleware::LoadId, std::shared_ptr<LoadJob>> loads; // Ids grow, so oldest first
+    std::deque<std::shared_ptr<LoadJob>> loadQueue;
+    std::vector<std::thread> loadWorkers;
+    bool loadWorkersRunning = false;
+    mutable std::mutex loadMutex;
+    std::condition_variable loadAvailable;
+    std::condition_variable loadFinished;
 
 public:
     Impl() : nextCallbackId(1), running(false), shutdownRequested(false) {
         MIDDLEWARE_LOG_INFO("AnariUsdMiddleware::Impl created with enhanced safety features");
         initializationTime = std::chrono::steady_clock::now();
-        lastCleanup = std::chrono::steady_clock::now();
     }
 
     ~Impl() {
         MIDDLEWARE_LOG_INFO("AnariUsdMiddleware::Impl destroyed");
         stopReceiving();
+        stopLodWorker();
+        stopLoadWorkers();
         zmqConnector.disconnect();
     }
 
@@ -79,6 +326,13 @@ public:
             usdProcessor->setMaxRecursionDepth(50);
             usdProcessor->setMemoryLimit(1024);
             usdProcessor->setReferenceResolutionEnabled(true);
+            usdProcessor->setWorkerThreads(usdWorkerThreads.load());
+            usdProcessor->setStageProfiler(&stageProfiler);
+            usdProcessor->setInstancingEnabled(usdInstancing.load());
+            usdProcessor->setLocalSpaceEnabled(usdLocalSpace.load());
+            usdProcessor->setMeshOptimizationEnabled(usdMeshOptimization.load());
+            usdProcessor->setWeldEpsilon(usdWeldEpsilon.load());
+            usdProcessor->setTimeCode(usdTimeCode.load());
             MIDDLEWARE_LOG_INFO("USD processor initialized successfully");
 
             // Initialize ZMQ connection with enhanced error handling
@@ -105,6 +359,8 @@ public:
         MIDDLEWARE_LOG_INFO("Shutting down AnariUsdMiddleware...");
         shutdownRequested.store(true);
         stopReceiving();
+        stopLodWorker();
+        stopLoadWorkers();
 
         std::lock_guard<std::mutex> lock(initMutex);
         try {
@@ -125,6 +381,10 @@ public:
                 std::lock_guard<std::mutex> callbackLock(callbackMutex);
                 updateCallbacks.clear();
                 messageCallbacks.clear();
+                sceneDeltaCallbacks.clear();
+                sceneDeltaCallbackCount.store(0);
+                meshLodCallbacks.clear();
+                meshLodCallbackCount.store(0);
             }
 
             initialized.store(false);
@@ -196,6 +456,79 @@ public:
         }
     }
 
+    int registerSceneDeltaCallback(AnariUsdMiddleware::SceneDeltaCallback callback) {
+        if (!callback) {
+            MIDDLEWARE_LOG_ERROR("Attempted to register null scene delta callback");
+            return -1;
+        }
+
+        if (shutdownRequested.load()) {
+            MIDDLEWARE_LOG_WARNING("Cannot register callback: shutdown requested");
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        int callbackId = nextCallbackId.fetch_add(1);
+        sceneDeltaCallbacks[callbackId] = std::move(callback);
+        sceneDeltaCallbackCount.store(sceneDeltaCallbacks.size());
+        MIDDLEWARE_LOG_INFO("Registered scene delta callback with ID: %d", callbackId);
+        return callbackId;
+    }
+
+    void unregisterSceneDeltaCallback(int callbackId) {
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        auto it = sceneDeltaCallbacks.find(callbackId);
+        if (it != sceneDeltaCallbacks.end()) {
+            sceneDeltaCallbacks.erase(it);
+            sceneDeltaCallbackCount.store(sceneDeltaCallbacks.size());
+            MIDDLEWARE_LOG_INFO("Unregistered scene delta callback with ID: %d", callbackId);
+        } else {
+            MIDDLEWARE_LOG_WARNING("Attempted to unregister non-existent scene delta callback ID: %d", callbackId);
+        }
+    }
+
+    int registerMeshLodCallback(AnariUsdMiddleware::MeshLodCallback callback) {
+        if (!callback) {
+            MIDDLEWARE_LOG_ERROR("Attempted to register null LOD callback");
+            return -1;
+        }
+
+        if (shutdownRequested.load()) {
+            MIDDLEWARE_LOG_WARNING("Cannot register callback: shutdown requested");
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        int callbackId = nextCallbackId.fetch_add(1);
+        meshLodCallbacks[callbackId] = std::move(callback);
+        meshLodCallbackCount.store(meshLodCallbacks.size());
+        MIDDLEWARE_LOG_INFO("Registered LOD callback with ID: %d", callbackId);
+        return callbackId;
+    }
+
+    void unregisterMeshLodCallback(int callbackId) {
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        auto it = meshLodCallbacks.find(callbackId);
+        if (it != meshLodCallbacks.end()) {
+            meshLodCallbacks.erase(it);
+            meshLodCallbackCount.store(meshLodCallbacks.size());
+            MIDDLEWARE_LOG_INFO("Unregistered LOD callback with ID: %d", callbackId);
+        } else {
+            MIDDLEWARE_LOG_WARNING("Attempted to unregister non-existent LOD callback ID: %d", callbackId);
+        }
+    }
+
+    void setLodOptions(uint32_t levelCount, size_t minTriangles) {
+        if (levelCount == 0 || levelCount > MAX_LOD_LEVELS) {
+            MIDDLEWARE_LOG_ERROR("Invalid LOD level count: %u (must be 1-%u)", levelCount, MAX_LOD_LEVELS);
+            return;
+        }
+        lodLevelCount.store(levelCount);
+        lodMinTriangles.store(minTriangles);
+        MIDDLEWARE_LOG_INFO("LOD delivery: %u levels for meshes with at least %zu triangles",
+                            levelCount, minTriangles);
+    }
+
     bool startReceiving() {
         if (running.load()) {
             MIDDLEWARE_LOG_INFO("Receiver thread already running");
@@ -208,6 +541,8 @@ public:
         }
 
         try {
+            // Workers must be ready before the receiver starts queueing
+            startPipeline();
             running.store(true);
             receiverThread = std::thread(&Impl::receiverLoop, this);
             MIDDLEWARE_LOG_INFO("Receiver thread started successfully");
@@ -215,6 +550,7 @@ public:
         } catch (const std::exception& e) {
             MIDDLEWARE_LOG_ERROR("Failed to start receiver thread: %s", e.what());
             running.store(false);
+            stopPipeline();
             return false;
         }
     }
@@ -227,8 +563,14 @@ public:
         MIDDLEWARE_LOG_INFO("Stopping receiver thread...");
         running.store(false);
 
-        // Give the thread time to observe the flag
-        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        // Interrupt the blocking poll so the thread observes the flag immediately
+        zmqConnector.wakeup();
+
+        // Release the receiver if it is stalled waiting for a free queue slot
+        {
+            std::lock_guard<std::mutex> lock(pipelineMutex);
+        }
+        spaceAvailable.notify_all();
 
         if (receiverThread.joinable()) {
             try {
@@ -238,38 +580,438 @@ public:
                 MIDDLEWARE_LOG_ERROR("Exception joining receiver thread: %s", e.what());
             }
         }
+
+        // Nothing is queued after the receiver exits, so workers can finish what is left
+        stopPipeline();
+    }
+
+    void startPipeline() {
+        const size_t workerCount = pipelineWorkerCount.load();
+        pipelineQueue = std::make_unique<BoundedMpmcQueue<std::unique_ptr<PipelineItem>>>(
+            pipelineQueueCapacity.load());
+        pipelineStats.queueDepth.store(0);
+        activeQueueCapacity.store(pipelineQueue->capacity());
+        pipelineRunning.store(true);
+
+        try {
+            pipelineWorkers.reserve(workerCount);
+            for (size_t i = 0; i < workerCount; ++i) {
+                pipelineWorkers.emplace_back(&Impl::pipelineWorkerLoop, this);
+            }
+        } catch (...) {
+            stopPipeline();
+            throw;
+        }
+
+        activeWorkerCount.store(workerCount);
+        MIDDLEWARE_LOG_INFO("Processing pipeline started: %zu workers, queue capacity %zu",
+                            workerCount, pipelineQueue->capacity());
+    }
+
+    void stopPipeline() {
+        {
+            std::lock_guard<std::mutex> lock(pipelineMutex);
+            pipelineRunning.store(false);
+        }
+        itemAvailable.notify_all();
+
+        for (auto& worker : pipelineWorkers) {
+            if (worker.joinable()) {
+                try {
+                    worker.join();
+                } catch (const std::exception& e) {
+                    MIDDLEWARE_LOG_ERROR("Exception joining pipeline worker: %s", e.what());
+                }
+            }
+        }
+        pipelineWorkers.clear();
+        activeWorkerCount.store(0);
+        MIDDLEWARE_LOG_INFO("Processing pipeline stopped");
+    }
+
+    void pipelineWorkerLoop() {
+        std::unique_ptr<PipelineItem> item;
+        while (true) {
+            if (pipelineQueue->tryPop(item)) {
+                pipelineStats.queueDepth.fetch_sub(1);
+                if (item->kind == PipelineItem::Kind::File) {
+                    const uint64_t poppedNs = profiling::StageProfiler::now();
+                    stageProfiler.record(profiling::Stage::QueueWait, item->enqueuedNs, poppedNs - item->enqueuedNs,
+                                         item->fileData.filename);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(pipelineMutex);
+                }
+                spaceAvailable.notify_one();
+
+                if (shutdownRequested.load()) {
+                    // Callers are tearing down; do not hand them data now
+                    pipelineStats.dropped.fetch_add(1);
+                } else {
+                    runPipelineItem(*item);
+                    pipelineStats.processed.fetch_add(1);
+                }
+                item.reset();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(pipelineMutex);
+            if (!pipelineRunning.load()) {
+                break;
+            }
+            itemAvailable.wait_for(lock, std::chrono::milliseconds(100), [this] {
+                return !pipelineQueue->emptyApprox() || !pipelineRunning.load();
+            });
+        }
+    }
+
+    void runPipelineItem(PipelineItem& item) {
+        try {
+            if (item.kind == PipelineItem::Kind::File) {
+                // Decoded here rather than on the receiver so the socket keeps draining
+                profiling::StageTimer decompressTimer(
+                    item.codec != compression::Codec::None ? &stageProfiler : nullptr,
+                    profiling::Stage::Decompress, item.fileData.filename);
+                if (!zmqConnector.decompressPayload(item.codec, item.rawSize, item.fileData.data)) {
+                    MIDDLEWARE_LOG_ERROR("Dropping %s: payload could not be decompressed",
+                                         item.fileData.filename.c_str());
+                    return;
+                }
+                decompressTimer.stop();
+                processReceivedFile(item.fileData, item.hashVerified);
+            } else {
+                processReceivedMessage(item.message);
+            }
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception in pipeline worker: %s", e.what());
+        }
+    }
+
+    bool enqueuePipelineItem(std::unique_ptr<PipelineItem> item) {
+        auto& queue = *pipelineQueue;
+        bool pushed = queue.tryPush(std::move(item));
+
+        if (!pushed) {
+            // Queue is full: hold the receiver back until a worker frees a slot or we time out
+            pipelineStats.stallCount.fetch_add(1);
+            const auto stallStart = std::chrono::steady_clock::now();
+            const auto deadline = stallStart + std::chrono::milliseconds(pipelineStallTimeoutMs.load());
+            {
+                std::unique_lock<std::mutex> lock(pipelineMutex);
+                while (!(pushed = queue.tryPush(std::move(item)))) {
+                    if (!running.load() || shutdownRequested.load()) {
+                        break;
+                    }
+                    if (spaceAvailable.wait_until(lock, deadline) == std::cv_status::timeout) {
+                        pushed = queue.tryPush(std::move(item));
+                        break;
+                    }
+                }
+            }
+            auto stalled = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - stallStart);
+            pipelineStats.totalStallMicros.fetch_add(static_cast<uint64_t>(stalled.count()));
+
+            if (!pushed) {
+                pipelineStats.dropped.fetch_add(1);
+                MIDDLEWARE_LOG_WARNING("Processing pipeline full, dropping %s",
+                                       item->kind == PipelineItem::Kind::File ?
+                                       item->fileData.filename.c_str() : "message");
+                return false;
+            }
+        }
+
+        pipelineStats.enqueued.fetch_add(1);
+        size_t depth = pipelineStats.queueDepth.fetch_add(1) + 1;
+        size_t peak = pipelineStats.peakQueueDepth.load();
+        while (depth > peak && !pipelineStats.peakQueueDepth.compare_exchange_weak(peak, depth)) {
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(pipelineMutex);
+        }
+        itemAvailable.notify_one();
+        return true;
+    }
+
+    void setPipelineWorkers(size_t workerCount) {
+        if (workerCount == 0 || workerCount > MAX_PIPELINE_WORKERS) {
+            MIDDLEWARE_LOG_ERROR("Invalid pipeline worker count: %zu (must be 1-%zu)",
+                                 workerCount, MAX_PIPELINE_WORKERS);
+            return;
+        }
+        pipelineWorkerCount.store(workerCount);
+        MIDDLEWARE_LOG_INFO("Pipeline workers set to %zu", workerCount);
+    }
+
+    void setUsdWorkerThreads(size_t threadCount) {
+        if (threadCount == 0 || threadCount > MAX_PIPELINE_WORKERS) {
+            MIDDLEWARE_LOG_ERROR("Invalid USD worker thread count: %zu (must be 1-%zu)",
+                                 threadCount, MAX_PIPELINE_WORKERS);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(initMutex);
+        usdWorkerThreads.store(threadCount);
+        if (usdProcessor) {
+            usdProcessor->setWorkerThreads(threadCount);
+        }
+        MIDDLEWARE_LOG_INFO("USD worker threads set to %zu", threadCount);
+    }
+
+    void setInstancingEnabled(bool enable) {
+        {
+            std::lock_guard<std::mutex> lock(initMutex);
+            usdInstancing.store(enable);
+            if (usdProcessor) {
+                usdProcessor->setInstancingEnabled(enable);
+            }
+        }
+        // Cached results were produced in the other mode
+        std::lock_guard<std::mutex> cacheLock(meshCacheMutex);
+        meshCache.clear();
+    }
+
+    void setLocalSpaceEnabled(bool enable) {
+        {
+            std::lock_guard<std::mutex> lock(initMutex);
+            usdLocalSpace.store(enable);
+            if (usdProcessor) {
+                usdProcessor->setLocalSpaceEnabled(enable);
+            }
+        }
+        std::lock_guard<std::mutex> cacheLock(meshCacheMutex);
+        meshCache.clear();
+    }
+
+    void setMeshOptimizationEnabled(bool enable) {
+        {
+            std::lock_guard<std::mutex> lock(initMutex);
+            usdMeshOptimization.store(enable);
+            if (usdProcessor) {
+                usdProcessor->setMeshOptimizationEnabled(enable);
+            }
+        }
+        std::lock_guard<std::mutex> cacheLock(meshCacheMutex);
+        meshCache.clear();
+    }
+
+    void setWeldEpsilon(float epsilon) {
+        if (!std::isfinite(epsilon) || epsilon < 0.0f) {
+            MIDDLEWARE_LOG_ERROR("Invalid weld epsilon: %f (must be finite and >= 0)", epsilon);
+            return;
+        }
+        float previous;
+        {
+            std::lock_guard<std::mutex> lock(initMutex);
+            previous = usdWeldEpsilon.exchange(epsilon);
+            if (usdProcessor) {
+                usdProcessor->setWeldEpsilon(epsilon);
+            }
+        }
+        if (previous != epsilon && usdMeshOptimization.load()) {
+            std::lock_guard<std::mutex> cacheLock(meshCacheMutex);
+            meshCache.clear();
+        }
+    }
+
+    void setTimeCode(double timeCode) {
+        if (std::isinf(timeCode)) {
+            MIDDLEWARE_LOG_ERROR("Invalid time code: %f (must be finite or NaN)", timeCode);
+            return;
+        }
+        double previous;
+        {
+            std::lock_guard<std::mutex> lock(initMutex);
+            previous = usdTimeCode.exchange(timeCode);
+            if (usdProcessor) {
+                usdProcessor->setTimeCode(timeCode);
+            }
+        }
+        // Mesh cache entries are keyed on content only and were extracted at the old time
+        if (previous != timeCode && !(std::isnan(previous) && std::isnan(timeCode))) {
+            std::lock_guard<std::mutex> cacheLock(meshCacheMutex);
+            meshCache.clear();
+        }
+    }
+
+    bool EvaluateTransforms(const uint8_t* data, size_t size, const std::string& fileName,
+                            double timeCode, std::vector<AnariUsdMiddleware::MeshTransform>& outTransforms) {
+        outTransforms.clear();
+        if (!canLoadUsd()) {
+            return false;
+        }
+
+        try {
+            std::vector<UsdProcessor::PrimTransform> primTransforms;
+            if (!usdProcessor->EvaluateTransforms(data, size, fileName, timeCode, primTransforms)) {
+                return false;
+            }
+
+            outTransforms.reserve(primTransforms.size());
+            std::unordered_map<std::string, size_t> occurrences;
+            for (const auto& prim : primTransforms) {
+                AnariUsdMiddleware::MeshTransform transform;
+                transform.key = nextMeshKey(prim.elementName, occurrences);
+                std::memcpy(transform.matrix, &prim.worldTransform[0][0], sizeof(transform.matrix));
+                outTransforms.push_back(std::move(transform));
+            }
+            return true;
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception in EvaluateTransforms: %s", e.what());
+            return false;
+        }
+    }
+
+    void setPipelineQueueCapacity(size_t capacity) {
+        if (capacity == 0 || capacity > MAX_PIPELINE_QUEUE_CAPACITY) {
+            MIDDLEWARE_LOG_ERROR("Invalid pipeline queue capacity: %zu (must be 1-%zu)",
+                                 capacity, MAX_PIPELINE_QUEUE_CAPACITY);
+            return;
+        }
+        pipelineQueueCapacity.store(capacity);
+        MIDDLEWARE_LOG_INFO("Pipeline queue capacity set to %zu", capacity);
+    }
+
+    void setPipelineStallTimeout(int timeoutMs) {
+        if (timeoutMs < 0 || timeoutMs > MAX_PIPELINE_STALL_TIMEOUT_MS) {
+            MIDDLEWARE_LOG_ERROR("Invalid pipeline stall timeout: %d ms (must be 0-%d)",
+                                 timeoutMs, MAX_PIPELINE_STALL_TIMEOUT_MS);
+            return;
+        }
+        pipelineStallTimeoutMs.store(timeoutMs);
+        MIDDLEWARE_LOG_INFO("Pipeline stall timeout set to %d ms", timeoutMs);
+    }
+
+    void appendStatusInfo(std::ostream& status) const {
+        auto stats = pipelineStats.getSnapshot();
+        status << "  Pipeline:\n";
+        status << "    Workers: " << activeWorkerCount.load() << "\n";
+        status << "    Queue depth: " << stats.queueDepth << "/" << activeQueueCapacity.load()
+               << " (peak " << stats.peakQueueDepth << ")\n";
+        status << "    Enqueued: " << stats.enqueued << ", Processed: " << stats.processed
+               << ", Dropped: " << stats.dropped << "\n";
+        status << "    Stalls: " << stats.stallCount << " (" << stats.totalStallMicros / 1000
+               << " ms total)\n";
+
+        status << "  Stage latency (p50 / p95 / p99 / max ms):\n";
+        for (const auto& stage : stageProfiler.getSnapshot()) {
+            if (stage.count == 0) {
+                continue;
+            }
+            status << "    " << stage.name << ": " << stage.count << " samples, " << stage.p50Ns / 1e6 << " / "
+                   << stage.p95Ns / 1e6 << " / " << stage.p99Ns / 1e6 << " / " << stage.maxNs / 1e6 << "\n";
+        }
+
+        auto zmqStats = zmqConnector.getMessageStats();
+        auto cacheStats = getCacheStats();
+        status << "  Caches:\n";
+        status << "    Dedup: " << cacheStats.dedupEntries << " entries, " << cacheStats.dedupHits
+               << " hits, " << cacheStats.dedupMisses << " misses, " << cacheStats.dedupEvictions << " evictions\n";
+        status << "    Mesh: " << cacheStats.meshEntries << " entries (" << cacheStats.meshBytes / 1024
+               << " KB), " << cacheStats.meshHits << " hits, " << cacheStats.meshMisses << " misses, "
+               << cacheStats.meshEvictions << " evictions\n";
+        status << "    Texture: " << cacheStats.textureEntries << " entries (" << cacheStats.textureBytes / 1024
+               << " KB), " << cacheStats.textureHits << " hits, " << cacheStats.textureDiskHits << " disk hits, "
+               << cacheStats.textureMisses << " misses, " << cacheStats.textureBytesSaved / 1024 << " KB saved\n";
+        if (meshDiskCache.isEnabled()) {
+            status << "    Mesh disk: " << cacheStats.meshDiskEntries << " entries (" << cacheStats.meshDiskBytes / 1024
+                   << " KB), " << cacheStats.meshDiskHits << " hits, " << cacheStats.meshDiskMisses << " misses, "
+                   << cacheStats.meshDiskStores << " stores, " << cacheStats.meshDiskEvictions << " evictions\n";
+        }
+
+        if (usdProcessor && usdMeshOptimization.load()) {
+            auto usdStats = usdProcessor->getProcessingStats();
+            const double triangles = static_cast<double>(std::max<uint64_t>(usdStats.optimizedTriangles, 1));
+            status << "  Mesh optimization:\n";
+            status << "    Meshes: " << usdStats.meshesOptimized << ", Vertices: " << usdStats.optimizedVerticesIn
+                   << " -> " << usdStats.optimizedVerticesOut << "\n";
+            status << "    ACMR: " << usdStats.cacheMissesBefore / triangles << " -> "
+                   << usdStats.cacheMissesAfter / triangles << "\n";
+        }
+
+        if (usdProcessor) {
+            auto usdStats = usdProcessor->getProcessingStats();
+            status << "  Scratch arenas: " << usdStats.arenaLeases << " leases, peak "
+                   << usdStats.arenaPeakBytes / 1024 << " KB, " << usdStats.arenaChunkAllocations
+                   << " chunk allocations (" << usdStats.arenaTimeUs / 1000.0 << " ms), "
+                   << usdStats.arenaRetainedBytes / 1024 << " KB retained\n";
+        }
+
+        status << "  Chunked transfers:\n";
+        status << "    Active: " << zmqConnector.getActiveTransferCount()
+               << ", Completed: " << zmqStats.chunkedFilesReceived
+               << ", Resumed: " << zmqStats.transfersResumed
+               << ", Chunks: " << zmqStats.chunksReceived << "\n";
+
+        status << "  Compressed transfers:\n";
+        status << "    Files: " << zmqStats.compressedFilesReceived
+               << ", Wire bytes: " << zmqStats.compressedBytesReceived
+               << ", Decoded bytes: " << zmqStats.decompressedBytes
+               << ", Failures: " << zmqStats.decompressionFailures << "\n";
+
+        status << "  Endpoints (" << zmqConnector.getIoThreads() << " I/O threads, HWM "
+               << zmqConnector.getHighWaterMark() << "):\n";
+        for (const auto& endpoint : zmqConnector.getEndpointStats()) {
+            status << "    " << endpoint.name << ": " << endpoint.messages << " msgs, "
+                   << endpoint.bytes / 1024 << " KB, " << endpoint.bytesPerSecond / (1024.0 * 1024.0)
+                   << " MB/s\n";
+        }
+
+        // The busiest senders are the ones to look at when a receiver saturates
+        constexpr size_t STATUS_CLIENT_LIMIT = 8;
+        auto clients = zmqConnector.getClientStats();
+        status << "  Senders: " << clients.size() << "\n";
+        for (size_t i = 0; i < std::min(clients.size(), STATUS_CLIENT_LIMIT); ++i) {
+            status << "    " << clients[i].name << " via " << clients[i].endpoint << ": "
+                   << clients[i].messages << " msgs, " << clients[i].bytes / 1024 << " KB, "
+                   << clients[i].bytesPerSecond / (1024.0 * 1024.0) << " MB/s\n";
+        }
     }
 
     void receiverLoop() {
         MIDDLEWARE_LOG_INFO("Enhanced receiver thread started");
         auto lastStatsLog = std::chrono::steady_clock::now();
         const auto STATS_LOG_INTERVAL = std::chrono::minutes(5);
+        constexpr int MIN_BACKOFF_MS = 10;
+        constexpr int MAX_BACKOFF_MS = 1000;
+        int backoffMs = 0; // Non-zero while the connector is disconnected
+        bool contextTerminated = false;
 
-        while (running.load() && !shutdownRequested.load()) {
+        while (running.load() && !shutdownRequested.load() && !contextTerminated) {
             try {
-                // Use polling with timeout instead of blocking receive
-                zmq::pollitem_t items[] = {
-                    { zmqConnector.getSocket(), 0, ZMQ_POLLIN, 0 }
-                };
-
-                int pollResult = zmq::poll(items, 1, std::chrono::milliseconds(100));
-
-                if (pollResult > 0 && (items[0].revents & ZMQ_POLLIN)) {
-                    // Socket has data available
-                    if (!processIncomingMessage()) {
-                        MIDDLEWARE_LOG_DEBUG("Failed to process incoming message");
+                // Block until a message arrives, stopReceiving() wakes us, or stats are due
+                auto untilStats = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    lastStatsLog + STATS_LOG_INTERVAL - std::chrono::steady_clock::now());
+                int waitMs = static_cast<int>(std::max<int64_t>(untilStats.count(), 0));
+
+                switch (zmqConnector.waitForMessage(waitMs)) {
+                case ZmqConnector::WaitResult::Ready:
+                    backoffMs = 0;
+                    drainPendingMessages();
+                    break;
+                case ZmqConnector::WaitResult::Timeout:
+                    backoffMs = 0;
+                    break;
+                case ZmqConnector::WaitResult::Disconnected:
+                    // Nothing blocks while disconnected; back off instead of spinning
+                    if (backoffMs == 0) {
+                        MIDDLEWARE_LOG_WARNING("Receiver waiting for the connection to come back");
                     }
+                    backoffMs = std::min(std::max(backoffMs * 2, MIN_BACKOFF_MS), MAX_BACKOFF_MS);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(std::min(backoffMs, waitMs)));
+                    break;
+                case ZmqConnector::WaitResult::Terminated:
+                    MIDDLEWARE_LOG_INFO("ZMQ context terminated, receiver thread exiting");
+                    contextTerminated = true;
+                    break;
                 }
 
                 // Periodic statistics logging
                 auto now = std::chrono::steady_clock::now();
-                if (now - lastStatsLog > STATS_LOG_INTERVAL) {
+                if (now - lastStatsLog >= STATS_LOG_INTERVAL) {
                     logStatistics();
                     lastStatsLog = now;
                 }
-
-                // Small sleep to prevent CPU spinning
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
             } catch (const std::exception& e) {
                 MIDDLEWARE_LOG_ERROR("Exception in receiver loop: %s", e.what());
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
@@ -279,36 +1021,124 @@ public:
         MIDDLEWARE_LOG_INFO("Enhanced receiver thread stopped");
     }
 
-    bool processIncomingMessage() {
-        MIDDLEWARE_LOG_DEBUG("=== PROCESSING INCOMING MESSAGE ===");
-        try {
-            AnariUsdMiddleware::FileData fileData;
+    size_t drainPendingMessages() {
+        const size_t budget = maxMessagesPerWakeup.load();
+        size_t processed = 0;
 
-            // Call receiveFile with 0 timeout since we know data is available
-            if (zmqConnector.receiveFile(fileData.filename, fileData.data, fileData.hash, 0)) {
-                MIDDLEWARE_LOG_INFO("Successfully received file via ZMQ: %s (%zu bytes)",
-                                    fileData.filename.c_str(), fileData.data.size());
-                return processReceivedFile(fileData);
+        // The first message is known to be ready; keep receiving while more are queued so a
+        // burst is handled without another poll round-trip. The budget bounds how long we go
+        // without checking the stop flag and the stats timer.
+        do {
+            if (!receiveIncomingMessage()) {
+                MIDDLEWARE_LOG_DEBUG("Failed to receive incoming message");
             }
+            ++processed;
+        } while (processed < budget && running.load() && zmqConnector.hasPendingMessage());
+
+        if (processed > 1) {
+            MIDDLEWARE_LOG_DEBUG("Drained %zu messages in one wakeup", processed);
+        }
+        return processed;
+    }
+
+    void setMaxMessagesPerWakeup(size_t maxMessages) {
+        if (maxMessages == 0 || maxMessages > MAX_MESSAGES_PER_WAKEUP_LIMIT) {
+            MIDDLEWARE_LOG_ERROR("Invalid max messages per wakeup: %zu (must be 1-%zu)",
+                                 maxMessages, MAX_MESSAGES_PER_WAKEUP_LIMIT);
+            return;
+        }
+        maxMessagesPerWakeup.store(maxMessages);
+        MIDDLEWARE_LOG_INFO("Max messages per wakeup set to %zu", maxMessages);
+    }
+
+    size_t getMaxMessagesPerWakeup() const {
+        return maxMessagesPerWakeup.load();
+    }
+
+    // Socket settings live in the connector, which applies them when it binds
+    void setReceiveIoThreads(int threads) {
+        zmqConnector.setIoThreads(threads);
+    }
 
-            MIDDLEWARE_LOG_DEBUG("Not a file message, trying as generic message");
-            // If not a file, try to receive as a generic message with 0 timeout
-            if (zmqConnector.receiveAnyMessage(0)) {
+    void setReceiveHighWaterMark(int messages) {
+        zmqConnector.setHighWaterMark(messages);
+    }
+
+    static std::vector<AnariUsdMiddleware::ThroughputStats> convertThroughput(
+        const std::vector<ZmqConnector::ThroughputStats>& source) {
+        std::vector<AnariUsdMiddleware::ThroughputStats> stats;
+        stats.reserve(source.size());
+        for (const auto& entry : source) {
+            AnariUsdMiddleware::ThroughputStats converted;
+            converted.name = entry.name;
+            converted.endpoint = entry.endpoint;
+            converted.messages = entry.messages;
+            converted.bytes = entry.bytes;
+            converted.bytesPerSecond = entry.bytesPerSecond;
+            stats.push_back(std::move(converted));
+        }
+        return stats;
+    }
+
+    std::vector<AnariUsdMiddleware::ThroughputStats> getEndpointStats() const {
+        return convertThroughput(zmqConnector.getEndpointStats());
+    }
+
+    std::vector<AnariUsdMiddleware::ThroughputStats> getClientStats() const {
+        return convertThroughput(zmqConnector.getClientStats());
+    }
+
+    // Receive stage: pull one message off the socket and hand it to the pipeline
+    bool receiveIncomingMessage() {
+        MIDDLEWARE_LOG_DEBUG("=== RECEIVING INCOMING MESSAGE ===");
+        try {
+            // Reads the whole multipart message once and dispatches on its layout, so a
+            // generic message is never half-consumed by a failed file receive
+            ZmqConnector::IncomingMessage incoming;
+            const uint64_t receiveStart = profiling::StageProfiler::now();
+            switch (zmqConnector.receiveNext(incoming)) {
+            case ZmqConnector::ReceiveResult::File: {
+                const uint64_t receivedNs = profiling::StageProfiler::now();
+                stageProfiler.record(profiling::Stage::Receive, receiveStart, receivedNs - receiveStart,
+                                     incoming.filename);
+                MIDDLEWARE_LOG_INFO("Successfully received file via ZMQ: %s (%zu bytes)",
+                                    incoming.filename.c_str(), incoming.data.size());
+                auto item = std::make_unique<PipelineItem>();
+                item->enqueuedNs = receivedNs;
+                item->kind = PipelineItem::Kind::File;
+                item->fileData.filename = std::move(incoming.filename);
+                item->fileData.data = std::move(incoming.data);
+                item->fileData.hash = std::move(incoming.hash);
+                item->hashVerified = incoming.hashVerified;
+                item->codec = incoming.codec;
+                item->rawSize = incoming.rawSize;
+                return enqueuePipelineItem(std::move(item));
+            }
+            case ZmqConnector::ReceiveResult::Message: {
                 MIDDLEWARE_LOG_INFO("Successfully received generic message via ZMQ");
-                return processReceivedMessage();
+                auto item = std::make_unique<PipelineItem>();
+                item->kind = PipelineItem::Kind::Message;
+                item->message = std::move(incoming.text);
+                return enqueuePipelineItem(std::move(item));
+            }
+            case ZmqConnector::ReceiveResult::TransferProgress:
+                // Chunk acknowledged or capabilities answered; files are dispatched once complete
+                return true;
+            case ZmqConnector::ReceiveResult::Nothing:
+            default:
+                MIDDLEWARE_LOG_WARNING("No valid message could be processed");
+                return false;
             }
-
-            MIDDLEWARE_LOG_WARNING("No valid message could be processed");
-            return false;
         } catch (const std::exception& e) {
-            MIDDLEWARE_LOG_ERROR("Exception in processIncomingMessage: %s", e.what());
+            MIDDLEWARE_LOG_ERROR("Exception in receiveIncomingMessage: %s", e.what());
             return false;
         }
     }
 
-    bool processReceivedFile(AnariUsdMiddleware::FileData& fileData) {
+    bool processReceivedFile(AnariUsdMiddleware::FileData& fileData, bool hashAlreadyVerified = false) {
         MIDDLEWARE_LOG_INFO("Processing received file: %s (size: %zu bytes, hash: %s)",
                             fileData.filename.c_str(), fileData.data.size(), fileData.hash.c_str());
+        std::optional<ProcessedFileKey> claim;
         try {
             // Basic validation
             if (fileData.filename.empty() || fileData.data.empty()) {
@@ -316,47 +1146,103 @@ public:
                 return false;
             }
 
-            // CRITICAL FIX: Check for duplicate files
-            if (isDuplicateFile(fileData.filename, fileData.hash)) {
+            // CRITICAL FIX: Check for duplicate files. Claiming is atomic so two workers
+            // handed the same file cannot both dispatch it.
+            // A claim on content that fails verification is dropped again, so that the
+            // sender's retransmission of the same file is not skipped as a duplicate.
+            if (!tryClaimFile(fileData, claim)) {
                 MIDDLEWARE_LOG_WARNING("Duplicate file detected, skipping: %s", fileData.filename.c_str());
                 return true; // Return true to indicate "successful" handling (just skipped)
             }
 
             // Determine file type
+            const std::string extension = lowerCaseExtension(fileData.filename);
             std::string fileType = "UNKNOWN";
-            if (fileData.filename.find(".usda") != std::string::npos ||
-                fileData.filename.find(".usd") != std::string::npos) {
+            if (extension == container::FILE_EXTENSION ||
+                container::isContainer(fileData.data.data(), fileData.data.size())) {
+                fileType = "MESH";
+            } else if (UsdProcessor::isSupportedExtension(extension)) {
                 fileType = "USD";
-            } else if (fileData.filename.find(".png") != std::string::npos ||
-                       fileData.filename.find(".jpg") != std::string::npos) {
+            } else if (extension == ".png" || extension == ".jpg") {
                 fileType = "IMAGE";
             }
 
             fileData.fileType = fileType;
             MIDDLEWARE_LOG_INFO("File type detected: %s", fileType.c_str());
 
-            // Hash verification (non-fatal)
-            if (HashVerifier::verifyHash(fileData.data, fileData.hash)) {
-                MIDDLEWARE_LOG_INFO("Hash verification succeeded for file: %s", fileData.filename.c_str());
+            // Hash verification (non-fatal). It runs on this pipeline worker, so the number of
+            // hashing threads stays bounded by the worker count; once verified, the frame's digest
+            // also keys the mesh cache, so the file is hashed only once.
+            bool digestVerified = hashAlreadyVerified;
+            if (hashAlreadyVerified) {
+                MIDDLEWARE_LOG_DEBUG("Hash already verified during transfer for file: %s", fileData.filename.c_str());
             } else {
-                MIDDLEWARE_LOG_WARNING("Hash verification failed for file: %s (continuing anyway)", fileData.filename.c_str());
+                profiling::StageTimer hashTimer(&stageProfiler, profiling::Stage::Hash, fileData.filename);
+                const bool verified =
+                    HashVerifier::verifyHash(fileData.data.data(), fileData.data.size(), fileData.hash);
+                hashTimer.stop();
+                logHashResult(fileData.filename, verified);
+                if (!verified) {
+                    releaseFileClaim(claim);
+                }
+                digestVerified = verified;
             }
 
-            // CRITICAL: Mark file as processed BEFORE notifying callbacks
-            markFileAsProcessed(fileData.filename, fileData.hash);
-
             // Notify callbacks
+            profiling::StageTimer callbackTimer(&stageProfiler, profiling::Stage::Callback, fileData.filename);
             notifyFileCallbacks(fileData);
+            callbackTimer.stop();
+
+            // Both consumers share one extraction of the file. LODs go first: their coarse
+            // levels are what gets something on screen soonest.
+            const bool hasMeshes = fileType == "USD" || fileType == "MESH";
+            const bool wantLods = hasMeshes && meshLodCallbackCount.load() > 0;
+            const bool wantDelta = hasMeshes && sceneDeltaCallbackCount.load() > 0;
+            if (wantLods || wantDelta) {
+                // A verified hash frame already names the content, so the mesh cache needs no hashing
+                ContentDigest frameDigest;
+                const bool haveFrameDigest =
+                    digestVerified && HashVerifier::digestFromHashFrame(fileData.hash, frameDigest);
+                std::vector<AnariUsdMiddleware::MeshData> meshes;
+                if (!LoadUSDBuffer(fileData.data.data(), fileData.data.size(), fileData.filename, meshes, nullptr,
+                                   nullptr, nullptr, haveFrameDigest ? &frameDigest : nullptr)) {
+                    MIDDLEWARE_LOG_WARNING("No LODs or scene delta for %s: USD parsing failed",
+                                           fileData.filename.c_str());
+                } else {
+                    if (wantLods) {
+                        // The LOD job keeps its meshes, so the delta needs its own copy
+                        dispatchMeshLods(fileData.filename, wantDelta ? meshes : std::move(meshes));
+                    }
+                    if (wantDelta) {
+                        dispatchSceneDelta(fileData.filename, std::move(meshes));
+                    }
+                }
+            }
             return true;
         } catch (const std::exception& e) {
             MIDDLEWARE_LOG_ERROR("Exception processing received file: %s", e.what());
+            releaseFileClaim(claim);
             return false;
         }
     }
 
-    bool processReceivedMessage() {
+    // Extension of a filename including the dot, lower-cased; empty if it has none
+    static std::string lowerCaseExtension(const std::string& filename) {
+        std::string extension = std::filesystem::path(filename).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+        return extension;
+    }
+
+    void logHashResult(const std::string& filename, bool verified) const {
+        if (verified) {
+            MIDDLEWARE_LOG_INFO("Hash verification succeeded for file: %s", filename.c_str());
+        } else {
+            MIDDLEWARE_LOG_WARNING("Hash verification failed for file: %s (continuing anyway)", filename.c_str());
+        }
+    }
+
+    bool processReceivedMessage(const std::string& message) {
         try {
-            const std::string& message = zmqConnector.getLastReceivedMessage();
             MIDDLEWARE_LOG_INFO("Processing received message: %s", message.c_str());
 
             // Enhanced message format detection
@@ -378,60 +1264,183 @@ public:
         }
     }
 
-    // CRITICAL: Add duplicate detection methods
-    bool isDuplicateFile(const std::string& filename, const std::string& hash) {
-        std::lock_guard<std::mutex> lock(processedFilesMutex);
-
-        // Create unique identifier combining filename and hash
-        std::string fileIdentifier = filename + ":" + hash;
-
-        // Check if already processed
-        bool isDuplicate = processedFiles.find(fileIdentifier) != processedFiles.end();
-
-        if (isDuplicate) {
-            MIDDLEWARE_LOG_DEBUG("Duplicate detected: %s", filename.c_str());
+    // CRITICAL: Duplicate detection. Check and insert happen under one lock because
+    // several pipeline workers may process files concurrently.
+    // Returns false if this content already arrived under the same filename; otherwise
+    // claim receives the key to pass to releaseFileClaim() if the file turns out bad.
+    bool tryClaimFile(const AnariUsdMiddleware::FileData& fileData, std::optional<ProcessedFileKey>& claim) {
+        // The sender's hash frame names the content; only hash ourselves if it is unusable
+        ProcessedFileKey key;
+        if (!HashVerifier::digestFromHashFrame(fileData.hash, key.digest) &&
+            !HashVerifier::calculateDigest(fileData.data.data(), fileData.data.size(), key.digest)) {
+            MIDDLEWARE_LOG_WARNING("Cannot derive content digest for %s, skipping duplicate check",
+                                   fileData.filename.c_str());
+            return true;
         }
+        key.filename = fileData.filename;
 
-        // Periodic cleanup to prevent memory growth
-        auto now = std::chrono::steady_clock::now();
-        if (now - lastCleanup > std::chrono::hours(1)) { // Cleanup every hour
-            cleanupOldEntries();
-            lastCleanup = now;
+        std::lock_guard<std::mutex> lock(processedFilesMutex);
+        if (processedFiles.find(key)) {
+            MIDDLEWARE_LOG_DEBUG("Duplicate detected: %s", fileData.filename.c_str());
+            return false;
         }
 
-        return isDuplicate;
+        processedFiles.insert(key, 0);
+        MIDDLEWARE_LOG_DEBUG("Marked as processed: %s", fileData.filename.c_str());
+        claim = std::move(key);
+        return true;
     }
 
-    void markFileAsProcessed(const std::string& filename, const std::string& hash) {
+    void releaseFileClaim(std::optional<ProcessedFileKey>& claim) {
+        if (!claim) {
+            return;
+        }
         std::lock_guard<std::mutex> lock(processedFilesMutex);
+        processedFiles.erase(*claim);
+        MIDDLEWARE_LOG_DEBUG("Released duplicate claim: %s", claim->filename.c_str());
+        claim.reset();
+    }
 
-        // Create unique identifier
-        std::string fileIdentifier = filename + ":" + hash;
-
-        // Add to processed set
-        processedFiles.insert(fileIdentifier);
-
-        MIDDLEWARE_LOG_DEBUG("Marked as processed: %s", filename.c_str());
+    static size_t estimateMeshBytes(const std::vector<AnariUsdMiddleware::MeshData>& meshes) {
+        size_t bytes = 0;
+        for (const auto& mesh : meshes) {
+            bytes += sizeof(mesh) + mesh.elementName.size() + mesh.typeName.size() +
+                     (mesh.points.size() + mesh.normals.size() + mesh.uvs.size() +
+                      mesh.vertex_colors.size() + mesh.instance_transforms.size()) * sizeof(float) +
+                     mesh.indices.size() * sizeof(uint32_t);
+        }
+        return bytes;
+    }
 
-        // Prevent memory growth by limiting tracked files
-        if (processedFiles.size() > maxTrackedFiles.load()) {
-            // Remove oldest entries (simple approach - remove 10% of entries)
-            auto it = processedFiles.begin();
-            size_t toRemove = processedFiles.size() / 10;
-            for (size_t i = 0; i < toRemove && it != processedFiles.end(); ++i) {
-                it = processedFiles.erase(it);
-            }
-            MIDDLEWARE_LOG_INFO("Cleaned up %zu old file entries", toRemove);
+    void setDedupCacheCapacity(size_t entries) {
+        if (entries == 0 || entries > safety::MAX_VECTOR_SIZE) {
+            MIDDLEWARE_LOG_ERROR("Invalid dedup cache capacity: %zu (must be 1-%zu)",
+                                 entries, safety::MAX_VECTOR_SIZE);
+            return;
         }
+        std::lock_guard<std::mutex> lock(processedFilesMutex);
+        processedFiles.setLimits(entries);
+        MIDDLEWARE_LOG_INFO("Dedup cache capacity set to %zu entries", entries);
     }
 
-    void cleanupOldEntries() {
-        // Simple cleanup - clear all after time period
-        if (processedFiles.size() > maxTrackedFiles.load() / 2) {
-            size_t originalSize = processedFiles.size();
-            processedFiles.clear();
-            MIDDLEWARE_LOG_INFO("Cleared %zu processed file entries during cleanup", originalSize);
+    void setMeshCacheLimits(size_t maxEntries, size_t maxBytes) {
+        if (maxEntries > safety::MAX_VECTOR_SIZE) {
+            MIDDLEWARE_LOG_ERROR("Invalid mesh cache entry limit: %zu (must be 0-%zu)",
+                                 maxEntries, safety::MAX_VECTOR_SIZE);
+            return;
         }
+        std::lock_guard<std::mutex> lock(meshCacheMutex);
+        meshCache.setLimits(maxEntries, maxBytes);
+        MIDDLEWARE_LOG_INFO("Mesh cache limits set to %zu entries, %zu bytes", maxEntries, maxBytes);
+    }
+
+    void setTextureCacheLimits(size_t maxEntries, size_t maxBytes) {
+        if (maxEntries > safety::MAX_VECTOR_SIZE) {
+            MIDDLEWARE_LOG_ERROR("Invalid texture cache entry limit: %zu (must be 0-%zu)",
+                                 maxEntries, safety::MAX_VECTOR_SIZE);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(textureCacheMutex);
+        textureCache.setLimits(maxEntries, maxBytes);
+        MIDDLEWARE_LOG_INFO("Texture cache limits set to %zu entries, %zu bytes", maxEntries, maxBytes);
+    }
+
+    bool setTextureCacheDirectory(const std::string& directory) {
+        std::filesystem::path path(directory);
+        if (!path.empty()) {
+            std::error_code ec;
+            std::filesystem::create_directories(path, ec);
+            if (ec || !std::filesystem::is_directory(path, ec)) {
+                MIDDLEWARE_LOG_ERROR("Cannot use texture cache directory %s: %s",
+                                     directory.c_str(), ec.message().c_str());
+                return false;
+            }
+        }
+        std::lock_guard<std::mutex> lock(textureCacheMutex);
+        textureCacheDirectory = std::move(path);
+        MIDDLEWARE_LOG_INFO("Texture disk cache %s%s", directory.empty() ? "disabled" : "directory set to ",
+                            directory.c_str());
+        return true;
+    }
+
+    bool setMeshDiskCache(const std::string& directory, uint64_t maxBytes) {
+        return meshDiskCache.setDirectory(directory, maxBytes);
+    }
+
+    void clearMeshDiskCache() {
+        meshDiskCache.clear();
+    }
+
+    void clearCaches() {
+        {
+            std::lock_guard<std::mutex> lock(processedFilesMutex);
+            processedFiles.clear();
+        }
+        {
+            std::lock_guard<std::mutex> lock(meshCacheMutex);
+            meshCache.clear();
+        }
+        {
+            std::lock_guard<std::mutex> lock(textureCacheMutex);
+            textureCache.clear();
+        }
+        MIDDLEWARE_LOG_INFO("Dedup, mesh and texture caches cleared");
+    }
+
+    AnariUsdMiddleware::CacheStats getCacheStats() const {
+        AnariUsdMiddleware::CacheStats stats;
+        {
+            std::lock_guard<std::mutex> lock(processedFilesMutex);
+            auto dedup = processedFiles.getStats();
+            stats.dedupHits = dedup.hits;
+            stats.dedupMisses = dedup.misses;
+            stats.dedupEvictions = dedup.evictions;
+            stats.dedupEntries = dedup.entries;
+        }
+        {
+            std::lock_guard<std::mutex> lock(meshCacheMutex);
+            auto mesh = meshCache.getStats();
+            stats.meshHits = mesh.hits;
+            stats.meshMisses = mesh.misses;
+            stats.meshEvictions = mesh.evictions;
+            stats.meshEntries = mesh.entries;
+            stats.meshBytes = mesh.totalCost;
+        }
+        {
+            std::lock_guard<std::mutex> lock(textureCacheMutex);
+            auto texture = textureCache.getStats();
+            stats.textureHits = texture.hits;
+            stats.textureMisses = texture.misses;
+            stats.textureDiskHits = textureDiskHits;
+            stats.textureEvictions = texture.evictions;
+            stats.textureEntries = texture.entries;
+            stats.textureBytes = texture.totalCost;
+            stats.textureBytesSaved = textureBytesSaved;
+        }
+        auto disk = meshDiskCache.getStats();
+        stats.meshDiskHits = disk.hits;
+        stats.meshDiskMisses = disk.misses;
+        stats.meshDiskStores = disk.stores;
+        stats.meshDiskEvictions = disk.evictions;
+        stats.meshDiskEntries = disk.entries;
+        stats.meshDiskBytes = disk.bytes;
+        return stats;
+    }
+
+    std::vector<profiling::StageProfiler::StageStats> getStageStats() const {
+        return stageProfiler.getSnapshot();
+    }
+
+    void resetStageStats() {
+        stageProfiler.reset();
+    }
+
+    void setTraceCapture(bool enable, size_t maxEvents) {
+        stageProfiler.setTraceCapture(enable, maxEvents);
+    }
+
+    bool writeTrace(const std::string& path) const {
+        return stageProfiler.writeChromeTrace(path);
     }
 
     void notifyFileCallbacks(const AnariUsdMiddleware::FileData& fileData) {
@@ -460,8 +1469,652 @@ public:
         }
     }
 
+    void notifySceneDeltaCallbacks(const AnariUsdMiddleware::SceneDelta& delta) {
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        for (const auto& pair : sceneDeltaCallbacks) {
+            try {
+                pair.second(delta);
+            } catch (const std::exception& e) {
+                MIDDLEWARE_LOG_ERROR("Exception in scene delta callback (ID: %d): %s", pair.first, e.what());
+            } catch (...) {
+                MIDDLEWARE_LOG_ERROR("Unknown exception in scene delta callback (ID: %d)", pair.first);
+            }
+        }
+    }
+
+    void notifyMeshLodCallbacks(const AnariUsdMiddleware::MeshLod& lod) {
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        for (const auto& pair : meshLodCallbacks) {
+            try {
+                pair.second(lod);
+            } catch (const std::exception& e) {
+                MIDDLEWARE_LOG_ERROR("Exception in LOD callback (ID: %d): %s", pair.first, e.what());
+            } catch (...) {
+                MIDDLEWARE_LOG_ERROR("Unknown exception in LOD callback (ID: %d)", pair.first);
+            }
+        }
+    }
+
+    // Stable per-file mesh identity: element name, "#n" appended to the n-th repeat
+    static std::string nextMeshKey(const std::string& elementName,
+                                   std::unordered_map<std::string, size_t>& occurrences) {
+        size_t occurrence = occurrences[elementName]++;
+        return occurrence == 0 ? elementName : elementName + "#" + std::to_string(occurrence);
+    }
+
+    // Simplified copy of a mesh for one LOD level; false if it would not be smaller
+    static bool buildLodLevel(const AnariUsdMiddleware::MeshData& mesh, uint32_t level,
+                              AnariUsdMiddleware::MeshData& outMesh) {
+        const size_t target = static_cast<size_t>(
+            static_cast<double>(mesh.getTriangleCount()) * std::pow(LOD_TRIANGLE_RATIO, level));
+        return target < mesh.getTriangleCount() && AnariUsdMiddleware::SimplifyMesh(mesh, target, outMesh) &&
+               outMesh.getTriangleCount() < mesh.getTriangleCount();
+    }
+
+    // Send the coarsest level of every large mesh of a received file right away and queue
+    // the finer levels; small meshes are sent once at full resolution
+    void dispatchMeshLods(const std::string& filename, std::vector<AnariUsdMiddleware::MeshData> meshes) {
+        LodJob job;
+        job.filename = filename;
+        job.levelCount = lodLevelCount.load();
+        const size_t minTriangles = lodMinTriangles.load();
+
+        std::unordered_map<std::string, size_t> occurrences;
+        for (auto& mesh : meshes) {
+            AnariUsdMiddleware::MeshLod lod;
+            lod.filename = filename;
+            lod.key = nextMeshKey(mesh.elementName, occurrences);
+
+            if (job.levelCount > 1 && mesh.getTriangleCount() >= minTriangles &&
+                buildLodLevel(mesh, job.levelCount - 1, lod.mesh)) {
+                lod.level = job.levelCount - 1;
+                lod.levelCount = job.levelCount;
+                notifyMeshLodCallbacks(lod);
+                job.keys.push_back(std::move(lod.key));
+                job.meshes.push_back(std::move(mesh));
+                continue;
+            }
+
+            lod.level = 0;
+            lod.levelCount = 1;
+            lod.mesh = std::move(mesh);
+            notifyMeshLodCallbacks(lod);
+        }
+
+        if (!job.meshes.empty()) {
+            enqueueLodJob(std::move(job));
+        }
+    }
+
+    void enqueueLodJob(LodJob job) {
+        std::unique_lock<std::mutex> lock(lodMutex);
+        job.generation = ++lodGenerations[job.filename];
+
+        // A newer version of the file makes queued work for the old one pointless
+        lodJobs.erase(std::remove_if(lodJobs.begin(), lodJobs.end(),
+                                     [&](const LodJob& queued) { return queued.filename == job.filename; }),
+                      lodJobs.end());
+
+        if (!lodWorkerRunning) {
+            try {
+                lodWorker = std::thread(&Impl::lodWorkerLoop, this);
+                lodWorkerRunning = true;
+            } catch (const std::system_error& e) {
+                // Without a worker the finer levels are built here, delaying the next file instead
+                MIDDLEWARE_LOG_WARNING("Failed to start LOD thread, refining inline: %s", e.what());
+                lock.unlock();
+                refineLods(job);
+                return;
+            }
+        }
+
+        lodJobs.push_back(std::move(job));
+        lock.unlock();
+        lodAvailable.notify_one();
+    }
+
+    void lodWorkerLoop() {
+        MIDDLEWARE_LOG_INFO("LOD thread started");
+        while (true) {
+            LodJob job;
+            {
+                std::unique_lock<std::mutex> lock(lodMutex);
+                lodAvailable.wait(lock, [this]() { return !lodJobs.empty() || !lodWorkerRunning; });
+                if (!lodWorkerRunning) {
+                    break;
+                }
+                job = std::move(lodJobs.front());
+                lodJobs.pop_front();
+            }
+
+            try {
+                refineLods(job);
+            } catch (const std::exception& e) {
+                MIDDLEWARE_LOG_ERROR("Exception refining LODs of %s: %s", job.filename.c_str(), e.what());
+            }
+        }
+        MIDDLEWARE_LOG_INFO("LOD thread stopped");
+    }
+
+    bool isLodJobCurrent(const LodJob& job) {
+        std::lock_guard<std::mutex> lock(lodMutex);
+        auto it = lodGenerations.find(job.filename);
+        return !shutdownRequested.load() && it != lodGenerations.end() && it->second == job.generation;
+    }
+
+    // Deliver every mesh's next finer level before moving on, ending with full resolution
+    void refineLods(LodJob& job) {
+        for (uint32_t level = job.levelCount - 1; level-- > 0;) {
+            for (size_t i = 0; i < job.meshes.size(); ++i) {
+                if (!isLodJobCurrent(job)) {
+                    MIDDLEWARE_LOG_DEBUG("Dropping LOD work for superseded %s", job.filename.c_str());
+                    return;
+                }
+
+                AnariUsdMiddleware::MeshLod lod;
+                lod.filename = job.filename;
+                lod.key = job.keys[i];
+                lod.level = level;
+                lod.levelCount = job.levelCount;
+                if (level == 0) {
+                    lod.mesh = std::move(job.meshes[i]);
+                } else if (!buildLodLevel(job.meshes[i], level, lod.mesh)) {
+                    continue;
+                }
+                notifyMeshLodCallbacks(lod);
+            }
+        }
+    }
+
+    void stopLodWorker() {
+        {
+            std::lock_guard<std::mutex> lock(lodMutex);
+            if (!lodWorkerRunning) {
+                return;
+            }
+            lodWorkerRunning = false;
+            lodJobs.clear();
+            lodGenerations.clear();
+        }
+        lodAvailable.notify_all();
+        if (lodWorker.joinable()) {
+            lodWorker.join();
+        }
+    }
+
+    void setAsyncLoadWorkers(size_t workerCount) {
+        if (workerCount == 0 || workerCount > MAX_LOAD_WORKERS) {
+            MIDDLEWARE_LOG_ERROR("Invalid load worker count: %zu (must be 1-%zu)", workerCount, MAX_LOAD_WORKERS);
+            return;
+        }
+        asyncLoadWorkerCount.store(workerCount);
+        MIDDLEWARE_LOG_INFO("Asynchronous load workers set to %zu", workerCount);
+    }
+
+    static bool isFinalLoadState(AnariUsdMiddleware::LoadState state) {
+        return state != AnariUsdMiddleware::LoadState::Queued && state != AnariUsdMiddleware::LoadState::Running;
+    }
+
+    static const char* loadStateName(AnariUsdMiddleware::LoadState state) {
+        switch (state) {
+        case AnariUsdMiddleware::LoadState::Queued: return "queued";
+        case AnariUsdMiddleware::LoadState::Running: return "running";
+        case AnariUsdMiddleware::LoadState::Completed: return "completed";
+        case AnariUsdMiddleware::LoadState::Failed: return "failed";
+        default: return "cancelled";
+        }
+    }
+
+    AnariUsdMiddleware::LoadId submitLoad(FilePayload buffer, const std::string& fileName, bool fromDisk,
+                                          const AnariUsdMiddleware::AsyncLoadOptions& options) {
+        if (fileName.empty() || (!fromDisk && buffer.empty())) {
+            MIDDLEWARE_LOG_ERROR("Asynchronous load requires %s", fromDisk ? "a file path" : "data and a filename");
+            return 0;
+        }
+        if (!canLoadUsd()) {
+            return 0;
+        }
+
+        auto job = std::make_shared<LoadJob>();
+        job->fileName = fileName;
+        job->buffer = std::move(buffer);
+        job->fromDisk = fromDisk;
+        job->options = options;
+
+        std::unique_lock<std::mutex> lock(loadMutex);
+        if (!startLoadWorkersLocked()) {
+            return 0;
+        }
+
+        job->id = nextLoadId++;
+        if (job->options.cancelPrevious) {
+            for (const auto& pair : loads) {
+                LoadJob& previous = *pair.second;
+                if (previous.fileName == job->fileName && !isFinalLoadState(previous.state.load()) &&
+                    !previous.cancelled.exchange(true)) {
+                    MIDDLEWARE_LOG_INFO("Load %llu of %s superseded by load %llu",
+                                        static_cast<unsigned long long>(previous.id), job->fileName.c_str(),
+                                        static_cast<unsigned long long>(job->id));
+                }
+            }
+        }
+        loads.emplace(job->id, job);
+        loadQueue.push_back(job);
+        const size_t queued = loadQueue.size();
+        lock.unlock();
+        loadAvailable.notify_one();
+
+        MIDDLEWARE_LOG_INFO("Queued load %llu of %s (%zu waiting)", static_cast<unsigned long long>(job->id),
+                            job->fileName.c_str(), queued);
+        return job->id;
+    }
+
+    bool startLoadWorkersLocked() {
+        if (loadWorkersRunning) {
+            return true;
+        }
+
+        const size_t workerCount = asyncLoadWorkerCount.load();
+        loadWorkersRunning = true;
+        try {
+            for (size_t i = 0; i < workerCount; ++i) {
+                loadWorkers.emplace_back(&Impl::loadWorkerLoop, this);
+            }
+        } catch (const std::system_error& e) {
+            MIDDLEWARE_LOG_WARNING("Started only %zu of %zu load threads: %s", loadWorkers.size(), workerCount, e.what());
+        }
+
+        if (loadWorkers.empty()) {
+            loadWorkersRunning = false;
+            MIDDLEWARE_LOG_ERROR("Failed to start any load thread");
+            return false;
+        }
+        MIDDLEWARE_LOG_INFO("Started %zu load threads", loadWorkers.size());
+        return true;
+    }
+
+    void loadWorkerLoop() {
+        while (true) {
+            std::shared_ptr<LoadJob> job;
+            {
+                std::unique_lock<std::mutex> lock(loadMutex);
+                loadAvailable.wait(lock, [this]() { return !loadQueue.empty() || !loadWorkersRunning; });
+                if (!loadWorkersRunning) {
+                    break;
+                }
+                job = std::move(loadQueue.front());
+                loadQueue.pop_front();
+            }
+            runLoadJob(job);
+        }
+    }
+
+    void runLoadJob(const std::shared_ptr<LoadJob>& job) {
+        using LoadState = AnariUsdMiddleware::LoadState;
+        using MeshData = AnariUsdMiddleware::MeshData;
+        std::vector<MeshData> meshes;
+        size_t streamed = 0;
+        bool loaded = false;
+
+        // Superseded while queued: finish without touching the data
+        if (!job->cancelled.load()) {
+            job->state.store(LoadState::Running);
+            reportLoadProgress(job, 0.0f, "Loading");
+            UsdProcessor::ProgressCallback progress = [this, &job](float value, const std::string& stage) {
+                reportLoadProgress(job, value, stage);
+            };
+            try {
+                if (job->options.onMesh) {
+                    // Streamed meshes go straight to the consumer; a cancelled load stops taking them
+                    AnariUsdMiddleware::MeshStreamCallback onMesh = [&job, &streamed](MeshData&& mesh) {
+                        if (job->cancelled.load()) {
+                            return false;
+                        }
+                        ++streamed;
+                        return job->options.onMesh(std::move(mesh));
+                    };
+                    loaded = job->fromDisk
+                                 ? StreamUSDFromDisk(job->fileName, onMesh, progress, &job->cancelled)
+                                 : StreamUSDBuffer(job->buffer.data(), job->buffer.size(), job->fileName, onMesh,
+                                                   progress, &job->cancelled);
+                } else {
+                    loaded = job->fromDisk
+                                 ? LoadUSDFromDisk(job->fileName, meshes, progress, &job->cancelled)
+                                 : LoadUSDBuffer(job->buffer.data(), job->buffer.size(), job->fileName, meshes,
+                                                 progress, &job->cancelled);
+                }
+            } catch (const std::exception& e) {
+                MIDDLEWARE_LOG_ERROR("Exception in load %llu of %s: %s", static_cast<unsigned long long>(job->id),
+                                     job->fileName.c_str(), e.what());
+                loaded = false;
+            }
+        }
+        job->buffer.reset();
+
+        // A load cancelled after it finished still counts as cancelled, so a superseded
+        // result is never delivered after or instead of the newer one
+        const LoadState state = (job->cancelled.load() || shutdownRequested.load()) ? LoadState::Cancelled
+                                : loaded ? LoadState::Completed : LoadState::Failed;
+        if (state == LoadState::Completed) {
+            reportLoadProgress(job, 1.0f, "Complete");
+        }
+        const size_t meshCount = job->options.onMesh ? streamed : meshes.size();
+        {
+            std::lock_guard<std::mutex> lock(loadMutex);
+            if (state == LoadState::Completed) {
+                job->meshes = std::move(meshes);
+            }
+            job->state.store(state);
+            trimFinishedLoadsLocked();
+        }
+        loadFinished.notify_all();
+        MIDDLEWARE_LOG_INFO("Load %llu of %s %s (%zu meshes)", static_cast<unsigned long long>(job->id),
+                            job->fileName.c_str(), loadStateName(state), state == LoadState::Completed ? meshCount : 0);
+
+        if (job->options.onComplete && !shutdownRequested.load()) {
+            dispatchLoadCallback(*job, [job, state]() { job->options.onComplete(job->id, state, job->meshes); });
+        }
+    }
+
+    // Record progress in whole percent steps and forward it to the load's executor
+    void reportLoadProgress(const std::shared_ptr<LoadJob>& job, float progress, const std::string& stage) {
+        const int percent = static_cast<int>(std::clamp(progress, 0.0f, 1.0f) * 100.0f);
+        if (percent <= job->reportedPercent) {
+            return;
+        }
+        job->reportedPercent = percent;
+        job->progress.store(percent / 100.0f);
+
+        if (job->options.onProgress && !shutdownRequested.load()) {
+            dispatchLoadCallback(*job, [job, percent, stage]() {
+                job->options.onProgress(job->id, percent / 100.0f, stage);
+            });
+        }
+    }
+
+    static void dispatchLoadCallback(const LoadJob& job, std::function<void()> task) {
+        const unsigned long long id = job.id;
+        auto guarded = [id, task = std::move(task)]() {
+            try {
+                task();
+            } catch (const std::exception& e) {
+                MIDDLEWARE_LOG_ERROR("Exception in load callback (load %llu): %s", id, e.what());
+            } catch (...) {
+                MIDDLEWARE_LOG_ERROR("Unknown exception in load callback (load %llu)", id);
+            }
+        };
+
+        if (!job.options.executor) {
+            guarded();
+            return;
+        }
+        try {
+            job.options.executor(std::move(guarded));
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Load executor rejected a callback (load %llu): %s", id, e.what());
+        } catch (...) {
+            MIDDLEWARE_LOG_ERROR("Load executor rejected a callback (load %llu)", id);
+        }
+    }
+
+    void trimFinishedLoadsLocked() {
+        size_t finished = 0;
+        for (const auto& pair : loads) {
+            if (isFinalLoadState(pair.second->state.load())) {
+                ++finished;
+            }
+        }
+        for (auto it = loads.begin(); it != loads.end() && finished > MAX_FINISHED_LOADS;) {
+            if (isFinalLoadState(it->second->state.load())) {
+                it = loads.erase(it);
+                --finished;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    std::shared_ptr<LoadJob> findLoadLocked(AnariUsdMiddleware::LoadId id) const {
+        auto it = loads.find(id);
+        return it != loads.end() ? it->second : nullptr;
+    }
+
+    bool getLoadStatus(AnariUsdMiddleware::LoadId id, AnariUsdMiddleware::LoadState& outState,
+                       float& outProgress) const {
+        std::lock_guard<std::mutex> lock(loadMutex);
+        std::shared_ptr<LoadJob> job = findLoadLocked(id);
+        if (!job) {
+            return false;
+        }
+        outState = job->state.load();
+        outProgress = job->progress.load();
+        return true;
+    }
+
+    bool waitForLoad(AnariUsdMiddleware::LoadId id, int timeoutMs) {
+        std::unique_lock<std::mutex> lock(loadMutex);
+        std::shared_ptr<LoadJob> job = findLoadLocked(id);
+        if (!job) {
+            return false;
+        }
+        auto finished = [&job]() { return isFinalLoadState(job->state.load()); };
+        if (timeoutMs < 0) {
+            loadFinished.wait(lock, finished);
+            return true;
+        }
+        return loadFinished.wait_for(lock, std::chrono::milliseconds(timeoutMs), finished);
+    }
+
+    bool takeLoadResult(AnariUsdMiddleware::LoadId id, std::vector<AnariUsdMiddleware::MeshData>& outMeshData) {
+        std::lock_guard<std::mutex> lock(loadMutex);
+        auto it = loads.find(id);
+        if (it == loads.end() || !isFinalLoadState(it->second->state.load())) {
+            return false;
+        }
+        std::shared_ptr<LoadJob> job = std::move(it->second);
+        loads.erase(it);
+        if (job->state.load() != AnariUsdMiddleware::LoadState::Completed) {
+            return false;
+        }
+        outMeshData = std::move(job->meshes);
+        return true;
+    }
+
+    bool cancelLoad(AnariUsdMiddleware::LoadId id) {
+        std::lock_guard<std::mutex> lock(loadMutex);
+        std::shared_ptr<LoadJob> job = findLoadLocked(id);
+        if (!job || isFinalLoadState(job->state.load())) {
+            return false;
+        }
+        if (!job->cancelled.exchange(true)) {
+            MIDDLEWARE_LOG_INFO("Cancelling load %llu of %s", static_cast<unsigned long long>(id),
+                                job->fileName.c_str());
+        }
+        return true;
+    }
+
+    void releaseLoad(AnariUsdMiddleware::LoadId id) {
+        std::lock_guard<std::mutex> lock(loadMutex);
+        auto it = loads.find(id);
+        if (it == loads.end()) {
+            return;
+        }
+        it->second->cancelled.store(true);
+        loads.erase(it);
+    }
+
+    void stopLoadWorkers() {
+        std::vector<std::thread> workers;
+        {
+            std::lock_guard<std::mutex> lock(loadMutex);
+            if (!loadWorkersRunning) {
+                return;
+            }
+            loadWorkersRunning = false;
+            for (const auto& pair : loads) {
+                pair.second->cancelled.store(true);
+            }
+            workers.swap(loadWorkers);
+        }
+        loadAvailable.notify_all();
+        for (auto& worker : workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+
+        // Loads that never left the queue end here; running ones finished as cancelled
+        std::lock_guard<std::mutex> lock(loadMutex);
+        for (const auto& job : loadQueue) {
+            job->state.store(AnariUsdMiddleware::LoadState::Cancelled);
+        }
+        loadQueue.clear();
+        loads.clear();
+        loadFinished.notify_all();
+    }
+
+    // Report how the meshes of a received file differ from its previous version
+    void dispatchSceneDelta(const std::string& filename, std::vector<AnariUsdMiddleware::MeshData> meshes) {
+        AnariUsdMiddleware::SceneDelta delta;
+        if (!computeSceneDelta(filename, std::move(meshes), delta)) {
+            return;
+        }
+        if (delta.revision > 1 && delta.empty()) {
+            MIDDLEWARE_LOG_DEBUG("Scene %s unchanged, no delta dispatched", filename.c_str());
+            return;
+        }
+        notifySceneDeltaCallbacks(delta);
+    }
+
+    // 64-bit content hash for change detection (not cryptographic): murmur-style word mixing
+    static uint64_t hashBytes(const void* data, size_t size, uint64_t seed) {
+        auto rotl = [](uint64_t v, int r) { return (v << r) | (v >> (64 - r)); };
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t h = seed ^ (size * 0x9E3779B97F4A7C15ull);
+
+        auto mix = [&](uint64_t word) {
+            word *= 0x87C37B91114253D5ull;
+            word = rotl(word, 31);
+            word *= 0x4CF5AD432745937Full;
+            h ^= word;
+            h = rotl(h, 27) * 5 + 0x52DCE729;
+        };
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(word));
+            mix(word);
+        }
+        if (i < size) {
+            uint64_t tail = 0;
+            std::memcpy(&tail, bytes + i, size - i);
+            mix(tail);
+        }
+
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    template <typename T>
+    static uint64_t hashVector(const std::vector<T>& values, uint64_t seed) {
+        return hashBytes(values.data(), values.size() * sizeof(T), seed);
+    }
+
+    static MeshSignature meshSignature(const AnariUsdMiddleware::MeshData& mesh) {
+        MeshSignature signature;
+        uint64_t h = hashVector(mesh.points, 0);
+        h = hashVector(mesh.indices, h);
+        h = hashVector(mesh.normals, h);
+        h = hashVector(mesh.uvs, h);
+        h = hashVector(mesh.vertex_colors, h);
+        signature.geometry = hashBytes(mesh.typeName.data(), mesh.typeName.size(), h);
+        signature.transforms = hashVector(mesh.instance_transforms, 0);
+        return signature;
+    }
+
+    bool computeSceneDelta(const std::string& fileName, std::vector<AnariUsdMiddleware::MeshData> meshes,
+                           AnariUsdMiddleware::SceneDelta& outDelta) {
+        if (fileName.empty()) {
+            MIDDLEWARE_LOG_ERROR("computeSceneDelta requires a filename");
+            return false;
+        }
+
+        try {
+            // Keys and hashes are computed before taking the history lock
+            SceneSnapshot next;
+            std::vector<std::pair<std::string, MeshSignature>> keyed;
+            keyed.reserve(meshes.size());
+            std::unordered_map<std::string, size_t> occurrences;
+            for (const auto& mesh : meshes) {
+                keyed.emplace_back(nextMeshKey(mesh.elementName, occurrences), meshSignature(mesh));
+            }
+
+            AnariUsdMiddleware::SceneDelta delta;
+            delta.filename = fileName;
+
+            std::lock_guard<std::mutex> lock(sceneHistoryMutex);
+            const SceneSnapshot* previous = sceneHistory.find(fileName);
+            next.revision = previous ? previous->revision + 1 : 1;
+            next.meshes.reserve(keyed.size());
+
+            for (size_t i = 0; i < keyed.size(); ++i) {
+                const std::string& key = keyed[i].first;
+                const MeshSignature& signature = keyed[i].second;
+                next.meshes[key] = signature;
+
+                const MeshSignature* old = nullptr;
+                if (previous) {
+                    auto it = previous->meshes.find(key);
+                    old = it != previous->meshes.end() ? &it->second : nullptr;
+                }
+
+                if (!old) {
+                    delta.added.push_back({key, std::move(meshes[i]), true});
+                } else if (old->geometry != signature.geometry || old->transforms != signature.transforms) {
+                    delta.changed.push_back({key, std::move(meshes[i]), old->geometry != signature.geometry});
+                } else {
+                    ++delta.unchangedCount;
+                }
+            }
+
+            if (previous) {
+                for (const auto& entry : previous->meshes) {
+                    if (next.meshes.find(entry.first) == next.meshes.end()) {
+                        delta.removed.push_back(entry.first);
+                    }
+                }
+                std::sort(delta.removed.begin(), delta.removed.end());
+            }
+
+            delta.revision = next.revision;
+            sceneHistory.insert(fileName, std::move(next));
+
+            MIDDLEWARE_LOG_INFO("Scene delta for %s (revision %llu): %zu added, %zu changed, %zu removed, %zu unchanged",
+                                fileName.c_str(), static_cast<unsigned long long>(delta.revision),
+                                delta.added.size(), delta.changed.size(), delta.removed.size(),
+                                delta.unchangedCount);
+            outDelta = std::move(delta);
+            return true;
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception in computeSceneDelta: %s", e.what());
+            return false;
+        }
+    }
+
+    void clearSceneHistory() {
+        std::lock_guard<std::mutex> lock(sceneHistoryMutex);
+        sceneHistory.clear();
+        MIDDLEWARE_LOG_INFO("Scene delta history cleared");
+    }
+
     // Enhanced texture creation with comprehensive validation
-    AnariUsdMiddleware::TextureData CreateTextureFromBuffer(const std::vector<uint8_t>& buffer) {
+    AnariUsdMiddleware::TextureData CreateTextureFromBuffer(const uint8_t* data, size_t size,
+                                                            const std::string& contentHash) {
         if (!usdProcessor) {
             MIDDLEWARE_LOG_ERROR("USD processor not initialized");
             return AnariUsdMiddleware::TextureData();
@@ -473,7 +2126,19 @@ public:
         }
 
         try {
-            UsdProcessor::TextureData processorTexData = usdProcessor->CreateTextureFromBuffer(buffer);
+            // The sender's hash frame names the content; only hash ourselves if it is unusable
+            ContentDigest digest;
+            const bool haveDigest = textureCacheEnabled() && data && size > 0 &&
+                ((!contentHash.empty() && HashVerifier::digestFromHashFrame(contentHash, digest)) ||
+                 HashVerifier::calculateDigest(data, size, digest));
+            if (haveDigest) {
+                AnariUsdMiddleware::TextureData cached;
+                if (findCachedTexture(digest, cached)) {
+                    return cached;
+                }
+            }
+
+            UsdProcessor::TextureData processorTexData = usdProcessor->CreateTextureFromBuffer(data, size);
 
             // Convert to public API structure with validation
             AnariUsdMiddleware::TextureData result;
@@ -486,6 +2151,8 @@ public:
             if (!result.isValid()) {
                 MIDDLEWARE_LOG_ERROR("Converted texture data failed validation");
                 result.clear();
+            } else if (haveDigest) {
+                cacheTexture(digest, result);
             }
 
             return result;
@@ -495,9 +2162,203 @@ public:
         }
     }
 
-    // Enhanced USD buffer loading with type conversion safety
-    bool LoadUSDBuffer(const std::vector<uint8_t>& buffer, const std::string& fileName,
-                       std::vector<AnariUsdMiddleware::MeshData>& outMeshData) {
+    bool textureCacheEnabled() const {
+        std::lock_guard<std::mutex> lock(textureCacheMutex);
+        return textureCache.maxEntries() > 0 || !textureCacheDirectory.empty();
+    }
+
+    // Header of a texture cache file; the pixels follow
+    struct TextureFileHeader {
+        char magic[4];
+        uint32_t version;
+        int32_t width;
+        int32_t height;
+        int32_t channels;
+        uint32_t reserved;
+        uint64_t dataSize;
+    };
+    static constexpr char TEXTURE_FILE_MAGIC[4] = {'J', 'T', 'E', 'X'};
+    static constexpr uint32_t TEXTURE_FILE_VERSION = 1;
+
+    static std::filesystem::path textureCachePath(const std::filesystem::path& directory,
+                                                  const ContentDigest& digest) {
+        static const char hexDigits[] = "0123456789abcdef";
+        std::string name;
+        name.reserve(digest.size() * 2 + 5);
+        for (uint8_t byte : digest) {
+            name += hexDigits[byte >> 4];
+            name += hexDigits[byte & 0xF];
+        }
+        name += ".jtex";
+        return directory / name;
+    }
+
+    static bool readTextureFile(const std::filesystem::path& path, AnariUsdMiddleware::TextureData& out) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+
+        TextureFileHeader header{};
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.magic, TEXTURE_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != TEXTURE_FILE_VERSION) {
+            return false;
+        }
+
+        out.width = header.width;
+        out.height = header.height;
+        out.channels = header.channels;
+        if (header.width <= 0 || header.height <= 0 || header.channels <= 0 || header.channels > 4 ||
+            header.dataSize != out.getExpectedDataSize() || header.dataSize > safety::MAX_BUFFER_SIZE) {
+            out.clear();
+            return false;
+        }
+
+        out.data.resize(static_cast<size_t>(header.dataSize));
+        if (!file.read(reinterpret_cast<char*>(out.data.data()), static_cast<std::streamsize>(header.dataSize))) {
+            out.clear();
+            return false;
+        }
+        return true;
+    }
+
+    // Written to a temporary name and renamed, so a concurrent reader never sees a partial file
+    static bool writeTextureFile(const std::filesystem::path& path, const AnariUsdMiddleware::TextureData& texture) {
+        TextureFileHeader header{};
+        std::memcpy(header.magic, TEXTURE_FILE_MAGIC, sizeof(header.magic));
+        header.version = TEXTURE_FILE_VERSION;
+        header.width = texture.width;
+        header.height = texture.height;
+        header.channels = texture.channels;
+        header.dataSize = texture.data.size();
+
+        std::filesystem::path temporary = path;
+        temporary += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+                !file.write(reinterpret_cast<const char*>(texture.data.data()),
+                            static_cast<std::streamsize>(texture.data.size()))) {
+                file.close();
+                std::error_code ignored;
+                std::filesystem::remove(temporary, ignored);
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(temporary, path, ec);
+        if (ec) {
+            std::filesystem::remove(temporary, ec);
+            return false;
+        }
+        return true;
+    }
+
+    // Look up a previous decode of identical content, in memory first and then on disk
+    bool findCachedTexture(const ContentDigest& digest, AnariUsdMiddleware::TextureData& out) {
+        std::filesystem::path directory;
+        {
+            std::lock_guard<std::mutex> lock(textureCacheMutex);
+            if (CachedTexture* cached = textureCache.find(digest)) {
+                out = **cached;
+                textureBytesSaved += out.data.size();
+                return true;
+            }
+            directory = textureCacheDirectory;
+        }
+
+        if (directory.empty() || !readTextureFile(textureCachePath(directory, digest), out)) {
+            return false;
+        }
+
+        MIDDLEWARE_LOG_DEBUG("Texture loaded from disk cache: %dx%d", out.width, out.height);
+        auto cached = std::make_shared<const AnariUsdMiddleware::TextureData>(out);
+        std::lock_guard<std::mutex> lock(textureCacheMutex);
+        ++textureDiskHits;
+        textureBytesSaved += out.data.size();
+        textureCache.insert(digest, std::move(cached), out.data.size());
+        return true;
+    }
+
+    void cacheTexture(const ContentDigest& digest, const AnariUsdMiddleware::TextureData& texture) {
+        std::filesystem::path directory;
+        {
+            auto cached = std::make_shared<const AnariUsdMiddleware::TextureData>(texture);
+            std::lock_guard<std::mutex> lock(textureCacheMutex);
+            textureCache.insert(digest, std::move(cached), texture.data.size());
+            directory = textureCacheDirectory;
+        }
+
+        if (!directory.empty() && !writeTextureFile(textureCachePath(directory, digest), texture)) {
+            MIDDLEWARE_LOG_WARNING("Failed to write texture to disk cache in %s", directory.string().c_str());
+        }
+    }
+
+    // Look up a previous parse of identical content; haveDigest tells whether a result can be
+    // cached. knownDigest, if given, is the verified digest of data and saves hashing it again.
+    CachedMeshes findCachedMeshes(const uint8_t* data, size_t size, ContentDigest& digest, bool& haveDigest,
+                                  const ContentDigest* knownDigest = nullptr) {
+        haveDigest = false;
+        if (!data || size == 0 || !meshCacheEnabled()) {
+            return nullptr;
+        }
+
+        // Only self-contained stages are cached, and identical content parses to identical
+        // meshes whatever it is called
+        if (knownDigest) {
+            digest = *knownDigest;
+            haveDigest = true;
+        } else {
+            haveDigest = HashVerifier::calculateDigest(data, size, digest);
+        }
+        if (!haveDigest) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(meshCacheMutex);
+        CachedMeshes* cached = meshCache.find(digest);
+        return cached ? *cached : nullptr;
+    }
+
+    void cacheMeshes(const ContentDigest& digest, std::vector<AnariUsdMiddleware::MeshData> meshes) {
+        auto cached = std::make_shared<const std::vector<AnariUsdMiddleware::MeshData>>(std::move(meshes));
+        size_t cost = estimateMeshBytes(*cached);
+        std::lock_guard<std::mutex> lock(meshCacheMutex);
+        meshCache.insert(digest, std::move(cached), cost);
+    }
+
+    bool meshCacheEnabled() const {
+        std::lock_guard<std::mutex> lock(meshCacheMutex);
+        return meshCache.maxEntries() > 0;
+    }
+
+    // Progress callback for monitoring, forwarding to onProgress if given
+    static UsdProcessor::ProgressCallback loggingProgress(const UsdProcessor::ProgressCallback& onProgress) {
+        return [onProgress](float progress, const std::string& status) {
+            if (progress == 1.0f) {
+                MIDDLEWARE_LOG_INFO("USD processing complete: %s", status.c_str());
+            } else if (static_cast<int>(progress * 10) % 2 == 0) {
+                MIDDLEWARE_LOG_DEBUG("USD processing progress: %.1f%% - %s",
+                                    progress * 100.0f, status.c_str());
+            }
+            if (onProgress) {
+                onProgress(progress, status);
+            }
+        };
+    }
+
+    // Run the USD processor with progress logging
+    bool parseUsdBuffer(const uint8_t* data, size_t size, const std::string& fileName,
+                        std::vector<UsdProcessor::MeshData>& processorMeshData,
+                        const UsdProcessor::ProgressCallback& onProgress = nullptr,
+                        const std::atomic<bool>* cancelFlag = nullptr,
+                        bool* usesExternalLayers = nullptr) {
+        return usdProcessor->LoadUSDBuffer(data, size, fileName, processorMeshData, loggingProgress(onProgress),
+                                           cancelFlag, usesExternalLayers);
+    }
+
+    bool canLoadUsd() const {
         if (!usdProcessor) {
             MIDDLEWARE_LOG_ERROR("USD processor not initialized");
             return false;
@@ -507,49 +2368,336 @@ public:
             MIDDLEWARE_LOG_WARNING("USD loading aborted: shutdown requested");
             return false;
         }
+        return true;
+    }
+
+    // Binary mesh containers need no parsing, so they bypass tinyusdz and the mesh cache
+    bool loadMeshContainer(const uint8_t* data, size_t size, const std::string& fileName,
+                           std::vector<AnariUsdMiddleware::MeshData>& outMeshData) {
+        std::vector<container::MeshView> views;
+        if (!container::parse(data, size, views)) {
+            MIDDLEWARE_LOG_ERROR("Invalid mesh container: %s", fileName.c_str());
+            return false;
+        }
+
+        outMeshData.clear();
+        outMeshData.reserve(views.size());
+        for (const auto& view : views) {
+            outMeshData.push_back(meshFromView(view));
+        }
+
+        MIDDLEWARE_LOG_INFO("Loaded %zu meshes from container %s", outMeshData.size(), fileName.c_str());
+        return !outMeshData.empty();
+    }
+
+    static AnariUsdMiddleware::MeshData meshFromView(const container::MeshView& view) {
+        AnariUsdMiddleware::MeshData mesh;
+        mesh.elementName.assign(view.elementName.data(), view.elementName.size());
+        mesh.typeName.assign(view.typeName.data(), view.typeName.size());
+        mesh.points.assign(view.points, view.points + view.vertexCount * 3);
+        mesh.indices.assign(view.indices, view.indices + view.indexCount);
+        if (view.normals) {
+            mesh.normals.assign(view.normals, view.normals + view.vertexCount * 3);
+        }
+        if (view.uvs) {
+            mesh.uvs.assign(view.uvs, view.uvs + view.vertexCount * 2);
+        }
+        if (view.colors) {
+            mesh.vertex_colors.assign(view.colors, view.colors + view.vertexCount * 4);
+        }
+        if (view.instanceTransforms) {
+            mesh.instance_transforms.assign(view.instanceTransforms,
+                                            view.instanceTransforms + view.instanceCount * 16);
+        }
+        return mesh;
+    }
+
+    // Enhanced USD buffer loading with type conversion safety; usesExternalLayers tells
+    // whether the meshes depend on other layers than data, knownDigest is a verified digest
+    // of data for the mesh cache
+    bool LoadUSDBuffer(const uint8_t* data, size_t size, const std::string& fileName,
+                       std::vector<AnariUsdMiddleware::MeshData>& outMeshData,
+                       const UsdProcessor::ProgressCallback& onProgress = nullptr,
+                       const std::atomic<bool>* cancelFlag = nullptr,
+                       bool* usesExternalLayers = nullptr,
+                       const ContentDigest* knownDigest = nullptr) {
+        bool external = false;
+        if (usesExternalLayers) {
+            *usesExternalLayers = false;
+        }
+        if (!canLoadUsd()) {
+            return false;
+        }
 
         try {
+            if (container::isContainer(data, size)) {
+                return loadMeshContainer(data, size, fileName, outMeshData);
+            }
+
+            ContentDigest digest;
+            bool haveDigest = false;
+            if (CachedMeshes cached = findCachedMeshes(data, size, digest, haveDigest, knownDigest)) {
+                outMeshData = *cached;
+                MIDDLEWARE_LOG_INFO("Mesh cache hit for %s (%zu meshes)", fileName.c_str(), outMeshData.size());
+                return true;
+            }
+
             // Use internal processor mesh data format
             std::vector<UsdProcessor::MeshData> processorMeshData;
+            bool result = parseUsdBuffer(data, size, fileName, processorMeshData, onProgress, cancelFlag, &external);
+            if (usesExternalLayers) {
+                *usesExternalLayers = external;
+            }
+
+            if (result && !processorMeshData.empty()) {
+                // Convert to public API structure with enhanced safety
+                profiling::StageTimer convertTimer(&stageProfiler, profiling::Stage::Convert, fileName);
+                outMeshData.clear();
+                outMeshData.reserve(processorMeshData.size());
+
+                for (const auto& meshData : processorMeshData) {
+                    AnariUsdMiddleware::MeshData publicMeshData;
+                    if (!convertMeshData(meshData, publicMeshData)) {
+                        MIDDLEWARE_LOG_WARNING("Failed to convert mesh data: %s", meshData.elementName.c_str());
+                        continue;
+                    }
+                    outMeshData.push_back(std::move(publicMeshData));
+                }
+                convertTimer.stop();
+
+                MIDDLEWARE_LOG_INFO("Successfully converted %zu meshes to public API format", outMeshData.size());
+
+                if (haveDigest && !external && !outMeshData.empty()) {
+                    cacheMeshes(digest, outMeshData);
+                }
+            }
+
+            return result;
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception in LoadUSDBuffer: %s", e.what());
+            return false;
+        }
+    }
+
+    // Streaming variant: each processor mesh is converted and handed on as soon as it is
+    // extracted, and released before the next one is converted
+    bool StreamUSDBuffer(const uint8_t* data, size_t size, const std::string& fileName,
+                         const AnariUsdMiddleware::MeshStreamCallback& onMesh,
+                         const UsdProcessor::ProgressCallback& onProgress = nullptr,
+                         const std::atomic<bool>* cancelFlag = nullptr) {
+        if (!onMesh) {
+            MIDDLEWARE_LOG_ERROR("Streaming load requires a mesh callback");
+            return false;
+        }
+        if (!canLoadUsd()) {
+            return false;
+        }
+
+        try {
+            if (container::isContainer(data, size)) {
+                std::vector<container::MeshView> views;
+                if (!container::parse(data, size, views) || views.empty()) {
+                    MIDDLEWARE_LOG_ERROR("Invalid mesh container: %s", fileName.c_str());
+                    return false;
+                }
+                for (const auto& view : views) {
+                    if (!onMesh(meshFromView(view))) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            ContentDigest digest;
+            bool haveDigest = false;
+            if (CachedMeshes cached = findCachedMeshes(data, size, digest, haveDigest)) {
+                MIDDLEWARE_LOG_INFO("Mesh cache hit for %s (%zu meshes)", fileName.c_str(), cached->size());
+                for (const auto& mesh : *cached) {
+                    if (!onMesh(AnariUsdMiddleware::MeshData(mesh))) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // The cache needs the whole list; only keep copies when it is in use
+            const bool keepForCache = haveDigest;
+            std::vector<AnariUsdMiddleware::MeshData> cachedMeshes;
+            size_t delivered = 0;
+            UsdProcessor::MeshSink sink = [&](UsdProcessor::MeshData&& processorMesh) {
+                AnariUsdMiddleware::MeshData mesh;
+                const bool converted = convertMeshData(processorMesh, mesh);
+                processorMesh = UsdProcessor::MeshData();
+                if (!converted) {
+                    MIDDLEWARE_LOG_WARNING("Failed to convert mesh data: %s", mesh.elementName.c_str());
+                    return true;
+                }
+                if (keepForCache) {
+                    cachedMeshes.push_back(mesh);
+                }
+                ++delivered;
+                return onMesh(std::move(mesh));
+            };
+
+            bool external = false;
+            bool result = usdProcessor->StreamUSDBuffer(data, size, fileName, sink, loggingProgress(onProgress),
+                                                        cancelFlag, &external);
+            MIDDLEWARE_LOG_INFO("Streamed %zu meshes from %s", delivered, fileName.c_str());
+            if (result && keepForCache && !external && !cachedMeshes.empty()) {
+                cacheMeshes(digest, std::move(cachedMeshes));
+            }
+            return result;
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception in StreamUSDBuffer: %s", e.what());
+            return false;
+        }
+    }
+
+    bool StreamUSDFromDisk(const std::string& filePath, const AnariUsdMiddleware::MeshStreamCallback& onMesh,
+                           const UsdProcessor::ProgressCallback& onProgress = nullptr,
+                           const std::atomic<bool>* cancelFlag = nullptr) {
+        MIDDLEWARE_LOG_INFO("Streaming USD from disk: %s", filePath.c_str());
+        try {
+            if (!validateFilePath(filePath)) {
+                return false;
+            }
+
+            // Streaming reads the disk cache but does not fill it: the meshes are handed on, not kept
+            ContentDigest diskKey;
+            bool haveDiskKey = false;
+            std::shared_ptr<MappedFile> mapped = findDiskCachedMeshes(filePath, diskKey, haveDiskKey);
+            if (!mapped) {
+                mapped = mapUsdFile(filePath);
+            }
+            if (!mapped) {
+                return false;
+            }
+
+            return StreamUSDBuffer(mapped->data(), mapped->size(), filePath, onMesh, onProgress, cancelFlag);
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception in StreamUSDFromDisk: %s - %s", filePath.c_str(), e.what());
+            return false;
+        }
+    }
+
+    // Single-allocation variant: processor meshes are written straight into the arena
+    bool LoadUSDBufferToArena(const uint8_t* data, size_t size, const std::string& fileName,
+                              const AnariUsdMiddleware::ArenaAllocator& allocate,
+                              AnariUsdMiddleware::MeshArena& outArena, size_t headerBytesPerMesh,
+                              bool* usesExternalLayers = nullptr) {
+        if (usesExternalLayers) {
+            *usesExternalLayers = false;
+        }
+        if (!allocate) {
+            MIDDLEWARE_LOG_ERROR("LoadUSDBufferToArena requires an allocator");
+            return false;
+        }
+        if (!canLoadUsd()) {
+            return false;
+        }
+
+        try {
+            if (container::isContainer(data, size)) {
+                std::vector<AnariUsdMiddleware::MeshData> meshes;
+                return loadMeshContainer(data, size, fileName, meshes) &&
+                       writeMeshArena(meshes, allocate, headerBytesPerMesh, outArena);
+            }
+
+            ContentDigest digest;
+            bool haveDigest = false;
+            if (CachedMeshes cached = findCachedMeshes(data, size, digest, haveDigest)) {
+                MIDDLEWARE_LOG_INFO("Mesh cache hit for %s (%zu meshes)", fileName.c_str(), cached->size());
+                return writeMeshArena(*cached, allocate, headerBytesPerMesh, outArena);
+            }
+
+            std::vector<UsdProcessor::MeshData> processorMeshData;
+            bool external = false;
+            const bool parsed = parseUsdBuffer(data, size, fileName, processorMeshData, nullptr, nullptr, &external);
+            if (usesExternalLayers) {
+                *usesExternalLayers = external;
+            }
+            if (!parsed || processorMeshData.empty()) {
+                return false;
+            }
 
-            // Progress callback for monitoring
-            auto progressCallback = [this](float progress, const std::string& status) {
-                if (progress == 1.0f) {
-                    MIDDLEWARE_LOG_INFO("USD processing complete: %s", status.c_str());
-                } else if (static_cast<int>(progress * 10) % 2 == 0) {
-                    MIDDLEWARE_LOG_DEBUG("USD processing progress: %.1f%% - %s",
-                                        progress * 100.0f, status.c_str());
+            profiling::StageTimer convertTimer(&stageProfiler, profiling::Stage::Convert, fileName);
+            if (!writeMeshArena(processorMeshData, allocate, headerBytesPerMesh, outArena)) {
+                return false;
+            }
+            convertTimer.stop();
+
+            // The cache keeps the vector form; only pay for it when the cache is in use
+            if (haveDigest && !external) {
+                std::vector<AnariUsdMiddleware::MeshData> cachedMeshes;
+                cachedMeshes.reserve(outArena.meshes.size());
+                for (const auto& slot : outArena.meshes) {
+                    AnariUsdMiddleware::MeshData mesh;
+                    mesh.elementName = slot.elementName;
+                    mesh.typeName = slot.typeName;
+                    const float* points = outArena.at<float>(slot.pointsOffset);
+                    mesh.points.assign(points, points + slot.pointsCount);
+                    const uint32_t* indices = outArena.at<uint32_t>(slot.indicesOffset);
+                    mesh.indices.assign(indices, indices + slot.indicesCount);
+                    const float* normals = outArena.at<float>(slot.normalsOffset);
+                    mesh.normals.assign(normals, normals + slot.normalsCount);
+                    const float* uvs = outArena.at<float>(slot.uvsOffset);
+                    mesh.uvs.assign(uvs, uvs + slot.uvsCount);
+                    const float* colors = outArena.at<float>(slot.colorsOffset);
+                    mesh.vertex_colors.assign(colors, colors + slot.colorsCount);
+                    const float* instances = outArena.at<float>(slot.instancesOffset);
+                    mesh.instance_transforms.assign(instances, instances + slot.instancesCount);
+                    cachedMeshes.push_back(std::move(mesh));
                 }
-            };
-
-            bool result = usdProcessor->LoadUSDBuffer(buffer, fileName, processorMeshData, progressCallback);
+                cacheMeshes(digest, std::move(cachedMeshes));
+            }
+            return true;
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception in LoadUSDBufferToArena: %s", e.what());
+            return false;
+        }
+    }
 
-            if (result && !processorMeshData.empty()) {
-                // Convert to public API structure with enhanced safety
-                outMeshData.clear();
-                outMeshData.reserve(processorMeshData.size());
+    bool LoadUSDFromDiskToArena(const std::string& filePath, const AnariUsdMiddleware::ArenaAllocator& allocate,
+                                AnariUsdMiddleware::MeshArena& outArena, size_t headerBytesPerMesh) {
+        MIDDLEWARE_LOG_INFO("Loading USD from disk into arena: %s", filePath.c_str());
+        try {
+            if (!validateFilePath(filePath)) {
+                return false;
+            }
 
-                for (const auto& meshData : processorMeshData) {
-                    AnariUsdMiddleware::MeshData publicMeshData;
-                    if (!convertMeshData(meshData, publicMeshData)) {
-                        MIDDLEWARE_LOG_WARNING("Failed to convert mesh data: %s", meshData.elementName.c_str());
-                        continue;
-                    }
-                    outMeshData.push_back(std::move(publicMeshData));
+            ContentDigest diskKey;
+            bool haveDiskKey = false;
+            if (auto cached = findDiskCachedMeshes(filePath, diskKey, haveDiskKey)) {
+                if (LoadUSDBufferToArena(cached->data(), cached->size(), filePath, allocate, outArena,
+                                         headerBytesPerMesh)) {
+                    return true;
                 }
+            }
 
-                MIDDLEWARE_LOG_INFO("Successfully converted %zu meshes to public API format", outMeshData.size());
+            std::shared_ptr<MappedFile> mapped = mapUsdFile(filePath);
+            if (!mapped) {
+                return false;
             }
 
+            // The key covers this file only, not the layers it pulls in
+            bool external = false;
+            bool result = LoadUSDBufferToArena(mapped->data(), mapped->size(), filePath, allocate, outArena,
+                                               headerBytesPerMesh, &external);
+            if (result && haveDiskKey && !external && !outArena.meshes.empty() &&
+                !container::isContainer(mapped->data(), mapped->size())) {
+                storeDiskCachedArena(diskKey, filePath, outArena);
+            }
             return result;
         } catch (const std::exception& e) {
-            MIDDLEWARE_LOG_ERROR("Exception in LoadUSDBuffer: %s", e.what());
+            MIDDLEWARE_LOG_ERROR("Exception in LoadUSDFromDiskToArena: %s - %s", filePath.c_str(), e.what());
             return false;
         }
     }
 
     // Enhanced disk loading with comprehensive file validation
-    bool LoadUSDFromDisk(const std::string& filePath, std::vector<AnariUsdMiddleware::MeshData>& outMeshData) {
+    bool LoadUSDFromDisk(const std::string& filePath, std::vector<AnariUsdMiddleware::MeshData>& outMeshData,
+                         const UsdProcessor::ProgressCallback& onProgress = nullptr,
+                         const std::atomic<bool>* cancelFlag = nullptr) {
         MIDDLEWARE_LOG_INFO("Loading USD from disk with enhanced validation: %s", filePath.c_str());
         try {
             // Comprehensive file validation
@@ -557,14 +2705,32 @@ public:
                 return false;
             }
 
-            // Read file with enhanced error handling
-            std::vector<uint8_t> buffer;
-            if (!readFileToBuffer(filePath, buffer)) {
+            // An unchanged file extracted before is read back from the disk cache, skipping the parse
+            ContentDigest diskKey;
+            bool haveDiskKey = false;
+            if (auto cached = findDiskCachedMeshes(filePath, diskKey, haveDiskKey)) {
+                if (loadMeshContainer(cached->data(), cached->size(), filePath, outMeshData)) {
+                    return true;
+                }
+            }
+
+            // Map instead of reading: parsing starts on the first pages while the rest stream in
+            std::shared_ptr<MappedFile> mapped = mapUsdFile(filePath);
+            if (!mapped) {
                 return false;
             }
 
             // Use existing buffer processing
-            return LoadUSDBuffer(buffer, filePath, outMeshData);
+            // The key covers this file only, not the layers it pulls in
+            bool external = false;
+            bool result = LoadUSDBuffer(mapped->data(), mapped->size(), filePath, outMeshData, onProgress, cancelFlag,
+                                        &external);
+            const bool cancelled = cancelFlag && cancelFlag->load();
+            if (result && !cancelled && haveDiskKey && !external && !outMeshData.empty() &&
+                !container::isContainer(mapped->data(), mapped->size())) {
+                storeDiskCachedMeshes(diskKey, filePath, outMeshData);
+            }
+            return result;
         } catch (const std::exception& e) {
             MIDDLEWARE_LOG_ERROR("Exception in LoadUSDFromDisk: %s - %s", filePath.c_str(), e.what());
             return false;
@@ -586,7 +2752,7 @@ public:
             }
 
             // Create texture from buffer
-            TextureData texData = CreateTextureFromBuffer(buffer);
+            TextureData texData = CreateTextureFromBuffer(buffer.data(), buffer.size(), std::string());
 
             // Validate gradient data (should be 1 row high)
             if (!texData.isValid() || texData.height != 1) {
@@ -634,7 +2800,7 @@ public:
                 return false;
             }
 
-            TextureData texData = CreateTextureFromBuffer(buffer);
+            TextureData texData = CreateTextureFromBuffer(buffer.data(), buffer.size(), std::string());
 
             // Validate gradient data
             if (!texData.isValid() || texData.height != 1) {
@@ -666,167 +2832,267 @@ public:
     }
 
 private:
-    // CRITICAL: Add the missing convertMeshData method
-bool convertMeshData(const UsdProcessor::MeshData& processorMeshData,
-                    AnariUsdMiddleware::MeshData& publicMeshData) {
-    try {
-        publicMeshData.elementName = processorMeshData.elementName;
-        publicMeshData.typeName = processorMeshData.typeName;
+    // Per-vertex RGBA floats a processor mesh converts to. Uniform (per-face) colors are
+    // expanded to the vertices, other mismatches are padded with white or truncated.
+    static size_t flatColorCount(const UsdProcessor::MeshData& mesh) {
+        return mesh.vertex_colors.empty() ? 0 : mesh.points.size() * 4;
+    }
 
-        // Calculate counts for interpolation detection
-        size_t pointCount = processorMeshData.points.size();
-        size_t faceCount = processorMeshData.indices.size() / 3;
-        size_t colorCount = processorMeshData.vertex_colors.size();
-
-        bool bVertexInterp = (colorCount == pointCount);
-        bool bUniformInterp = (colorCount == faceCount);
-
-        MIDDLEWARE_LOG_INFO("convertMeshData: %zu colors, %zu vertices, %zu faces - Mode: %s",
-            colorCount, pointCount, faceCount,
-            bVertexInterp ? "VERTEX" : (bUniformInterp ? "UNIFORM" : "UNKNOWN"));
-
-        // Convert points (glm::vec3 → flat float array)
-        publicMeshData.points.clear();
-        publicMeshData.points.reserve(pointCount * 3);
-        for (const auto& point : processorMeshData.points) {
-            publicMeshData.points.push_back(point.x);
-            publicMeshData.points.push_back(point.y);
-            publicMeshData.points.push_back(point.z);
-        }
-
-        // Direct copy for indices
-        publicMeshData.indices = processorMeshData.indices;
-
-        // Convert normals (glm::vec3 → flat float array)
-        publicMeshData.normals.clear();
-        publicMeshData.normals.reserve(processorMeshData.normals.size() * 3);
-        for (const auto& normal : processorMeshData.normals) {
-            publicMeshData.normals.push_back(normal.x);
-            publicMeshData.normals.push_back(normal.y);
-            publicMeshData.normals.push_back(normal.z);
-        }
-
-        // Convert UVs (glm::vec2 → flat float array)
-        publicMeshData.uvs.clear();
-        publicMeshData.uvs.reserve(processorMeshData.uvs.size() * 2);
-        for (const auto& uv : processorMeshData.uvs) {
-            publicMeshData.uvs.push_back(uv.x);
-            publicMeshData.uvs.push_back(uv.y);
-        }
-
-        // ✅ ENHANCED: Vertex color conversion with interpolation handling
-        publicMeshData.vertex_colors.clear();
-        if (!processorMeshData.vertex_colors.empty()) {
-
-            if (bVertexInterp) {
-                // Direct per-vertex mapping
-                MIDDLEWARE_LOG_INFO("Using VERTEX interpolation - direct color mapping");
-                publicMeshData.vertex_colors.reserve(colorCount * 4);
-                for (const auto& color : processorMeshData.vertex_colors) {
-                    publicMeshData.vertex_colors.push_back(color.r);
-                    publicMeshData.vertex_colors.push_back(color.g);
-                    publicMeshData.vertex_colors.push_back(color.b);
-                    publicMeshData.vertex_colors.push_back(color.a);
-                }
-            }
-            else if (bUniformInterp) {
-                // Expand uniform (per-face) colors to per-vertex
-                MIDDLEWARE_LOG_INFO("Using UNIFORM interpolation - expanding face colors to vertices");
-                publicMeshData.vertex_colors.reserve(pointCount * 4);
-
-                // Create per-vertex colors by mapping face colors to vertices
-                std::vector<glm::vec4> vertexColors(pointCount, glm::vec4(1.0f)); // Default white
-
-                for (size_t faceIdx = 0; faceIdx < faceCount; ++faceIdx) {
-                    if (faceIdx >= colorCount) break;
-
-                    const auto& faceColor = processorMeshData.vertex_colors[faceIdx];
-
-                    // Get the three vertex indices for this face
-                    size_t i0 = processorMeshData.indices[faceIdx * 3 + 0];
-                    size_t i1 = processorMeshData.indices[faceIdx * 3 + 1];
-                    size_t i2 = processorMeshData.indices[faceIdx * 3 + 2];
-
-                    // Assign face color to all three vertices
-                    if (i0 < pointCount) vertexColors[i0] = faceColor;
-                    if (i1 < pointCount) vertexColors[i1] = faceColor;
-                    if (i2 < pointCount) vertexColors[i2] = faceColor;
-                }
-
-                // Flatten to float array
-                for (const auto& color : vertexColors) {
-                    publicMeshData.vertex_colors.push_back(color.r);
-                    publicMeshData.vertex_colors.push_back(color.g);
-                    publicMeshData.vertex_colors.push_back(color.b);
-                    publicMeshData.vertex_colors.push_back(color.a);
-                }
-
-                MIDDLEWARE_LOG_INFO("Expanded %zu face colors to %zu vertex colors",
-                    colorCount, vertexColors.size());
-            }
-            else {
-                // Fallback: treat as vertex colors with padding/truncation
-                MIDDLEWARE_LOG_WARNING("Color count mismatch - using fallback vertex mapping");
-                publicMeshData.vertex_colors.reserve(pointCount * 4);
-
-                for (size_t i = 0; i < pointCount; ++i) {
-                    if (i < colorCount) {
-                        const auto& color = processorMeshData.vertex_colors[i];
-                        publicMeshData.vertex_colors.push_back(color.r);
-                        publicMeshData.vertex_colors.push_back(color.g);
-                        publicMeshData.vertex_colors.push_back(color.b);
-                        publicMeshData.vertex_colors.push_back(color.a);
-                    } else {
-                        // Default white for missing colors
-                        publicMeshData.vertex_colors.push_back(1.0f);
-                        publicMeshData.vertex_colors.push_back(1.0f);
-                        publicMeshData.vertex_colors.push_back(1.0f);
-                        publicMeshData.vertex_colors.push_back(1.0f);
+    static void writeFlatColors(const UsdProcessor::MeshData& mesh, float* out) {
+        static_assert(sizeof(glm::vec4) == 4 * sizeof(float), "glm::vec4 must be four packed floats");
+        const size_t pointCount = mesh.points.size();
+        const size_t faceCount = mesh.indices.size() / 3;
+        const size_t colorCount = mesh.vertex_colors.size();
+        glm::vec4* colors = reinterpret_cast<glm::vec4*>(out);
+
+        if (colorCount == pointCount) {
+            // Direct per-vertex mapping
+            MIDDLEWARE_LOG_INFO("Using VERTEX interpolation - direct color mapping");
+            std::memcpy(out, mesh.vertex_colors.data(), colorCount * sizeof(glm::vec4));
+        } else if (colorCount == faceCount) {
+            // Expand uniform (per-face) colors to per-vertex
+            MIDDLEWARE_LOG_INFO("Using UNIFORM interpolation - expanding face colors to vertices");
+            std::fill(colors, colors + pointCount, glm::vec4(1.0f)); // Default white
+
+            for (size_t faceIdx = 0; faceIdx < faceCount; ++faceIdx) {
+                const auto& faceColor = mesh.vertex_colors[faceIdx];
+
+                // Assign face color to all three vertices
+                for (size_t corner = 0; corner < 3; ++corner) {
+                    size_t vertex = mesh.indices[faceIdx * 3 + corner];
+                    if (vertex < pointCount) {
+                        colors[vertex] = faceColor;
                     }
                 }
             }
 
-            // Debug logging for first few colors
-            MIDDLEWARE_LOG_INFO("First few converted colors:");
-            for (size_t i = 0; i < std::min<size_t>(5, publicMeshData.vertex_colors.size() / 4); ++i) {
-                size_t idx = i * 4;
-                MIDDLEWARE_LOG_INFO("  Color[%zu]: (%.3f, %.3f, %.3f, %.3f)", i,
-                    publicMeshData.vertex_colors[idx],
-                    publicMeshData.vertex_colors[idx + 1],
-                    publicMeshData.vertex_colors[idx + 2],
-                    publicMeshData.vertex_colors[idx + 3]);
+            MIDDLEWARE_LOG_INFO("Expanded %zu face colors to %zu vertex colors", colorCount, pointCount);
+        } else {
+            // Fallback: treat as vertex colors with padding/truncation
+            MIDDLEWARE_LOG_WARNING("Color count mismatch - using fallback vertex mapping");
+            size_t copied = std::min(colorCount, pointCount);
+            std::memcpy(out, mesh.vertex_colors.data(), copied * sizeof(glm::vec4));
+            std::fill(colors + copied, colors + pointCount, glm::vec4(1.0f)); // Default white for missing colors
+        }
+    }
+
+    bool convertMeshData(const UsdProcessor::MeshData& processorMeshData,
+                         AnariUsdMiddleware::MeshData& publicMeshData) {
+        try {
+            static_assert(sizeof(glm::vec3) == 3 * sizeof(float) && sizeof(glm::vec2) == 2 * sizeof(float),
+                          "glm vectors must be packed floats");
+
+            publicMeshData.elementName = processorMeshData.elementName;
+            publicMeshData.typeName = processorMeshData.typeName;
+
+            size_t pointCount = processorMeshData.points.size();
+            size_t faceCount = processorMeshData.indices.size() / 3;
+            MIDDLEWARE_LOG_INFO("convertMeshData: %zu colors, %zu vertices, %zu faces",
+                                processorMeshData.vertex_colors.size(), pointCount, faceCount);
+
+            // glm vectors are packed floats, so each attribute flattens with one copy
+            const float* points = reinterpret_cast<const float*>(processorMeshData.points.data());
+            publicMeshData.points.assign(points, points + pointCount * 3);
+
+            publicMeshData.indices = processorMeshData.indices;
+
+            const float* normals = reinterpret_cast<const float*>(processorMeshData.normals.data());
+            publicMeshData.normals.assign(normals, normals + processorMeshData.normals.size() * 3);
+
+            const float* uvs = reinterpret_cast<const float*>(processorMeshData.uvs.data());
+            publicMeshData.uvs.assign(uvs, uvs + processorMeshData.uvs.size() * 2);
+
+            publicMeshData.vertex_colors.resize(flatColorCount(processorMeshData));
+            if (!publicMeshData.vertex_colors.empty()) {
+                writeFlatColors(processorMeshData, publicMeshData.vertex_colors.data());
+            }
+
+            static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "glm::mat4 must be 16 packed floats");
+            const float* instances = reinterpret_cast<const float*>(processorMeshData.instanceTransforms.data());
+            publicMeshData.instance_transforms.assign(instances,
+                                                      instances + processorMeshData.instanceTransforms.size() * 16);
+
+            // Validate the converted mesh data
+            bool isValid = publicMeshData.isValid();
+            if (!isValid) {
+                MIDDLEWARE_LOG_ERROR("Converted mesh data failed validation for: %s",
+                    processorMeshData.elementName.c_str());
+            } else {
+                MIDDLEWARE_LOG_INFO("Successfully converted mesh: %s (%zu vertices, %zu faces, %zu colors)",
+                    processorMeshData.elementName.c_str(), pointCount, faceCount,
+                    publicMeshData.vertex_colors.size() / 4);
             }
+
+            return isValid;
+
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception in convertMeshData: %s", e.what());
+            return false;
         }
+    }
 
-        // Validate the converted mesh data
-        bool isValid = publicMeshData.isValid();
-        if (!isValid) {
-            MIDDLEWARE_LOG_ERROR("Converted mesh data failed validation for: %s",
-                processorMeshData.elementName.c_str());
-        } else {
-            MIDDLEWARE_LOG_INFO("Successfully converted mesh: %s (%zu vertices, %zu faces, %zu colors)",
-                processorMeshData.elementName.c_str(), pointCount, faceCount,
-                publicMeshData.vertex_colors.size() / 4);
+    // Flat attribute sizes of a mesh in either representation, in elements
+    struct FlatMeshSizes {
+        size_t points = 0;
+        size_t indices = 0;
+        size_t normals = 0;
+        size_t uvs = 0;
+        size_t colors = 0;
+        size_t instances = 0;
+    };
+
+    static FlatMeshSizes flatSizes(const UsdProcessor::MeshData& mesh) {
+        return {mesh.points.size() * 3, mesh.indices.size(), mesh.normals.size() * 3,
+                mesh.uvs.size() * 2, flatColorCount(mesh), mesh.instanceTransforms.size() * 16};
+    }
+
+    static FlatMeshSizes flatSizes(const AnariUsdMiddleware::MeshData& mesh) {
+        return {mesh.points.size(), mesh.indices.size(), mesh.normals.size(),
+                mesh.uvs.size(), mesh.vertex_colors.size(), mesh.instance_transforms.size()};
+    }
+
+    static bool isArenaCandidate(const UsdProcessor::MeshData& mesh) {
+        // Same requirements convertMeshData enforces through MeshData::isValid
+        return !mesh.elementName.empty() && !mesh.points.empty() && !mesh.indices.empty() &&
+               mesh.indices.size() % 3 == 0;
+    }
+
+    static bool isArenaCandidate(const AnariUsdMiddleware::MeshData& mesh) {
+        return mesh.isValid();
+    }
+
+    static void writeArenaAttributes(const UsdProcessor::MeshData& mesh,
+                                     const AnariUsdMiddleware::MeshArena& arena,
+                                     const AnariUsdMiddleware::ArenaMesh& slot) {
+        std::memcpy(arena.at<float>(slot.pointsOffset), mesh.points.data(), slot.pointsCount * sizeof(float));
+        std::memcpy(arena.at<uint32_t>(slot.indicesOffset), mesh.indices.data(), slot.indicesCount * sizeof(uint32_t));
+        if (slot.normalsCount) {
+            std::memcpy(arena.at<float>(slot.normalsOffset), mesh.normals.data(), slot.normalsCount * sizeof(float));
+        }
+        if (slot.uvsCount) {
+            std::memcpy(arena.at<float>(slot.uvsOffset), mesh.uvs.data(), slot.uvsCount * sizeof(float));
+        }
+        if (slot.colorsCount) {
+            writeFlatColors(mesh, arena.at<float>(slot.colorsOffset));
         }
+        if (slot.instancesCount) {
+            std::memcpy(arena.at<float>(slot.instancesOffset), mesh.instanceTransforms.data(),
+                        slot.instancesCount * sizeof(float));
+        }
+    }
 
-        return isValid;
+    static void writeArenaAttributes(const AnariUsdMiddleware::MeshData& mesh,
+                                     const AnariUsdMiddleware::MeshArena& arena,
+                                     const AnariUsdMiddleware::ArenaMesh& slot) {
+        std::memcpy(arena.at<float>(slot.pointsOffset), mesh.points.data(), slot.pointsCount * sizeof(float));
+        std::memcpy(arena.at<uint32_t>(slot.indicesOffset), mesh.indices.data(), slot.indicesCount * sizeof(uint32_t));
+        if (slot.normalsCount) {
+            std::memcpy(arena.at<float>(slot.normalsOffset), mesh.normals.data(), slot.normalsCount * sizeof(float));
+        }
+        if (slot.uvsCount) {
+            std::memcpy(arena.at<float>(slot.uvsOffset), mesh.uvs.data(), slot.uvsCount * sizeof(float));
+        }
+        if (slot.colorsCount) {
+            std::memcpy(arena.at<float>(slot.colorsOffset), mesh.vertex_colors.data(), slot.colorsCount * sizeof(float));
+        }
+        if (slot.instancesCount) {
+            std::memcpy(arena.at<float>(slot.instancesOffset), mesh.instance_transforms.data(),
+                        slot.instancesCount * sizeof(float));
+        }
+    }
 
-    } catch (const std::exception& e) {
-        MIDDLEWARE_LOG_ERROR("Exception in convertMeshData: %s", e.what());
-        return false;
+    static size_t alignArenaOffset(size_t offset) {
+        constexpr size_t mask = AnariUsdMiddleware::ARENA_ALIGNMENT - 1;
+        return (offset + mask) & ~mask;
+    }
+
+    /**
+     * Lay out all meshes in one allocation and write their attributes exactly once
+     * @return True if at least one mesh was written
+     */
+    template <typename Mesh>
+    bool writeMeshArena(const std::vector<Mesh>& meshes, const AnariUsdMiddleware::ArenaAllocator& allocate,
+                        size_t headerBytesPerMesh, AnariUsdMiddleware::MeshArena& outArena) {
+        std::vector<const Mesh*> accepted;
+        accepted.reserve(meshes.size());
+        for (const auto& mesh : meshes) {
+            if (isArenaCandidate(mesh)) {
+                accepted.push_back(&mesh);
+            } else {
+                MIDDLEWARE_LOG_WARNING("Skipping invalid mesh for arena: %s", mesh.elementName.c_str());
+            }
+        }
+        if (accepted.empty()) {
+            return false;
+        }
+
+        // First pass: offsets only
+        AnariUsdMiddleware::MeshArena arena;
+        arena.headerBytes = alignArenaOffset(headerBytesPerMesh * accepted.size());
+        arena.meshes.resize(accepted.size());
+        size_t cursor = arena.headerBytes;
+        auto place = [&cursor](size_t count, size_t elementSize, size_t& offset) {
+            if (count == 0) {
+                offset = 0;
+                return;
+            }
+            offset = alignArenaOffset(cursor);
+            cursor = offset + count * elementSize;
+        };
+
+        for (size_t i = 0; i < accepted.size(); ++i) {
+            const Mesh& mesh = *accepted[i];
+            AnariUsdMiddleware::ArenaMesh& slot = arena.meshes[i];
+            FlatMeshSizes sizes = flatSizes(mesh);
+            slot.elementName = mesh.elementName;
+            slot.typeName = mesh.typeName;
+            slot.pointsCount = sizes.points;
+            slot.indicesCount = sizes.indices;
+            slot.normalsCount = sizes.normals;
+            slot.uvsCount = sizes.uvs;
+            slot.colorsCount = sizes.colors;
+            slot.instancesCount = sizes.instances;
+            place(slot.pointsCount, sizeof(float), slot.pointsOffset);
+            place(slot.indicesCount, sizeof(uint32_t), slot.indicesOffset);
+            place(slot.normalsCount, sizeof(float), slot.normalsOffset);
+            place(slot.uvsCount, sizeof(float), slot.uvsOffset);
+            place(slot.colorsCount, sizeof(float), slot.colorsOffset);
+            place(slot.instancesCount, sizeof(float), slot.instancesOffset);
+        }
+        arena.size = alignArenaOffset(cursor);
+
+        arena.data = static_cast<uint8_t*>(allocate(arena.size));
+        if (!arena.data) {
+            MIDDLEWARE_LOG_ERROR("Mesh arena allocation of %zu bytes failed", arena.size);
+            return false;
+        }
+
+        // Second pass: each attribute is written to its final place once
+        for (size_t i = 0; i < accepted.size(); ++i) {
+            writeArenaAttributes(*accepted[i], arena, arena.meshes[i]);
+        }
+
+        MIDDLEWARE_LOG_INFO("Wrote %zu meshes into a %zu byte arena", arena.meshes.size(), arena.size);
+        outArena = std::move(arena);
+        return true;
     }
-}
 
     // Helper methods
     void cleanup() {
         try {
             stopReceiving();
+            stopLodWorker();
+            stopLoadWorkers();
             zmqConnector.disconnect();
             usdProcessor.reset();
 
             std::lock_guard<std::mutex> lock(callbackMutex);
             updateCallbacks.clear();
             messageCallbacks.clear();
+            sceneDeltaCallbacks.clear();
+            sceneDeltaCallbackCount.store(0);
+            meshLodCallbacks.clear();
+            meshLodCallbackCount.store(0);
         } catch (const std::exception& e) {
             MIDDLEWARE_LOG_ERROR("Exception during cleanup: %s", e.what());
         }
@@ -867,38 +3133,100 @@ bool convertMeshData(const UsdProcessor::MeshData& processorMeshData,
         return true;
     }
 
-    bool readFileToBuffer(const std::string& filePath, std::vector<uint8_t>& buffer) {
-        try {
-            std::ifstream file(filePath, std::ios::binary | std::ios::ate);
-            if (!file.is_open()) {
-                MIDDLEWARE_LOG_ERROR("Failed to open file: %s", filePath.c_str());
-                return false;
-            }
+    // Every setting that changes what LoadUSDFromDisk extracts, for the disk cache key
+    uint64_t extractionFingerprint() const {
+        uint64_t fingerprint = 1469598103934665603ull;
+        auto mix = [&fingerprint](uint64_t value) { fingerprint = (fingerprint ^ value) * 1099511628211ull; };
+
+        const bool optimize = usdMeshOptimization.load();
+        const float weldEpsilon = usdWeldEpsilon.load();
+        const double timeCode = usdTimeCode.load();
+        uint32_t weldBits = 0;
+        uint64_t timeBits = ~0ull; // Any NaN means the default time
+        std::memcpy(&weldBits, &weldEpsilon, sizeof(weldBits));
+        if (!std::isnan(timeCode)) {
+            std::memcpy(&timeBits, &timeCode, sizeof(timeBits));
+        }
 
-            auto fileSize = file.tellg();
-            if (fileSize <= 0) {
-                MIDDLEWARE_LOG_ERROR("Invalid file size: %lld", static_cast<long long>(fileSize));
-                return false;
-            }
+        mix(usdInstancing.load());
+        mix(usdLocalSpace.load());
+        mix(optimize);
+        mix(optimize ? weldBits : 0);
+        mix(timeBits);
+        return fingerprint;
+    }
 
-            if (static_cast<size_t>(fileSize) > safety::MAX_BUFFER_SIZE) {
-                MIDDLEWARE_LOG_ERROR("File too large: %lld bytes (max: %zu)",
-                                    static_cast<long long>(fileSize), safety::MAX_BUFFER_SIZE);
-                return false;
+    // Map a previous extraction of an unchanged file; haveKey tells whether a result can be stored
+    std::shared_ptr<MappedFile> findDiskCachedMeshes(const std::string& filePath, ContentDigest& key, bool& haveKey) {
+        haveKey = meshDiskCache.isEnabled() && MeshDiskCache::makeKey(filePath, extractionFingerprint(), key);
+        if (!haveKey) {
+            return nullptr;
+        }
+        std::shared_ptr<MappedFile> cached = meshDiskCache.find(key);
+        if (cached) {
+            MIDDLEWARE_LOG_INFO("Mesh disk cache hit for %s (%zu bytes)", filePath.c_str(), cached->size());
+        }
+        return cached;
+    }
+
+    void storeDiskCachedMeshes(const ContentDigest& key, const std::string& filePath,
+                               const std::vector<AnariUsdMiddleware::MeshData>& meshes) {
+        std::vector<container::MeshView> views;
+        if (!describeMeshes(meshes, true, views)) {
+            MIDDLEWARE_LOG_DEBUG("Meshes of %s have attributes the container cannot hold, not cached on disk",
+                                 filePath.c_str());
+            return;
+        }
+        meshDiskCache.store(key, views.data(), views.size());
+    }
+
+    void storeDiskCachedArena(const ContentDigest& key, const std::string& filePath,
+                              const AnariUsdMiddleware::MeshArena& arena) {
+        std::vector<container::MeshView> views;
+        views.reserve(arena.meshes.size());
+        for (const auto& slot : arena.meshes) {
+            const size_t vertexCount = slot.pointsCount / 3;
+            if ((slot.normalsCount != 0 && slot.normalsCount != vertexCount * 3) ||
+                (slot.uvsCount != 0 && slot.uvsCount != vertexCount * 2) ||
+                (slot.colorsCount != 0 && slot.colorsCount != vertexCount * 4)) {
+                MIDDLEWARE_LOG_DEBUG("Meshes of %s have attributes the container cannot hold, not cached on disk",
+                                     filePath.c_str());
+                return;
             }
 
-            file.seekg(0, std::ios::beg);
-            buffer.resize(static_cast<size_t>(fileSize));
-            if (!file.read(reinterpret_cast<char*>(buffer.data()), fileSize)) {
-                MIDDLEWARE_LOG_ERROR("Failed to read file contents: %s", filePath.c_str());
-                return false;
+            container::MeshView view;
+            view.elementName = slot.elementName;
+            view.typeName = slot.typeName;
+            view.points = arena.at<float>(slot.pointsOffset);
+            view.vertexCount = vertexCount;
+            view.indices = arena.at<uint32_t>(slot.indicesOffset);
+            view.indexCount = slot.indicesCount;
+            view.normals = slot.normalsCount ? arena.at<float>(slot.normalsOffset) : nullptr;
+            view.uvs = slot.uvsCount ? arena.at<float>(slot.uvsOffset) : nullptr;
+            view.colors = slot.colorsCount ? arena.at<float>(slot.colorsOffset) : nullptr;
+            if (slot.instancesCount) {
+                view.instanceTransforms = arena.at<float>(slot.instancesOffset);
+                view.instanceCount = slot.instancesCount / 16;
             }
+            views.push_back(view);
+        }
+        meshDiskCache.store(key, views.data(), views.size());
+    }
 
-            return true;
-        } catch (const std::exception& e) {
-            MIDDLEWARE_LOG_ERROR("Exception reading file %s: %s", filePath.c_str(), e.what());
-            return false;
+    std::shared_ptr<MappedFile> mapUsdFile(const std::string& filePath) {
+        std::shared_ptr<MappedFile> mapped = MappedFile::open(filePath);
+        if (!mapped) {
+            return nullptr;
+        }
+
+        if (mapped->size() > safety::MAX_STREAMED_FILE_SIZE) {
+            MIDDLEWARE_LOG_ERROR("File too large: %zu bytes (max: %llu)", mapped->size(),
+                                 static_cast<unsigned long long>(safety::MAX_STREAMED_FILE_SIZE));
+            return nullptr;
         }
+
+        mapped->prefetch(0, mapped->size());
+        return mapped;
     }
 
     void logStatistics() {
@@ -907,13 +3235,32 @@ bool convertMeshData(const UsdProcessor::MeshData& processorMeshData,
             if (usdProcessor) {
                 auto usdStats = usdProcessor->getProcessingStats();
                 MIDDLEWARE_LOG_INFO("Middleware Statistics - ZMQ: %zu msgs, %zu files, %zu bytes | "
-                                    "USD: %zu files, %zu meshes, %zu errors",
+                                    "USD: %zu files, %zu meshes, %zu errors, %zu patched (%.1f ms preprocessing)",
                                     static_cast<size_t>(zmqStats.totalMessagesReceived),
                                     static_cast<size_t>(zmqStats.totalFilesReceived),
                                     static_cast<size_t>(zmqStats.totalBytesReceived),
                                     static_cast<size_t>(usdStats.filesProcessed),
                                     static_cast<size_t>(usdStats.meshesExtracted),
-                                    static_cast<size_t>(usdStats.processingErrors));
+                                    static_cast<size_t>(usdStats.processingErrors),
+                                    static_cast<size_t>(usdStats.filesPreprocessed),
+                                    usdStats.preprocessTimeUs / 1000.0);
+            }
+
+            std::ostringstream stages;
+            for (const auto& stage : stageProfiler.getSnapshot()) {
+                if (stage.count > 0) {
+                    stages << (stages.tellp() > 0 ? ", " : "") << stage.name << " " << stage.p99Ns / 1e6;
+                }
+            }
+            if (stages.tellp() > 0) {
+                MIDDLEWARE_LOG_INFO("Stage p99 latency (ms): %s", stages.str().c_str());
+            }
+
+            auto clients = zmqConnector.getClientStats();
+            if (!clients.empty()) {
+                MIDDLEWARE_LOG_INFO("Busiest sender: %s via %s (%.2f MB/s, %zu senders tracked)",
+                                    clients.front().name.c_str(), clients.front().endpoint.c_str(),
+                                    clients.front().bytesPerSecond / (1024.0 * 1024.0), clients.size());
             }
         } catch (const std::exception& e) {
             MIDDLEWARE_LOG_ERROR("Exception logging statistics: %s", e.what());
@@ -966,6 +3313,83 @@ void AnariUsdMiddleware::unregisterMessageCallback(int callbackId) {
     pImpl->unregisterMessageCallback(callbackId);
 }
 
+int AnariUsdMiddleware::registerSceneDeltaCallback(SceneDeltaCallback callback) {
+    return pImpl->registerSceneDeltaCallback(callback);
+}
+
+void AnariUsdMiddleware::unregisterSceneDeltaCallback(int callbackId) {
+    pImpl->unregisterSceneDeltaCallback(callbackId);
+}
+
+int AnariUsdMiddleware::registerMeshLodCallback(MeshLodCallback callback) {
+    return pImpl->registerMeshLodCallback(callback);
+}
+
+void AnariUsdMiddleware::unregisterMeshLodCallback(int callbackId) {
+    pImpl->unregisterMeshLodCallback(callbackId);
+}
+
+void AnariUsdMiddleware::setLodOptions(uint32_t levelCount, size_t minTriangles) {
+    pImpl->setLodOptions(levelCount, minTriangles);
+}
+
+bool AnariUsdMiddleware::SimplifyMesh(const MeshData& mesh, size_t targetTriangles, MeshData& outMesh) {
+    if (!mesh.isValid()) {
+        MIDDLEWARE_LOG_ERROR("SimplifyMesh: invalid input mesh");
+        return false;
+    }
+
+    try {
+        const size_t vertexCount = mesh.getVertexCount();
+        lod::MeshView view;
+        view.points = mesh.points.data();
+        view.vertexCount = vertexCount;
+        view.indices = mesh.indices.data();
+        view.indexCount = mesh.indices.size();
+        // Attributes that are not per-vertex cannot be averaged per cluster
+        view.normals = mesh.normals.size() == vertexCount * 3 ? mesh.normals.data() : nullptr;
+        view.uvs = mesh.uvs.size() == vertexCount * 2 ? mesh.uvs.data() : nullptr;
+        view.colors = mesh.vertex_colors.size() == vertexCount * 4 ? mesh.vertex_colors.data() : nullptr;
+
+        lod::SimplifiedMesh simplified;
+        if (!lod::simplifyToTarget(view, targetTriangles, simplified)) {
+            return false;
+        }
+
+        outMesh.elementName = mesh.elementName;
+        outMesh.typeName = mesh.typeName;
+        outMesh.points = std::move(simplified.points);
+        outMesh.indices = std::move(simplified.indices);
+        outMesh.normals = std::move(simplified.normals);
+        outMesh.uvs = std::move(simplified.uvs);
+        outMesh.vertex_colors = std::move(simplified.colors);
+        outMesh.instance_transforms = mesh.instance_transforms;
+        return true;
+    } catch (const std::exception& e) {
+        MIDDLEWARE_LOG_ERROR("Exception in SimplifyMesh: %s", e.what());
+        return false;
+    }
+}
+
+bool AnariUsdMiddleware::EncodeMeshContainer(const std::vector<MeshData>& meshes, std::vector<uint8_t>& outBuffer) {
+    try {
+        std::vector<container::MeshView> views;
+        return describeMeshes(meshes, false, views) && container::encode(views.data(), views.size(), outBuffer);
+    } catch (const std::exception& e) {
+        MIDDLEWARE_LOG_ERROR("Exception in EncodeMeshContainer: %s", e.what());
+        return false;
+    }
+}
+
+bool AnariUsdMiddleware::computeSceneDelta(const std::string& fileName, const std::vector<MeshData>& meshes,
+                                           SceneDelta& outDelta) {
+    return pImpl->computeSceneDelta(fileName, meshes, outDelta);
+}
+
+void AnariUsdMiddleware::clearSceneHistory() {
+    pImpl->clearSceneHistory();
+}
+
 bool AnariUsdMiddleware::startReceiving() {
     return pImpl->startReceiving();
 }
@@ -975,12 +3399,22 @@ void AnariUsdMiddleware::stopReceiving() {
 }
 
 AnariUsdMiddleware::TextureData AnariUsdMiddleware::CreateTextureFromBuffer(const std::vector<uint8_t>& buffer) {
-    return pImpl->CreateTextureFromBuffer(buffer);
+    return pImpl->CreateTextureFromBuffer(buffer.data(), buffer.size(), std::string());
+}
+
+AnariUsdMiddleware::TextureData AnariUsdMiddleware::CreateTextureFromBuffer(const uint8_t* data, size_t size,
+                                                                            const std::string& contentHash) {
+    return pImpl->CreateTextureFromBuffer(data, size, contentHash);
 }
 
 bool AnariUsdMiddleware::LoadUSDBuffer(const std::vector<uint8_t>& buffer, const std::string& fileName,
                                        std::vector<MeshData>& outMeshData) {
-    return pImpl->LoadUSDBuffer(buffer, fileName, outMeshData);
+    return pImpl->LoadUSDBuffer(buffer.data(), buffer.size(), fileName, outMeshData);
+}
+
+bool AnariUsdMiddleware::LoadUSDBuffer(const uint8_t* data, size_t size, const std::string& fileName,
+                                       std::vector<MeshData>& outMeshData) {
+    return pImpl->LoadUSDBuffer(data, size, fileName, outMeshData);
 }
 
 bool AnariUsdMiddleware::LoadUSDFromDisk(const std::string& filePath,
@@ -988,6 +3422,67 @@ bool AnariUsdMiddleware::LoadUSDFromDisk(const std::string& filePath,
     return pImpl->LoadUSDFromDisk(filePath, outMeshData);
 }
 
+bool AnariUsdMiddleware::LoadUSDBufferStreaming(const uint8_t* data, size_t size, const std::string& fileName,
+                                                const MeshStreamCallback& onMesh) {
+    return pImpl->StreamUSDBuffer(data, size, fileName, onMesh);
+}
+
+bool AnariUsdMiddleware::LoadUSDFromDiskStreaming(const std::string& filePath, const MeshStreamCallback& onMesh) {
+    return pImpl->StreamUSDFromDisk(filePath, onMesh);
+}
+
+AnariUsdMiddleware::LoadId AnariUsdMiddleware::LoadUSDBufferAsync(FilePayload buffer, const std::string& fileName,
+                                                                  const AsyncLoadOptions& options) {
+    return pImpl->submitLoad(std::move(buffer), fileName, false, options);
+}
+
+AnariUsdMiddleware::LoadId AnariUsdMiddleware::LoadUSDFromDiskAsync(const std::string& filePath,
+                                                                    const AsyncLoadOptions& options) {
+    return pImpl->submitLoad(FilePayload(), filePath, true, options);
+}
+
+bool AnariUsdMiddleware::getLoadStatus(LoadId id, LoadState& outState, float& outProgress) const {
+    return pImpl->getLoadStatus(id, outState, outProgress);
+}
+
+bool AnariUsdMiddleware::waitForLoad(LoadId id, int timeoutMs) {
+    return pImpl->waitForLoad(id, timeoutMs);
+}
+
+bool AnariUsdMiddleware::takeLoadResult(LoadId id, std::vector<MeshData>& outMeshData) {
+    return pImpl->takeLoadResult(id, outMeshData);
+}
+
+bool AnariUsdMiddleware::cancelLoad(LoadId id) {
+    return pImpl->cancelLoad(id);
+}
+
+void AnariUsdMiddleware::releaseLoad(LoadId id) {
+    pImpl->releaseLoad(id);
+}
+
+void AnariUsdMiddleware::setAsyncLoadWorkers(size_t workerCount) {
+    pImpl->setAsyncLoadWorkers(workerCount);
+}
+
+bool AnariUsdMiddleware::LoadUSDBufferToArena(const std::vector<uint8_t>& buffer, const std::string& fileName,
+                                              const ArenaAllocator& allocate, MeshArena& outArena,
+                                              size_t headerBytesPerMesh) {
+    return pImpl->LoadUSDBufferToArena(buffer.data(), buffer.size(), fileName, allocate, outArena,
+                                       headerBytesPerMesh);
+}
+
+bool AnariUsdMiddleware::LoadUSDBufferToArena(const uint8_t* data, size_t size, const std::string& fileName,
+                                              const ArenaAllocator& allocate, MeshArena& outArena,
+                                              size_t headerBytesPerMesh) {
+    return pImpl->LoadUSDBufferToArena(data, size, fileName, allocate, outArena, headerBytesPerMesh);
+}
+
+bool AnariUsdMiddleware::LoadUSDFromDiskToArena(const std::string& filePath, const ArenaAllocator& allocate,
+                                                MeshArena& outArena, size_t headerBytesPerMesh) {
+    return pImpl->LoadUSDFromDiskToArena(filePath, allocate, outArena, headerBytesPerMesh);
+}
+
 bool AnariUsdMiddleware::WriteGradientLineAsPNG(const std::vector<uint8_t>& buffer, const std::string& outPath) {
     return pImpl->WriteGradientLineAsPNG(buffer, outPath);
 }
@@ -997,11 +3492,134 @@ bool AnariUsdMiddleware::GetGradientLineAsPNGBuffer(const std::vector<uint8_t>&
     return pImpl->GetGradientLineAsPNGBuffer(buffer, outPngBuffer);
 }
 
+void AnariUsdMiddleware::setMaxMessagesPerWakeup(size_t maxMessages) {
+    pImpl->setMaxMessagesPerWakeup(maxMessages);
+}
+
+size_t AnariUsdMiddleware::getMaxMessagesPerWakeup() const {
+    return pImpl->getMaxMessagesPerWakeup();
+}
+
+void AnariUsdMiddleware::setReceiveIoThreads(int threads) {
+    pImpl->setReceiveIoThreads(threads);
+}
+
+void AnariUsdMiddleware::setReceiveHighWaterMark(int messages) {
+    pImpl->setReceiveHighWaterMark(messages);
+}
+
+std::vector<AnariUsdMiddleware::ThroughputStats> AnariUsdMiddleware::getEndpointStats() const {
+    return pImpl->getEndpointStats();
+}
+
+std::vector<AnariUsdMiddleware::ThroughputStats> AnariUsdMiddleware::getClientStats() const {
+    return pImpl->getClientStats();
+}
+
+void AnariUsdMiddleware::setPipelineWorkers(size_t workerCount) {
+    pImpl->setPipelineWorkers(workerCount);
+}
+
+void AnariUsdMiddleware::setUsdWorkerThreads(size_t threadCount) {
+    pImpl->setUsdWorkerThreads(threadCount);
+}
+
+void AnariUsdMiddleware::setInstancingEnabled(bool enable) {
+    pImpl->setInstancingEnabled(enable);
+}
+
+void AnariUsdMiddleware::setLocalSpaceEnabled(bool enable) {
+    pImpl->setLocalSpaceEnabled(enable);
+}
+
+void AnariUsdMiddleware::setMeshOptimizationEnabled(bool enable) {
+    pImpl->setMeshOptimizationEnabled(enable);
+}
+
+void AnariUsdMiddleware::setWeldEpsilon(float epsilon) {
+    pImpl->setWeldEpsilon(epsilon);
+}
+
+void AnariUsdMiddleware::setTimeCode(double timeCode) {
+    pImpl->setTimeCode(timeCode);
+}
+
+bool AnariUsdMiddleware::EvaluateTransforms(const uint8_t* data, size_t size, const std::string& fileName,
+                                            double timeCode, std::vector<MeshTransform>& outTransforms) {
+    return pImpl->EvaluateTransforms(data, size, fileName, timeCode, outTransforms);
+}
+
+void AnariUsdMiddleware::setPipelineQueueCapacity(size_t capacity) {
+    pImpl->setPipelineQueueCapacity(capacity);
+}
+
+void AnariUsdMiddleware::setPipelineStallTimeout(int timeoutMs) {
+    pImpl->setPipelineStallTimeout(timeoutMs);
+}
+
+void AnariUsdMiddleware::setDedupCacheCapacity(size_t entries) {
+    pImpl->setDedupCacheCapacity(entries);
+}
+
+void AnariUsdMiddleware::setMeshCacheLimits(size_t maxEntries, size_t maxBytes) {
+    pImpl->setMeshCacheLimits(maxEntries, maxBytes);
+}
+
+void AnariUsdMiddleware::setTextureCacheLimits(size_t maxEntries, size_t maxBytes) {
+    pImpl->setTextureCacheLimits(maxEntries, maxBytes);
+}
+
+bool AnariUsdMiddleware::setTextureCacheDirectory(const std::string& directory) {
+    return pImpl->setTextureCacheDirectory(directory);
+}
+
+bool AnariUsdMiddleware::setMeshDiskCache(const std::string& directory, uint64_t maxBytes) {
+    return pImpl->setMeshDiskCache(directory, maxBytes);
+}
+
+void AnariUsdMiddleware::clearMeshDiskCache() {
+    pImpl->clearMeshDiskCache();
+}
+
+void AnariUsdMiddleware::clearCaches() {
+    pImpl->clearCaches();
+}
+
+AnariUsdMiddleware::CacheStats AnariUsdMiddleware::getCacheStats() const {
+    return pImpl->getCacheStats();
+}
+
+std::vector<profiling::StageProfiler::StageStats> AnariUsdMiddleware::getStageStats() const {
+    return pImpl->getStageStats();
+}
+
+void AnariUsdMiddleware::resetStageStats() {
+    pImpl->resetStageStats();
+}
+
+void AnariUsdMiddleware::setTraceCapture(bool enable, size_t maxEvents) {
+    pImpl->setTraceCapture(enable, maxEvents);
+}
+
+bool AnariUsdMiddleware::writeTrace(const std::string& path) const {
+    if (path.empty()) {
+        MIDDLEWARE_LOG_ERROR("Trace path cannot be empty");
+        return false;
+    }
+    try {
+        return pImpl->writeTrace(path);
+    } catch (const std::exception& e) {
+        MIDDLEWARE_LOG_ERROR("Exception writing trace %s: %s", path.c_str(), e.what());
+        return false;
+    }
+}
+
 std::string AnariUsdMiddleware::getStatusInfo() const {
     try {
         std::ostringstream status;
         status << "AnariUsdMiddleware Status:\n";
         status << "  Connected: " << (isConnected() ? "Yes" : "No") << "\n";
+        pImpl->appendStatusInfo(status);
         return status.str();
     } catch (const std::exception& e) {
         return "Error getting status: " + std::string(e.what());
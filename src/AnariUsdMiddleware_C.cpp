@@ -1,8 +1,12 @@
 #include "AnariUsdMiddleware_C.h"
 #include "AnariUsdMiddleware.h"
+#include "MeshKernels.h"
+#include "TexturePipeline.h"
 #include <memory>
 #include <string>
+#include <cstdlib>
 #include <cstring>
+#include <functional>
 
 // ============================================================================
 // GLOBAL STATE MANAGEMENT
@@ -14,6 +18,122 @@ static std::unique_ptr<anari_usd_middleware::AnariUsdMiddleware> g_middleware;
 // Global callback storage - maintains C callback function pointers
 static FileReceivedCallback_C g_file_callback = nullptr;
 static MessageReceivedCallback_C g_message_callback = nullptr;
+static SceneDeltaCallback_C g_scene_delta_callback = nullptr;
+static MeshLodCallback_C g_mesh_lod_callback = nullptr;
+
+// Receive socket settings, kept so they can be given before InitializeMiddleware_C (0 = default)
+static int g_io_threads = 0;
+static int g_receive_hwm = 0;
+
+// Apply socket settings given before the middleware instance existed
+static void applyReceiveSocketSettings() {
+    if (g_io_threads != 0) {
+        g_middleware->setReceiveIoThreads(g_io_threads);
+    }
+    if (g_receive_hwm != 0) {
+        g_middleware->setReceiveHighWaterMark(g_receive_hwm);
+    }
+}
+
+static size_t copyThroughputStats(const std::vector<anari_usd_middleware::AnariUsdMiddleware::ThroughputStats>& stats,
+                                  CThroughputStats* out_stats, size_t capacity) {
+    if (!out_stats) {
+        return stats.size();
+    }
+    for (size_t i = 0; i < stats.size() && i < capacity; ++i) {
+        CThroughputStats& out = out_stats[i];
+        out = {};
+        #ifdef _WIN32
+        strncpy_s(out.name, sizeof(out.name), stats[i].name.c_str(), 255);
+        strncpy_s(out.endpoint, sizeof(out.endpoint), stats[i].endpoint.c_str(), 255);
+        #else
+        std::strncpy(out.name, stats[i].name.c_str(), 255);
+        std::strncpy(out.endpoint, stats[i].endpoint.c_str(), 255);
+        #endif
+        out.messages = stats[i].messages;
+        out.bytes = stats[i].bytes;
+        out.bytes_per_second = stats[i].bytesPerSecond;
+    }
+    return stats.size();
+}
+
+// Expose a mesh's arrays without copying (valid while the mesh is alive)
+static CMeshData borrowMeshData(const anari_usd_middleware::AnariUsdMiddleware::MeshData& mesh) {
+    CMeshData c_mesh = {};
+    #ifdef _WIN32
+    strncpy_s(c_mesh.element_name, sizeof(c_mesh.element_name), mesh.elementName.c_str(), 255);
+    strncpy_s(c_mesh.type_name, sizeof(c_mesh.type_name), mesh.typeName.c_str(), 127);
+    #else
+    std::strncpy(c_mesh.element_name, mesh.elementName.c_str(), 255);
+    std::strncpy(c_mesh.type_name, mesh.typeName.c_str(), 127);
+    #endif
+
+    auto borrow = [](const auto& values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        return values.empty() ? nullptr : const_cast<T*>(values.data());
+    };
+    c_mesh.points = borrow(mesh.points);
+    c_mesh.points_count = mesh.points.size();
+    c_mesh.indices = reinterpret_cast<unsigned int*>(borrow(mesh.indices));
+    c_mesh.indices_count = mesh.indices.size();
+    c_mesh.normals = borrow(mesh.normals);
+    c_mesh.normals_count = mesh.normals.size();
+    c_mesh.uvs = borrow(mesh.uvs);
+    c_mesh.uvs_count = mesh.uvs.size();
+    c_mesh.vertex_colors = borrow(mesh.vertex_colors);
+    c_mesh.vertex_colors_count = mesh.vertex_colors.size();
+    c_mesh.instance_transforms = borrow(mesh.instance_transforms);
+    c_mesh.instance_transforms_count = mesh.instance_transforms.size();
+    return c_mesh;
+}
+
+static void forwardSceneDelta(const anari_usd_middleware::AnariUsdMiddleware::SceneDelta& delta) {
+    if (!g_scene_delta_callback) {
+        return;
+    }
+
+    auto toChanges = [](const std::vector<anari_usd_middleware::AnariUsdMiddleware::MeshChange>& changes) {
+        std::vector<CMeshChange> c_changes;
+        c_changes.reserve(changes.size());
+        for (const auto& change : changes) {
+            c_changes.push_back({change.key.c_str(), borrowMeshData(change.mesh), change.geometryChanged ? 1 : 0});
+        }
+        return c_changes;
+    };
+    std::vector<CMeshChange> added = toChanges(delta.added);
+    std::vector<CMeshChange> changed = toChanges(delta.changed);
+    std::vector<const char*> removed;
+    removed.reserve(delta.removed.size());
+    for (const auto& key : delta.removed) {
+        removed.push_back(key.c_str());
+    }
+
+    CSceneDelta c_delta = {};
+    c_delta.filename = delta.filename.c_str();
+    c_delta.revision = delta.revision;
+    c_delta.added = added.empty() ? nullptr : added.data();
+    c_delta.added_count = added.size();
+    c_delta.changed = changed.empty() ? nullptr : changed.data();
+    c_delta.changed_count = changed.size();
+    c_delta.removed = removed.empty() ? nullptr : removed.data();
+    c_delta.removed_count = removed.size();
+    c_delta.unchanged_count = delta.unchangedCount;
+    g_scene_delta_callback(&c_delta);
+}
+
+static void forwardMeshLod(const anari_usd_middleware::AnariUsdMiddleware::MeshLod& lod) {
+    if (!g_mesh_lod_callback) {
+        return;
+    }
+
+    CMeshLod c_lod = {};
+    c_lod.filename = lod.filename.c_str();
+    c_lod.key = lod.key.c_str();
+    c_lod.level = lod.level;
+    c_lod.level_count = lod.levelCount;
+    c_lod.mesh = borrowMeshData(lod.mesh);
+    g_mesh_lod_callback(&c_lod);
+}
 
 // ============================================================================
 // C INTERFACE IMPLEMENTATION
@@ -31,6 +151,7 @@ int InitializeMiddleware_C(const char* endpoint) {
         if (!g_middleware) {
             g_middleware = std::make_unique<anari_usd_middleware::AnariUsdMiddleware>();
         }
+        applyReceiveSocketSettings();
 
         // Use provided endpoint or default fallback
         std::string endpoint_str = endpoint ? endpoint : "tcp://*:5556";
@@ -59,17 +180,13 @@ int InitializeMiddleware_C(const char* endpoint) {
                         c_data.file_type[31] = '\0';
                         #endif
 
-                        // Copy binary data safely
-                        c_data.data_size = file_data.data.size();
-                        if (c_data.data_size > 0) {
-                            c_data.data = new unsigned char[c_data.data_size];
-                            std::memcpy(c_data.data, file_data.data.data(), c_data.data_size);
-                        } else {
-                            c_data.data = nullptr;
-                        }
-
-                        // FIXED: Call the callback without immediately freeing memory
-                        // Memory will be cleaned up when Unreal calls FreeFileData_C
+                        // Expose the received bytes directly; the payload reference lets the
+                        // consumer retain them past the callback without a copy
+                        anari_usd_middleware::FilePayload payload = file_data.data;
+                        c_data.data = payload.empty() ? nullptr : payload.data();
+                        c_data.data_size = payload.size();
+                        c_data.payload = &payload;
+
                         g_file_callback(&c_data);
                     }
                 });
@@ -83,6 +200,16 @@ int InitializeMiddleware_C(const char* endpoint) {
                     }
                 });
             }
+
+            // Register scene delta callback if available
+            if (g_scene_delta_callback) {
+                g_middleware->registerSceneDeltaCallback(forwardSceneDelta);
+            }
+
+            // Register LOD callback if available
+            if (g_mesh_lod_callback) {
+                g_middleware->registerMeshLodCallback(forwardMeshLod);
+            }
         }
 
         return result ? 1 : 0;
@@ -104,6 +231,8 @@ void ShutdownMiddleware_C() {
     // Clear callback pointers
     g_file_callback = nullptr;
     g_message_callback = nullptr;
+    g_scene_delta_callback = nullptr;
+    g_mesh_lod_callback = nullptr;
 }
 
 /**
@@ -145,205 +274,666 @@ void StopReceiving_C() {
 }
 
 /**
- * Load USD data from memory buffer and extract mesh geometry
- * ENHANCED: Now includes vertex color extraction for Unreal RealtimeMesh
+ * Set the receiver's per-wakeup drain limit
+ * Invalid values are rejected and logged by the middleware
  */
-int LoadUSDBuffer_C(const unsigned char* buffer, size_t buffer_size, const char* filename,
-                   CMeshData** out_meshes, size_t* out_count) {
-    // Validate input parameters
-    if (!g_middleware || !buffer || !filename || !out_meshes || !out_count) {
+void SetMaxMessagesPerWakeup_C(size_t max_messages) {
+    if (g_middleware) {
+        g_middleware->setMaxMessagesPerWakeup(max_messages);
+    }
+}
+
+/**
+ * Remember the receive socket settings for the next initialization
+ * Invalid values are rejected and logged by the middleware
+ */
+void ConfigureReceiveSockets_C(int io_threads, int high_water_mark) {
+    if (io_threads != 0) {
+        g_io_threads = io_threads;
+    }
+    if (high_water_mark != 0) {
+        g_receive_hwm = high_water_mark;
+    }
+    if (g_middleware) {
+        applyReceiveSocketSettings();
+    }
+}
+
+size_t GetEndpointStats_C(CThroughputStats* out_stats, size_t capacity) {
+    if (!g_middleware) {
         return 0;
     }
 
     try {
-        // Convert C types to C++ types
-        std::vector<unsigned char> std_buffer(buffer, buffer + buffer_size);
-        std::string std_filename(filename);
-        std::vector<anari_usd_middleware::AnariUsdMiddleware::MeshData> mesh_data;
+        return copyThroughputStats(g_middleware->getEndpointStats(), out_stats, capacity);
+    } catch (...) {
+        return 0;
+    }
+}
+
+size_t GetClientStats_C(CThroughputStats* out_stats, size_t capacity) {
+    if (!g_middleware) {
+        return 0;
+    }
 
-        // Call middleware USD processing
-        bool result = g_middleware->LoadUSDBuffer(std_buffer, std_filename, mesh_data);
+    try {
+        return copyThroughputStats(g_middleware->getClientStats(), out_stats, capacity);
+    } catch (...) {
+        return 0;
+    }
+}
 
-        if (!result || mesh_data.empty()) {
-            *out_count = 0;
-            *out_meshes = nullptr;
-            return 0;
-        }
+/**
+ * Configure the worker pipeline
+ * Invalid values are rejected and logged by the middleware
+ */
+void ConfigurePipeline_C(size_t workers, size_t queue_capacity, int stall_timeout_ms) {
+    if (g_middleware) {
+        g_middleware->setPipelineWorkers(workers);
+        g_middleware->setPipelineQueueCapacity(queue_capacity);
+        g_middleware->setPipelineStallTimeout(stall_timeout_ms);
+    }
+}
+
+void SetUsdWorkerThreads_C(size_t thread_count) {
+    if (g_middleware) {
+        g_middleware->setUsdWorkerThreads(thread_count);
+    }
+}
+
+void SetInstancingEnabled_C(int enable) {
+    if (g_middleware) {
+        g_middleware->setInstancingEnabled(enable != 0);
+    }
+}
+
+void SetLocalSpaceEnabled_C(int enable) {
+    if (g_middleware) {
+        g_middleware->setLocalSpaceEnabled(enable != 0);
+    }
+}
+
+void SetMeshOptimizationEnabled_C(int enable) {
+    if (g_middleware) {
+        g_middleware->setMeshOptimizationEnabled(enable != 0);
+    }
+}
+
+void SetWeldEpsilon_C(float epsilon) {
+    if (g_middleware) {
+        g_middleware->setWeldEpsilon(epsilon);
+    }
+}
+
+void SetTimeCode_C(double time_code) {
+    if (g_middleware) {
+        g_middleware->setTimeCode(time_code);
+    }
+}
+
+/**
+ * Configure the dedup and mesh caches
+ * Invalid values are rejected and logged by the middleware
+ */
+void ConfigureCaches_C(size_t dedup_entries, size_t mesh_entries, size_t mesh_max_bytes) {
+    if (g_middleware) {
+        g_middleware->setDedupCacheCapacity(dedup_entries);
+        g_middleware->setMeshCacheLimits(mesh_entries, mesh_max_bytes);
+    }
+}
+
+int GetCacheStats_C(CCacheStats* out_stats) {
+    if (!g_middleware || !out_stats) {
+        return 0;
+    }
+
+    try {
+        auto stats = g_middleware->getCacheStats();
+        out_stats->dedup_hits = stats.dedupHits;
+        out_stats->dedup_misses = stats.dedupMisses;
+        out_stats->dedup_evictions = stats.dedupEvictions;
+        out_stats->dedup_entries = stats.dedupEntries;
+        out_stats->mesh_hits = stats.meshHits;
+        out_stats->mesh_misses = stats.meshMisses;
+        out_stats->mesh_evictions = stats.meshEvictions;
+        out_stats->mesh_entries = stats.meshEntries;
+        out_stats->mesh_bytes = stats.meshBytes;
+        out_stats->texture_hits = stats.textureHits;
+        out_stats->texture_misses = stats.textureMisses;
+        out_stats->texture_disk_hits = stats.textureDiskHits;
+        out_stats->texture_evictions = stats.textureEvictions;
+        out_stats->texture_entries = stats.textureEntries;
+        out_stats->texture_bytes = stats.textureBytes;
+        out_stats->texture_bytes_saved = stats.textureBytesSaved;
+        out_stats->mesh_disk_hits = stats.meshDiskHits;
+        out_stats->mesh_disk_misses = stats.meshDiskMisses;
+        out_stats->mesh_disk_stores = stats.meshDiskStores;
+        out_stats->mesh_disk_evictions = stats.meshDiskEvictions;
+        out_stats->mesh_disk_entries = stats.meshDiskEntries;
+        out_stats->mesh_disk_bytes = stats.meshDiskBytes;
+        return 1;
+    } catch (...) {
+        return 0;
+    }
+}
+
+int ConfigureTextureCache_C(size_t max_entries, size_t max_bytes, const char* directory) {
+    if (!g_middleware) {
+        return 0;
+    }
+
+    try {
+        g_middleware->setTextureCacheLimits(max_entries, max_bytes);
+        return g_middleware->setTextureCacheDirectory(directory ? directory : "") ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
 
-        // Allocate C mesh array
-        *out_count = mesh_data.size();
-        *out_meshes = new CMeshData[*out_count];
+int ConfigureMeshDiskCache_C(const char* directory, uint64_t max_bytes) {
+    if (!g_middleware) {
+        return 0;
+    }
+
+    try {
+        return g_middleware->setMeshDiskCache(directory ? directory : "", max_bytes) ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
+
+void ClearMeshDiskCache_C(void) {
+    if (g_middleware) {
+        g_middleware->clearMeshDiskCache();
+    }
+}
 
-        // Convert each mesh from C++ to C format
-        for (size_t i = 0; i < mesh_data.size(); ++i) {
-            const auto& src = mesh_data[i];
-            CMeshData& dst = (*out_meshes)[i];
+void ClearCaches_C(void) {
+    if (g_middleware) {
+        g_middleware->clearCaches();
+    }
+}
 
-            // Initialize all pointers to null for safety
-            dst.points = nullptr;
-            dst.indices = nullptr;
-            dst.normals = nullptr;
-            dst.uvs = nullptr;
-            dst.vertex_colors = nullptr;
+size_t GetStageStats_C(CStageStats* out_stats, size_t capacity) {
+    if (!g_middleware) {
+        return 0;
+    }
 
-            // Safe string copying with bounds checking
+    try {
+        const auto stages = g_middleware->getStageStats();
+        if (!out_stats) {
+            return stages.size();
+        }
+        for (size_t i = 0; i < stages.size() && i < capacity; ++i) {
+            CStageStats& out = out_stats[i];
+            out = {};
             #ifdef _WIN32
-            strncpy_s(dst.element_name, sizeof(dst.element_name), src.elementName.c_str(), 255);
-            strncpy_s(dst.type_name, sizeof(dst.type_name), src.typeName.c_str(), 127);
+            strncpy_s(out.name, sizeof(out.name), stages[i].name, sizeof(out.name) - 1);
             #else
-            std::strncpy(dst.element_name, src.elementName.c_str(), 255);
-            std::strncpy(dst.type_name, src.typeName.c_str(), 127);
-            dst.element_name[255] = '\0';
-            dst.type_name[127] = '\0';
+            std::strncpy(out.name, stages[i].name, sizeof(out.name) - 1);
             #endif
+            out.count = stages[i].count;
+            out.total_ns = stages[i].totalNs;
+            out.max_ns = stages[i].maxNs;
+            out.p50_ns = stages[i].p50Ns;
+            out.p95_ns = stages[i].p95Ns;
+            out.p99_ns = stages[i].p99Ns;
+        }
+        return stages.size();
+    } catch (...) {
+        return 0;
+    }
+}
 
-            // FIXED: Copy points (src.points is already a flat float array from middleware)
-            dst.points_count = src.points.size();
-            if (dst.points_count > 0) {
-                dst.points = new float[dst.points_count];
-                std::memcpy(dst.points, src.points.data(), dst.points_count * sizeof(float));
-            }
+void ResetStageStats_C(void) {
+    if (g_middleware) {
+        g_middleware->resetStageStats();
+    }
+}
 
-            // Copy triangle indices
-            dst.indices_count = src.indices.size();
-            if (dst.indices_count > 0) {
-                dst.indices = new unsigned int[dst.indices_count];
-                std::memcpy(dst.indices, src.indices.data(), dst.indices_count * sizeof(unsigned int));
-            }
+void SetTraceCapture_C(int enable, size_t max_events) {
+    if (g_middleware) {
+        g_middleware->setTraceCapture(enable != 0, max_events != 0 ? max_events :
+                                      anari_usd_middleware::profiling::StageProfiler::DEFAULT_TRACE_EVENTS);
+    }
+}
 
-            // FIXED: Copy normals (src.normals is already a flat float array from middleware)
-            dst.normals_count = src.normals.size();
-            if (dst.normals_count > 0) {
-                dst.normals = new float[dst.normals_count];
-                std::memcpy(dst.normals, src.normals.data(), dst.normals_count * sizeof(float));
-            }
+int WriteTrace_C(const char* path) {
+    if (!g_middleware || !path) {
+        return 0;
+    }
 
-            // FIXED: Copy UVs (src.uvs is already a flat float array from middleware)
-            dst.uvs_count = src.uvs.size();
-            if (dst.uvs_count > 0) {
-                dst.uvs = new float[dst.uvs_count];
-                std::memcpy(dst.uvs, src.uvs.data(), dst.uvs_count * sizeof(float));
-            }
+    try {
+        return g_middleware->writeTrace(path) ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
 
-            // ✅ NEW: Copy vertex colors (RGBA values from primvars:color.timeSamples)
-            // This is the missing piece that will fix your color display issue
-            dst.vertex_colors_count = src.vertex_colors.size();
-            if (dst.vertex_colors_count > 0) {
-                dst.vertex_colors = new float[dst.vertex_colors_count];
-                std::memcpy(dst.vertex_colors, src.vertex_colors.data(),
-                           dst.vertex_colors_count * sizeof(float));
-            }
+void ClearSceneHistory_C(void) {
+    if (g_middleware) {
+        g_middleware->clearSceneHistory();
+    }
+}
+
+void SetLodOptions_C(unsigned int level_count, size_t min_triangles) {
+    if (g_middleware) {
+        g_middleware->setLodOptions(level_count, min_triangles);
+    }
+}
+
+/**
+ * Fill the CMeshData headers reserved at the front of an arena
+ * Attribute pointers point into the same allocation, so one free releases everything
+ */
+static CMeshData* fillMeshHeaders(const anari_usd_middleware::AnariUsdMiddleware::MeshArena& arena) {
+    CMeshData* headers = reinterpret_cast<CMeshData*>(arena.data);
+
+    for (size_t i = 0; i < arena.meshes.size(); ++i) {
+        const auto& src = arena.meshes[i];
+        CMeshData& dst = headers[i];
+
+        // Safe string copying with bounds checking
+        #ifdef _WIN32
+        strncpy_s(dst.element_name, sizeof(dst.element_name), src.elementName.c_str(), 255);
+        strncpy_s(dst.type_name, sizeof(dst.type_name), src.typeName.c_str(), 127);
+        #else
+        std::strncpy(dst.element_name, src.elementName.c_str(), 255);
+        std::strncpy(dst.type_name, src.typeName.c_str(), 127);
+        dst.element_name[255] = '\0';
+        dst.type_name[127] = '\0';
+        #endif
+
+        dst.points = src.pointsCount ? arena.at<float>(src.pointsOffset) : nullptr;
+        dst.points_count = src.pointsCount;
+        dst.indices = src.indicesCount ? arena.at<unsigned int>(src.indicesOffset) : nullptr;
+        dst.indices_count = src.indicesCount;
+        dst.normals = src.normalsCount ? arena.at<float>(src.normalsOffset) : nullptr;
+        dst.normals_count = src.normalsCount;
+        dst.uvs = src.uvsCount ? arena.at<float>(src.uvsOffset) : nullptr;
+        dst.uvs_count = src.uvsCount;
+        dst.vertex_colors = src.colorsCount ? arena.at<float>(src.colorsOffset) : nullptr;
+        dst.vertex_colors_count = src.colorsCount;
+        dst.instance_transforms = src.instancesCount ? arena.at<float>(src.instancesOffset) : nullptr;
+        dst.instance_transforms_count = src.instancesCount;
+    }
+
+    return headers;
+}
+
+/**
+ * Shared body of the LoadUSD*_C functions: load into one arena with room for the headers
+ */
+using ArenaLoadFn = std::function<bool(const anari_usd_middleware::AnariUsdMiddleware::ArenaAllocator&,
+                                       anari_usd_middleware::AnariUsdMiddleware::MeshArena&, size_t)>;
+
+static int loadMeshesToArena(const ArenaLoadFn& load, MeshArenaAllocator_C allocator, void* user_data,
+                             CMeshData** out_meshes, size_t* out_count) {
+    *out_count = 0;
+    *out_meshes = nullptr;
+
+    try {
+        anari_usd_middleware::AnariUsdMiddleware::ArenaAllocator allocate;
+        if (allocator) {
+            allocate = [allocator, user_data](size_t bytes) { return allocator(bytes, user_data); };
+        } else {
+            allocate = [](size_t bytes) { return std::malloc(bytes); };
+        }
+
+        anari_usd_middleware::AnariUsdMiddleware::MeshArena arena;
+        if (!load(allocate, arena, sizeof(CMeshData)) || arena.meshes.empty()) {
+            return 0;
         }
 
+        *out_meshes = fillMeshHeaders(arena);
+        *out_count = arena.meshes.size();
         return 1;
     } catch (...) {
-        // Cleanup on exception
         *out_count = 0;
         *out_meshes = nullptr;
         return 0;
     }
 }
 
+/**
+ * Load USD data from memory buffer and extract mesh geometry
+ * All meshes and attributes are returned in a single allocation
+ */
+int LoadUSDBuffer_C(const unsigned char* buffer, size_t buffer_size, const char* filename,
+                   CMeshData** out_meshes, size_t* out_count) {
+    return LoadUSDBufferWithAllocator_C(buffer, buffer_size, filename, nullptr, nullptr, out_meshes, out_count);
+}
+
+int LoadUSDBufferWithAllocator_C(const unsigned char* buffer, size_t buffer_size, const char* filename,
+                                 MeshArenaAllocator_C allocator, void* user_data,
+                                 CMeshData** out_meshes, size_t* out_count) {
+    // Validate input parameters
+    if (!g_middleware || !buffer || !filename || !out_meshes || !out_count) {
+        return 0;
+    }
+
+    std::string std_filename(filename);
+    return loadMeshesToArena(
+        [&](const anari_usd_middleware::AnariUsdMiddleware::ArenaAllocator& allocate,
+            anari_usd_middleware::AnariUsdMiddleware::MeshArena& arena, size_t header_bytes) {
+            return g_middleware->LoadUSDBufferToArena(buffer, buffer_size, std_filename, allocate, arena, header_bytes);
+        },
+        allocator, user_data, out_meshes, out_count);
+}
+
 /**
  * Load USD data directly from disk file
- * ENHANCED: Now includes vertex color extraction for Unreal RealtimeMesh
+ * All meshes and attributes are returned in a single allocation
  */
 int LoadUSDFromDisk_C(const char* filepath, CMeshData** out_meshes, size_t* out_count) {
+    return LoadUSDFromDiskWithAllocator_C(filepath, nullptr, nullptr, out_meshes, out_count);
+}
+
+int LoadUSDFromDiskWithAllocator_C(const char* filepath, MeshArenaAllocator_C allocator, void* user_data,
+                                   CMeshData** out_meshes, size_t* out_count) {
     // Validate input parameters
     if (!g_middleware || !filepath || !out_meshes || !out_count) {
         return 0;
     }
 
+    std::string std_filepath(filepath);
+    return loadMeshesToArena(
+        [&](const anari_usd_middleware::AnariUsdMiddleware::ArenaAllocator& allocate,
+            anari_usd_middleware::AnariUsdMiddleware::MeshArena& arena, size_t header_bytes) {
+            return g_middleware->LoadUSDFromDiskToArena(std_filepath, allocate, arena, header_bytes);
+        },
+        allocator, user_data, out_meshes, out_count);
+}
+
+/**
+ * Hand each streamed mesh to the C callback as a borrowed view
+ */
+static anari_usd_middleware::AnariUsdMiddleware::MeshStreamCallback toMeshStreamCallback(
+    MeshStreamCallback_C on_mesh, void* user_data) {
+    return [on_mesh, user_data](anari_usd_middleware::AnariUsdMiddleware::MeshData&& mesh) {
+        CMeshData borrowed = borrowMeshData(mesh);
+        return on_mesh(&borrowed, user_data) != 0;
+    };
+}
+
+int LoadUSDBufferStreaming_C(const unsigned char* buffer, size_t buffer_size, const char* filename,
+                             MeshStreamCallback_C on_mesh, void* user_data) {
+    if (!g_middleware || !buffer || !filename || !on_mesh) {
+        return 0;
+    }
+
     try {
-        // Convert C types to C++ types
-        std::string std_filepath(filepath);
-        std::vector<anari_usd_middleware::AnariUsdMiddleware::MeshData> mesh_data;
+        return g_middleware->LoadUSDBufferStreaming(buffer, buffer_size, filename,
+                                                    toMeshStreamCallback(on_mesh, user_data)) ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
 
-        // Call middleware USD processing
-        bool result = g_middleware->LoadUSDFromDisk(std_filepath, mesh_data);
+int LoadUSDFromDiskStreaming_C(const char* filepath, MeshStreamCallback_C on_mesh, void* user_data) {
+    if (!g_middleware || !filepath || !on_mesh) {
+        return 0;
+    }
 
-        if (!result || mesh_data.empty()) {
-            *out_count = 0;
-            *out_meshes = nullptr;
-            return 0;
+    try {
+        return g_middleware->LoadUSDFromDiskStreaming(filepath, toMeshStreamCallback(on_mesh, user_data)) ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
+
+/**
+ * Run a task handed to a LoadExecutor_C and free it
+ */
+static void runLoadTask(void* task_data) {
+    std::unique_ptr<std::function<void()>> task(static_cast<std::function<void()>*>(task_data));
+    if (task && *task) {
+        (*task)();
+    }
+}
+
+/**
+ * Wrap the C callbacks of an asynchronous load; NULL options behave as all zero
+ */
+static anari_usd_middleware::AnariUsdMiddleware::AsyncLoadOptions toAsyncLoadOptions(const CAsyncLoadOptions* options) {
+    using Middleware = anari_usd_middleware::AnariUsdMiddleware;
+    Middleware::AsyncLoadOptions converted;
+    converted.cancelPrevious = false;
+    if (!options) {
+        return converted;
+    }
+
+    const CAsyncLoadOptions c_options = *options;
+    converted.cancelPrevious = c_options.cancel_previous != 0;
+    if (c_options.on_complete) {
+        converted.onComplete = [c_options](Middleware::LoadId id, Middleware::LoadState state,
+                                           std::vector<Middleware::MeshData>& meshes) {
+            std::vector<CMeshData> borrowed;
+            borrowed.reserve(meshes.size());
+            for (const auto& mesh : meshes) {
+                borrowed.push_back(borrowMeshData(mesh));
+            }
+            c_options.on_complete(id, static_cast<CLoadState>(state), borrowed.empty() ? nullptr : borrowed.data(),
+                                  borrowed.size(), c_options.user_data);
+        };
+    }
+    if (c_options.on_progress) {
+        converted.onProgress = [c_options](Middleware::LoadId id, float progress, const std::string& stage) {
+            c_options.on_progress(id, progress, stage.c_str(), c_options.user_data);
+        };
+    }
+    if (c_options.on_mesh) {
+        converted.onMesh = toMeshStreamCallback(c_options.on_mesh, c_options.user_data);
+    }
+    if (c_options.executor) {
+        converted.executor = [c_options](std::function<void()> task) {
+            c_options.executor(&runLoadTask, new std::function<void()>(std::move(task)), c_options.user_data);
+        };
+    }
+    return converted;
+}
+
+/**
+ * Copy meshes into one malloc'd block laid out like the LoadUSD*_C results
+ */
+static int packMeshData(const std::vector<anari_usd_middleware::AnariUsdMiddleware::MeshData>& meshes,
+                        CMeshData** out_meshes, size_t* out_count) {
+    const size_t alignment = anari_usd_middleware::AnariUsdMiddleware::ARENA_ALIGNMENT;
+    auto padded = [alignment](size_t bytes) { return (bytes + alignment - 1) & ~(alignment - 1); };
+    auto arrayBytes = [](const auto& values) { return values.size() * sizeof(values[0]); };
+
+    size_t total = padded(meshes.size() * sizeof(CMeshData));
+    for (const auto& mesh : meshes) {
+        total += padded(arrayBytes(mesh.points)) + padded(arrayBytes(mesh.indices)) +
+                 padded(arrayBytes(mesh.normals)) + padded(arrayBytes(mesh.uvs)) +
+                 padded(arrayBytes(mesh.vertex_colors)) + padded(arrayBytes(mesh.instance_transforms));
+    }
+
+    uint8_t* block = static_cast<uint8_t*>(std::malloc(total));
+    if (!block) {
+        return 0;
+    }
+
+    CMeshData* headers = reinterpret_cast<CMeshData*>(block);
+    uint8_t* cursor = block + padded(meshes.size() * sizeof(CMeshData));
+    auto place = [&](const auto& values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        if (values.empty()) {
+            return static_cast<T*>(nullptr);
         }
+        T* dst = reinterpret_cast<T*>(cursor);
+        std::memcpy(dst, values.data(), arrayBytes(values));
+        cursor += padded(arrayBytes(values));
+        return dst;
+    };
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        CMeshData& dst = headers[i];
+        dst = borrowMeshData(meshes[i]);
+        dst.points = place(meshes[i].points);
+        dst.indices = reinterpret_cast<unsigned int*>(place(meshes[i].indices));
+        dst.normals = place(meshes[i].normals);
+        dst.uvs = place(meshes[i].uvs);
+        dst.vertex_colors = place(meshes[i].vertex_colors);
+        dst.instance_transforms = place(meshes[i].instance_transforms);
+    }
 
-        // Allocate C mesh array
-        *out_count = mesh_data.size();
-        *out_meshes = new CMeshData[*out_count];
+    *out_meshes = headers;
+    *out_count = meshes.size();
+    return 1;
+}
 
-        // Convert each mesh from C++ to C format
-        for (size_t i = 0; i < mesh_data.size(); ++i) {
-            const auto& src = mesh_data[i];
-            CMeshData& dst = (*out_meshes)[i];
+/**
+ * Queue an asynchronous load of a copy of the buffer
+ */
+uint64_t LoadUSDBufferAsync_C(const unsigned char* buffer, size_t buffer_size, const char* filename,
+                              const CAsyncLoadOptions* options) {
+    if (!g_middleware || !buffer || buffer_size == 0 || !filename) {
+        return 0;
+    }
 
-            // Initialize all pointers to null for safety
-            dst.points = nullptr;
-            dst.indices = nullptr;
-            dst.normals = nullptr;
-            dst.uvs = nullptr;
-            dst.vertex_colors = nullptr;
+    try {
+        std::vector<uint8_t> copy(buffer, buffer + buffer_size);
+        return g_middleware->LoadUSDBufferAsync(anari_usd_middleware::FilePayload::fromVector(std::move(copy)),
+                                                filename, toAsyncLoadOptions(options));
+    } catch (...) {
+        return 0;
+    }
+}
 
-            // Safe string copying with bounds checking
-            #ifdef _WIN32
-            strncpy_s(dst.element_name, sizeof(dst.element_name), src.elementName.c_str(), 255);
-            strncpy_s(dst.type_name, sizeof(dst.type_name), src.typeName.c_str(), 127);
-            #else
-            std::strncpy(dst.element_name, src.elementName.c_str(), 255);
-            std::strncpy(dst.type_name, src.typeName.c_str(), 127);
-            dst.element_name[255] = '\0';
-            dst.type_name[127] = '\0';
-            #endif
+uint64_t LoadUSDFromDiskAsync_C(const char* filepath, const CAsyncLoadOptions* options) {
+    if (!g_middleware || !filepath) {
+        return 0;
+    }
 
-            // FIXED: Direct memory copy for flat arrays (already processed by middleware)
-            dst.points_count = src.points.size();
-            if (dst.points_count > 0) {
-                dst.points = new float[dst.points_count];
-                std::memcpy(dst.points, src.points.data(), dst.points_count * sizeof(float));
-            }
+    try {
+        return g_middleware->LoadUSDFromDiskAsync(filepath, toAsyncLoadOptions(options));
+    } catch (...) {
+        return 0;
+    }
+}
 
-            dst.indices_count = src.indices.size();
-            if (dst.indices_count > 0) {
-                dst.indices = new unsigned int[dst.indices_count];
-                std::memcpy(dst.indices, src.indices.data(), dst.indices_count * sizeof(unsigned int));
-            }
+int GetLoadStatus_C(uint64_t load_id, CLoadState* out_state, float* out_progress) {
+    if (!g_middleware) {
+        return 0;
+    }
 
-            dst.normals_count = src.normals.size();
-            if (dst.normals_count > 0) {
-                dst.normals = new float[dst.normals_count];
-                std::memcpy(dst.normals, src.normals.data(), dst.normals_count * sizeof(float));
-            }
+    anari_usd_middleware::AnariUsdMiddleware::LoadState state;
+    float progress = 0.0f;
+    if (!g_middleware->getLoadStatus(load_id, state, progress)) {
+        return 0;
+    }
+    if (out_state) {
+        *out_state = static_cast<CLoadState>(state);
+    }
+    if (out_progress) {
+        *out_progress = progress;
+    }
+    return 1;
+}
 
-            dst.uvs_count = src.uvs.size();
-            if (dst.uvs_count > 0) {
-                dst.uvs = new float[dst.uvs_count];
-                std::memcpy(dst.uvs, src.uvs.data(), dst.uvs_count * sizeof(float));
-            }
+int WaitForLoad_C(uint64_t load_id, int timeout_ms) {
+    return g_middleware && g_middleware->waitForLoad(load_id, timeout_ms) ? 1 : 0;
+}
 
-            // ✅ NEW: Copy vertex colors (RGBA values from primvars:color.timeSamples)
-            // This enables vertex colors from USD files in Unreal Engine
-            dst.vertex_colors_count = src.vertex_colors.size();
-            if (dst.vertex_colors_count > 0) {
-                dst.vertex_colors = new float[dst.vertex_colors_count];
-                std::memcpy(dst.vertex_colors, src.vertex_colors.data(),
-                           dst.vertex_colors_count * sizeof(float));
-            }
+int TakeLoadResult_C(uint64_t load_id, CMeshData** out_meshes, size_t* out_count) {
+    if (!g_middleware || !out_meshes || !out_count) {
+        return 0;
+    }
+    *out_meshes = nullptr;
+    *out_count = 0;
+
+    try {
+        std::vector<anari_usd_middleware::AnariUsdMiddleware::MeshData> meshes;
+        if (!g_middleware->takeLoadResult(load_id, meshes) || meshes.empty()) {
+            return 0;
         }
+        return packMeshData(meshes, out_meshes, out_count);
+    } catch (...) {
+        return 0;
+    }
+}
 
+int CancelLoad_C(uint64_t load_id) {
+    return g_middleware && g_middleware->cancelLoad(load_id) ? 1 : 0;
+}
+
+void ReleaseLoad_C(uint64_t load_id) {
+    if (g_middleware) {
+        g_middleware->releaseLoad(load_id);
+    }
+}
+
+void SetAsyncLoadWorkers_C(size_t worker_count) {
+    if (g_middleware) {
+        g_middleware->setAsyncLoadWorkers(worker_count);
+    }
+}
+
+/**
+ * Evaluate mesh prim world transforms without extracting geometry
+ */
+int EvaluateTransforms_C(const unsigned char* buffer, size_t buffer_size, const char* filename,
+                         double time_code, CMeshTransform** out_transforms, size_t* out_count) {
+    if (!out_transforms || !out_count) {
+        return 0;
+    }
+    *out_transforms = nullptr;
+    *out_count = 0;
+
+    if (!g_middleware || !buffer || !filename) {
+        return 0;
+    }
+
+    try {
+        std::vector<anari_usd_middleware::AnariUsdMiddleware::MeshTransform> transforms;
+        if (!g_middleware->EvaluateTransforms(buffer, buffer_size, filename, time_code, transforms)) {
+            return 0;
+        }
+        if (transforms.empty()) {
+            return 1;
+        }
+
+        CMeshTransform* result = new CMeshTransform[transforms.size()];
+        for (size_t i = 0; i < transforms.size(); ++i) {
+            #ifdef _WIN32
+            strncpy_s(result[i].key, sizeof(result[i].key), transforms[i].key.c_str(), 255);
+            #else
+            std::strncpy(result[i].key, transforms[i].key.c_str(), 255);
+            result[i].key[255] = '\0';
+            #endif
+            std::memcpy(result[i].matrix, transforms[i].matrix, sizeof(result[i].matrix));
+        }
+        *out_transforms = result;
+        *out_count = transforms.size();
         return 1;
     } catch (...) {
-        // Cleanup on exception
-        *out_count = 0;
-        *out_meshes = nullptr;
         return 0;
     }
 }
 
+/**
+ * Pack float RGBA vertex colors into 8-bit channels using the middleware's SIMD kernels
+ * Needs no initialized middleware
+ */
+void PackVertexColors_C(const float* rgba, size_t count, unsigned char* out_bytes, int bgra) {
+    if (!rgba || !out_bytes || count == 0) {
+        return;
+    }
+    anari_usd_middleware::kernels::packColors(rgba, out_bytes, count,
+        bgra ? anari_usd_middleware::kernels::ColorOrder::Bgra
+             : anari_usd_middleware::kernels::ColorOrder::Rgba);
+}
+
 /**
  * Create texture data from raw image buffer
  * Supports common image formats and converts to RGBA
  */
 CTextureData CreateTextureFromBuffer_C(const unsigned char* buffer, size_t buffer_size) {
+    return CreateTextureFromBufferWithHash_C(buffer, buffer_size, nullptr);
+}
+
+CTextureData CreateTextureFromBufferWithHash_C(const unsigned char* buffer, size_t buffer_size,
+                                               const char* content_hash) {
     CTextureData result = {};
 
     // Validate inputs
@@ -352,12 +942,9 @@ CTextureData CreateTextureFromBuffer_C(const unsigned char* buffer, size_t buffe
     }
 
     try {
-        // Convert to C++ vector
-        std::vector<unsigned char> std_buffer(buffer, buffer + buffer_size);
-
-        // Process through middleware
+        // Process through middleware, reading the caller's bytes in place
         anari_usd_middleware::AnariUsdMiddleware::TextureData tex_data =
-            g_middleware->CreateTextureFromBuffer(std_buffer);
+            g_middleware->CreateTextureFromBuffer(buffer, buffer_size, content_hash ? content_hash : "");
 
         // Copy results to C structure
         result.width = tex_data.width;
@@ -377,6 +964,113 @@ CTextureData CreateTextureFromBuffer_C(const unsigned char* buffer, size_t buffe
     return result;
 }
 
+// Storage behind CGpuTexture::internal
+struct GpuTextureHolder {
+    anari_usd_middleware::texture::Texture texture;
+    std::vector<CTextureMip> mips;
+};
+
+static anari_usd_middleware::texture::Options toTextureOptions(const CTextureOptions* options) {
+    anari_usd_middleware::texture::Options result;
+    if (options) {
+        result.generateMips = options->generate_mips != 0;
+        result.compression = static_cast<anari_usd_middleware::texture::Compression>(options->compression);
+        result.srgb = options->linear == 0;
+        result.highQuality = options->high_quality != 0;
+    }
+    return result;
+}
+
+// Hand an encoded texture to C without copying its data
+static void exposeGpuTexture(anari_usd_middleware::texture::Texture&& texture, CGpuTexture* out) {
+    auto holder = std::make_unique<GpuTextureHolder>();
+    holder->texture = std::move(texture);
+    holder->mips.reserve(holder->texture.mips.size());
+    for (const auto& mip : holder->texture.mips) {
+        holder->mips.push_back({static_cast<int>(mip.width), static_cast<int>(mip.height), mip.offset, mip.size});
+    }
+    out->width = static_cast<int>(holder->texture.width);
+    out->height = static_cast<int>(holder->texture.height);
+    out->format = static_cast<CTextureFormat>(holder->texture.format);
+    out->mips = holder->mips.data();
+    out->mip_count = holder->mips.size();
+    out->data = holder->texture.data.data();
+    out->data_size = holder->texture.data.size();
+    out->internal = holder.release();
+}
+
+static bool validTextureOptions(const CTextureOptions* options) {
+    return !options || (options->compression >= TEXTURE_COMPRESSION_NONE &&
+                        options->compression <= TEXTURE_COMPRESSION_AUTO);
+}
+
+/**
+ * Decode an image into a GPU-ready texture
+ */
+int CreateGpuTexture_C(const unsigned char* buffer, size_t buffer_size, const CTextureOptions* options,
+                       CGpuTexture* out_texture) {
+    if (!out_texture) {
+        return 0;
+    }
+    *out_texture = CGpuTexture{};
+    if (!buffer || buffer_size == 0 || !validTextureOptions(options)) {
+        return 0;
+    }
+
+    try {
+        anari_usd_middleware::texture::Texture texture;
+        if (!anari_usd_middleware::texture::process(buffer, buffer_size, toTextureOptions(options), texture)) {
+            return 0;
+        }
+        exposeGpuTexture(std::move(texture), out_texture);
+        return 1;
+    } catch (...) {
+        *out_texture = CGpuTexture{};
+        return 0;
+    }
+}
+
+/**
+ * Process several images in parallel
+ */
+size_t CreateGpuTextures_C(const unsigned char* const* buffers, const size_t* buffer_sizes, size_t count,
+                           const CTextureOptions* options, size_t thread_count, CGpuTexture* out_textures) {
+    if (!out_textures || count == 0) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        out_textures[i] = CGpuTexture{};
+    }
+    if (!buffers || !buffer_sizes || !validTextureOptions(options)) {
+        return 0;
+    }
+
+    try {
+        std::vector<anari_usd_middleware::texture::Source> sources(count);
+        for (size_t i = 0; i < count; ++i) {
+            sources[i].data = buffers[i];
+            sources[i].size = buffers[i] ? buffer_sizes[i] : 0;
+        }
+        std::vector<anari_usd_middleware::texture::Texture> textures(count);
+        anari_usd_middleware::texture::processBatch(sources.data(), count, toTextureOptions(options),
+                                                    textures.data(), thread_count);
+
+        size_t succeeded = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (textures[i].isValid()) {
+                exposeGpuTexture(std::move(textures[i]), &out_textures[i]);
+                ++succeeded;
+            }
+        }
+        return succeeded;
+    } catch (...) {
+        for (size_t i = 0; i < count; ++i) {
+            FreeGpuTexture_C(&out_textures[i]);
+        }
+        return 0;
+    }
+}
+
 /**
  * Extract gradient line from image and write as PNG file
  * Specialized function for gradient/colormap processing
@@ -441,22 +1135,18 @@ int GetGradientLineAsPNGBuffer_C(const unsigned char* buffer, size_t buffer_size
 
 /**
  * Free mesh data array allocated by LoadUSDBuffer_C or LoadUSDFromDisk_C
- * ENHANCED: Now properly frees vertex color data
+ * The headers and every attribute array share one allocation
  */
 void FreeMeshData_C(CMeshData* meshes, size_t count) {
-    if (!meshes) return;
-
-    // Free each mesh's internal arrays
-    for (size_t i = 0; i < count; ++i) {
-        delete[] meshes[i].points;
-        delete[] meshes[i].indices;
-        delete[] meshes[i].normals;
-        delete[] meshes[i].uvs;
-        delete[] meshes[i].vertex_colors;  // ✅ NEW: Free vertex colors
-    }
+    (void)count;
+    std::free(meshes);
+}
 
-    // Free the main array
-    delete[] meshes;
+/**
+ * Free a transform array allocated by EvaluateTransforms_C
+ */
+void FreeMeshTransforms_C(CMeshTransform* transforms) {
+    delete[] transforms;
 }
 
 /**
@@ -470,6 +1160,16 @@ void FreeTextureData_C(CTextureData* texture) {
     }
 }
 
+/**
+ * Free a texture created by CreateGpuTexture_C or CreateGpuTextures_C
+ */
+void FreeGpuTexture_C(CGpuTexture* texture) {
+    if (texture) {
+        delete static_cast<GpuTextureHolder*>(texture->internal);
+        *texture = CGpuTexture{};
+    }
+}
+
 /**
  * Free generic buffer allocated by middleware functions
  */
@@ -478,16 +1178,46 @@ void FreeBuffer_C(unsigned char* buffer) {
 }
 
 /**
- * Free file data structure (for callback cleanup)
+ * Free file data structure (deprecated)
+ * Data is middleware-owned, so only the fields are cleared
  */
 void FreeFileData_C(CFileData* file_data) {
-    if (file_data && file_data->data) {
-        delete[] file_data->data;
+    if (file_data) {
         file_data->data = nullptr;
         file_data->data_size = 0;
     }
 }
 
+/**
+ * Retain received file data beyond the callback
+ * Copies the small header struct and takes a payload reference; the bytes are shared
+ */
+CFileData* RetainFileData_C(const CFileData* file_data) {
+    if (!file_data || !file_data->payload) {
+        return nullptr;
+    }
+
+    try {
+        auto retained = std::make_unique<CFileData>(*file_data);
+        retained->payload = new anari_usd_middleware::FilePayload(
+            *static_cast<const anari_usd_middleware::FilePayload*>(file_data->payload));
+        return retained.release();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+/**
+ * Release file data retained with RetainFileData_C
+ */
+void ReleaseFileData_C(CFileData* file_data) {
+    if (!file_data) {
+        return;
+    }
+    delete static_cast<anari_usd_middleware::FilePayload*>(file_data->payload);
+    delete file_data;
+}
+
 // ============================================================================
 // CALLBACK REGISTRATION FUNCTIONS
 // ============================================================================
@@ -508,4 +1238,20 @@ void RegisterMessageCallback_C(MessageReceivedCallback_C callback) {
     g_message_callback = callback;
 }
 
+/**
+ * Register callback function for scene delta notifications
+ * Only one delta callback can be registered at a time
+ */
+void RegisterSceneDeltaCallback_C(SceneDeltaCallback_C callback) {
+    g_scene_delta_callback = callback;
+}
+
+/**
+ * Register callback function for progressive LOD delivery
+ * Only one LOD callback can be registered at a time
+ */
+void RegisterMeshLodCallback_C(MeshLodCallback_C callback) {
+    g_mesh_lod_callback = callback;
+}
+
 } // extern "C"
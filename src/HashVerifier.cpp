@@ -8,34 +8,53 @@
 #include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <cstring>
 
 namespace anari_usd_middleware {
 
-// Static member initialization
-std::mutex HashVerifier::opensslMutex;
+namespace {
+
+const EVP_MD* digestFor(HashVerifier::HashAlgorithm algorithm) {
+    switch (algorithm) {
+    case HashVerifier::HashAlgorithm::Blake2b512:
+        return EVP_blake2b512();
+    case HashVerifier::HashAlgorithm::Sha256:
+    default:
+        return EVP_sha256();
+    }
+}
+
+} // namespace
 
 bool HashVerifier::verifyHash(const std::vector<uint8_t>& data, const std::string& expectedHash) {
-    MIDDLEWARE_LOG_DEBUG("Verifying hash for data of size %zu bytes", data.size());
+    return verifyHash(data.data(), data.size(), expectedHash);
+}
+
+bool HashVerifier::verifyHash(const uint8_t* data, size_t size, const std::string& expectedHash) {
+    MIDDLEWARE_LOG_DEBUG("Verifying hash for data of size %zu bytes", size);
 
     // Input validation
-    if (!validateInputData(data, "verifyHash")) {
+    if (!validateInputData(data, size, "verifyHash")) {
         return false;
     }
 
-    if (!validateHashString(expectedHash, "verifyHash")) {
+    HashAlgorithm algorithm = HashAlgorithm::Sha256;
+    std::string expectedDigest;
+    if (!parseHashFrame(expectedHash, algorithm, expectedDigest)) {
+        MIDDLEWARE_LOG_ERROR("Invalid hash frame in verifyHash: %s", expectedHash.c_str());
         return false;
     }
 
     try {
-        // Calculate hash with safety measures
-        std::string computedHash = calculateHash(data);
+        // Calculate hash with the algorithm the sender picked
+        std::string computedHash = calculateHash(data, size, algorithm);
         if (computedHash.empty()) {
             MIDDLEWARE_LOG_ERROR("Failed to compute hash for verification");
             return false;
         }
 
         // Safe comparison
-        bool result = compareHashes(computedHash, expectedHash);
+        bool result = compareHashes(computedHash, expectedDigest);
 
         if (result) {
             MIDDLEWARE_LOG_DEBUG("Hash verification successful");
@@ -53,34 +72,216 @@ bool HashVerifier::verifyHash(const std::vector<uint8_t>& data, const std::strin
 }
 
 std::string HashVerifier::calculateHash(const std::vector<uint8_t>& data) {
-    MIDDLEWARE_LOG_DEBUG("Calculating hash for data of size %zu bytes", data.size());
+    return calculateHash(data.data(), data.size());
+}
+
+std::string HashVerifier::calculateHash(const uint8_t* data, size_t size) {
+    return calculateHash(data, size, HashAlgorithm::Sha256);
+}
+
+std::string HashVerifier::calculateHash(const uint8_t* data, size_t size, HashAlgorithm algorithm) {
+    MIDDLEWARE_LOG_DEBUG("Calculating %s hash for data of size %zu bytes", algorithmName(algorithm), size);
 
     // Input validation
-    if (!validateInputData(data, "calculateHash")) {
+    if (!validateInputData(data, size, "calculateHash")) {
         return "";
     }
 
     try {
-        unsigned char hash[EVP_MAX_MD_SIZE];
-        unsigned int hashLen = 0;
+        std::string result = performHashOperation(data, size, algorithm, "calculateHash");
+        if (!result.empty()) {
+            MIDDLEWARE_LOG_DEBUG("Calculated hash: %s", result.c_str());
+        }
+        return result;
+
+    } catch (const std::exception& e) {
+        MIDDLEWARE_LOG_ERROR("Exception in calculateHash: %s", e.what());
+        return "";
+    }
+}
 
-        // Thread-safe hash calculation
-        std::lock_guard<std::mutex> lock(opensslMutex);
+bool HashVerifier::calculateDigest(const uint8_t* data, size_t size, ContentDigest& digest) {
+    if (!validateInputData(data, size, "calculateDigest")) {
+        return false;
+    }
 
-        if (!performHashOperation(data, hash, &hashLen, "calculateHash")) {
-            return "";
+    unsigned char hash[EVP_MAX_MD_SIZE];
+    unsigned int hashLen = 0;
+    if (!EVP_Digest(data, size, hash, &hashLen, EVP_sha256(), nullptr) || hashLen != digest.size()) {
+        MIDDLEWARE_LOG_ERROR("Failed to compute content digest");
+        return false;
+    }
+
+    std::memcpy(digest.data(), hash, digest.size());
+    return true;
+}
+
+bool HashVerifier::digestFromHashFrame(const std::string& frame, ContentDigest& digest) {
+    HashAlgorithm algorithm = HashAlgorithm::Sha256;
+    std::string hexDigest;
+    if (!parseHashFrame(frame, algorithm, hexDigest)) {
+        return false;
+    }
+
+    auto nibble = [](char c) -> uint8_t {
+        if (c >= '0' && c <= '9') return static_cast<uint8_t>(c - '0');
+        return static_cast<uint8_t>(std::tolower(static_cast<unsigned char>(c)) - 'a' + 10);
+    };
+    for (size_t i = 0; i < digest.size(); ++i) {
+        digest[i] = static_cast<uint8_t>((nibble(hexDigest[2 * i]) << 4) | nibble(hexDigest[2 * i + 1]));
+    }
+    return true;
+}
+
+bool HashVerifier::parseHashFrame(const std::string& frame, HashAlgorithm& algorithm, std::string& hexDigest) {
+    size_t separator = frame.find(':');
+    std::string name = separator == std::string::npos ? std::string() : frame.substr(0, separator);
+    std::string digest = separator == std::string::npos ? frame : frame.substr(separator + 1);
+
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+    if (name.empty() || name == "sha256") {
+        algorithm = HashAlgorithm::Sha256;
+    } else if (name == "blake2b512" || name == "blake2b") {
+        algorithm = HashAlgorithm::Blake2b512;
+    } else {
+        MIDDLEWARE_LOG_ERROR("Unsupported hash algorithm: %s", name.c_str());
+        return false;
+    }
+
+    if (digest.length() != digestHexLength(algorithm) || !isHexString(digest)) {
+        return false;
+    }
+
+    hexDigest = std::move(digest);
+    return true;
+}
+
+std::string HashVerifier::formatHashFrame(HashAlgorithm algorithm, const std::string& hexDigest) {
+    if (algorithm == HashAlgorithm::Sha256) {
+        return hexDigest;
+    }
+    return std::string(algorithmName(algorithm)) + ":" + hexDigest;
+}
+
+const char* HashVerifier::algorithmName(HashAlgorithm algorithm) {
+    switch (algorithm) {
+    case HashAlgorithm::Blake2b512:
+        return "blake2b512";
+    case HashAlgorithm::Sha256:
+    default:
+        return "sha256";
+    }
+}
+
+size_t HashVerifier::digestHexLength(HashAlgorithm algorithm) {
+    switch (algorithm) {
+    case HashAlgorithm::Blake2b512:
+        return 128;
+    case HashAlgorithm::Sha256:
+    default:
+        return 64;
+    }
+}
+
+HashVerifier::StreamingHash::StreamingHash(HashAlgorithm algorithm) : hashAlgorithm(algorithm) {
+    context = EVP_MD_CTX_new();
+    if (!context) {
+        MIDDLEWARE_LOG_ERROR("Failed to create EVP_MD_CTX for streaming hash");
+        return;
+    }
+
+    if (!reset(algorithm)) {
+        EVP_MD_CTX_free(context);
+        context = nullptr;
+    }
+}
+
+HashVerifier::StreamingHash::~StreamingHash() {
+    if (context) {
+        EVP_MD_CTX_free(context);
+    }
+}
+
+HashVerifier::StreamingHash::StreamingHash(StreamingHash&& other) noexcept
+    : context(other.context), hashAlgorithm(other.hashAlgorithm),
+      totalBytes(other.totalBytes), finalized(other.finalized) {
+    other.context = nullptr;
+    other.totalBytes = 0;
+}
+
+HashVerifier::StreamingHash& HashVerifier::StreamingHash::operator=(StreamingHash&& other) noexcept {
+    if (this != &other) {
+        if (context) {
+            EVP_MD_CTX_free(context);
         }
+        context = other.context;
+        hashAlgorithm = other.hashAlgorithm;
+        totalBytes = other.totalBytes;
+        finalized = other.finalized;
+        other.context = nullptr;
+        other.totalBytes = 0;
+    }
+    return *this;
+}
 
-        // Convert to hex string safely
-        std::string result = bytesToHexString(hash, hashLen);
+bool HashVerifier::StreamingHash::isValid() const {
+    return context != nullptr && !finalized;
+}
 
-        MIDDLEWARE_LOG_DEBUG("Calculated hash: %s", result.c_str());
-        return result;
+bool HashVerifier::StreamingHash::reset(HashAlgorithm newAlgorithm) {
+    if (!context) {
+        return false;
+    }
 
-    } catch (const std::exception& e) {
-        MIDDLEWARE_LOG_ERROR("Exception in calculateHash: %s", e.what());
+    const EVP_MD* md = digestFor(newAlgorithm);
+    // Re-initializing keeps the context's allocation, so reuse costs no malloc
+    if (!md || !EVP_DigestInit_ex(context, md, nullptr)) {
+        MIDDLEWARE_LOG_ERROR("Failed to initialize streaming %s digest", algorithmName(newAlgorithm));
+        finalized = true;
+        return false;
+    }
+
+    hashAlgorithm = newAlgorithm;
+    totalBytes = 0;
+    finalized = false;
+    return true;
+}
+
+bool HashVerifier::StreamingHash::update(const uint8_t* data, size_t size) {
+    if (!isValid()) {
+        return false;
+    }
+    if (size == 0) {
+        return true;
+    }
+    if (!data || !EVP_DigestUpdate(context, data, size)) {
+        MIDDLEWARE_LOG_ERROR("Failed to update streaming digest at offset %llu",
+                             static_cast<unsigned long long>(totalBytes));
+        return false;
+    }
+    totalBytes += size;
+    return true;
+}
+
+std::string HashVerifier::StreamingHash::finalizeHex() {
+    if (!isValid()) {
         return "";
     }
+
+    unsigned char hash[EVP_MAX_MD_SIZE];
+    unsigned int hashLen = 0;
+    bool ok = EVP_DigestFinal_ex(context, hash, &hashLen) == 1;
+
+    // The context cannot be updated again until reset()
+    finalized = true;
+
+    if (!ok) {
+        MIDDLEWARE_LOG_ERROR("Failed to finalize streaming digest");
+        return "";
+    }
+    return bytesToHexString(hash, hashLen);
 }
 
 bool HashVerifier::verifyHashStreaming(const std::vector<uint8_t>& data,
@@ -94,31 +295,23 @@ bool HashVerifier::verifyHashStreaming(const std::vector<uint8_t>& data,
         return false;
     }
 
-    if (!validateHashString(expectedHash, "verifyHashStreaming")) {
+    // The frame selects the algorithm, and with it the digest length to expect
+    HashAlgorithm algorithm = HashAlgorithm::Sha256;
+    std::string expectedDigest;
+    if (!parseHashFrame(expectedHash, algorithm, expectedDigest)) {
+        MIDDLEWARE_LOG_ERROR("Invalid hash frame in verifyHashStreaming: %s", expectedHash.c_str());
         return false;
     }
 
     // Validate chunk size
-    if (chunkSize == 0 || chunkSize > safety::MAX_BUFFER_SIZE) {
+    if (chunkSize == 0 || chunkSize > safety::MAX_STREAMED_FILE_SIZE) {
         MIDDLEWARE_LOG_ERROR("Invalid chunk size: %zu", chunkSize);
         return false;
     }
 
     try {
-        std::lock_guard<std::mutex> lock(opensslMutex);
-
-        // Create EVP context
-        std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> mdctx(
-            EVP_MD_CTX_new(), EVP_MD_CTX_free);
-
-        if (!mdctx) {
-            MIDDLEWARE_LOG_ERROR("Failed to create EVP_MD_CTX for streaming");
-            return false;
-        }
-
-        // Initialize digest
-        const EVP_MD* md = EVP_sha256();
-        if (!md || !EVP_DigestInit_ex(mdctx.get(), md, nullptr)) {
+        StreamingHash digest(algorithm);
+        if (!digest.isValid()) {
             MIDDLEWARE_LOG_ERROR("Failed to initialize digest for streaming");
             return false;
         }
@@ -128,7 +321,7 @@ bool HashVerifier::verifyHashStreaming(const std::vector<uint8_t>& data,
         while (processed < data.size()) {
             size_t currentChunk = std::min(chunkSize, data.size() - processed);
 
-            if (!EVP_DigestUpdate(mdctx.get(), data.data() + processed, currentChunk)) {
+            if (!digest.update(data.data() + processed, currentChunk)) {
                 MIDDLEWARE_LOG_ERROR("Failed to update digest during streaming at offset %zu", processed);
                 return false;
             }
@@ -144,18 +337,14 @@ bool HashVerifier::verifyHashStreaming(const std::vector<uint8_t>& data,
             }
         }
 
-        // Finalize hash
-        unsigned char hash[EVP_MAX_MD_SIZE];
-        unsigned int hashLen = 0;
-
-        if (!EVP_DigestFinal_ex(mdctx.get(), hash, &hashLen)) {
+        std::string computedHash = digest.finalizeHex();
+        if (computedHash.empty()) {
             MIDDLEWARE_LOG_ERROR("Failed to finalize digest for streaming");
             return false;
         }
 
-        // Convert and compare
-        std::string computedHash = bytesToHexString(hash, hashLen);
-        bool result = compareHashes(computedHash, expectedHash);
+        // Compare
+        bool result = compareHashes(computedHash, expectedDigest);
 
         if (result) {
             MIDDLEWARE_LOG_DEBUG("Streaming hash verification successful");
@@ -182,20 +371,8 @@ std::string HashVerifier::calculateHashWithProgress(const std::vector<uint8_t>&
     }
 
     try {
-        std::lock_guard<std::mutex> lock(opensslMutex);
-
-        // Create EVP context
-        std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> mdctx(
-            EVP_MD_CTX_new(), EVP_MD_CTX_free);
-
-        if (!mdctx) {
-            MIDDLEWARE_LOG_ERROR("Failed to create EVP_MD_CTX for progress calculation");
-            return "";
-        }
-
-        // Initialize digest
-        const EVP_MD* md = EVP_sha256();
-        if (!md || !EVP_DigestInit_ex(mdctx.get(), md, nullptr)) {
+        StreamingHash digest;
+        if (!digest.isValid()) {
             MIDDLEWARE_LOG_ERROR("Failed to initialize digest for progress calculation");
             return "";
         }
@@ -207,7 +384,7 @@ std::string HashVerifier::calculateHashWithProgress(const std::vector<uint8_t>&
         while (processed < data.size()) {
             size_t currentChunk = std::min(chunkSize, data.size() - processed);
 
-            if (!EVP_DigestUpdate(mdctx.get(), data.data() + processed, currentChunk)) {
+            if (!digest.update(data.data() + processed, currentChunk)) {
                 MIDDLEWARE_LOG_ERROR("Failed to update digest with progress at offset %zu", processed);
                 return "";
             }
@@ -226,17 +403,12 @@ std::string HashVerifier::calculateHashWithProgress(const std::vector<uint8_t>&
             }
         }
 
-        // Finalize hash
-        unsigned char hash[EVP_MAX_MD_SIZE];
-        unsigned int hashLen = 0;
-
-        if (!EVP_DigestFinal_ex(mdctx.get(), hash, &hashLen)) {
+        std::string result = digest.finalizeHex();
+        if (result.empty()) {
             MIDDLEWARE_LOG_ERROR("Failed to finalize digest with progress");
             return "";
         }
 
-        std::string result = bytesToHexString(hash, hashLen);
-
         // Final progress callback
         if (progressCallback) {
             try {
@@ -256,20 +428,15 @@ std::string HashVerifier::calculateHashWithProgress(const std::vector<uint8_t>&
 }
 
 bool HashVerifier::isValidHashFormat(const std::string& hashString) {
-    // SHA256 hash should be exactly 64 hexadecimal characters
-    if (hashString.length() != 64) {
-        return false;
-    }
-
-    // Check if all characters are valid hexadecimal
-    return std::all_of(hashString.begin(), hashString.end(), [](char c) {
-        return std::isxdigit(static_cast<unsigned char>(c));
-    });
+    // The digest must have the length of the algorithm the frame names
+    HashAlgorithm algorithm = HashAlgorithm::Sha256;
+    std::string hexDigest;
+    return parseHashFrame(hashString, algorithm, hexDigest);
 }
 
 bool HashVerifier::compareHashes(const std::string& hash1, const std::string& hash2) {
-    // Validate both hashes first
-    if (!isValidHashFormat(hash1) || !isValidHashFormat(hash2)) {
+    // Validate both hashes first; digests of different algorithms never match
+    if (hash1.empty() || hash1.length() != hash2.length() || !isHexString(hash1) || !isHexString(hash2)) {
         MIDDLEWARE_LOG_ERROR("Invalid hash format in comparison");
         return false;
     }
@@ -297,76 +464,52 @@ bool HashVerifier::compareHashes(const std::string& hash1, const std::string& ha
 // Private helper methods
 
 bool HashVerifier::validateInputData(const std::vector<uint8_t>& data, const std::string& context) {
-    if (data.empty()) {
-        MIDDLEWARE_LOG_ERROR("Cannot process hash: Empty data buffer in %s", context.c_str());
-        return false;
-    }
-
-    if (data.size() > safety::MAX_BUFFER_SIZE) {
-        MIDDLEWARE_LOG_ERROR("Data buffer too large (%zu bytes) in %s, max allowed: %zu",
-                            data.size(), context.c_str(), safety::MAX_BUFFER_SIZE);
-        return false;
-    }
-
-    return true;
+    return validateInputData(data.data(), data.size(), context);
 }
 
-bool HashVerifier::validateHashString(const std::string& hash, const std::string& context) {
-    if (hash.empty()) {
-        MIDDLEWARE_LOG_ERROR("Cannot process hash: Empty hash string in %s", context.c_str());
+bool HashVerifier::validateInputData(const uint8_t* data, size_t size, const std::string& context) {
+    if (!data || size == 0) {
+        MIDDLEWARE_LOG_ERROR("Cannot process hash: Empty data buffer in %s", context.c_str());
         return false;
     }
 
-    if (!isValidHashFormat(hash)) {
-        MIDDLEWARE_LOG_ERROR("Invalid hash format in %s: %s", context.c_str(), hash.c_str());
+    // Hashing only reads the bytes, so payloads streamed or mapped from disk are fine
+    if (size > safety::MAX_STREAMED_FILE_SIZE) {
+        MIDDLEWARE_LOG_ERROR("Data buffer too large (%zu bytes) in %s, max allowed: %llu",
+                            size, context.c_str(), static_cast<unsigned long long>(safety::MAX_STREAMED_FILE_SIZE));
         return false;
     }
 
     return true;
 }
 
-bool HashVerifier::performHashOperation(const std::vector<uint8_t>& data,
-                                       unsigned char* hash,
-                                       unsigned int* hashLen,
-                                       const std::string& context) {
-    MIDDLEWARE_VALIDATE_POINTER(hash, context.c_str());
-    MIDDLEWARE_VALIDATE_POINTER(hashLen, context.c_str());
+std::string HashVerifier::performHashOperation(const uint8_t* data, size_t size,
+                                               HashAlgorithm algorithm,
+                                               const std::string& context) {
+    // One context per thread, re-initialized per digest; concurrent callers never contend
+    thread_local StreamingHash digest;
 
-    // Create EVP context with RAII
-    std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> mdctx(
-        EVP_MD_CTX_new(), EVP_MD_CTX_free);
-
-    if (!mdctx) {
-        MIDDLEWARE_LOG_ERROR("Failed to create EVP_MD_CTX in %s", context.c_str());
-        return false;
-    }
-
-    // Get SHA-256 algorithm
-    const EVP_MD* md = EVP_sha256();
-    if (!md) {
-        MIDDLEWARE_LOG_ERROR("Failed to get SHA-256 algorithm in %s", context.c_str());
-        return false;
-    }
-
-    // Initialize digest
-    if (!EVP_DigestInit_ex(mdctx.get(), md, nullptr)) {
+    if (!digest.reset(algorithm)) {
         MIDDLEWARE_LOG_ERROR("Failed to initialize digest context in %s", context.c_str());
-        return false;
+        return "";
     }
 
-    // Update with data
-    if (!EVP_DigestUpdate(mdctx.get(), data.data(), data.size())) {
+    if (!digest.update(data, size)) {
         MIDDLEWARE_LOG_ERROR("Failed to update digest with data in %s", context.c_str());
-        return false;
+        return "";
     }
 
-    // Finalize
-    if (!EVP_DigestFinal_ex(mdctx.get(), hash, hashLen)) {
+    std::string result = digest.finalizeHex();
+    if (result.empty()) {
         MIDDLEWARE_LOG_ERROR("Failed to finalize digest in %s", context.c_str());
-        return false;
     }
+    return result;
+}
 
-    return true;
+bool HashVerifier::isHexString(const std::string& value) {
+    return std::all_of(value.begin(), value.end(), [](char c) {
+        return std::isxdigit(static_cast<unsigned char>(c));
+    });
 }
 
 std::string HashVerifier::bytesToHexString(const unsigned char* bytes, unsigned int length) {
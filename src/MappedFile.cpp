@@ -0,0 +1,133 @@
+#include "MappedFile.h"
+#include "MiddlewareLogging.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace anari_usd_middleware {
+
+std::shared_ptr<MappedFile> MappedFile::open(const std::string& path, bool removeOnClose) {
+    std::shared_ptr<MappedFile> mapped(new MappedFile());
+    mapped->filePath = path;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        MIDDLEWARE_LOG_ERROR("Failed to open file for mapping: %s (error %lu)", path.c_str(), GetLastError());
+        return nullptr;
+    }
+    mapped->fileHandle = file;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        MIDDLEWARE_LOG_ERROR("Cannot map empty or unreadable file: %s", path.c_str());
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        MIDDLEWARE_LOG_ERROR("CreateFileMapping failed for %s (error %lu)", path.c_str(), GetLastError());
+        return nullptr;
+    }
+    mapped->mappingHandle = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        MIDDLEWARE_LOG_ERROR("MapViewOfFile failed for %s (error %lu)", path.c_str(), GetLastError());
+        return nullptr;
+    }
+    mapped->bytes = static_cast<const uint8_t*>(view);
+    mapped->length = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        MIDDLEWARE_LOG_ERROR("Failed to open file for mapping: %s", path.c_str());
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        MIDDLEWARE_LOG_ERROR("Cannot map empty or unreadable file: %s", path.c_str());
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        MIDDLEWARE_LOG_ERROR("mmap failed for %s", path.c_str());
+        return nullptr;
+    }
+
+    // Consumers read front to back; let the kernel read ahead aggressively
+    madvise(view, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+    mapped->bytes = static_cast<const uint8_t*>(view);
+    mapped->length = static_cast<size_t>(info.st_size);
+#endif
+
+    mapped->removeFile = removeOnClose;
+    MIDDLEWARE_LOG_DEBUG("Mapped %s (%zu bytes)", path.c_str(), mapped->length);
+    return mapped;
+}
+
+void MappedFile::prefetch(size_t offset, size_t count) const {
+    if (!bytes || offset >= length) {
+        return;
+    }
+    count = std::min(count, length - offset);
+
+#ifdef _WIN32
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<uint8_t*>(bytes + offset);
+    range.NumberOfBytes = count;
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+#else
+    // madvise needs a page-aligned start
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t alignedOffset = offset - offset % pageSize;
+    madvise(const_cast<uint8_t*>(bytes + alignedOffset), count + (offset - alignedOffset), MADV_WILLNEED);
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    if (bytes) {
+        UnmapViewOfFile(bytes);
+    }
+    if (mappingHandle) {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle) {
+        CloseHandle(fileHandle);
+    }
+#else
+    if (bytes) {
+        munmap(const_cast<uint8_t*>(bytes), length);
+    }
+#endif
+
+    if (removeFile && !filePath.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(filePath, ec);
+        if (ec) {
+            MIDDLEWARE_LOG_WARNING("Failed to remove mapped file %s: %s", filePath.c_str(), ec.message().c_str());
+        }
+    }
+}
+
+} // namespace anari_usd_middleware
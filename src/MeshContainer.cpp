@@ -0,0 +1,293 @@
+#include "MeshContainer.h"
+#include "MiddlewareLogging.h"
+
+#include <cstring>
+#include <limits>
+
+namespace anari_usd_middleware {
+namespace container {
+
+namespace {
+
+// On-disk records; fields are naturally aligned, so the structs have no padding
+struct Header {
+    char magic[4];
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t meshCount;
+    uint32_t flags;
+    uint64_t fileSize;
+    uint64_t tableOffset;
+    uint8_t reserved[32];
+};
+
+struct Record {
+    uint64_t nameOffset;
+    uint32_t nameLength;
+    uint32_t typeNameLength;
+    uint64_t typeNameOffset;
+    uint64_t vertexCount;
+    uint64_t indexCount;
+    uint64_t instanceCount;
+    uint64_t pointsOffset;
+    uint64_t indicesOffset;
+    uint64_t normalsOffset;
+    uint64_t uvsOffset;
+    uint64_t colorsOffset;
+    uint64_t instancesOffset;
+    uint8_t reserved[32];
+};
+
+static_assert(sizeof(Header) == HEADER_SIZE, "container header layout");
+static_assert(sizeof(Record) == RECORD_SIZE, "container record layout");
+
+// Blocks are used in place, so the host byte order has to match the file's
+bool hostIsLittleEndian() {
+    const uint16_t probe = 1;
+    uint8_t first = 0;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+size_t alignBlock(size_t offset) {
+    return (offset + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+}
+
+bool isEncodable(const MeshView& mesh) {
+    return !mesh.elementName.empty() && mesh.elementName.size() <= MAX_NAME_LENGTH &&
+           mesh.typeName.size() <= MAX_NAME_LENGTH &&
+           mesh.points && mesh.vertexCount > 0 &&
+           mesh.indices && mesh.indexCount > 0 && mesh.indexCount % 3 == 0 &&
+           (mesh.instanceCount == 0) == (mesh.instanceTransforms == nullptr);
+}
+
+/**
+ * Assign file offsets to every name and block
+ * @return Total container size, 0 on invalid input
+ */
+size_t layout(const MeshView* meshes, size_t count, std::vector<Record>& records) {
+    if (!hostIsLittleEndian()) {
+        MIDDLEWARE_LOG_ERROR("Mesh containers require a little-endian host");
+        return 0;
+    }
+    if ((count > 0 && !meshes) || count > MAX_MESHES) {
+        MIDDLEWARE_LOG_ERROR("Invalid mesh count for container: %zu", count);
+        return 0;
+    }
+
+    records.assign(count, Record{});
+    size_t cursor = HEADER_SIZE + count * RECORD_SIZE;
+    for (size_t i = 0; i < count; ++i) {
+        if (!isEncodable(meshes[i])) {
+            MIDDLEWARE_LOG_ERROR("Mesh %zu cannot be encoded (missing name, points or triangles)", i);
+            return 0;
+        }
+        records[i].nameOffset = cursor;
+        records[i].nameLength = static_cast<uint32_t>(meshes[i].elementName.size());
+        cursor += meshes[i].elementName.size();
+        records[i].typeNameOffset = cursor;
+        records[i].typeNameLength = static_cast<uint32_t>(meshes[i].typeName.size());
+        cursor += meshes[i].typeName.size();
+    }
+
+    auto place = [&cursor](const void* data, size_t bytes) -> uint64_t {
+        if (!data) {
+            return 0;
+        }
+        const size_t offset = alignBlock(cursor);
+        cursor = offset + bytes;
+        return offset;
+    };
+
+    for (size_t i = 0; i < count; ++i) {
+        const MeshView& mesh = meshes[i];
+        Record& record = records[i];
+        record.vertexCount = mesh.vertexCount;
+        record.indexCount = mesh.indexCount;
+        record.instanceCount = mesh.instanceCount;
+        record.pointsOffset = place(mesh.points, mesh.vertexCount * 3 * sizeof(float));
+        record.indicesOffset = place(mesh.indices, mesh.indexCount * sizeof(uint32_t));
+        record.normalsOffset = place(mesh.normals, mesh.vertexCount * 3 * sizeof(float));
+        record.uvsOffset = place(mesh.uvs, mesh.vertexCount * 2 * sizeof(float));
+        record.colorsOffset = place(mesh.colors, mesh.vertexCount * 4 * sizeof(float));
+        record.instancesOffset = place(mesh.instanceTransforms, mesh.instanceCount * 16 * sizeof(float));
+    }
+    return alignBlock(cursor);
+}
+
+/**
+ * Resolve an optional block of elementCount elements
+ * @return False if the block is present but misplaced
+ */
+template <typename T>
+bool resolveBlock(const uint8_t* data, uint64_t bound, uint64_t offset, uint64_t elementCount,
+                  const T*& out) {
+    out = nullptr;
+    if (offset == 0) {
+        return true;
+    }
+    if (offset % BLOCK_ALIGNMENT != 0 || offset < HEADER_SIZE || offset > bound ||
+        elementCount > (bound - offset) / sizeof(T)) {
+        return false;
+    }
+    out = reinterpret_cast<const T*>(data + offset);
+    return true;
+}
+
+bool resolveName(const char* data, uint64_t bound, uint64_t offset, uint32_t length, std::string_view& out) {
+    if (length > MAX_NAME_LENGTH || offset > bound || length > bound - offset) {
+        return false;
+    }
+    out = std::string_view(data + offset, length);
+    return true;
+}
+
+} // namespace
+
+bool isContainer(const uint8_t* data, size_t size) {
+    if (!data || size < HEADER_SIZE) {
+        return false;
+    }
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    return std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION;
+}
+
+bool parse(const uint8_t* data, size_t size, std::vector<MeshView>& out) {
+    out.clear();
+    if (!isContainer(data, size)) {
+        MIDDLEWARE_LOG_ERROR("Not a mesh container (bad magic or unsupported version)");
+        return false;
+    }
+    if (!hostIsLittleEndian()) {
+        MIDDLEWARE_LOG_ERROR("Mesh containers require a little-endian host");
+        return false;
+    }
+    if (reinterpret_cast<uintptr_t>(data) % alignof(float) != 0) {
+        MIDDLEWARE_LOG_ERROR("Mesh container buffer is not 4-byte aligned");
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    const uint64_t bound = header.fileSize;
+    if (header.headerSize < HEADER_SIZE || bound > size || bound < header.headerSize ||
+        header.meshCount > MAX_MESHES || header.tableOffset < header.headerSize || header.tableOffset > bound ||
+        header.meshCount > (bound - header.tableOffset) / RECORD_SIZE) {
+        MIDDLEWARE_LOG_ERROR("Malformed mesh container header (%zu bytes, %u meshes)", size, header.meshCount);
+        return false;
+    }
+
+    const char* chars = reinterpret_cast<const char*>(data);
+    std::vector<MeshView> meshes(header.meshCount);
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        Record record;
+        std::memcpy(&record, data + header.tableOffset + i * RECORD_SIZE, sizeof(record));
+        MeshView& mesh = meshes[i];
+
+        // Counts are bounded by the file size first so the element counts below cannot overflow
+        const bool countsFit = record.vertexCount > 0 && record.vertexCount <= bound / (3 * sizeof(float)) &&
+                               record.vertexCount <= std::numeric_limits<uint32_t>::max() &&
+                               record.indexCount > 0 && record.indexCount % 3 == 0 &&
+                               record.indexCount <= bound / sizeof(uint32_t) &&
+                               record.instanceCount <= bound / (16 * sizeof(float)) &&
+                               (record.instanceCount == 0) == (record.instancesOffset == 0);
+        const bool layoutValid =
+            countsFit && record.pointsOffset != 0 && record.indicesOffset != 0 &&
+            resolveName(chars, bound, record.nameOffset, record.nameLength, mesh.elementName) &&
+            resolveName(chars, bound, record.typeNameOffset, record.typeNameLength, mesh.typeName) &&
+            !mesh.elementName.empty() &&
+            resolveBlock(data, bound, record.pointsOffset, record.vertexCount * 3, mesh.points) &&
+            resolveBlock(data, bound, record.indicesOffset, record.indexCount, mesh.indices) &&
+            resolveBlock(data, bound, record.normalsOffset, record.vertexCount * 3, mesh.normals) &&
+            resolveBlock(data, bound, record.uvsOffset, record.vertexCount * 2, mesh.uvs) &&
+            resolveBlock(data, bound, record.colorsOffset, record.vertexCount * 4, mesh.colors) &&
+            resolveBlock(data, bound, record.instancesOffset, record.instanceCount * 16, mesh.instanceTransforms);
+        if (!layoutValid) {
+            MIDDLEWARE_LOG_ERROR("Malformed record for mesh %zu in container", i);
+            return false;
+        }
+
+        mesh.vertexCount = static_cast<size_t>(record.vertexCount);
+        mesh.indexCount = static_cast<size_t>(record.indexCount);
+        mesh.instanceCount = static_cast<size_t>(record.instanceCount);
+
+        // Consumers index straight into the points, so this is the one pass over the data
+        const uint32_t vertexCount = static_cast<uint32_t>(mesh.vertexCount);
+        for (size_t k = 0; k < mesh.indexCount; ++k) {
+            if (mesh.indices[k] >= vertexCount) {
+                MIDDLEWARE_LOG_ERROR("Mesh %.*s in container has index %u out of range (%u vertices)",
+                                     static_cast<int>(mesh.elementName.size()), mesh.elementName.data(),
+                                     mesh.indices[k], vertexCount);
+                return false;
+            }
+        }
+    }
+
+    out = std::move(meshes);
+    return true;
+}
+
+size_t encodedSize(const MeshView* meshes, size_t count) {
+    std::vector<Record> records;
+    return layout(meshes, count, records);
+}
+
+size_t encode(const MeshView* meshes, size_t count, uint8_t* out, size_t capacity) {
+    std::vector<Record> records;
+    const size_t total = layout(meshes, count, records);
+    if (total == 0) {
+        return 0;
+    }
+    if (!out || capacity < total) {
+        MIDDLEWARE_LOG_ERROR("Container needs %zu bytes, buffer has %zu", total, capacity);
+        return 0;
+    }
+
+    // Padding and reserved fields are zero
+    std::memset(out, 0, total);
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.headerSize = static_cast<uint16_t>(HEADER_SIZE);
+    header.meshCount = static_cast<uint32_t>(count);
+    header.fileSize = total;
+    header.tableOffset = HEADER_SIZE;
+    std::memcpy(out, &header, sizeof(header));
+
+    auto copyBlock = [out](uint64_t offset, const void* data, size_t bytes) {
+        if (offset != 0) {
+            std::memcpy(out + offset, data, bytes);
+        }
+    };
+
+    for (size_t i = 0; i < count; ++i) {
+        const MeshView& mesh = meshes[i];
+        const Record& record = records[i];
+        std::memcpy(out + HEADER_SIZE + i * RECORD_SIZE, &record, sizeof(record));
+        copyBlock(record.nameOffset, mesh.elementName.data(), mesh.elementName.size());
+        if (!mesh.typeName.empty()) {
+            copyBlock(record.typeNameOffset, mesh.typeName.data(), mesh.typeName.size());
+        }
+        copyBlock(record.pointsOffset, mesh.points, mesh.vertexCount * 3 * sizeof(float));
+        copyBlock(record.indicesOffset, mesh.indices, mesh.indexCount * sizeof(uint32_t));
+        copyBlock(record.normalsOffset, mesh.normals, mesh.vertexCount * 3 * sizeof(float));
+        copyBlock(record.uvsOffset, mesh.uvs, mesh.vertexCount * 2 * sizeof(float));
+        copyBlock(record.colorsOffset, mesh.colors, mesh.vertexCount * 4 * sizeof(float));
+        copyBlock(record.instancesOffset, mesh.instanceTransforms, mesh.instanceCount * 16 * sizeof(float));
+    }
+    return total;
+}
+
+bool encode(const MeshView* meshes, size_t count, std::vector<uint8_t>& out) {
+    const size_t total = encodedSize(meshes, count);
+    if (total == 0) {
+        return false;
+    }
+    out.resize(total);
+    return encode(meshes, count, out.data(), out.size()) == total;
+}
+
+} // namespace container
+} // namespace anari_usd_middleware
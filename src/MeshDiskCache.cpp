@@ -0,0 +1,287 @@
+#include "MeshDiskCache.h"
+#include "MiddlewareLogging.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace anari_usd_middleware {
+
+namespace {
+
+constexpr const char* TEMPORARY_SUFFIX = ".tmp";
+
+template <typename T>
+void appendBytes(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool writeFile(const std::filesystem::path& path, const std::vector<uint8_t>& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    return file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())) &&
+           file.flush();
+}
+
+} // namespace
+
+std::string MeshDiskCache::fileName(const ContentDigest& key) {
+    static const char hexDigits[] = "0123456789abcdef";
+    std::string name;
+    name.reserve(key.size() * 2 + std::strlen(container::FILE_EXTENSION));
+    for (uint8_t byte : key) {
+        name += hexDigits[byte >> 4];
+        name += hexDigits[byte & 0xF];
+    }
+    name += container::FILE_EXTENSION;
+    return name;
+}
+
+bool MeshDiskCache::setDirectory(const std::string& directory, uint64_t maxBytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    root.clear();
+    entries.clear();
+    totalBytes = 0;
+    byteLimit = maxBytes;
+
+    if (directory.empty()) {
+        MIDDLEWARE_LOG_INFO("Mesh disk cache disabled");
+        return true;
+    }
+
+    std::filesystem::path path(directory);
+    std::error_code ec;
+    std::filesystem::create_directories(path, ec);
+    if (ec || !std::filesystem::is_directory(path, ec) || !indexDirectory(path)) {
+        MIDDLEWARE_LOG_ERROR("Cannot use mesh disk cache directory %s%s%s", directory.c_str(),
+                             ec ? ": " : "", ec ? ec.message().c_str() : "");
+        entries.clear();
+        totalBytes = 0;
+        return false;
+    }
+
+    root = std::move(path);
+    evictLocked();
+    MIDDLEWARE_LOG_INFO("Mesh disk cache at %s: %zu entries, %llu of %llu bytes", directory.c_str(),
+                        entries.size(), static_cast<unsigned long long>(totalBytes),
+                        static_cast<unsigned long long>(byteLimit));
+    return true;
+}
+
+bool MeshDiskCache::indexDirectory(const std::filesystem::path& directory) {
+    std::error_code ec;
+    std::filesystem::directory_iterator it(directory, ec);
+    if (ec) {
+        return false;
+    }
+
+    for (; it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        if (ec) {
+            return false;
+        }
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+
+        const std::filesystem::path& path = it->path();
+        const std::string name = path.filename().string();
+        if (name.find(TEMPORARY_SUFFIX) != std::string::npos) {
+            // Left behind by a process that stopped while writing
+            std::filesystem::remove(path, ec);
+            continue;
+        }
+        if (path.extension() != container::FILE_EXTENSION) {
+            continue;
+        }
+
+        Entry entry;
+        entry.size = it->file_size(ec);
+        entry.lastUse = it->last_write_time(ec);
+        if (!ec) {
+            totalBytes += entry.size;
+            entries.emplace(name, entry);
+        }
+    }
+    return true;
+}
+
+bool MeshDiskCache::isEnabled() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !root.empty();
+}
+
+bool MeshDiskCache::makeKey(const std::string& sourcePath, uint64_t optionsFingerprint, ContentDigest& key) {
+    std::error_code ec;
+    std::filesystem::path path = std::filesystem::canonical(sourcePath, ec);
+    if (ec) {
+        return false;
+    }
+    const uint64_t size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return false;
+    }
+    const auto modified = std::filesystem::last_write_time(path, ec).time_since_epoch().count();
+    if (ec) {
+        return false;
+    }
+
+    std::string material = path.string();
+    appendBytes(material, FORMAT_VERSION);
+    appendBytes(material, container::VERSION);
+    appendBytes(material, size);
+    appendBytes(material, static_cast<int64_t>(modified));
+    appendBytes(material, optionsFingerprint);
+    return HashVerifier::calculateDigest(reinterpret_cast<const uint8_t*>(material.data()), material.size(), key);
+}
+
+std::shared_ptr<MappedFile> MeshDiskCache::find(const ContentDigest& key) {
+    const std::string name = fileName(key);
+    std::filesystem::path path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (root.empty() || entries.find(name) == entries.end()) {
+            ++counters.misses;
+            return nullptr;
+        }
+        path = root / name;
+    }
+
+    std::shared_ptr<MappedFile> mapped = MappedFile::open(path.string());
+    const bool valid = mapped && container::isContainer(mapped->data(), mapped->size());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(name);
+    if (!valid) {
+        // Truncated or written by an incompatible build: drop it so it is rebuilt
+        MIDDLEWARE_LOG_WARNING("Discarding unreadable mesh disk cache entry %s", name.c_str());
+        mapped.reset();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        if (it != entries.end()) {
+            totalBytes -= it->second.size;
+            entries.erase(it);
+        }
+        ++counters.misses;
+        return nullptr;
+    }
+
+    const auto now = std::filesystem::file_time_type::clock::now();
+    if (it != entries.end()) {
+        it->second.lastUse = now;
+    }
+    std::error_code ec;
+    std::filesystem::last_write_time(path, now, ec); // Recency for the next process; best effort
+    ++counters.hits;
+    return mapped;
+}
+
+bool MeshDiskCache::store(const ContentDigest& key, const container::MeshView* meshes, size_t count) {
+    std::filesystem::path directory;
+    uint64_t limit;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        directory = root;
+        limit = byteLimit;
+    }
+    if (directory.empty()) {
+        return false;
+    }
+
+    const size_t size = container::encodedSize(meshes, count);
+    if (size == 0) {
+        return false;
+    }
+    if (size > limit) {
+        MIDDLEWARE_LOG_DEBUG("Mesh set of %zu bytes exceeds the disk cache budget, not stored", size);
+        return false;
+    }
+
+    // Encoded and written outside the lock; the rename publishes the entry atomically
+    std::vector<uint8_t> bytes;
+    if (!container::encode(meshes, count, bytes)) {
+        return false;
+    }
+
+    const std::string name = fileName(key);
+    const std::filesystem::path path = directory / name;
+    std::filesystem::path temporary = path;
+    temporary += TEMPORARY_SUFFIX + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+    std::error_code ec;
+    if (!writeFile(temporary, bytes)) {
+        std::filesystem::remove(temporary, ec);
+        MIDDLEWARE_LOG_WARNING("Failed to write mesh disk cache entry %s", temporary.string().c_str());
+        return false;
+    }
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        MIDDLEWARE_LOG_WARNING("Failed to publish mesh disk cache entry %s: %s", path.string().c_str(),
+                               ec.message().c_str());
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (root != directory) {
+        return false; // Directory changed while writing
+    }
+    Entry& entry = entries[name];
+    totalBytes -= entry.size;
+    entry.size = bytes.size();
+    entry.lastUse = std::filesystem::file_time_type::clock::now();
+    totalBytes += entry.size;
+    ++counters.stores;
+    evictLocked();
+    return true;
+}
+
+void MeshDiskCache::evictLocked() {
+    if (totalBytes <= byteLimit) {
+        return;
+    }
+
+    std::vector<std::pair<std::filesystem::file_time_type, std::string>> byAge;
+    byAge.reserve(entries.size());
+    for (const auto& pair : entries) {
+        byAge.emplace_back(pair.second.lastUse, pair.first);
+    }
+    std::sort(byAge.begin(), byAge.end());
+
+    for (const auto& candidate : byAge) {
+        if (totalBytes <= byteLimit) {
+            break;
+        }
+        std::error_code ec;
+        std::filesystem::remove(root / candidate.second, ec);
+        auto it = entries.find(candidate.second);
+        totalBytes -= it->second.size;
+        entries.erase(it);
+        ++counters.evictions;
+    }
+}
+
+void MeshDiskCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& pair : entries) {
+        std::error_code ec;
+        std::filesystem::remove(root / pair.first, ec);
+    }
+    entries.clear();
+    totalBytes = 0;
+    if (!root.empty()) {
+        MIDDLEWARE_LOG_INFO("Mesh disk cache cleared: %s", root.string().c_str());
+    }
+}
+
+MeshDiskCache::Stats MeshDiskCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats snapshot = counters;
+    snapshot.entries = entries.size();
+    snapshot.bytes = totalBytes;
+    return snapshot;
+}
+
+} // namespace anari_usd_middleware
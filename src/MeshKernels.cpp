@@ -0,0 +1,619 @@
+#include "MeshKernels.h"
+
+#include <atomic>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define JUSYNC_KERNELS_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+// MSVC accepts AVX2 intrinsics in any function
+#define JUSYNC_TARGET_AVX2
+#else
+#define JUSYNC_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define JUSYNC_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace anari_usd_middleware {
+namespace kernels {
+
+namespace {
+
+// Squared length below which a normal is treated as degenerate (matches safety::EPSILON on the length)
+constexpr float MIN_NORMAL_LENGTH_SQ = 1e-20f;
+
+// ============================================================================
+// Scalar reference implementations (also used for loop tails)
+// ============================================================================
+namespace scalar {
+
+bool allFinite(const float* values, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (!std::isfinite(values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void transformPoints(const float* m, const float* in, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const float x = in[i * 3 + 0];
+        const float y = in[i * 3 + 1];
+        const float z = in[i * 3 + 2];
+        out[i * 3 + 0] = m[0] * x + m[4] * y + m[8] * z + m[12];
+        out[i * 3 + 1] = m[1] * x + m[5] * y + m[9] * z + m[13];
+        out[i * 3 + 2] = m[2] * x + m[6] * y + m[10] * z + m[14];
+    }
+}
+
+void transformNormals(const float* m, const float* in, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const float x = in[i * 3 + 0];
+        const float y = in[i * 3 + 1];
+        const float z = in[i * 3 + 2];
+        float nx = m[0] * x + m[4] * y + m[8] * z;
+        float ny = m[1] * x + m[5] * y + m[9] * z;
+        float nz = m[2] * x + m[6] * y + m[10] * z;
+
+        const float lengthSq = nx * nx + ny * ny + nz * nz;
+        if (lengthSq > MIN_NORMAL_LENGTH_SQ) {
+            const float length = std::sqrt(lengthSq);
+            nx /= length;
+            ny /= length;
+            nz /= length;
+        } else {
+            nx = 0.0f;
+            ny = 1.0f;
+            nz = 0.0f;
+        }
+
+        out[i * 3 + 0] = nx;
+        out[i * 3 + 1] = ny;
+        out[i * 3 + 2] = nz;
+    }
+}
+
+inline uint8_t packChannel(float value) {
+    float scaled = value * 255.0f;
+    scaled = scaled > 0.0f ? scaled : 0.0f; // Also maps NaN to 0
+    scaled = scaled < 255.0f ? scaled : 255.0f;
+    return static_cast<uint8_t>(scaled);
+}
+
+void packColors(const float* rgba, uint8_t* out, size_t count, ColorOrder order) {
+    const bool bgra = (order == ColorOrder::Bgra);
+    for (size_t i = 0; i < count; ++i) {
+        const float* src = rgba + i * 4;
+        uint8_t* dst = out + i * 4;
+        dst[0] = packChannel(bgra ? src[2] : src[0]);
+        dst[1] = packChannel(src[1]);
+        dst[2] = packChannel(bgra ? src[0] : src[2]);
+        dst[3] = packChannel(src[3]);
+    }
+}
+
+} // namespace scalar
+
+#ifdef JUSYNC_KERNELS_X86
+
+// ============================================================================
+// SSE2 (baseline on x86-64)
+// ============================================================================
+namespace sse2 {
+
+// Split four packed xyz points (three registers) into x, y and z registers
+inline void deinterleave(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z) {
+    // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+    x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                       _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                       _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+inline void interleave(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c) {
+    a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                       _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                       _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                       _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+bool allFinite(const float* values, size_t count) {
+    const __m128i exponentMask = _mm_set1_epi32(0x7f800000);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i bits = _mm_castps_si128(_mm_loadu_ps(values + i));
+        __m128i special = _mm_cmpeq_epi32(_mm_and_si128(bits, exponentMask), exponentMask);
+        if (_mm_movemask_epi8(special) != 0) {
+            return false;
+        }
+    }
+    return scalar::allFinite(values + i, count - i);
+}
+
+void transformPoints(const float* m, const float* in, float* out, size_t count) {
+    const __m128 m00 = _mm_set1_ps(m[0]), m01 = _mm_set1_ps(m[1]), m02 = _mm_set1_ps(m[2]);
+    const __m128 m10 = _mm_set1_ps(m[4]), m11 = _mm_set1_ps(m[5]), m12 = _mm_set1_ps(m[6]);
+    const __m128 m20 = _mm_set1_ps(m[8]), m21 = _mm_set1_ps(m[9]), m22 = _mm_set1_ps(m[10]);
+    const __m128 m30 = _mm_set1_ps(m[12]), m31 = _mm_set1_ps(m[13]), m32 = _mm_set1_ps(m[14]);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* src = in + i * 3;
+        __m128 x, y, z;
+        deinterleave(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+
+        __m128 ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m10, y)),
+                               _mm_add_ps(_mm_mul_ps(m20, z), m30));
+        __m128 oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m01, x), _mm_mul_ps(m11, y)),
+                               _mm_add_ps(_mm_mul_ps(m21, z), m31));
+        __m128 oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m02, x), _mm_mul_ps(m12, y)),
+                               _mm_add_ps(_mm_mul_ps(m22, z), m32));
+
+        __m128 a, b, c;
+        interleave(ox, oy, oz, a, b, c);
+        float* dst = out + i * 3;
+        _mm_storeu_ps(dst, a);
+        _mm_storeu_ps(dst + 4, b);
+        _mm_storeu_ps(dst + 8, c);
+    }
+    scalar::transformPoints(m, in + i * 3, out + i * 3, count - i);
+}
+
+void transformNormals(const float* m, const float* in, float* out, size_t count) {
+    const __m128 m00 = _mm_set1_ps(m[0]), m01 = _mm_set1_ps(m[1]), m02 = _mm_set1_ps(m[2]);
+    const __m128 m10 = _mm_set1_ps(m[4]), m11 = _mm_set1_ps(m[5]), m12 = _mm_set1_ps(m[6]);
+    const __m128 m20 = _mm_set1_ps(m[8]), m21 = _mm_set1_ps(m[9]), m22 = _mm_set1_ps(m[10]);
+    const __m128 minLengthSq = _mm_set1_ps(MIN_NORMAL_LENGTH_SQ);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* src = in + i * 3;
+        __m128 x, y, z;
+        deinterleave(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+
+        __m128 nx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m10, y)), _mm_mul_ps(m20, z));
+        __m128 ny = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m01, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m21, z));
+        __m128 nz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m02, x), _mm_mul_ps(m12, y)), _mm_mul_ps(m22, z));
+
+        __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(ny, ny)), _mm_mul_ps(nz, nz));
+        __m128 valid = _mm_cmpgt_ps(lengthSq, minLengthSq);
+        __m128 length = _mm_sqrt_ps(lengthSq);
+
+        // Degenerate lanes fall back to the up vector
+        nx = _mm_and_ps(valid, _mm_div_ps(nx, length));
+        ny = _mm_or_ps(_mm_and_ps(valid, _mm_div_ps(ny, length)), _mm_andnot_ps(valid, one));
+        nz = _mm_and_ps(valid, _mm_div_ps(nz, length));
+
+        __m128 a, b, c;
+        interleave(nx, ny, nz, a, b, c);
+        float* dst = out + i * 3;
+        _mm_storeu_ps(dst, a);
+        _mm_storeu_ps(dst + 4, b);
+        _mm_storeu_ps(dst + 8, c);
+    }
+    scalar::transformNormals(m, in + i * 3, out + i * 3, count - i);
+}
+
+inline __m128i convertColor(__m128 color, __m128 scale, __m128 maxValue, bool bgra) {
+    if (bgra) {
+        color = _mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 0, 1, 2));
+    }
+    // max first so NaN lanes become 0
+    __m128 scaled = _mm_min_ps(_mm_max_ps(_mm_mul_ps(color, scale), _mm_setzero_ps()), maxValue);
+    return _mm_cvttps_epi32(scaled);
+}
+
+void packColors(const float* rgba, uint8_t* out, size_t count, ColorOrder order) {
+    const bool bgra = (order == ColorOrder::Bgra);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 maxValue = _mm_set1_ps(255.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* src = rgba + i * 4;
+        __m128i c0 = convertColor(_mm_loadu_ps(src), scale, maxValue, bgra);
+        __m128i c1 = convertColor(_mm_loadu_ps(src + 4), scale, maxValue, bgra);
+        __m128i c2 = convertColor(_mm_loadu_ps(src + 8), scale, maxValue, bgra);
+        __m128i c3 = convertColor(_mm_loadu_ps(src + 12), scale, maxValue, bgra);
+
+        __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 4), bytes);
+    }
+    scalar::packColors(rgba + i * 4, out + i * 4, count - i, order);
+}
+
+} // namespace sse2
+
+// ============================================================================
+// AVX2 + FMA: two four-point groups per iteration, one in each 128-bit lane
+// ============================================================================
+namespace avx2 {
+
+JUSYNC_TARGET_AVX2
+inline void deinterleave(__m256 a, __m256 b, __m256 c, __m256& x, __m256& y, __m256& z) {
+    x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                          _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                          _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+JUSYNC_TARGET_AVX2
+inline void interleave(__m256 x, __m256 y, __m256 z, __m256& a, __m256& b, __m256& c) {
+    a = _mm256_shuffle_ps(_mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                          _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    b = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                          _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    c = _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                          _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// Load eight packed xyz points so that lane 0 holds points 0-3 and lane 1 holds points 4-7
+JUSYNC_TARGET_AVX2
+inline void loadPoints(const float* src, __m256& a, __m256& b, __m256& c) {
+    __m256 v0 = _mm256_loadu_ps(src);
+    __m256 v1 = _mm256_loadu_ps(src + 8);
+    __m256 v2 = _mm256_loadu_ps(src + 16);
+    a = _mm256_permute2f128_ps(v0, v1, 0x30);
+    b = _mm256_permute2f128_ps(v0, v2, 0x21);
+    c = _mm256_permute2f128_ps(v1, v2, 0x30);
+}
+
+JUSYNC_TARGET_AVX2
+inline void storePoints(float* dst, __m256 a, __m256 b, __m256 c) {
+    _mm256_storeu_ps(dst, _mm256_permute2f128_ps(a, b, 0x20));
+    _mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(c, a, 0x30));
+    _mm256_storeu_ps(dst + 16, _mm256_permute2f128_ps(b, c, 0x31));
+}
+
+JUSYNC_TARGET_AVX2
+bool allFinite(const float* values, size_t count) {
+    const __m256i exponentMask = _mm256_set1_epi32(0x7f800000);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i bits = _mm256_castps_si256(_mm256_loadu_ps(values + i));
+        __m256i special = _mm256_cmpeq_epi32(_mm256_and_si256(bits, exponentMask), exponentMask);
+        if (_mm256_movemask_epi8(special) != 0) {
+            return false;
+        }
+    }
+    return sse2::allFinite(values + i, count - i);
+}
+
+JUSYNC_TARGET_AVX2
+void transformPoints(const float* m, const float* in, float* out, size_t count) {
+    const __m256 m00 = _mm256_set1_ps(m[0]), m01 = _mm256_set1_ps(m[1]), m02 = _mm256_set1_ps(m[2]);
+    const __m256 m10 = _mm256_set1_ps(m[4]), m11 = _mm256_set1_ps(m[5]), m12 = _mm256_set1_ps(m[6]);
+    const __m256 m20 = _mm256_set1_ps(m[8]), m21 = _mm256_set1_ps(m[9]), m22 = _mm256_set1_ps(m[10]);
+    const __m256 m30 = _mm256_set1_ps(m[12]), m31 = _mm256_set1_ps(m[13]), m32 = _mm256_set1_ps(m[14]);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 a, b, c, x, y, z;
+        loadPoints(in + i * 3, a, b, c);
+        deinterleave(a, b, c, x, y, z);
+
+        __m256 ox = _mm256_fmadd_ps(m00, x, _mm256_fmadd_ps(m10, y, _mm256_fmadd_ps(m20, z, m30)));
+        __m256 oy = _mm256_fmadd_ps(m01, x, _mm256_fmadd_ps(m11, y, _mm256_fmadd_ps(m21, z, m31)));
+        __m256 oz = _mm256_fmadd_ps(m02, x, _mm256_fmadd_ps(m12, y, _mm256_fmadd_ps(m22, z, m32)));
+
+        interleave(ox, oy, oz, a, b, c);
+        storePoints(out + i * 3, a, b, c);
+    }
+    sse2::transformPoints(m, in + i * 3, out + i * 3, count - i);
+}
+
+JUSYNC_TARGET_AVX2
+void transformNormals(const float* m, const float* in, float* out, size_t count) {
+    const __m256 m00 = _mm256_set1_ps(m[0]), m01 = _mm256_set1_ps(m[1]), m02 = _mm256_set1_ps(m[2]);
+    const __m256 m10 = _mm256_set1_ps(m[4]), m11 = _mm256_set1_ps(m[5]), m12 = _mm256_set1_ps(m[6]);
+    const __m256 m20 = _mm256_set1_ps(m[8]), m21 = _mm256_set1_ps(m[9]), m22 = _mm256_set1_ps(m[10]);
+    const __m256 minLengthSq = _mm256_set1_ps(MIN_NORMAL_LENGTH_SQ);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 a, b, c, x, y, z;
+        loadPoints(in + i * 3, a, b, c);
+        deinterleave(a, b, c, x, y, z);
+
+        __m256 nx = _mm256_fmadd_ps(m00, x, _mm256_fmadd_ps(m10, y, _mm256_mul_ps(m20, z)));
+        __m256 ny = _mm256_fmadd_ps(m01, x, _mm256_fmadd_ps(m11, y, _mm256_mul_ps(m21, z)));
+        __m256 nz = _mm256_fmadd_ps(m02, x, _mm256_fmadd_ps(m12, y, _mm256_mul_ps(m22, z)));
+
+        __m256 lengthSq = _mm256_fmadd_ps(nx, nx, _mm256_fmadd_ps(ny, ny, _mm256_mul_ps(nz, nz)));
+        __m256 valid = _mm256_cmp_ps(lengthSq, minLengthSq, _CMP_GT_OQ);
+        __m256 length = _mm256_sqrt_ps(lengthSq);
+
+        nx = _mm256_and_ps(valid, _mm256_div_ps(nx, length));
+        ny = _mm256_blendv_ps(one, _mm256_div_ps(ny, length), valid);
+        nz = _mm256_and_ps(valid, _mm256_div_ps(nz, length));
+
+        interleave(nx, ny, nz, a, b, c);
+        storePoints(out + i * 3, a, b, c);
+    }
+    sse2::transformNormals(m, in + i * 3, out + i * 3, count - i);
+}
+
+JUSYNC_TARGET_AVX2
+inline __m256i convertColors(__m256 colors, __m256 scale, __m256 maxValue, bool bgra) {
+    if (bgra) {
+        colors = _mm256_shuffle_ps(colors, colors, _MM_SHUFFLE(3, 0, 1, 2));
+    }
+    __m256 scaled = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(colors, scale), _mm256_setzero_ps()), maxValue);
+    return _mm256_cvttps_epi32(scaled);
+}
+
+JUSYNC_TARGET_AVX2
+void packColors(const float* rgba, uint8_t* out, size_t count, ColorOrder order) {
+    const bool bgra = (order == ColorOrder::Bgra);
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    const __m256 maxValue = _mm256_set1_ps(255.0f);
+    // The in-lane packs leave colors in the order 0 2 4 6 1 3 5 7
+    const __m256i restoreOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float* src = rgba + i * 4;
+        __m256i c01 = convertColors(_mm256_loadu_ps(src), scale, maxValue, bgra);
+        __m256i c23 = convertColors(_mm256_loadu_ps(src + 8), scale, maxValue, bgra);
+        __m256i c45 = convertColors(_mm256_loadu_ps(src + 16), scale, maxValue, bgra);
+        __m256i c67 = convertColors(_mm256_loadu_ps(src + 24), scale, maxValue, bgra);
+
+        __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(c01, c23), _mm256_packs_epi32(c45, c67));
+        bytes = _mm256_permutevar8x32_epi32(bytes, restoreOrder);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 4), bytes);
+    }
+    sse2::packColors(rgba + i * 4, out + i * 4, count - i, order);
+}
+
+} // namespace avx2
+
+bool cpuSupportsAvx2() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !fma || !avx) {
+        return false;
+    }
+    // The OS must save the upper halves of the YMM registers
+    if ((_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+
+#endif // JUSYNC_KERNELS_X86
+
+#ifdef JUSYNC_KERNELS_NEON
+
+// ============================================================================
+// NEON (always available on ARM64)
+// ============================================================================
+namespace neon {
+
+bool allFinite(const float* values, size_t count) {
+    const uint32x4_t exponentMask = vdupq_n_u32(0x7f800000);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t bits = vreinterpretq_u32_f32(vld1q_f32(values + i));
+        uint32x4_t special = vceqq_u32(vandq_u32(bits, exponentMask), exponentMask);
+        if (vmaxvq_u32(special) != 0) {
+            return false;
+        }
+    }
+    return scalar::allFinite(values + i, count - i);
+}
+
+void transformPoints(const float* m, const float* in, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4x3_t p = vld3q_f32(in + i * 3);
+        float32x4x3_t o;
+        o.val[0] = vfmaq_n_f32(vfmaq_n_f32(vfmaq_n_f32(vdupq_n_f32(m[12]), p.val[2], m[8]), p.val[1], m[4]), p.val[0], m[0]);
+        o.val[1] = vfmaq_n_f32(vfmaq_n_f32(vfmaq_n_f32(vdupq_n_f32(m[13]), p.val[2], m[9]), p.val[1], m[5]), p.val[0], m[1]);
+        o.val[2] = vfmaq_n_f32(vfmaq_n_f32(vfmaq_n_f32(vdupq_n_f32(m[14]), p.val[2], m[10]), p.val[1], m[6]), p.val[0], m[2]);
+        vst3q_f32(out + i * 3, o);
+    }
+    scalar::transformPoints(m, in + i * 3, out + i * 3, count - i);
+}
+
+void transformNormals(const float* m, const float* in, float* out, size_t count) {
+    const float32x4_t minLengthSq = vdupq_n_f32(MIN_NORMAL_LENGTH_SQ);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4x3_t p = vld3q_f32(in + i * 3);
+        float32x4_t nx = vfmaq_n_f32(vfmaq_n_f32(vmulq_n_f32(p.val[2], m[8]), p.val[1], m[4]), p.val[0], m[0]);
+        float32x4_t ny = vfmaq_n_f32(vfmaq_n_f32(vmulq_n_f32(p.val[2], m[9]), p.val[1], m[5]), p.val[0], m[1]);
+        float32x4_t nz = vfmaq_n_f32(vfmaq_n_f32(vmulq_n_f32(p.val[2], m[10]), p.val[1], m[6]), p.val[0], m[2]);
+
+        float32x4_t lengthSq = vfmaq_f32(vfmaq_f32(vmulq_f32(nz, nz), ny, ny), nx, nx);
+        uint32x4_t valid = vcgtq_f32(lengthSq, minLengthSq);
+        float32x4_t length = vsqrtq_f32(lengthSq);
+
+        float32x4x3_t o;
+        o.val[0] = vbslq_f32(valid, vdivq_f32(nx, length), zero);
+        o.val[1] = vbslq_f32(valid, vdivq_f32(ny, length), one);
+        o.val[2] = vbslq_f32(valid, vdivq_f32(nz, length), zero);
+        vst3q_f32(out + i * 3, o);
+    }
+    scalar::transformNormals(m, in + i * 3, out + i * 3, count - i);
+}
+
+inline uint16x4_t convertColor(float32x4_t color, float32x4_t scale, float32x4_t maxValue) {
+    // vmaxnm returns the number when one operand is NaN
+    float32x4_t scaled = vminq_f32(vmaxnmq_f32(vmulq_f32(color, scale), vdupq_n_f32(0.0f)), maxValue);
+    return vmovn_u32(vcvtq_u32_f32(scaled));
+}
+
+void packColors(const float* rgba, uint8_t* out, size_t count, ColorOrder order) {
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+    const float32x4_t maxValue = vdupq_n_f32(255.0f);
+    static const uint8_t bgraShuffle[16] = {2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15};
+    const uint8x16_t swizzle = vld1q_u8(bgraShuffle);
+    const bool bgra = (order == ColorOrder::Bgra);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* src = rgba + i * 4;
+        uint16x8_t c01 = vcombine_u16(convertColor(vld1q_f32(src), scale, maxValue),
+                                      convertColor(vld1q_f32(src + 4), scale, maxValue));
+        uint16x8_t c23 = vcombine_u16(convertColor(vld1q_f32(src + 8), scale, maxValue),
+                                      convertColor(vld1q_f32(src + 12), scale, maxValue));
+        uint8x16_t bytes = vcombine_u8(vmovn_u16(c01), vmovn_u16(c23));
+        if (bgra) {
+            bytes = vqtbl1q_u8(bytes, swizzle);
+        }
+        vst1q_u8(out + i * 4, bytes);
+    }
+    scalar::packColors(rgba + i * 4, out + i * 4, count - i, order);
+}
+
+} // namespace neon
+
+#endif // JUSYNC_KERNELS_NEON
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+struct KernelTable {
+    InstructionSet isa;
+    bool (*allFinite)(const float*, size_t);
+    void (*transformPoints)(const float*, const float*, float*, size_t);
+    void (*transformNormals)(const float*, const float*, float*, size_t);
+    void (*packColors)(const float*, uint8_t*, size_t, ColorOrder);
+};
+
+const KernelTable scalarTable = {InstructionSet::Scalar, scalar::allFinite, scalar::transformPoints,
+                                 scalar::transformNormals, scalar::packColors};
+#ifdef JUSYNC_KERNELS_X86
+const KernelTable sse2Table = {InstructionSet::Sse2, sse2::allFinite, sse2::transformPoints,
+                               sse2::transformNormals, sse2::packColors};
+const KernelTable avx2Table = {InstructionSet::Avx2, avx2::allFinite, avx2::transformPoints,
+                               avx2::transformNormals, avx2::packColors};
+#endif
+#ifdef JUSYNC_KERNELS_NEON
+const KernelTable neonTable = {InstructionSet::Neon, neon::allFinite, neon::transformPoints,
+                               neon::transformNormals, neon::packColors};
+#endif
+
+const KernelTable* tableFor(InstructionSet isa) {
+    switch (isa) {
+        case InstructionSet::Scalar:
+            return &scalarTable;
+#ifdef JUSYNC_KERNELS_X86
+        case InstructionSet::Sse2:
+            return &sse2Table;
+        case InstructionSet::Avx2:
+            return cpuSupportsAvx2() ? &avx2Table : nullptr;
+#endif
+#ifdef JUSYNC_KERNELS_NEON
+        case InstructionSet::Neon:
+            return &neonTable;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+const KernelTable* detectBestTable() {
+#ifdef JUSYNC_KERNELS_X86
+    return cpuSupportsAvx2() ? &avx2Table : &sse2Table;
+#elif defined(JUSYNC_KERNELS_NEON)
+    return &neonTable;
+#else
+    return &scalarTable;
+#endif
+}
+
+std::atomic<const KernelTable*> activeTable{nullptr};
+
+const KernelTable& kernelTable() {
+    const KernelTable* table = activeTable.load(std::memory_order_acquire);
+    if (!table) {
+        // Detection is idempotent, so racing first callers store the same table
+        table = detectBestTable();
+        activeTable.store(table, std::memory_order_release);
+    }
+    return *table;
+}
+
+} // namespace
+
+InstructionSet activeInstructionSet() {
+    return kernelTable().isa;
+}
+
+bool setInstructionSet(InstructionSet isa) {
+    const KernelTable* table = tableFor(isa);
+    if (!table) {
+        return false;
+    }
+    activeTable.store(table, std::memory_order_release);
+    return true;
+}
+
+const char* instructionSetName(InstructionSet isa) {
+    switch (isa) {
+        case InstructionSet::Scalar: return "Scalar";
+        case InstructionSet::Sse2: return "SSE2";
+        case InstructionSet::Avx2: return "AVX2";
+        case InstructionSet::Neon: return "NEON";
+    }
+    return "Unknown";
+}
+
+bool allFinite(const float* values, size_t count) {
+    if (!values || count == 0) {
+        return true;
+    }
+    return kernelTable().allFinite(values, count);
+}
+
+void transformPoints(const float* matrix, const float* in, float* out, size_t count) {
+    if (!matrix || !in || !out || count == 0) {
+        return;
+    }
+    kernelTable().transformPoints(matrix, in, out, count);
+}
+
+void transformNormals(const float* matrix, const float* in, float* out, size_t count) {
+    if (!matrix || !in || !out || count == 0) {
+        return;
+    }
+    kernelTable().transformNormals(matrix, in, out, count);
+}
+
+void packColors(const float* rgba, uint8_t* out, size_t count, ColorOrder order) {
+    if (!rgba || !out || count == 0) {
+        return;
+    }
+    kernelTable().packColors(rgba, out, count, order);
+}
+
+} // namespace kernels
+} // namespace anari_usd_middleware
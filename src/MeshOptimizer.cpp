@@ -0,0 +1,367 @@
+#include "MeshOptimizer.h"
+#include "MiddlewareLogging.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace anari_usd_middleware {
+namespace optimize {
+
+namespace {
+
+bool isValidIndexBuffer(const uint32_t* indices, size_t indexCount, size_t vertexCount) {
+    if (!indices || indexCount % 3 != 0 || vertexCount == 0 || vertexCount >= INVALID_INDEX) {
+        return false;
+    }
+    for (size_t i = 0; i < indexCount; ++i) {
+        if (indices[i] >= vertexCount) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Hash and equality over the canonical attribute values of a vertex, so the welding map
+// can be keyed by vertex index without copying any attribute data
+struct VertexKey {
+    const VertexStream* streams;
+    size_t streamCount;
+    double invEpsilon; // 0: exact comparison
+
+    double value(const VertexStream& stream, uint32_t v, size_t c) const {
+        double x = stream.data[size_t(v) * stream.components + c];
+        if (invEpsilon > 0.0) {
+            x = std::floor(x * invEpsilon + 0.5);
+        }
+        return x == 0.0 ? 0.0 : x; // -0 and +0 compare equal
+    }
+
+    size_t operator()(uint32_t v) const {
+        uint64_t hash = 14695981039346656037ull; // FNV-1a
+        for (size_t s = 0; s < streamCount; ++s) {
+            for (size_t c = 0; c < streams[s].components; ++c) {
+                double x = value(streams[s], v, c);
+                uint64_t bits;
+                std::memcpy(&bits, &x, sizeof(bits));
+                hash = (hash ^ bits) * 1099511628211ull;
+            }
+        }
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    }
+
+    bool operator()(uint32_t a, uint32_t b) const {
+        for (size_t s = 0; s < streamCount; ++s) {
+            for (size_t c = 0; c < streams[s].components; ++c) {
+                double x = value(streams[s], a, c);
+                double y = value(streams[s], b, c);
+                if (std::memcmp(&x, &y, sizeof(x)) != 0) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// Triangles adjacent to each vertex, in compressed row form
+struct Adjacency {
+    std::vector<uint32_t> offsets; // vertexCount + 1
+    std::vector<uint32_t> triangles;
+
+    Adjacency(const uint32_t* indices, size_t indexCount, size_t vertexCount)
+        : offsets(vertexCount + 1, 0), triangles(indexCount) {
+        for (size_t i = 0; i < indexCount; ++i) {
+            ++offsets[indices[i] + 1];
+        }
+        for (size_t v = 0; v < vertexCount; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < indexCount; ++i) {
+            triangles[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+};
+
+} // namespace
+
+size_t weldVertices(const VertexStream* streams, size_t streamCount, size_t vertexCount,
+                    float epsilon, uint32_t* remap) {
+    if (!streams || streamCount == 0 || !remap || vertexCount == 0 || vertexCount >= INVALID_INDEX ||
+        !(epsilon >= 0.0f) || !std::isfinite(epsilon)) {
+        MIDDLEWARE_LOG_ERROR("Invalid input to weldVertices");
+        return 0;
+    }
+    for (size_t s = 0; s < streamCount; ++s) {
+        if (!streams[s].data || streams[s].components == 0 || streams[s].components > 4) {
+            MIDDLEWARE_LOG_ERROR("Invalid vertex stream %zu passed to weldVertices", s);
+            return 0;
+        }
+    }
+
+    VertexKey key{streams, streamCount, epsilon > 0.0f ? 1.0 / epsilon : 0.0};
+    std::unordered_map<uint32_t, uint32_t, VertexKey, VertexKey> unique(vertexCount, key, key);
+
+    uint32_t uniqueCount = 0;
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+        auto inserted = unique.emplace(v, uniqueCount);
+        if (inserted.second) {
+            ++uniqueCount;
+        }
+        remap[v] = inserted.first->second;
+    }
+    return uniqueCount;
+}
+
+void remapIndices(uint32_t* indices, size_t indexCount, const uint32_t* remap) {
+    for (size_t i = 0; i < indexCount; ++i) {
+        indices[i] = remap[indices[i]];
+    }
+}
+
+void remapVertexStream(const float* in, size_t components, size_t vertexCount,
+                       const uint32_t* remap, float* out) {
+    // Walk backwards so the first vertex of a welded group is written last
+    for (size_t v = vertexCount; v-- > 0;) {
+        if (remap[v] != INVALID_INDEX) {
+            std::memcpy(out + size_t(remap[v]) * components, in + v * components, components * sizeof(float));
+        }
+    }
+}
+
+size_t removeDegenerateTriangles(uint32_t* indices, size_t indexCount) {
+    size_t written = 0;
+    for (size_t i = 0; i + 2 < indexCount; i += 3) {
+        const uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        if (a == b || b == c || a == c) {
+            continue;
+        }
+        indices[written++] = a;
+        indices[written++] = b;
+        indices[written++] = c;
+    }
+    return written;
+}
+
+bool optimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount, size_t cacheSize) {
+    if (!isValidIndexBuffer(indices, indexCount, vertexCount) || cacheSize < 3) {
+        MIDDLEWARE_LOG_ERROR("Invalid input to optimizeVertexCache");
+        return false;
+    }
+    if (indexCount == 0) {
+        return true;
+    }
+
+    const size_t triangleCount = indexCount / 3;
+    const Adjacency adjacency(indices, indexCount, vertexCount);
+
+    std::vector<uint32_t> live(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        live[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+    }
+    std::vector<size_t> cacheTime(vertexCount, 0);
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<uint32_t> deadEnd;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> output;
+    output.reserve(indexCount);
+
+    size_t timestamp = cacheSize + 1;
+    size_t cursor = 0;
+    int64_t fanning = indices[0];
+
+    while (fanning >= 0) {
+        candidates.clear();
+        const uint32_t f = static_cast<uint32_t>(fanning);
+        for (uint32_t a = adjacency.offsets[f]; a < adjacency.offsets[f + 1]; ++a) {
+            const uint32_t t = adjacency.triangles[a];
+            if (emitted[t]) {
+                continue;
+            }
+            emitted[t] = 1;
+            for (int k = 0; k < 3; ++k) {
+                const uint32_t v = indices[size_t(t) * 3 + k];
+                output.push_back(v);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                --live[v];
+                if (timestamp - cacheTime[v] > cacheSize) {
+                    cacheTime[v] = timestamp++;
+                }
+            }
+        }
+
+        // Next fan: the candidate that stays in the cache longest after its remaining
+        // triangles are emitted, else the most recent dead-end vertex, else the next live one
+        fanning = -1;
+        int64_t bestPriority = -1;
+        for (uint32_t v : candidates) {
+            if (live[v] == 0) {
+                continue;
+            }
+            int64_t priority = 0;
+            if (timestamp - cacheTime[v] + 2 * size_t(live[v]) <= cacheSize) {
+                priority = static_cast<int64_t>(timestamp - cacheTime[v]);
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                fanning = v;
+            }
+        }
+        while (fanning < 0 && !deadEnd.empty()) {
+            const uint32_t v = deadEnd.back();
+            deadEnd.pop_back();
+            if (live[v] > 0) {
+                fanning = v;
+            }
+        }
+        while (fanning < 0 && cursor < vertexCount) {
+            if (live[cursor] > 0) {
+                fanning = static_cast<int64_t>(cursor);
+            }
+            ++cursor;
+        }
+    }
+
+    std::copy(output.begin(), output.end(), indices);
+    return true;
+}
+
+bool optimizeOverdraw(uint32_t* indices, size_t indexCount, const float* points,
+                      size_t vertexCount, size_t cacheSize) {
+    if (!isValidIndexBuffer(indices, indexCount, vertexCount) || !points || cacheSize < 3) {
+        MIDDLEWARE_LOG_ERROR("Invalid input to optimizeOverdraw");
+        return false;
+    }
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2) {
+        return true;
+    }
+
+    // A cluster starts at every triangle whose three vertices all miss the cache
+    std::vector<size_t> clusterStart;
+    std::vector<size_t> cacheTime(vertexCount, 0);
+    size_t timestamp = cacheSize + 1;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        int misses = 0;
+        for (int k = 0; k < 3; ++k) {
+            const uint32_t v = indices[t * 3 + k];
+            if (timestamp - cacheTime[v] > cacheSize) {
+                cacheTime[v] = timestamp++;
+                ++misses;
+            }
+        }
+        if (t == 0 || misses == 3) {
+            clusterStart.push_back(t);
+        }
+    }
+    const size_t clusterCount = clusterStart.size();
+    if (clusterCount < 2) {
+        return true;
+    }
+    clusterStart.push_back(triangleCount);
+
+    // Area-weighted centroid and summed normal of every cluster and of the whole mesh
+    std::vector<double> centroids(clusterCount * 3, 0.0);
+    std::vector<double> normals(clusterCount * 3, 0.0);
+    double meshCentroid[3] = {0.0, 0.0, 0.0};
+    double meshArea = 0.0;
+    for (size_t c = 0; c < clusterCount; ++c) {
+        double area = 0.0;
+        for (size_t t = clusterStart[c]; t < clusterStart[c + 1]; ++t) {
+            const float* p0 = points + size_t(indices[t * 3]) * 3;
+            const float* p1 = points + size_t(indices[t * 3 + 1]) * 3;
+            const float* p2 = points + size_t(indices[t * 3 + 2]) * 3;
+            const double e1[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+            const double e2[3] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+            const double n[3] = {e1[1] * e2[2] - e1[2] * e2[1],
+                                 e1[2] * e2[0] - e1[0] * e2[2],
+                                 e1[0] * e2[1] - e1[1] * e2[0]};
+            const double a = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int k = 0; k < 3; ++k) {
+                normals[c * 3 + k] += n[k];
+                centroids[c * 3 + k] += a * (double(p0[k]) + p1[k] + p2[k]) / 3.0;
+            }
+            area += a;
+        }
+        for (int k = 0; k < 3; ++k) {
+            meshCentroid[k] += centroids[c * 3 + k];
+            centroids[c * 3 + k] = area > 0.0 ? centroids[c * 3 + k] / area : 0.0;
+        }
+        meshArea += area;
+    }
+    if (meshArea <= 0.0) {
+        return true; // All triangles degenerate: nothing to orient by
+    }
+    for (double& m : meshCentroid) {
+        m /= meshArea;
+    }
+
+    // Clusters facing away from the mesh centre are likely to occlude the rest
+    std::vector<double> sortKey(clusterCount, 0.0);
+    for (size_t c = 0; c < clusterCount; ++c) {
+        const double* n = &normals[c * 3];
+        const double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (length > 0.0) {
+            sortKey[c] = ((centroids[c * 3] - meshCentroid[0]) * n[0] +
+                          (centroids[c * 3 + 1] - meshCentroid[1]) * n[1] +
+                          (centroids[c * 3 + 2] - meshCentroid[2]) * n[2]) / length;
+        }
+    }
+    std::vector<uint32_t> order(clusterCount);
+    for (size_t c = 0; c < clusterCount; ++c) {
+        order[c] = static_cast<uint32_t>(c);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&sortKey](uint32_t a, uint32_t b) { return sortKey[a] > sortKey[b]; });
+
+    std::vector<uint32_t> output;
+    output.reserve(indexCount);
+    for (uint32_t c : order) {
+        output.insert(output.end(), indices + clusterStart[c] * 3, indices + clusterStart[c + 1] * 3);
+    }
+    std::copy(output.begin(), output.end(), indices);
+    return true;
+}
+
+size_t optimizeVertexFetch(uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t* remap) {
+    if (!isValidIndexBuffer(indices, indexCount, vertexCount) || !remap) {
+        MIDDLEWARE_LOG_ERROR("Invalid input to optimizeVertexFetch");
+        return 0;
+    }
+
+    std::fill(remap, remap + vertexCount, INVALID_INDEX);
+    uint32_t next = 0;
+    for (size_t i = 0; i < indexCount; ++i) {
+        uint32_t& slot = remap[indices[i]];
+        if (slot == INVALID_INDEX) {
+            slot = next++;
+        }
+        indices[i] = slot;
+    }
+    return next;
+}
+
+size_t countCacheMisses(const uint32_t* indices, size_t indexCount, size_t vertexCount, size_t cacheSize) {
+    if (!indices || vertexCount == 0 || cacheSize == 0) {
+        return 0;
+    }
+
+    std::vector<size_t> cacheTime(vertexCount, 0);
+    size_t timestamp = cacheSize + 1;
+    size_t misses = 0;
+    for (size_t i = 0; i < indexCount; ++i) {
+        const uint32_t v = indices[i];
+        if (v < vertexCount && timestamp - cacheTime[v] > cacheSize) {
+            cacheTime[v] = timestamp++;
+            ++misses;
+        }
+    }
+    return misses;
+}
+
+} // namespace optimize
+} // namespace anari_usd_middleware
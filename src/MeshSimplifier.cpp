@@ -0,0 +1,255 @@
+#include "MeshSimplifier.h"
+#include "MiddlewareLogging.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace anari_usd_middleware {
+namespace lod {
+
+namespace {
+
+constexpr uint32_t UNASSIGNED = std::numeric_limits<uint32_t>::max();
+constexpr size_t MIN_GRID_RESOLUTION = 2;
+constexpr int CELL_BITS = 21;
+
+// Squared length below which an averaged normal is treated as degenerate
+constexpr float MIN_NORMAL_LENGTH_SQ = 1e-20f;
+
+struct Bounds {
+    float lo[3];
+    float extent; // Longest axis
+};
+
+// Uniform cubic cells anchored at the bounds minimum
+struct Grid {
+    float origin[3];
+    float cellsPerUnit;
+    uint32_t maxCell;
+
+    uint64_t cellKey(const float* p) const {
+        uint64_t key = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            float c = (p[axis] - origin[axis]) * cellsPerUnit;
+            uint32_t cell = 0;
+            if (c >= static_cast<float>(maxCell)) {
+                cell = maxCell;
+            } else if (c > 0.0f) { // Also rejects NaN
+                cell = static_cast<uint32_t>(c);
+            }
+            key = (key << CELL_BITS) | cell;
+        }
+        return key;
+    }
+};
+
+bool isValidView(const MeshView& mesh) {
+    return mesh.points && mesh.vertexCount > 0 && mesh.vertexCount < UNASSIGNED &&
+           mesh.indices && mesh.indexCount >= 3 && mesh.indexCount % 3 == 0;
+}
+
+Bounds computeBounds(const MeshView& mesh) {
+    float lo[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                   std::numeric_limits<float>::max()};
+    float hi[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                   std::numeric_limits<float>::lowest()};
+    for (size_t v = 0; v < mesh.vertexCount; ++v) {
+        const float* p = mesh.points + v * 3;
+        for (int axis = 0; axis < 3; ++axis) {
+            lo[axis] = std::min(lo[axis], p[axis]);
+            hi[axis] = std::max(hi[axis], p[axis]);
+        }
+    }
+
+    Bounds bounds;
+    bounds.extent = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        bounds.lo[axis] = lo[axis];
+        bounds.extent = std::max(bounds.extent, hi[axis] - lo[axis]);
+    }
+    return bounds;
+}
+
+Grid makeGrid(const Bounds& bounds, size_t resolution) {
+    Grid grid;
+    for (int axis = 0; axis < 3; ++axis) {
+        grid.origin[axis] = bounds.lo[axis];
+    }
+    // A flat or point-sized mesh collapses into the first cell along every axis
+    grid.cellsPerUnit = bounds.extent > 0.0f ? static_cast<float>(resolution) / bounds.extent : 0.0f;
+    grid.maxCell = static_cast<uint32_t>(resolution - 1);
+    return grid;
+}
+
+size_t countOccupiedCells(const MeshView& mesh, const Grid& grid) {
+    std::unordered_set<uint64_t> cells;
+    cells.reserve(std::min<size_t>(mesh.vertexCount, 1u << 20));
+    for (size_t v = 0; v < mesh.vertexCount; ++v) {
+        cells.insert(grid.cellKey(mesh.points + v * 3));
+    }
+    return cells.size();
+}
+
+bool clusterOnGrid(const MeshView& mesh, const Grid& grid, SimplifiedMesh& out) {
+    out = SimplifiedMesh{};
+
+    // Only vertices used by a triangle are assigned a cell
+    std::vector<uint32_t> clusterOf(mesh.vertexCount, UNASSIGNED);
+    std::unordered_map<uint64_t, uint32_t> cellCluster;
+    cellCluster.reserve(std::min<size_t>(mesh.vertexCount, 1u << 20));
+    auto clusterFor = [&](uint32_t v) {
+        if (clusterOf[v] == UNASSIGNED) {
+            auto inserted = cellCluster.emplace(grid.cellKey(mesh.points + size_t(v) * 3),
+                                                static_cast<uint32_t>(cellCluster.size()));
+            clusterOf[v] = inserted.first->second;
+        }
+        return clusterOf[v];
+    };
+
+    for (size_t i = 0; i < mesh.indexCount; i += 3) {
+        const uint32_t i0 = mesh.indices[i], i1 = mesh.indices[i + 1], i2 = mesh.indices[i + 2];
+        if (i0 >= mesh.vertexCount || i1 >= mesh.vertexCount || i2 >= mesh.vertexCount) {
+            continue;
+        }
+        const uint32_t a = clusterFor(i0), b = clusterFor(i1), c = clusterFor(i2);
+        if (a == b || b == c || a == c) {
+            continue; // Collapsed inside one cell
+        }
+        out.indices.push_back(a);
+        out.indices.push_back(b);
+        out.indices.push_back(c);
+    }
+
+    if (out.indices.empty()) {
+        return false;
+    }
+
+    // Clusters touched only by collapsed triangles are dropped; survivors are numbered in
+    // first-use order, which keeps the output vertex buffer in triangle order
+    std::vector<uint32_t> outputIndex(cellCluster.size(), UNASSIGNED);
+    uint32_t outputCount = 0;
+    for (uint32_t& index : out.indices) {
+        if (outputIndex[index] == UNASSIGNED) {
+            outputIndex[index] = outputCount++;
+        }
+        index = outputIndex[index];
+    }
+
+    std::vector<uint32_t> members(outputCount, 0);
+    out.points.assign(size_t(outputCount) * 3, 0.0f);
+    if (mesh.normals) {
+        out.normals.assign(size_t(outputCount) * 3, 0.0f);
+    }
+    if (mesh.uvs) {
+        out.uvs.assign(size_t(outputCount) * 2, 0.0f);
+    }
+    if (mesh.colors) {
+        out.colors.assign(size_t(outputCount) * 4, 0.0f);
+    }
+
+    for (size_t v = 0; v < mesh.vertexCount; ++v) {
+        if (clusterOf[v] == UNASSIGNED || outputIndex[clusterOf[v]] == UNASSIGNED) {
+            continue;
+        }
+        const size_t o = outputIndex[clusterOf[v]];
+        ++members[o];
+        for (int k = 0; k < 3; ++k) {
+            out.points[o * 3 + k] += mesh.points[v * 3 + k];
+        }
+        if (mesh.normals) {
+            for (int k = 0; k < 3; ++k) {
+                out.normals[o * 3 + k] += mesh.normals[v * 3 + k];
+            }
+        }
+        if (mesh.uvs) {
+            for (int k = 0; k < 2; ++k) {
+                out.uvs[o * 2 + k] += mesh.uvs[v * 2 + k];
+            }
+        }
+        if (mesh.colors) {
+            for (int k = 0; k < 4; ++k) {
+                out.colors[o * 4 + k] += mesh.colors[v * 4 + k];
+            }
+        }
+    }
+
+    for (size_t o = 0; o < outputCount; ++o) {
+        const float inv = 1.0f / static_cast<float>(members[o]);
+        for (int k = 0; k < 3; ++k) {
+            out.points[o * 3 + k] *= inv;
+        }
+        if (!out.uvs.empty()) {
+            out.uvs[o * 2] *= inv;
+            out.uvs[o * 2 + 1] *= inv;
+        }
+        if (!out.colors.empty()) {
+            for (int k = 0; k < 4; ++k) {
+                out.colors[o * 4 + k] *= inv;
+            }
+        }
+        if (!out.normals.empty()) {
+            float* n = &out.normals[o * 3];
+            float lengthSq = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+            if (lengthSq > MIN_NORMAL_LENGTH_SQ) {
+                float invLength = 1.0f / std::sqrt(lengthSq);
+                n[0] *= invLength;
+                n[1] *= invLength;
+                n[2] *= invLength;
+            } else {
+                n[0] = 0.0f;
+                n[1] = 1.0f;
+                n[2] = 0.0f;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool clusterVertices(const MeshView& mesh, size_t gridResolution, SimplifiedMesh& out) {
+    if (!isValidView(mesh)) {
+        MIDDLEWARE_LOG_ERROR("Invalid mesh passed to vertex clustering");
+        return false;
+    }
+    if (gridResolution < MIN_GRID_RESOLUTION || gridResolution > MAX_GRID_RESOLUTION) {
+        MIDDLEWARE_LOG_ERROR("Invalid clustering grid resolution: %zu (must be %zu-%zu)",
+                             gridResolution, MIN_GRID_RESOLUTION, MAX_GRID_RESOLUTION);
+        return false;
+    }
+    return clusterOnGrid(mesh, makeGrid(computeBounds(mesh), gridResolution), out);
+}
+
+bool simplifyToTarget(const MeshView& mesh, size_t targetTriangles, SimplifiedMesh& out) {
+    if (!isValidView(mesh)) {
+        MIDDLEWARE_LOG_ERROR("Invalid mesh passed to simplification");
+        return false;
+    }
+
+    // A closed surface has about twice as many triangles as vertices, and the number of
+    // occupied cells grows with the square of the resolution
+    const double targetVertices = std::max<double>(static_cast<double>(targetTriangles) / 2.0, 4.0);
+    auto clampResolution = [](double resolution) {
+        return static_cast<size_t>(std::min<double>(std::max<double>(resolution, MIN_GRID_RESOLUTION),
+                                                    MAX_GRID_RESOLUTION));
+    };
+
+    const Bounds bounds = computeBounds(mesh);
+    size_t resolution = clampResolution(std::sqrt(targetVertices));
+    const size_t occupied = countOccupiedCells(mesh, makeGrid(bounds, resolution));
+    if (occupied > 0) {
+        resolution = clampResolution(static_cast<double>(resolution) *
+                                     std::sqrt(targetVertices / static_cast<double>(occupied)));
+    }
+
+    bool result = clusterOnGrid(mesh, makeGrid(bounds, resolution), out);
+    MIDDLEWARE_LOG_DEBUG("Simplified %zu -> %zu triangles (target %zu, grid %zu)",
+                         mesh.indexCount / 3, out.triangleCount(), targetTriangles, resolution);
+    return result;
+}
+
+} // namespace lod
+} // namespace anari_usd_middleware
@@ -0,0 +1,158 @@
+#include "MeshTriangulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace anari_usd_middleware {
+namespace triangulate {
+
+namespace {
+
+inline bool isTriangulated(int32_t corners) {
+    return corners >= 3 && corners <= MAX_FACE_VERTICES;
+}
+
+inline void accumulateFaceNormal(const float* points, uint32_t i0, uint32_t i1, uint32_t i2, float* normalSums) {
+    const float* p0 = points + static_cast<size_t>(i0) * 3;
+    const float* p1 = points + static_cast<size_t>(i1) * 3;
+    const float* p2 = points + static_cast<size_t>(i2) * 3;
+    const float e1x = p1[0] - p0[0], e1y = p1[1] - p0[1], e1z = p1[2] - p0[2];
+    const float e2x = p2[0] - p0[0], e2y = p2[1] - p0[1], e2z = p2[2] - p0[2];
+    float nx = e1y * e2z - e1z * e2y;
+    float ny = e1z * e2x - e1x * e2z;
+    float nz = e1x * e2y - e1y * e2x;
+
+    const float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+    if (!(length > DEGENERATE_LENGTH)) {
+        return;
+    }
+    nx /= length;
+    ny /= length;
+    nz /= length;
+
+    for (uint32_t index : {i0, i1, i2}) {
+        float* sum = normalSums + static_cast<size_t>(index) * 3;
+        sum[0] += nx;
+        sum[1] += ny;
+        sum[2] += nz;
+    }
+}
+
+} // namespace
+
+void planFaceRanges(const int32_t* faceCounts, size_t faceCount, size_t cornerCount, size_t rangeCount, Plan& out) {
+    out.ranges.clear();
+    out.indexCount = 0;
+    out.skippedFaces = 0;
+    out.truncated = false;
+    if (!faceCounts || faceCount == 0) {
+        return;
+    }
+
+    const size_t facesPerRange = (faceCount + std::max<size_t>(rangeCount, 1) - 1) / std::max<size_t>(rangeCount, 1);
+    out.ranges.reserve((faceCount + facesPerRange - 1) / facesPerRange);
+
+    size_t corner = 0;
+    size_t face = 0;
+    for (; face < faceCount; ++face) {
+        if (face % facesPerRange == 0) {
+            if (!out.ranges.empty()) {
+                FaceRange& previous = out.ranges.back();
+                previous.faceCount = face - previous.firstFace;
+            }
+            FaceRange range;
+            range.firstFace = face;
+            range.firstCorner = corner;
+            range.firstIndex = out.indexCount;
+            out.ranges.push_back(range);
+        }
+
+        const int32_t corners = faceCounts[face];
+        if (!isTriangulated(corners)) {
+            ++out.skippedFaces;
+            corner += static_cast<size_t>(std::max(corners, 0));
+            continue;
+        }
+        if (corner + static_cast<size_t>(corners) > cornerCount) {
+            out.truncated = true;
+            break;
+        }
+
+        const size_t indices = static_cast<size_t>(corners - 2) * 3;
+        out.ranges.back().indexCount += indices;
+        out.indexCount += indices;
+        corner += static_cast<size_t>(corners);
+    }
+
+    FaceRange& last = out.ranges.back();
+    last.faceCount = face - last.firstFace;
+    if (last.faceCount == 0) {
+        out.ranges.pop_back();
+    }
+}
+
+size_t sweepFaceRange(const int32_t* faceCounts, const int32_t* faceIndices, const FaceRange& range,
+                      const float* points, size_t vertexCount, uint32_t* outIndices, float* normalSums) {
+    uint32_t* out = outIndices + range.firstIndex;
+    uint32_t* const begin = out;
+    size_t corner = range.firstCorner;
+    const bool withNormals = normalSums && points;
+
+    for (size_t face = range.firstFace; face < range.firstFace + range.faceCount; ++face) {
+        const int32_t corners = faceCounts[face];
+        if (!isTriangulated(corners)) {
+            corner += static_cast<size_t>(std::max(corners, 0));
+            continue;
+        }
+
+        const int32_t* faceCorners = faceIndices + corner;
+        const uint32_t i0 = static_cast<uint32_t>(faceCorners[0]);
+        for (int32_t t = 1; t + 1 < corners; ++t) {
+            const uint32_t i1 = static_cast<uint32_t>(faceCorners[t]);
+            const uint32_t i2 = static_cast<uint32_t>(faceCorners[t + 1]);
+            if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+                continue;
+            }
+            out[0] = i0;
+            out[1] = i1;
+            out[2] = i2;
+            out += 3;
+            if (withNormals) {
+                accumulateFaceNormal(points, i0, i1, i2, normalSums);
+            }
+        }
+        corner += static_cast<size_t>(corners);
+    }
+    return static_cast<size_t>(out - begin);
+}
+
+size_t compactRanges(uint32_t* indices, const FaceRange* ranges, const size_t* written, size_t rangeCount) {
+    size_t packed = 0;
+    for (size_t r = 0; r < rangeCount; ++r) {
+        if (ranges[r].firstIndex != packed && written[r] > 0) {
+            std::memmove(indices + packed, indices + ranges[r].firstIndex, written[r] * sizeof(uint32_t));
+        }
+        packed += written[r];
+    }
+    return packed;
+}
+
+void normalizeNormals(float* normals, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        float* n = normals + i * 3;
+        const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (length > DEGENERATE_LENGTH) {
+            n[0] /= length;
+            n[1] /= length;
+            n[2] /= length;
+        } else {
+            n[0] = 0.0f;
+            n[1] = 1.0f;
+            n[2] = 0.0f;
+        }
+    }
+}
+
+} // namespace triangulate
+} // namespace anari_usd_middleware
@@ -0,0 +1,177 @@
+#include "ScratchArena.h"
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+
+namespace anari_usd_middleware {
+
+namespace {
+
+constexpr std::align_val_t CHUNK_ALIGNMENT{alignof(std::max_align_t)};
+
+uint64_t elapsedNs(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+size_t alignedOffset(const std::byte* base, size_t offset, size_t alignment) {
+    const uintptr_t address = reinterpret_cast<uintptr_t>(base) + offset;
+    const uintptr_t aligned = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    return offset + static_cast<size_t>(aligned - address);
+}
+
+} // namespace
+
+ScratchArena::~ScratchArena() {
+    for (const Chunk& chunk : chunks) {
+        ::operator delete(chunk.data, CHUNK_ALIGNMENT);
+    }
+}
+
+void* ScratchArena::allocateFromChunk(size_t bytes, size_t alignment) {
+    const Chunk& chunk = chunks[current];
+    const size_t start = alignedOffset(chunk.data, offset, alignment);
+    if (start > chunk.size || chunk.size - start < bytes) {
+        return nullptr;
+    }
+    inUse += start + bytes - offset;
+    counters.bytesAllocated += start + bytes - offset;
+    counters.peakBytes = std::max<uint64_t>(counters.peakBytes, inUse);
+    offset = start + bytes;
+    return chunk.data + start;
+}
+
+void* ScratchArena::do_allocate(size_t bytes, size_t alignment) {
+    if (current < chunks.size()) {
+        if (void* p = allocateFromChunk(bytes, alignment)) {
+            return p;
+        }
+    }
+    return refill(bytes, alignment);
+}
+
+void* ScratchArena::refill(size_t bytes, size_t alignment) {
+    // Retained chunks are tried first; the rest of the current one is abandoned until reset()
+    if (current < chunks.size()) {
+        inUse += chunks[current].size - offset;
+    }
+    for (++current; current < chunks.size(); ++current) {
+        offset = 0;
+        if (void* p = allocateFromChunk(bytes, alignment)) {
+            return p;
+        }
+        inUse += chunks[current].size;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const size_t last = chunks.empty() ? 0 : chunks.back().size;
+    const size_t grown = std::min(std::max(MIN_CHUNK_BYTES, last * 2), MAX_CHUNK_BYTES);
+    const size_t size = std::max(grown, bytes + alignment);
+    Chunk chunk{static_cast<std::byte*>(::operator new(size, CHUNK_ALIGNMENT)), size};
+    chunks.push_back(chunk);
+    current = chunks.size() - 1;
+    offset = 0;
+    ++counters.chunkAllocations;
+    counters.allocatorTimeNs += elapsedNs(start);
+    return allocateFromChunk(bytes, alignment);
+}
+
+void ScratchArena::reset() {
+    const auto start = std::chrono::steady_clock::now();
+    size_t retained = 0;
+    size_t kept = 0;
+    bool freed = false;
+    for (const Chunk& chunk : chunks) {
+        if (retained + chunk.size <= RETAINED_BYTES) {
+            retained += chunk.size;
+            chunks[kept++] = chunk;
+        } else {
+            ::operator delete(chunk.data, CHUNK_ALIGNMENT);
+            freed = true;
+        }
+    }
+    chunks.resize(kept);
+    current = 0;
+    offset = 0;
+    inUse = 0;
+    if (freed) {
+        counters.allocatorTimeNs += elapsedNs(start);
+    }
+}
+
+size_t ScratchArena::retainedBytes() const {
+    size_t total = 0;
+    for (const Chunk& chunk : chunks) {
+        total += chunk.size;
+    }
+    return total;
+}
+
+ScratchArena::Stats ScratchArena::takeStats() {
+    Stats taken = counters;
+    counters = Stats{};
+    counters.peakBytes = inUse;
+    return taken;
+}
+
+ScratchArenaPool::Lease::Lease(ScratchArenaPool* owner, std::unique_ptr<ScratchArena> arena)
+    : pool(owner), leased(std::move(arena)) {}
+
+ScratchArenaPool::Lease::Lease(Lease&& other) noexcept
+    : pool(other.pool), leased(std::move(other.leased)) {}
+
+ScratchArenaPool::Lease::~Lease() {
+    if (leased) {
+        pool->release(std::move(leased));
+    }
+}
+
+ScratchArenaPool::Lease ScratchArenaPool::acquire() {
+    std::unique_ptr<ScratchArena> arena;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++totals.leases;
+        if (!idle.empty()) {
+            arena = std::move(idle.back());
+            idle.pop_back();
+        }
+    }
+    if (!arena) {
+        arena = std::make_unique<ScratchArena>();
+    }
+    return Lease(this, std::move(arena));
+}
+
+void ScratchArenaPool::release(std::unique_ptr<ScratchArena> arena) {
+    arena->reset();
+    const ScratchArena::Stats used = arena->takeStats();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    totals.bytesAllocated += used.bytesAllocated;
+    totals.peakBytes = std::max(totals.peakBytes, used.peakBytes);
+    totals.chunkAllocations += used.chunkAllocations;
+    totals.allocatorTimeNs += used.allocatorTimeNs;
+    if (idle.size() < MAX_IDLE_ARENAS) {
+        idle.push_back(std::move(arena));
+    }
+    // Otherwise the surplus arena is freed here
+}
+
+ScratchArenaPool::Stats ScratchArenaPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats snapshot = totals;
+    snapshot.idleArenas = idle.size();
+    snapshot.retainedBytes = 0;
+    for (const auto& arena : idle) {
+        snapshot.retainedBytes += arena->retainedBytes();
+    }
+    return snapshot;
+}
+
+void ScratchArenaPool::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    totals = Stats{};
+}
+
+} // namespace anari_usd_middleware
@@ -0,0 +1,277 @@
+#include "StageProfiler.h"
+#include "MiddlewareLogging.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace anari_usd_middleware {
+namespace profiling {
+
+namespace {
+
+const char* const STAGE_NAMES[STAGE_COUNT] = {
+    "receive", "queue_wait", "decompress", "hash", "preprocess", "parse",
+    "traverse", "extract", "references", "convert", "callback",
+};
+
+int highestBit(uint64_t value) {
+#if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+uint32_t currentThreadNumber() {
+    static std::atomic<uint32_t> nextThread{0};
+    thread_local const uint32_t number = ++nextThread;
+    return number;
+}
+
+void appendJsonString(std::string& out, std::string_view text) {
+    out.push_back('"');
+    for (char c : text) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                out += escaped;
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+// Chrome trace timestamps are microseconds; keep the nanoseconds as decimals
+void appendMicroseconds(std::string& out, uint64_t ns) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%llu.%03u", static_cast<unsigned long long>(ns / 1000),
+                  static_cast<unsigned>(ns % 1000));
+    out += buffer;
+}
+
+} // namespace
+
+const char* stageName(Stage stage) {
+    const size_t index = static_cast<size_t>(stage);
+    return index < STAGE_COUNT ? STAGE_NAMES[index] : "unknown";
+}
+
+LatencyHistogram::LatencyHistogram() {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t durationNs) {
+    if (durationNs < SUB_BUCKETS) {
+        return static_cast<size_t>(durationNs);
+    }
+    const int exponent = highestBit(durationNs);
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    const uint64_t sub = (durationNs >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return static_cast<size_t>((exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub);
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    const int exponent = static_cast<int>(index / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+    const uint64_t sub = index % SUB_BUCKETS;
+    const int shift = exponent - SUB_BUCKET_BITS;
+    return ((SUB_BUCKETS + sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t durationNs) {
+    buckets[bucketIndex(durationNs)].fetch_add(1, std::memory_order_relaxed);
+    totalNs.fetch_add(durationNs, std::memory_order_relaxed);
+
+    uint64_t previous = maxNs.load(std::memory_order_relaxed);
+    while (durationNs > previous &&
+           !maxNs.compare_exchange_weak(previous, durationNs, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t LatencyHistogram::percentile(const uint64_t* counts, uint64_t total, uint64_t maxSample,
+                                      double fraction) {
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * total)));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(i), maxSample);
+        }
+    }
+    return maxSample;
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const {
+    Snapshot result;
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t bucketTotal = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts[i] = buckets[i].load(std::memory_order_relaxed);
+        bucketTotal += counts[i];
+    }
+    result.count = bucketTotal;
+    result.totalNs = totalNs.load(std::memory_order_relaxed);
+    result.maxNs = maxNs.load(std::memory_order_relaxed);
+    if (bucketTotal > 0) {
+        result.p50Ns = percentile(counts, bucketTotal, result.maxNs, 0.50);
+        result.p95Ns = percentile(counts, bucketTotal, result.maxNs, 0.95);
+        result.p99Ns = percentile(counts, bucketTotal, result.maxNs, 0.99);
+    }
+    return result;
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    totalNs.store(0, std::memory_order_relaxed);
+    maxNs.store(0, std::memory_order_relaxed);
+}
+
+uint64_t StageProfiler::now() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+void StageProfiler::record(Stage stage, uint64_t startNs, uint64_t durationNs, std::string_view detail) {
+    const size_t index = static_cast<size_t>(stage);
+    if (index >= STAGE_COUNT) {
+        return;
+    }
+    histograms[index].record(durationNs);
+
+    if (!tracing.load(std::memory_order_relaxed)) {
+        return;
+    }
+    TraceEvent event;
+    event.stage = stage;
+    event.thread = currentThreadNumber();
+    event.startNs = startNs;
+    event.durationNs = durationNs;
+    event.detail.assign(detail.data(), detail.size());
+
+    std::lock_guard<std::mutex> lock(traceMutex);
+    if (traceEvents.size() < traceCapacity) {
+        traceEvents.push_back(std::move(event));
+    } else {
+        traceEvents[traceNext] = std::move(event);
+        traceNext = (traceNext + 1) % traceCapacity;
+        ++traceOverwritten;
+    }
+}
+
+std::vector<StageProfiler::StageStats> StageProfiler::getSnapshot() const {
+    std::vector<StageStats> result(STAGE_COUNT);
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        const LatencyHistogram::Snapshot snapshot = histograms[i].snapshot();
+        StageStats& stats = result[i];
+        stats.stage = static_cast<Stage>(i);
+        stats.name = STAGE_NAMES[i];
+        stats.count = snapshot.count;
+        stats.totalNs = snapshot.totalNs;
+        stats.maxNs = snapshot.maxNs;
+        stats.p50Ns = snapshot.p50Ns;
+        stats.p95Ns = snapshot.p95Ns;
+        stats.p99Ns = snapshot.p99Ns;
+    }
+    return result;
+}
+
+void StageProfiler::reset() {
+    for (auto& histogram : histograms) {
+        histogram.reset();
+    }
+}
+
+void StageProfiler::setTraceCapture(bool enable, size_t maxEvents) {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    if (enable) {
+        traceCapacity = std::max<size_t>(1, maxEvents);
+        traceEvents.clear();
+        traceEvents.reserve(std::min(traceCapacity, DEFAULT_TRACE_EVENTS));
+        traceNext = 0;
+        traceOverwritten = 0;
+    }
+    tracing.store(enable, std::memory_order_relaxed);
+    MIDDLEWARE_LOG_INFO("Stage trace capture %s", enable ? "enabled" : "disabled");
+}
+
+std::vector<StageProfiler::TraceEvent> StageProfiler::getTraceEvents() const {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    std::vector<TraceEvent> result;
+    result.reserve(traceEvents.size());
+    // Once the buffer has wrapped, traceNext is the oldest event
+    for (size_t i = 0; i < traceEvents.size(); ++i) {
+        result.push_back(traceEvents[(traceNext + i) % traceEvents.size()]);
+    }
+    return result;
+}
+
+bool StageProfiler::writeChromeTrace(const std::string& path) const {
+    const std::vector<TraceEvent> events = getTraceEvents();
+    uint64_t overwritten = 0;
+    {
+        std::lock_guard<std::mutex> lock(traceMutex);
+        overwritten = traceOverwritten;
+    }
+
+    std::string json;
+    json.reserve(64 + events.size() * 128);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    json += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+            "\"args\":{\"name\":\"AnariUsdMiddleware\"}}";
+    for (const TraceEvent& event : events) {
+        json += ",\n{\"name\":";
+        appendJsonString(json, stageName(event.stage));
+        json += ",\"cat\":\"jusync\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+        json += std::to_string(event.thread);
+        json += ",\"ts\":";
+        appendMicroseconds(json, event.startNs);
+        json += ",\"dur\":";
+        appendMicroseconds(json, event.durationNs);
+        if (!event.detail.empty()) {
+            json += ",\"args\":{\"file\":";
+            appendJsonString(json, event.detail);
+            json += "}";
+        }
+        json += "}";
+    }
+    json += "\n],\"otherData\":{\"overwrittenEvents\":";
+    json += std::to_string(overwritten);
+    json += "}}\n";
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file || !file.write(json.data(), static_cast<std::streamsize>(json.size()))) {
+        MIDDLEWARE_LOG_ERROR("Failed to write stage trace: %s", path.c_str());
+        return false;
+    }
+    MIDDLEWARE_LOG_INFO("Wrote %zu stage trace events to %s", events.size(), path.c_str());
+    return true;
+}
+
+} // namespace profiling
+} // namespace anari_usd_middleware
@@ -0,0 +1,352 @@
+#include "TexturePipeline.h"
+#include "MiddlewareLogging.h"
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#include "stb_image.h"
+
+#define STB_DXT_IMPLEMENTATION
+#include "stb_dxt.h"
+
+#ifdef JUSYNC_WITH_SPNG
+#include <spng.h>
+#endif
+#ifdef JUSYNC_WITH_TURBOJPEG
+#include <turbojpeg.h>
+#endif
+
+namespace anari_usd_middleware {
+namespace texture {
+
+namespace {
+
+constexpr size_t LINEAR_STEPS = 4096;
+
+// sRGB <-> linear conversion tables for mip filtering
+struct SrgbTables {
+    float toLinear[256];
+    uint8_t fromLinear[LINEAR_STEPS];
+
+    SrgbTables() {
+        for (int i = 0; i < 256; ++i) {
+            const float c = i / 255.0f;
+            toLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        for (size_t i = 0; i < LINEAR_STEPS; ++i) {
+            const float l = static_cast<float>(i) / (LINEAR_STEPS - 1);
+            const float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+            fromLinear[i] = static_cast<uint8_t>(std::clamp(c * 255.0f + 0.5f, 0.0f, 255.0f));
+        }
+    }
+};
+
+const SrgbTables& srgbTables() {
+    static const SrgbTables tables;
+    return tables;
+}
+
+bool validDimensions(int width, int height) {
+    return width > 0 && height > 0 && width <= static_cast<int>(MAX_DIMENSION) &&
+           height <= static_cast<int>(MAX_DIMENSION);
+}
+
+#ifdef JUSYNC_WITH_SPNG
+bool isPng(const uint8_t* data, size_t size) {
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    return size >= sizeof(signature) && std::memcmp(data, signature, sizeof(signature)) == 0;
+}
+
+bool decodePng(const uint8_t* data, size_t size, std::vector<uint8_t>& out, uint32_t& width, uint32_t& height) {
+    spng_ctx* ctx = spng_ctx_new(0);
+    if (!ctx) {
+        return false;
+    }
+    size_t decodedSize = 0;
+    spng_ihdr header{};
+    bool ok = spng_set_image_limits(ctx, MAX_DIMENSION, MAX_DIMENSION) == 0 &&
+              spng_set_png_buffer(ctx, data, size) == 0 &&
+              spng_get_ihdr(ctx, &header) == 0 &&
+              spng_decoded_image_size(ctx, SPNG_FMT_RGBA8, &decodedSize) == 0;
+    if (ok) {
+        out.resize(decodedSize);
+        ok = spng_decode_image(ctx, out.data(), out.size(), SPNG_FMT_RGBA8, SPNG_DECODE_TRNS) == 0;
+    }
+    spng_ctx_free(ctx);
+    if (!ok) {
+        return false;
+    }
+    width = header.width;
+    height = header.height;
+    return true;
+}
+#endif
+
+#ifdef JUSYNC_WITH_TURBOJPEG
+bool isJpeg(const uint8_t* data, size_t size) {
+    return size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF;
+}
+
+bool decodeJpeg(const uint8_t* data, size_t size, std::vector<uint8_t>& out, uint32_t& width, uint32_t& height) {
+    tjhandle handle = tjInitDecompress();
+    if (!handle) {
+        return false;
+    }
+    int w = 0, h = 0, subsampling = 0, colorspace = 0;
+    const unsigned long jpegSize = static_cast<unsigned long>(size);
+    bool ok = tjDecompressHeader3(handle, data, jpegSize, &w, &h, &subsampling, &colorspace) == 0 &&
+              validDimensions(w, h);
+    if (ok) {
+        out.resize(static_cast<size_t>(w) * h * 4);
+        ok = tjDecompress2(handle, data, jpegSize, out.data(), w, 0, h, TJPF_RGBA, TJFLAG_FASTDCT) == 0;
+    }
+    tjDestroy(handle);
+    if (!ok) {
+        return false;
+    }
+    width = static_cast<uint32_t>(w);
+    height = static_cast<uint32_t>(h);
+    return true;
+}
+#endif
+
+bool decodeStb(const uint8_t* data, size_t size, std::vector<uint8_t>& out, uint32_t& width, uint32_t& height) {
+    if (size > static_cast<size_t>(INT32_MAX)) {
+        MIDDLEWARE_LOG_ERROR("Image too large to decode: %zu bytes", size);
+        return false;
+    }
+    int w = 0, h = 0, channels = 0;
+    unsigned char* pixels = stbi_load_from_memory(data, static_cast<int>(size), &w, &h, &channels, 4);
+    if (!pixels) {
+        const char* reason = stbi_failure_reason();
+        MIDDLEWARE_LOG_ERROR("Failed to decode image data: %s", reason ? reason : "Unknown error");
+        return false;
+    }
+    if (!validDimensions(w, h)) {
+        MIDDLEWARE_LOG_ERROR("Invalid image dimensions: %dx%d", w, h);
+        stbi_image_free(pixels);
+        return false;
+    }
+    const size_t bytes = static_cast<size_t>(w) * h * 4;
+    out.assign(pixels, pixels + bytes);
+    stbi_image_free(pixels);
+    width = static_cast<uint32_t>(w);
+    height = static_cast<uint32_t>(h);
+    return true;
+}
+
+/**
+ * Box-filter one level into the next; odd edges reuse the last row or column
+ */
+void downsample(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight,
+                uint8_t* dst, uint32_t dstWidth, uint32_t dstHeight, bool srgb) {
+    const SrgbTables& tables = srgbTables();
+    for (uint32_t y = 0; y < dstHeight; ++y) {
+        const uint8_t* row0 = src + static_cast<size_t>(std::min(2 * y, srcHeight - 1)) * srcWidth * 4;
+        const uint8_t* row1 = src + static_cast<size_t>(std::min(2 * y + 1, srcHeight - 1)) * srcWidth * 4;
+        uint8_t* out = dst + static_cast<size_t>(y) * dstWidth * 4;
+        for (uint32_t x = 0; x < dstWidth; ++x, out += 4) {
+            const size_t x0 = static_cast<size_t>(std::min(2 * x, srcWidth - 1)) * 4;
+            const size_t x1 = static_cast<size_t>(std::min(2 * x + 1, srcWidth - 1)) * 4;
+            const uint8_t* p[4] = {row0 + x0, row0 + x1, row1 + x0, row1 + x1};
+            for (int c = 0; c < 3; ++c) {
+                if (srgb) {
+                    const float l = (tables.toLinear[p[0][c]] + tables.toLinear[p[1][c]] +
+                                     tables.toLinear[p[2][c]] + tables.toLinear[p[3][c]]) * 0.25f;
+                    out[c] = tables.fromLinear[static_cast<size_t>(l * (LINEAR_STEPS - 1) + 0.5f)];
+                } else {
+                    out[c] = static_cast<uint8_t>((p[0][c] + p[1][c] + p[2][c] + p[3][c] + 2) / 4);
+                }
+            }
+            out[3] = static_cast<uint8_t>((p[0][3] + p[1][3] + p[2][3] + p[3][3] + 2) / 4);
+        }
+    }
+}
+
+bool hasAlpha(const uint8_t* rgba, size_t pixelCount) {
+    for (size_t i = 0; i < pixelCount; ++i) {
+        if (rgba[i * 4 + 3] != 255) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Compress one RGBA8 level into 4x4 blocks; partial edge blocks repeat the last row or column
+ */
+void compressLevel(const uint8_t* rgba, uint32_t width, uint32_t height, PixelFormat format,
+                   bool highQuality, uint8_t* out) {
+    const int alpha = format == PixelFormat::BC3 ? 1 : 0;
+    const size_t blockBytes = format == PixelFormat::BC3 ? 16 : 8;
+    const int mode = highQuality ? STB_DXT_HIGHQUAL : STB_DXT_NORMAL;
+    uint8_t block[16 * 4];
+    for (uint32_t by = 0; by < height; by += 4) {
+        for (uint32_t bx = 0; bx < width; bx += 4) {
+            for (uint32_t y = 0; y < 4; ++y) {
+                const size_t row = static_cast<size_t>(std::min(by + y, height - 1)) * width;
+                for (uint32_t x = 0; x < 4; ++x) {
+                    std::memcpy(block + (y * 4 + x) * 4, rgba + (row + std::min(bx + x, width - 1)) * 4, 4);
+                }
+            }
+            stb_compress_dxt_block(out, block, alpha, mode);
+            out += blockBytes;
+        }
+    }
+}
+
+} // namespace
+
+uint32_t mipCount(uint32_t width, uint32_t height) {
+    uint32_t levels = 0;
+    for (uint32_t size = std::max(width, height); size > 0; size >>= 1) {
+        ++levels;
+    }
+    return levels;
+}
+
+size_t levelSize(PixelFormat format, uint32_t width, uint32_t height) {
+    if (format == PixelFormat::RGBA8) {
+        return static_cast<size_t>(width) * height * 4;
+    }
+    const size_t blocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+    return blocks * (format == PixelFormat::BC3 ? 16 : 8);
+}
+
+bool decodeRGBA8(const uint8_t* data, size_t size, std::vector<uint8_t>& out, uint32_t& width, uint32_t& height) {
+    out.clear();
+    width = height = 0;
+    if (!data || size == 0) {
+        MIDDLEWARE_LOG_ERROR("decodeRGBA8: empty image buffer");
+        return false;
+    }
+
+    try {
+        // The fast decoders write straight into out; anything they reject goes to stb_image
+#ifdef JUSYNC_WITH_SPNG
+        if (isPng(data, size) && decodePng(data, size, out, width, height)) {
+            return true;
+        }
+#endif
+#ifdef JUSYNC_WITH_TURBOJPEG
+        if (isJpeg(data, size) && decodeJpeg(data, size, out, width, height)) {
+            return true;
+        }
+#endif
+        return decodeStb(data, size, out, width, height);
+    } catch (const std::bad_alloc&) {
+        MIDDLEWARE_LOG_ERROR("Out of memory decoding a %zu byte image", size);
+        out.clear();
+        return false;
+    }
+}
+
+bool encode(std::vector<uint8_t>&& rgba, uint32_t width, uint32_t height, const Options& options, Texture& out) {
+    out = Texture{};
+    if (width == 0 || height == 0 || width > MAX_DIMENSION || height > MAX_DIMENSION ||
+        rgba.size() != static_cast<size_t>(width) * height * 4) {
+        MIDDLEWARE_LOG_ERROR("Invalid texture for encoding: %ux%u with %zu bytes", width, height, rgba.size());
+        return false;
+    }
+
+    try {
+        PixelFormat format = PixelFormat::RGBA8;
+        switch (options.compression) {
+            case Compression::None: format = PixelFormat::RGBA8; break;
+            case Compression::BC1: format = PixelFormat::BC1; break;
+            case Compression::BC3: format = PixelFormat::BC3; break;
+            case Compression::Auto:
+                format = hasAlpha(rgba.data(), static_cast<size_t>(width) * height) ? PixelFormat::BC3 : PixelFormat::BC1;
+                break;
+        }
+        if (format != PixelFormat::RGBA8 && (width % 4 != 0 || height % 4 != 0)) {
+            MIDDLEWARE_LOG_WARNING("%ux%u texture is not a multiple of 4, keeping it uncompressed", width, height);
+            format = PixelFormat::RGBA8;
+        }
+
+        // Lay out the RGBA8 chain; uncompressed textures keep it as their data
+        const uint32_t levels = options.generateMips ? mipCount(width, height) : 1;
+        std::vector<MipLevel> chain(levels);
+        size_t chainSize = 0;
+        for (uint32_t level = 0; level < levels; ++level) {
+            chain[level].width = std::max(width >> level, 1u);
+            chain[level].height = std::max(height >> level, 1u);
+            chain[level].offset = chainSize;
+            chain[level].size = levelSize(PixelFormat::RGBA8, chain[level].width, chain[level].height);
+            chainSize += chain[level].size;
+        }
+        rgba.resize(chainSize);
+        for (uint32_t level = 1; level < levels; ++level) {
+            const MipLevel& src = chain[level - 1];
+            const MipLevel& dst = chain[level];
+            downsample(rgba.data() + src.offset, src.width, src.height,
+                       rgba.data() + dst.offset, dst.width, dst.height, options.srgb);
+        }
+
+        out.width = width;
+        out.height = height;
+        out.format = format;
+        if (format == PixelFormat::RGBA8) {
+            out.mips = std::move(chain);
+            out.data = std::move(rgba);
+            return true;
+        }
+
+        out.mips.resize(levels);
+        size_t compressedSize = 0;
+        for (uint32_t level = 0; level < levels; ++level) {
+            out.mips[level].width = chain[level].width;
+            out.mips[level].height = chain[level].height;
+            out.mips[level].offset = compressedSize;
+            out.mips[level].size = levelSize(format, chain[level].width, chain[level].height);
+            compressedSize += out.mips[level].size;
+        }
+        out.data.resize(compressedSize);
+        for (uint32_t level = 0; level < levels; ++level) {
+            compressLevel(rgba.data() + chain[level].offset, chain[level].width, chain[level].height,
+                          format, options.highQuality, out.data.data() + out.mips[level].offset);
+        }
+        return true;
+    } catch (const std::bad_alloc&) {
+        MIDDLEWARE_LOG_ERROR("Out of memory encoding a %ux%u texture", width, height);
+        out = Texture{};
+        return false;
+    }
+}
+
+bool process(const uint8_t* data, size_t size, const Options& options, Texture& out) {
+    std::vector<uint8_t> rgba;
+    uint32_t width = 0, height = 0;
+    if (!decodeRGBA8(data, size, rgba, width, height)) {
+        out = Texture{};
+        return false;
+    }
+    return encode(std::move(rgba), width, height, options, out);
+}
+
+size_t processBatch(const Source* sources, size_t count, const Options& options, Texture* out, size_t threads) {
+    if (count == 0 || !sources || !out) {
+        return 0;
+    }
+    WorkerPool& pool = WorkerPool::shared();
+    if (threads == 0) {
+        threads = pool.threadCount() + 1;
+    }
+    threads = std::min(threads, count);
+
+    std::atomic<size_t> succeeded{0};
+    pool.parallelFor(count, threads, [&](size_t i) {
+        if (process(sources[i].data, sources[i].size, options, out[i])) {
+            succeeded.fetch_add(1);
+        }
+    });
+
+    MIDDLEWARE_LOG_INFO("Processed %zu/%zu textures on up to %zu threads", succeeded.load(), count, threads);
+    return succeeded.load();
+}
+
+} // namespace texture
+} // namespace anari_usd_middleware
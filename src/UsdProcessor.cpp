@@ -1,5 +1,15 @@
 #include "UsdProcessor.h"
+#include "HashVerifier.h"
+#include "LruCache.h"
+#include "MappedFile.h"
+#include "MeshKernels.h"
+#include "MeshOptimizer.h"
+#include "MeshTriangulator.h"
 #include "MiddlewareLogging.h"
+#include "ScratchArena.h"
+#include "StageProfiler.h"
+#include "TexturePipeline.h"
+#include "WorkerPool.h"
 
 // Standard library includes with enhanced safety
 #include <algorithm>
@@ -10,9 +20,15 @@
 #include <chrono>
 #include <thread>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <atomic>
+#include <system_error>
+#include <future>
+#include <unordered_map>
+#include <string_view>
+#include <type_traits>
 
 // Include TinyUSDZ with error handling
 #include "tinyusdz.hh"
@@ -39,115 +55,152 @@ public:
         MIDDLEWARE_LOG_INFO("UsdProcessorImpl destroyed");
     }
 
-    // Enhanced preprocessing with comprehensive validation
-    std::vector<uint8_t> preprocessUsdContent(const std::vector<uint8_t>& buffer) {
-        MIDDLEWARE_LOG_INFO("Preprocessing USD content of size %zu", buffer.size());
-
-        // Validate input buffer
-        if (buffer.empty()) {
+    /**
+     * Single-pass fixer for known exporter quirks in USDA text. Binary crates (USDC/USDZ)
+     * and geometry-carrying layers are left alone.
+     * @param data Input USD content
+     * @param size Input size in bytes
+     * @param out Receives the patched content; untouched when nothing needs patching
+     * @return True if out holds patched content, false if the input should be used as-is
+     */
+    bool preprocessUsdContent(const uint8_t* data, size_t size, std::pmr::vector<uint8_t>& out) const {
+        if (size == 0) {
             MIDDLEWARE_LOG_ERROR("Cannot preprocess empty buffer");
-            return buffer;
+            return false;
         }
 
-        if (buffer.size() > safety::MAX_BUFFER_SIZE) {
-            MIDDLEWARE_LOG_ERROR("Buffer too large for preprocessing: %zu bytes (max: %zu)",
-                                buffer.size(), safety::MAX_BUFFER_SIZE);
-            return buffer;
+        if (size > safety::MAX_STREAMED_FILE_SIZE) {
+            MIDDLEWARE_LOG_ERROR("Buffer too large for preprocessing: %zu bytes (max: %llu)",
+                                size, static_cast<unsigned long long>(safety::MAX_STREAMED_FILE_SIZE));
+            return false;
         }
 
-        try {
-            // Convert buffer to string with size validation
-            std::string fileContent;
-            fileContent.assign(reinterpret_cast<const char*>(buffer.data()), buffer.size());
-
-            if (fileContent.find("int[] faceVertexIndices") != std::string::npos ||
-                fileContent.find("point3f[] points") != std::string::npos ||
-                fileContent.find("float3[] points") != std::string::npos) {
+        const std::string_view content(reinterpret_cast<const char*>(data), size);
 
-                MIDDLEWARE_LOG_INFO("Large geometry detected - preserving original USD data for Unreal RealtimeMesh");
-                return buffer;  // Return original content without any modifications
-                }
-
-            // Apply regex replacements with exception handling
-            try {
-                // Fix common USD format issues
-                fileContent = std::regex_replace(fileContent, std::regex("0: None"), "0: []");
-                fileContent = std::regex_replace(fileContent, std::regex("asset:images/"), "@./images/");
-                fileContent = std::regex_replace(fileContent, std::regex("texCoord2f"), "texCoord2f[]");
+        if (isBinaryUsd(content)) {
+            MIDDLEWARE_LOG_DEBUG("Binary USD content - skipping text preprocessing");
+            return false;
+        }
 
-                MIDDLEWARE_LOG_DEBUG("Applied regex replacements successfully");
+        if (content.find("int[] faceVertexIndices") != std::string_view::npos ||
+            content.find("point3f[] points") != std::string_view::npos ||
+            content.find("float3[] points") != std::string_view::npos) {
+            MIDDLEWARE_LOG_INFO("Large geometry detected - preserving original USD data for Unreal RealtimeMesh");
+            return false;
+        }
 
-            } catch (const std::regex_error& e) {
-                MIDDLEWARE_LOG_ERROR("Regex error during preprocessing: %s", e.what());
-                return buffer; // Return original on regex failure
+        try {
+            // Each rule keeps its own forward-only cursor, so every byte is visited once per rule
+            struct Rule {
+                std::string_view match;
+                std::string_view replacement;
+                size_t next;
+            };
+            Rule rules[] = {
+                {"0: None", "0: []", 0},
+                {"asset:images/", "@./images/", 0},
+                {"texCoord2f", "texCoord2f[]", 0},
+            };
+            auto advance = [&](Rule& rule, size_t from) {
+                rule.next = content.find(rule.match, from);
+                // Already-fixed declarations must not gain a second pair of brackets
+                while (rule.next != std::string_view::npos && rule.match == "texCoord2f" &&
+                       rule.next + rule.match.size() < size && content[rule.next + rule.match.size()] == '[') {
+                    rule.next = content.find(rule.match, rule.next + rule.match.size());
+                }
+            };
+            for (auto& rule : rules) {
+                advance(rule, 0);
             }
 
-            // Safe line processing with bounds checking
-            std::vector<std::string> lines;
-            std::istringstream iss(fileContent);
-            std::string line;
-
-            // Limit number of lines to prevent memory exhaustion
-            const size_t MAX_LINES = 1000000;
-            lines.reserve(std::min(MAX_LINES, static_cast<size_t>(fileContent.size() / 50))); // Estimate
-
-            while (std::getline(iss, line) && lines.size() < MAX_LINES) {
-                // Validate line length
-                lines.push_back(std::move(line));
+            // Some exporters drop the shader id in front of the texture input on line 34
+            constexpr std::string_view SHADER_ID = "uniform token info:id = \"UsdPreviewSurface\";";
+            size_t insertAt = std::string_view::npos;
+            size_t lineStart = 0;
+            for (int line = 0; line < 33 && lineStart < size; ++line) {
+                const void* eol = std::memchr(data + lineStart, '\n', size - lineStart);
+                lineStart = eol ? static_cast<size_t>(static_cast<const uint8_t*>(eol) - data) + 1 : size;
             }
-
-            if (lines.size() >= MAX_LINES) {
-                MIDDLEWARE_LOG_WARNING("File has too many lines, truncated at %zu", MAX_LINES);
+            if (lineStart < size) {
+                const void* eol = std::memchr(data + lineStart, '\n', size - lineStart);
+                size_t lineEnd = eol ? static_cast<size_t>(static_cast<const uint8_t*>(eol) - data) : size;
+                std::string_view line34 = content.substr(lineStart, lineEnd - lineStart);
+                if ((line34.find("texture") != std::string_view::npos ||
+                     line34.find("albedoTex") != std::string_view::npos) &&
+                    line34.find("uniform") == std::string_view::npos) {
+                    insertAt = lineStart;
+                }
             }
 
-            // Safe line modification with bounds checking
-            if (lines.size() > 33) {
-                std::string& line34 = lines[33];
-                MIDDLEWARE_LOG_DEBUG("Processing line 34: %s", line34.c_str());
-
-                if ((line34.find("texture") != std::string::npos ||
-                     line34.find("albedoTex") != std::string::npos) &&
-                    line34.find("uniform") == std::string::npos) {
+            auto pending = [&]() {
+                return insertAt != std::string_view::npos ||
+                       std::any_of(std::begin(rules), std::end(rules),
+                                   [](const Rule& r) { return r.next != std::string_view::npos; });
+            };
+            if (!pending()) {
+                return false;
+            }
 
-                    std::string newLine = "uniform token info:id = \"UsdPreviewSurface\";" + line34;
-                    if (newLine.size() < 1000) { // Reasonable line length check
-                        lines[33] = std::move(newLine);
-                        MIDDLEWARE_LOG_DEBUG("Modified line 34 successfully");
-                    } else {
-                        MIDDLEWARE_LOG_WARNING("Modified line would be too long, skipping");
+            out.clear();
+            out.reserve(size + size / 64 + SHADER_ID.size());
+            auto append = [&out](std::string_view part) {
+                out.insert(out.end(), part.begin(), part.end());
+            };
+
+            size_t copied = 0;
+            size_t patches = 0;
+            while (pending()) {
+                Rule* earliest = nullptr;
+                for (auto& rule : rules) {
+                    if (rule.next != std::string_view::npos && (!earliest || rule.next < earliest->next)) {
+                        earliest = &rule;
                     }
                 }
-            }
 
-            // Rebuild content with size monitoring
-            fileContent.clear();
-            size_t estimatedSize = 0;
-            const size_t MAX_GROWTH_FACTOR = 2;
+                if (insertAt != std::string_view::npos && (!earliest || insertAt <= earliest->next)) {
+                    append(content.substr(copied, insertAt - copied));
+                    append(SHADER_ID);
+                    copied = insertAt;
+                    insertAt = std::string_view::npos;
+                    ++patches;
+                    continue;
+                }
 
-            for (const auto& l : lines) {
-                estimatedSize += l.size() + 1; // +1 for newline
+                append(content.substr(copied, earliest->next - copied));
+                append(earliest->replacement);
+                copied = earliest->next + earliest->match.size();
+                ++patches;
 
-                // Prevent excessive memory growth
-                if (estimatedSize > buffer.size() * MAX_GROWTH_FACTOR) {
-                    MIDDLEWARE_LOG_WARNING("Preprocessed content growing too large, truncating at %zu bytes",
-                                         estimatedSize);
-                    break;
+                // Matches overlapping the replaced span are consumed by it
+                for (auto& rule : rules) {
+                    if (rule.next != std::string_view::npos && rule.next < copied) {
+                        advance(rule, copied);
+                    }
+                }
+                if (insertAt != std::string_view::npos && insertAt < copied) {
+                    insertAt = std::string_view::npos;
                 }
-
-                fileContent += l + "\n";
             }
+            append(content.substr(copied));
 
-            MIDDLEWARE_LOG_INFO("Preprocessing complete: %zu -> %zu bytes",
-                              buffer.size(), fileContent.size());
-
-            return std::vector<uint8_t>(fileContent.begin(), fileContent.end());
+            MIDDLEWARE_LOG_INFO("Preprocessing complete: %zu patches, %zu -> %zu bytes",
+                              patches, size, out.size());
+            return true;
 
         } catch (const std::exception& e) {
             MIDDLEWARE_LOG_ERROR("Exception in preprocessUsdContent: %s", e.what());
-            return buffer; // Return original on any failure
+            out.clear();
+            return false;
         }
     }
 
+    static bool isBinaryUsd(std::string_view content) {
+        constexpr std::string_view USDC_MAGIC = "PXR-USDC";
+        constexpr std::string_view ZIP_MAGIC = "PK\x03\x04";
+        return content.substr(0, USDC_MAGIC.size()) == USDC_MAGIC ||
+               content.substr(0, ZIP_MAGIC.size()) == ZIP_MAGIC;
+    }
+
     // Enhanced memory monitoring
     bool checkMemoryUsage(size_t additionalBytes = 0) const {
         // Simple memory usage estimation
@@ -164,11 +217,196 @@ public:
         return true;
     }
 
+    using CachedLayer = std::shared_ptr<const std::vector<UsdProcessor::MeshData>>;
+
+    /**
+     * Look up a referenced layer, parsing it at most once even under concurrent requests
+     * @param key Identity of the file version (see layerCacheKey)
+     * @param parse Produces the layer's meshes, nullptr on failure (failures are not cached)
+     * @param hit Set to true if no parse was needed (cached or joined an in-flight parse)
+     * @return Extracted meshes, nullptr on failure
+     */
+    CachedLayer acquireLayer(const std::string& key, const std::function<CachedLayer()>& parse, bool& hit) {
+        std::promise<CachedLayer> promise;
+        std::shared_future<CachedLayer> pending;
+        {
+            std::lock_guard<std::mutex> lock(layerCacheMutex);
+            if (CachedLayer* cached = layerCache.find(key)) {
+                hit = true;
+                return *cached;
+            }
+            auto it = layersInFlight.find(key);
+            if (it != layersInFlight.end()) {
+                pending = it->second;
+            } else {
+                layersInFlight.emplace(key, promise.get_future().share());
+            }
+        }
+
+        if (pending.valid()) {
+            hit = true;
+            return pending.get();
+        }
+
+        hit = false;
+        CachedLayer layer;
+        try {
+            layer = parse();
+        } catch (const std::exception& e) {
+            MIDDLEWARE_LOG_ERROR("Exception parsing layer %s: %s", key.c_str(), e.what());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(layerCacheMutex);
+            if (layer) {
+                layerCache.insert(key, layer, estimateLayerBytes(*layer));
+            }
+            layersInFlight.erase(key);
+        }
+        promise.set_value(layer);
+        return layer;
+    }
+
+    void setLayerCacheBudget(size_t bytes) {
+        std::lock_guard<std::mutex> lock(layerCacheMutex);
+        layerCache.setLimits(MAX_CACHED_LAYERS, bytes);
+    }
+
+    void clearLayerCache() {
+        std::lock_guard<std::mutex> lock(layerCacheMutex);
+        layerCache.clear();
+    }
+
+    static size_t estimateLayerBytes(const std::vector<UsdProcessor::MeshData>& meshes) {
+        size_t bytes = sizeof(meshes) + meshes.capacity() * sizeof(UsdProcessor::MeshData);
+        for (const auto& mesh : meshes) {
+            bytes += mesh.elementName.capacity() + mesh.typeName.capacity() +
+                     mesh.points.capacity() * sizeof(glm::vec3) +
+                     mesh.indices.capacity() * sizeof(uint32_t) +
+                     mesh.normals.capacity() * sizeof(glm::vec3) +
+                     mesh.uvs.capacity() * sizeof(glm::vec2) +
+                     mesh.vertex_colors.capacity() * sizeof(glm::vec4) +
+                     mesh.instanceTransforms.capacity() * sizeof(glm::mat4);
+        }
+        return bytes;
+    }
+
+    /**
+     * Parsed stage kept for repeated transform evaluation, plus the world matrices of
+     * prims whose whole parent chain is static (valid at every time code)
+     */
+    struct TransformStage {
+        tinyusdz::Stage stage;
+        std::mutex mutex;
+        std::unordered_map<const void*, glm::mat4> staticWorld;
+    };
+
+    std::shared_ptr<TransformStage> findTransformStage(const ContentDigest& digest) {
+        std::lock_guard<std::mutex> lock(transformStageMutex);
+        std::shared_ptr<TransformStage>* cached = transformStages.find(digest);
+        return cached ? *cached : nullptr;
+    }
+
+    void storeTransformStage(const ContentDigest& digest, std::shared_ptr<TransformStage> entry) {
+        std::lock_guard<std::mutex> lock(transformStageMutex);
+        transformStages.insert(digest, std::move(entry));
+    }
+
+    void clearTransformStages() {
+        std::lock_guard<std::mutex> lock(transformStageMutex);
+        transformStages.clear();
+    }
+
+    static constexpr size_t MAX_CACHED_LAYERS = 1024;
+    static constexpr size_t MAX_TRANSFORM_STAGES = 4;
+
+    // Transient data of loads: one lease per load thread and per extraction worker
+    ScratchArenaPool scratchArenas;
+
 private:
     std::chrono::steady_clock::time_point processingStartTime;
     std::atomic<size_t> memoryLimitBytes{1024 * 1024 * 1024}; // 1GB default
+
+    // Meshes of referenced/clip layers, keyed on canonical path + mtime + size
+    std::mutex layerCacheMutex;
+    LruCache<std::string, CachedLayer> layerCache{MAX_CACHED_LAYERS};
+    std::unordered_map<std::string, std::shared_future<CachedLayer>> layersInFlight;
+
+    // Stages of recently animated files, keyed on content digest
+    std::mutex transformStageMutex;
+    LruCache<ContentDigest, std::shared_ptr<TransformStage>, ContentDigestHash> transformStages{MAX_TRANSFORM_STAGES};
 };
 
+namespace {
+
+// Share of the processor memory limit the layer cache may hold
+constexpr size_t LAYER_CACHE_SHARE_DIVISOR = 4;
+
+// Faces per triangulation range below which a mesh is not worth splitting across threads
+constexpr size_t PARALLEL_TRIANGULATION_FACES = 65536;
+
+size_t layerCacheBudget(size_t memoryLimitMB) {
+    return memoryLimitMB * 1024 * 1024 / LAYER_CACHE_SHARE_DIVISOR;
+}
+
+// Cheap geometry key: attribute sizes plus a strided sample of positions and indices
+uint64_t geometryFingerprint(const UsdProcessor::MeshData& mesh) {
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void* bytes, size_t size) {
+        const uint8_t* p = static_cast<const uint8_t*>(bytes);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ p[i]) * FNV_PRIME;
+        }
+    };
+    const size_t sizes[] = {mesh.points.size(), mesh.indices.size(), mesh.normals.size(),
+                            mesh.uvs.size(), mesh.vertex_colors.size()};
+    mix(sizes, sizeof(sizes));
+
+    constexpr size_t SAMPLES = 64;
+    size_t pointStride = std::max<size_t>(1, mesh.points.size() / SAMPLES);
+    for (size_t i = 0; i < mesh.points.size(); i += pointStride) {
+        mix(&mesh.points[i], sizeof(glm::vec3));
+    }
+    size_t indexStride = std::max<size_t>(1, mesh.indices.size() / SAMPLES);
+    for (size_t i = 0; i < mesh.indices.size(); i += indexStride) {
+        mix(&mesh.indices[i], sizeof(uint32_t));
+    }
+    return hash;
+}
+
+template <typename T>
+bool sameElements(const std::vector<T>& a, const std::vector<T>& b) {
+    return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+bool sameGeometry(const UsdProcessor::MeshData& a, const UsdProcessor::MeshData& b) {
+    return sameElements(a.points, b.points) && sameElements(a.indices, b.indices) &&
+           sameElements(a.normals, b.normals) && sameElements(a.uvs, b.uvs) &&
+           sameElements(a.vertex_colors, b.vertex_colors);
+}
+
+// Identifies one version of a file on disk; empty if the file cannot be inspected
+std::string layerCacheKey(const std::string& filePath) {
+    std::error_code ec;
+    std::filesystem::path canonical = std::filesystem::canonical(filePath, ec);
+    if (ec) {
+        return {};
+    }
+    auto size = std::filesystem::file_size(canonical, ec);
+    if (ec) {
+        return {};
+    }
+    auto mtime = std::filesystem::last_write_time(canonical, ec);
+    if (ec) {
+        return {};
+    }
+    return canonical.string() + "|" + std::to_string(mtime.time_since_epoch().count()) + "|" +
+           std::to_string(size);
+}
+
+} // namespace
+
 // Enhanced MeshData validation methods
 std::pair<glm::vec3, glm::vec3> UsdProcessor::MeshData::getBounds() const {
     if (points.empty()) {
@@ -250,8 +488,10 @@ bool UsdProcessor::MeshData::validateGeometry() const {
 
 // Constructor and destructor with enhanced safety
 UsdProcessor::UsdProcessor() : pImpl(std::make_unique<UsdProcessorImpl>()) {
-    MIDDLEWARE_LOG_INFO("UsdProcessor created with enhanced safety features");
+    MIDDLEWARE_LOG_INFO("UsdProcessor created with enhanced safety features (%s mesh kernels)",
+                        kernels::instructionSetName(kernels::activeInstructionSet()));
     stats.reset();
+    pImpl->setLayerCacheBudget(layerCacheBudget(memoryLimitMB.load()));
 }
 
 UsdProcessor::~UsdProcessor() {
@@ -266,151 +506,56 @@ UsdProcessor::~UsdProcessor() {
 // Enhanced texture creation with comprehensive validation
 UsdProcessor::TextureData UsdProcessor::CreateTextureFromBuffer(const std::vector<uint8_t>& buffer,
                                                                const std::string& expectedFormat) {
+    return CreateTextureFromBuffer(buffer.data(), buffer.size(), expectedFormat);
+}
+
+UsdProcessor::TextureData UsdProcessor::CreateTextureFromBuffer(const uint8_t* data, size_t size,
+                                                               const std::string& expectedFormat) {
     std::shared_lock<std::shared_mutex> lock(processingMutex);
 
-    MIDDLEWARE_LOG_INFO("Creating texture from buffer of size %zu", buffer.size());
+    MIDDLEWARE_LOG_INFO("Creating texture from buffer of size %zu", size);
 
     TextureData textureData;
 
     // MEMORY SAFETY: Validate input buffer
-    if (buffer.empty()) {
+    if (size == 0) {
         MIDDLEWARE_LOG_ERROR("CreateTextureFromBuffer: Empty buffer");
         stats.processingErrors.fetch_add(1);
         return textureData;
     }
 
-    if (buffer.size() > safety::MAX_BUFFER_SIZE) {
-        MIDDLEWARE_LOG_ERROR("Buffer too large for texture creation: %zu bytes (max: %zu)",
-                            buffer.size(), safety::MAX_BUFFER_SIZE);
+    if (size > safety::MAX_STREAMED_FILE_SIZE) {
+        MIDDLEWARE_LOG_ERROR("Buffer too large for texture creation: %zu bytes (max: %llu)",
+                            size, static_cast<unsigned long long>(safety::MAX_STREAMED_FILE_SIZE));
         stats.processingErrors.fetch_add(1);
         return textureData;
     }
 
     // MEMORY SAFETY: Check buffer data pointer validity
-    if (!buffer.data()) {
-        MIDDLEWARE_LOG_ERROR("Buffer has null data pointer despite non-zero size: %zu", buffer.size());
+    if (!data) {
+        MIDDLEWARE_LOG_ERROR("Buffer has null data pointer despite non-zero size: %zu", size);
         stats.processingErrors.fetch_add(1);
         return textureData;
     }
 
     try {
-        int width, height, channels;
-
-        // Use STB image with enhanced error handling
-        stbi_set_flip_vertically_on_load(0); // Don't flip for consistency
-
-        // MEMORY SAFETY: Validate buffer size for STB processing
-        if (buffer.size() > INT_MAX) {
-            MIDDLEWARE_LOG_ERROR("Buffer too large for STB image processing: %zu bytes (max: %d)",
-                                buffer.size(), INT_MAX);
-            stats.processingErrors.fetch_add(1);
-            return textureData;
-        }
-
-        // MEMORY SAFETY: Double-check buffer pointer before passing to STB
-        const unsigned char* bufferPtr = buffer.data();
-        if (!bufferPtr) {
-            MIDDLEWARE_LOG_ERROR("Buffer data pointer is null before STB processing");
-            stats.processingErrors.fetch_add(1);
-            return textureData;
-        }
-
-        unsigned char* imageData = stbi_load_from_memory(
-            bufferPtr,
-            static_cast<int>(buffer.size()),
-            &width, &height, &channels,
-            4 // Force RGBA
-        );
-
-        if (!imageData) {
-            const char* reason = stbi_failure_reason();
-            MIDDLEWARE_LOG_ERROR("Failed to decode image data: %s", reason ? reason : "Unknown error");
-            stats.processingErrors.fetch_add(1);
-            return textureData;
-        }
-
-        // MEMORY SAFETY: Validate dimensions returned by STB
-        if (width <= 0 || height <= 0 || width > 32768 || height > 32768) {
-            MIDDLEWARE_LOG_ERROR("Invalid image dimensions from STB: %dx%d", width, height);
-            stbi_image_free(imageData);
-            stats.processingErrors.fetch_add(1);
-            return textureData;
-        }
-
-        // MEMORY SAFETY: Check for potential overflow in size calculation
-        if (width > 0 && height > 0) {
-            // Check if multiplication would overflow
-            size_t maxAllowedWidth = safety::MAX_BUFFER_SIZE / static_cast<size_t>(height) / 4;
-            if (static_cast<size_t>(width) > maxAllowedWidth) {
-                MIDDLEWARE_LOG_ERROR("Image dimensions would cause overflow: %dx%d", width, height);
-                stbi_image_free(imageData);
-                stats.processingErrors.fetch_add(1);
-                return textureData;
-            }
-        }
-
-        // Calculate expected data size with overflow protection
-        size_t expectedDataSize = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
-        if (expectedDataSize > safety::MAX_BUFFER_SIZE) {
-            MIDDLEWARE_LOG_ERROR("Decoded image too large: %zu bytes (max: %zu)",
-                                expectedDataSize, safety::MAX_BUFFER_SIZE);
-            stbi_image_free(imageData);
+        // Decoded straight into the texture (no second copy); libspng/libjpeg-turbo when available
+        uint32_t width = 0, height = 0;
+        if (!texture::decodeRGBA8(data, size, textureData.data, width, height)) {
+            textureData.clear();
             stats.processingErrors.fetch_add(1);
             return textureData;
         }
 
-        // MEMORY SAFETY: Validate imageData pointer after STB processing
-        if (!imageData) {
-            MIDDLEWARE_LOG_ERROR("STB returned null image data pointer");
-            stats.processingErrors.fetch_add(1);
-            return textureData;
-        }
+        textureData.width = static_cast<int>(width);
+        textureData.height = static_cast<int>(height);
+        textureData.channels = 4;
 
         // Handle gradient line extraction (height == 2)
         if (height == 2) {
             MIDDLEWARE_LOG_INFO("Detected gradient image, extracting top row");
-
-            size_t rowSize = static_cast<size_t>(width) * 4;
-
-            // MEMORY SAFETY: Validate row size before allocation
-            if (rowSize == 0 || rowSize > safety::MAX_BUFFER_SIZE) {
-                MIDDLEWARE_LOG_ERROR("Invalid gradient row size: %zu", rowSize);
-                stbi_image_free(imageData);
-                stats.processingErrors.fetch_add(1);
-                return textureData;
-            }
-
-            try {
-                textureData.data.clear();
-                textureData.data.reserve(rowSize);
-                textureData.data.resize(rowSize);
-
-                // MEMORY SAFETY: Safe copy with bounds checking
-                std::memcpy(textureData.data.data(), imageData, rowSize);
-
-                // Verify the copy worked correctly
-                if (textureData.data.size() != rowSize) {
-                    MIDDLEWARE_LOG_ERROR("Gradient data copy size mismatch: expected %zu, got %zu",
-                                        rowSize, textureData.data.size());
-                    stbi_image_free(imageData);
-                    textureData.clear();
-                    stats.processingErrors.fetch_add(1);
-                    return textureData;
-                }
-
-            } catch (const std::bad_alloc& e) {
-                MIDDLEWARE_LOG_ERROR("Memory allocation failed for gradient data: %s", e.what());
-                stbi_image_free(imageData);
-                textureData.clear();
-                stats.processingErrors.fetch_add(1);
-                return textureData;
-            }
-
-            textureData.width = width;
+            textureData.data.resize(static_cast<size_t>(width) * 4);
             textureData.height = 1;
-            textureData.channels = 4;
-
-            stbi_image_free(imageData);
 
             MIDDLEWARE_LOG_INFO("Gradient line extracted: %dx%d, %d channels",
                               textureData.width, textureData.height, textureData.channels);
@@ -419,45 +564,6 @@ UsdProcessor::TextureData UsdProcessor::CreateTextureFromBuffer(const std::vecto
             return textureData;
         }
 
-        // Standard image processing
-        try {
-            textureData.data.clear();
-            textureData.data.reserve(expectedDataSize);
-            textureData.data.resize(expectedDataSize);
-
-            // MEMORY SAFETY: Safe copy with validation
-            std::memcpy(textureData.data.data(), imageData, expectedDataSize);
-
-            // Verify the copy worked correctly
-            if (textureData.data.size() != expectedDataSize) {
-                MIDDLEWARE_LOG_ERROR("Image data copy size mismatch: expected %zu, got %zu",
-                                    expectedDataSize, textureData.data.size());
-                stbi_image_free(imageData);
-                textureData.clear();
-                stats.processingErrors.fetch_add(1);
-                return textureData;
-            }
-
-        } catch (const std::bad_alloc& e) {
-            MIDDLEWARE_LOG_ERROR("Memory allocation failed for image data: %s", e.what());
-            stbi_image_free(imageData);
-            textureData.clear();
-            stats.processingErrors.fetch_add(1);
-            return textureData;
-        } catch (const std::exception& e) {
-            MIDDLEWARE_LOG_ERROR("Exception during image data copy: %s", e.what());
-            stbi_image_free(imageData);
-            textureData.clear();
-            stats.processingErrors.fetch_add(1);
-            return textureData;
-        }
-
-        textureData.width = width;
-        textureData.height = height;
-        textureData.channels = 4;
-
-        stbi_image_free(imageData);
-
         // Validate final texture data
         if (!textureData.isValid()) {
             MIDDLEWARE_LOG_ERROR("Created texture data failed validation");
@@ -493,28 +599,76 @@ UsdProcessor::TextureData UsdProcessor::CreateTextureFromBuffer(const std::vecto
 bool UsdProcessor::LoadUSDBuffer(const std::vector<uint8_t>& buffer,
                                 const std::string& fileName,
                                 std::vector<MeshData>& outMeshData,
-                                ProgressCallback progressCallback) {
-    std::unique_lock<std::shared_mutex> lock(processingMutex);
-    if (shutdownRequested.load()) {
-        MIDDLEWARE_LOG_WARNING("USD loading aborted: shutdown requested");
+                                ProgressCallback progressCallback,
+                                const std::atomic<bool>* cancelFlag) {
+    return LoadUSDBuffer(buffer.data(), buffer.size(), fileName, outMeshData, progressCallback, cancelFlag);
+}
+
+bool UsdProcessor::LoadUSDBuffer(const uint8_t* data,
+                                size_t size,
+                                const std::string& fileName,
+                                std::vector<MeshData>& outMeshData,
+                                ProgressCallback progressCallback,
+                                const std::atomic<bool>* cancelFlag,
+                                bool* usesExternalLayers) {
+    // Clear output data first
+    outMeshData.clear();
+
+    MeshSink collect = [&outMeshData](MeshData&& mesh) {
+        outMeshData.push_back(std::move(mesh));
+        return true;
+    };
+    if (!StreamUSDBuffer(data, size, fileName, collect, std::move(progressCallback), cancelFlag,
+                         usesExternalLayers)) {
         return false;
     }
 
-    MIDDLEWARE_LOG_INFO("Loading USD from buffer, size: %zu, filename: %s", buffer.size(), fileName.c_str());
+    // LIMITED DEBUG: Only show mesh statistics for RealtimeMesh, not full data
+    for (size_t i = 0; i < outMeshData.size(); ++i) {
+        const auto& mesh = outMeshData[i];
+        MIDDLEWARE_LOG_INFO("Mesh %zu '%s': %zu vertices, %zu triangles, %zu normals, %zu UVs",
+                           i, mesh.elementName.c_str(),
+                           mesh.points.size() / 3,
+                           mesh.indices.size() / 3,
+                           mesh.normals.size() / 3,
+                           mesh.uvs.size() / 2);
+    }
 
-    // Clear output data first
-    outMeshData.clear();
+    return true;
+}
+
+bool UsdProcessor::StreamUSDBuffer(const uint8_t* data,
+                                  size_t size,
+                                  const std::string& fileName,
+                                  const MeshSink& sink,
+                                  ProgressCallback progressCallback,
+                                  const std::atomic<bool>* cancelFlag,
+                                  bool* usesExternalLayers) {
+    if (usesExternalLayers) {
+        *usesExternalLayers = false;
+    }
+
+    // Shared: loads only touch their own stage and the internally locked caches, so
+    // several can run at once; the destructor still waits for all of them
+    std::shared_lock<std::shared_mutex> lock(processingMutex);
+    if (isCancelled(cancelFlag)) {
+        MIDDLEWARE_LOG_WARNING("USD loading aborted: %s", shutdownRequested.load() ? "shutdown requested" : "cancelled");
+        return false;
+    }
+
+    MIDDLEWARE_LOG_INFO("Loading USD from buffer, size: %zu, filename: %s", size, fileName.c_str());
 
     // Validate inputs
-    if (buffer.empty()) {
+    if (!data || size == 0) {
         MIDDLEWARE_LOG_ERROR("Cannot load USD from empty buffer");
         stats.processingErrors.fetch_add(1);
         return false;
     }
 
-    if (buffer.size() > safety::MAX_BUFFER_SIZE) {
-        MIDDLEWARE_LOG_ERROR("USD buffer too large: %zu bytes (max: %zu)",
-                            buffer.size(), safety::MAX_BUFFER_SIZE);
+    // The buffer is usually a mapping of a chunked transfer's spool file, not a heap copy
+    if (size > safety::MAX_STREAMED_FILE_SIZE) {
+        MIDDLEWARE_LOG_ERROR("USD buffer too large: %zu bytes (max: %llu)",
+                            size, static_cast<unsigned long long>(safety::MAX_STREAMED_FILE_SIZE));
         stats.processingErrors.fetch_add(1);
         return false;
     }
@@ -525,37 +679,176 @@ bool UsdProcessor::LoadUSDBuffer(const std::vector<uint8_t>& buffer,
         return false;
     }
 
+    if (!sink) {
+        MIDDLEWARE_LOG_ERROR("StreamUSDBuffer requires a mesh sink");
+        stats.processingErrors.fetch_add(1);
+        return false;
+    }
+
     try {
+        // Everything below that only lives for this load comes from the arena, which is
+        // reset in one shot when the lease ends
+        ScratchArenaPool::Lease scratch = pImpl->scratchArenas.acquire();
+        tinyusdz::Stage stage;
+        std::pmr::vector<uint8_t> patchedBuffer(scratch.resource());
+        if (!ParseStage(data, size, fileName, stage, patchedBuffer, progressCallback)) {
+            return false;
+        }
+        const uint8_t* processedData = patchedBuffer.empty() ? data : patchedBuffer.data();
+        const size_t processedSize = patchedBuffer.empty() ? size : patchedBuffer.size();
+
+        // Referenced layers and clips resolve against the file name and can change on their own,
+        // so callers caching by content need to know about them
+        if (usesExternalLayers) {
+            std::pmr::vector<std::pmr::string> layerPaths(scratch.resource());
+            ExtractReferencePaths(stage, layerPaths);
+            ExtractClipsFromRawContent(processedData, processedSize, layerPaths);
+            *usesExternalLayers = !layerPaths.empty();
+        }
+
         if (progressCallback) {
-            progressCallback(0.1f, "Preprocessing USD content");
+            progressCallback(0.5f, "Processing primitives");
         }
 
-        // CRITICAL FIX: Preserve full data for Unreal RealtimeMesh processing
-        std::vector<uint8_t> processedBuffer;
+        // Process main stage
+        profiling::StageProfiler* profiler = stageProfiler.load();
+        glm::mat4 identity(1.0f);
+        std::vector<MeshWorkItem> workItems;
 
-        // Convert buffer to string for geometry detection
-        std::string content(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        profiling::StageTimer traverseTimer(profiler, profiling::Stage::Traverse, fileName);
+        for (const auto& rootPrim : stage.root_prims()) {
+            if (isCancelled(cancelFlag)) {
+                MIDDLEWARE_LOG_WARNING("USD processing aborted: %s", shutdownRequested.load() ? "shutdown requested" : "cancelled");
+                return false;
+            }
 
-        // Check if this contains large geometry arrays
-        if (content.find("int[] faceVertexIndices") != std::string::npos ||
-            content.find("point3f[] points") != std::string::npos ||
-            content.find("float3[] points") != std::string::npos) {
+            if (!ProcessPrim(const_cast<tinyusdz::Prim*>(&rootPrim), workItems, identity, 0, cancelFlag)) {
+                MIDDLEWARE_LOG_WARNING("Failed to process root prim: %s", rootPrim.element_name().c_str());
+            }
+        }
+        traverseTimer.stop();
 
-            MIDDLEWARE_LOG_INFO("Large geometry detected - preserving original USD data for Unreal RealtimeMesh");
-            processedBuffer = buffer;  // Use original buffer without preprocessing
-        } else {
-            // Apply minimal preprocessing for non-geometry files
-            processedBuffer = pImpl->preprocessUsdContent(buffer);
+        // Extraction is the long stage, so it reports per mesh within 0.5 - 0.7
+        ProgressCallback extractionProgress;
+        if (progressCallback) {
+            extractionProgress = [&progressCallback](float fraction, const std::string& status) {
+                progressCallback(0.5f + fraction * 0.2f, status);
+            };
+        }
+        bool sinkStopped = false;
+        profiling::StageTimer extractTimer(profiler, profiling::Stage::Extract, fileName);
+        size_t streamed = ExtractMeshWorkItems(workItems, sink, cancelFlag, extractionProgress, &sinkStopped);
+        extractTimer.stop();
+        if (sinkStopped) {
+            MIDDLEWARE_LOG_INFO("USD processing stopped by the mesh consumer after %zu meshes", streamed);
+            return false;
+        }
+        if (isCancelled(cancelFlag)) {
+            MIDDLEWARE_LOG_WARNING("USD processing aborted: %s", shutdownRequested.load() ? "shutdown requested" : "cancelled");
+            return false;
+        }
+
+        MIDDLEWARE_LOG_INFO("Extracted %zu meshes from main stage", streamed);
+
+        if (progressCallback) {
+            progressCallback(0.7f, "Resolving references");
+        }
+
+        // Enhanced reference resolution; extracted meshes are always valid, so it only runs when
+        // the main stage yielded no geometry at all
+        std::vector<MeshData> referencedMeshes;
+        if (referenceResolutionEnabled.load() && streamed == 0) {
+            MIDDLEWARE_LOG_INFO("Attempting reference resolution for missing geometry");
+
+            ProgressCallback referenceProgress;
+            if (progressCallback) {
+                referenceProgress = [&progressCallback](float fraction, const std::string& status) {
+                    progressCallback(0.7f + fraction * 0.2f, status);
+                };
+            }
+            profiling::StageTimer referencesTimer(profiler, profiling::Stage::References, fileName);
+            if (!resolveReferences(stage, processedData, processedSize, fileName, referencedMeshes,
+                                   referenceProgress, cancelFlag, scratch.resource())) {
+                MIDDLEWARE_LOG_WARNING("Reference resolution completed with some failures");
+            }
+            referencesTimer.stop();
+            if (isCancelled(cancelFlag)) {
+                MIDDLEWARE_LOG_WARNING("USD processing aborted: %s", shutdownRequested.load() ? "shutdown requested" : "cancelled");
+                return false;
+            }
+        }
+
+        if (progressCallback) {
+            progressCallback(0.9f, "Validating mesh data");
+        }
+
+        // Validate all mesh data
+        for (auto& mesh : referencedMeshes) {
+            if (!mesh.isValid()) {
+                MIDDLEWARE_LOG_WARNING("Removing invalid mesh: %s", mesh.elementName.c_str());
+                continue;
+            }
+            if (!sink(std::move(mesh))) {
+                MIDDLEWARE_LOG_INFO("USD processing stopped by the mesh consumer after %zu meshes", streamed);
+                return false;
+            }
+            ++streamed;
         }
 
-        // LIMITED DEBUG: Only show first 200 characters for debugging
-        if (processedBuffer.size() > 200) {
-            std::string preview(reinterpret_cast<const char*>(processedBuffer.data()), 200);
-            preview += "... [truncated for debug]";
-            MIDDLEWARE_LOG_DEBUG("USD content preview: %s", preview.c_str());
+        if (progressCallback) {
+            progressCallback(1.0f, "Processing complete");
+        }
+
+        // Update statistics
+        stats.filesProcessed.fetch_add(1);
+        stats.meshesExtracted.fetch_add(streamed);
+        stats.totalBytesProcessed.fetch_add(size);
+
+        MIDDLEWARE_LOG_INFO("USD processing complete: %zu valid meshes extracted for RealtimeMesh", streamed);
+        return true;
+
+    } catch (const std::exception& e) {
+        MIDDLEWARE_LOG_ERROR("Exception in StreamUSDBuffer: %s", e.what());
+        stats.processingErrors.fetch_add(1);
+        return false;
+    }
+}
+
+
+bool UsdProcessor::ParseStage(const uint8_t* data,
+                              size_t size,
+                              const std::string& fileName,
+                              tinyusdz::Stage& stage,
+                              std::pmr::vector<uint8_t>& patchedBuffer,
+                              ProgressCallback progressCallback) {
+    try {
+        if (progressCallback) {
+            progressCallback(0.1f, "Preprocessing USD content");
+        }
+
+        // Geometry layers and binary crates are passed through without a copy
+        patchedBuffer.clear();
+        profiling::StageProfiler* profiler = stageProfiler.load();
+        const uint64_t preprocessStart = profiling::StageProfiler::now();
+        bool patched = pImpl->preprocessUsdContent(data, size, patchedBuffer);
+        const uint64_t preprocessNs = profiling::StageProfiler::now() - preprocessStart;
+        stats.preprocessTimeUs.fetch_add(preprocessNs / 1000);
+        if (profiler) {
+            profiler->record(profiling::Stage::Preprocess, preprocessStart, preprocessNs, fileName);
+        }
+        if (patched) {
+            stats.filesPreprocessed.fetch_add(1);
+        }
+        const uint8_t* processedData = patched ? patchedBuffer.data() : data;
+        const size_t processedSize = patched ? patchedBuffer.size() : size;
+
+        // LIMITED DEBUG: Only show first 200 characters for debugging; printed in place, no copy
+        if (processedSize > 200) {
+            MIDDLEWARE_LOG_DEBUG("USD content preview: %.*s... [truncated for debug]",
+                                 200, reinterpret_cast<const char*>(processedData));
         } else {
-            std::string fullContent(reinterpret_cast<const char*>(processedBuffer.data()), processedBuffer.size());
-            MIDDLEWARE_LOG_DEBUG("USD content: %s", fullContent.c_str());
+            MIDDLEWARE_LOG_DEBUG("USD content: %.*s", static_cast<int>(processedSize),
+                                 reinterpret_cast<const char*>(processedData));
         }
 
         if (progressCallback) {
@@ -563,7 +856,9 @@ bool UsdProcessor::LoadUSDBuffer(const std::vector<uint8_t>& buffer,
         }
 
         // Detect file format
-        bool isUSDZ = (fileName.find(".usdz") != std::string::npos);
+        std::string extension = std::filesystem::path(fileName).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+        bool isUSDZ = (extension == ".usdz");
         if (isUSDZ) {
             MIDDLEWARE_LOG_INFO("Detected USDZ format file");
         }
@@ -573,7 +868,6 @@ bool UsdProcessor::LoadUSDBuffer(const std::vector<uint8_t>& buffer,
         }
 
         // Load USD stage with enhanced options
-        tinyusdz::Stage stage;
         std::string warnings, errors;
         tinyusdz::USDLoadOptions options;
         options.load_payloads = true;
@@ -581,15 +875,17 @@ bool UsdProcessor::LoadUSDBuffer(const std::vector<uint8_t>& buffer,
         options.load_sublayers = true;
         options.max_memory_limit_in_mb = static_cast<int>(memoryLimitMB.load());
 
+        profiling::StageTimer parseTimer(profiler, profiling::Stage::Parse, fileName);
         bool loadResult = tinyusdz::LoadUSDFromMemory(
-            processedBuffer.data(),
-            processedBuffer.size(),
+            processedData,
+            processedSize,
             fileName.c_str(),
             &stage,
             &warnings,
             &errors,
             options
         );
+        parseTimer.stop();
 
         if (!loadResult) {
             MIDDLEWARE_LOG_ERROR("TinyUSDZ load error: %s", errors.c_str());
@@ -602,83 +898,71 @@ bool UsdProcessor::LoadUSDBuffer(const std::vector<uint8_t>& buffer,
         }
 
         MIDDLEWARE_LOG_INFO("USD stage loaded successfully. Root prims: %zu", stage.root_prims().size());
+        return true;
 
-        if (progressCallback) {
-            progressCallback(0.5f, "Processing primitives");
-        }
-
-        // Process main stage
-        glm::mat4 identity(1.0f);
-        size_t initialMeshCount = outMeshData.size();
-
-        for (const auto& rootPrim : stage.root_prims()) {
-            if (shutdownRequested.load()) {
-                MIDDLEWARE_LOG_WARNING("USD processing aborted: shutdown requested");
-                return false;
-            }
-
-            if (!ProcessPrim(const_cast<tinyusdz::Prim*>(&rootPrim), outMeshData, identity, 0)) {
-                MIDDLEWARE_LOG_WARNING("Failed to process root prim: %s", rootPrim.element_name().c_str());
-            }
-        }
+    } catch (const std::exception& e) {
+        MIDDLEWARE_LOG_ERROR("Exception in ParseStage: %s", e.what());
+        stats.processingErrors.fetch_add(1);
+        return false;
+    }
+}
 
-        size_t meshesFromMain = outMeshData.size() - initialMeshCount;
-        MIDDLEWARE_LOG_INFO("Extracted %zu meshes from main stage", meshesFromMain);
+bool UsdProcessor::EvaluateTransforms(const uint8_t* data,
+                                      size_t size,
+                                      const std::string& fileName,
+                                      double timeCode,
+                                      std::vector<PrimTransform>& outTransforms) {
+    std::shared_lock<std::shared_mutex> lock(processingMutex);
+    outTransforms.clear();
 
-        if (progressCallback) {
-            progressCallback(0.7f, "Resolving references");
-        }
+    if (shutdownRequested.load()) {
+        MIDDLEWARE_LOG_WARNING("Transform evaluation aborted: shutdown requested");
+        return false;
+    }
 
-        // Enhanced reference resolution
-        if (referenceResolutionEnabled.load() && (outMeshData.empty() || hasEmptyGeometry(outMeshData))) {
-            MIDDLEWARE_LOG_INFO("Attempting reference resolution for missing geometry");
+    if (!data || size == 0 || size > safety::MAX_STREAMED_FILE_SIZE || fileName.empty()) {
+        MIDDLEWARE_LOG_ERROR("Invalid input for transform evaluation: %zu bytes, filename '%s'",
+                             size, fileName.c_str());
+        stats.processingErrors.fetch_add(1);
+        return false;
+    }
 
-            if (!resolveReferences(stage, processedBuffer, fileName, outMeshData, progressCallback)) {
-                MIDDLEWARE_LOG_WARNING("Reference resolution completed with some failures");
-            }
-        }
+    try {
+        stats.transformEvaluations.fetch_add(1);
 
-        if (progressCallback) {
-            progressCallback(0.9f, "Validating mesh data");
+        ContentDigest digest;
+        if (!HashVerifier::calculateDigest(data, size, digest)) {
+            MIDDLEWARE_LOG_ERROR("Failed to digest USD content for transform evaluation");
+            stats.processingErrors.fetch_add(1);
+            return false;
         }
 
-        // Validate all mesh data
-        auto it = outMeshData.begin();
-        while (it != outMeshData.end()) {
-            if (!it->isValid()) {
-                MIDDLEWARE_LOG_WARNING("Removing invalid mesh: %s", it->elementName.c_str());
-                it = outMeshData.erase(it);
-            } else {
-                ++it;
+        // Scrubbing through an animation re-sends the same content, so the parse is paid once
+        std::shared_ptr<UsdProcessorImpl::TransformStage> entry = pImpl->findTransformStage(digest);
+        if (entry) {
+            stats.transformStageHits.fetch_add(1);
+        } else {
+            entry = std::make_shared<UsdProcessorImpl::TransformStage>();
+            ScratchArenaPool::Lease scratch = pImpl->scratchArenas.acquire();
+            std::pmr::vector<uint8_t> patchedBuffer(scratch.resource());
+            if (!ParseStage(data, size, fileName, entry->stage, patchedBuffer, nullptr)) {
+                return false;
             }
+            pImpl->storeTransformStage(digest, entry);
         }
 
-        if (progressCallback) {
-            progressCallback(1.0f, "Processing complete");
-        }
-
-        // Update statistics
-        stats.filesProcessed.fetch_add(1);
-        stats.meshesExtracted.fetch_add(outMeshData.size());
-        stats.totalBytesProcessed.fetch_add(buffer.size());
-
-        // LIMITED DEBUG: Only show mesh statistics for RealtimeMesh, not full data
-        MIDDLEWARE_LOG_INFO("USD processing complete: %zu valid meshes extracted for RealtimeMesh", outMeshData.size());
-
-        for (size_t i = 0; i < outMeshData.size(); ++i) {
-            const auto& mesh = outMeshData[i];
-            MIDDLEWARE_LOG_INFO("Mesh %zu '%s': %zu vertices, %zu triangles, %zu normals, %zu UVs",
-                               i, mesh.elementName.c_str(),
-                               mesh.points.size() / 3,
-                               mesh.indices.size() / 3,
-                               mesh.normals.size() / 3,
-                               mesh.uvs.size() / 2);
+        std::lock_guard<std::mutex> stageLock(entry->mutex);
+        const glm::mat4 identity(1.0f);
+        for (const auto& rootPrim : entry->stage.root_prims()) {
+            CollectTransforms(&rootPrim, identity, false, 0, timeCode, entry->staticWorld, outTransforms);
         }
 
+        MIDDLEWARE_LOG_DEBUG("Evaluated %zu mesh transforms of %s at time %f",
+                             outTransforms.size(), fileName.c_str(), timeCode);
         return true;
 
     } catch (const std::exception& e) {
-        MIDDLEWARE_LOG_ERROR("Exception in LoadUSDBuffer: %s", e.what());
+        MIDDLEWARE_LOG_ERROR("Exception in EvaluateTransforms: %s", e.what());
         stats.processingErrors.fetch_add(1);
         return false;
     }
@@ -688,7 +972,8 @@ bool UsdProcessor::LoadUSDBuffer(const std::vector<uint8_t>& buffer,
 // Enhanced disk loading with file validation
 bool UsdProcessor::LoadUSDFromDisk(const std::string& filePath,
                                   std::vector<MeshData>& outMeshData,
-                                  ProgressCallback progressCallback) {
+                                  ProgressCallback progressCallback,
+                                  const std::atomic<bool>* cancelFlag) {
     MIDDLEWARE_LOG_INFO("Loading USD from disk: %s", filePath.c_str());
 
     // Validate file path
@@ -699,38 +984,28 @@ bool UsdProcessor::LoadUSDFromDisk(const std::string& filePath,
 
     try {
         if (progressCallback) {
-            progressCallback(0.1f, "Reading file from disk");
+            progressCallback(0.1f, "Mapping file from disk");
         }
 
-        // Read file with size validation
-        std::ifstream file(filePath, std::ios::binary | std::ios::ate);
-        if (!file.is_open()) {
+        // Parse straight out of the page cache instead of reading into a heap buffer
+        std::shared_ptr<MappedFile> mapped = MappedFile::open(filePath);
+        if (!mapped) {
             MIDDLEWARE_LOG_ERROR("Failed to open file: %s", filePath.c_str());
             return false;
         }
 
-        auto fileSize = file.tellg();
-        if (fileSize <= 0 || static_cast<size_t>(fileSize) > safety::MAX_BUFFER_SIZE) {
-            MIDDLEWARE_LOG_ERROR("Invalid file size: %lld bytes", static_cast<long long>(fileSize));
+        if (mapped->size() > safety::MAX_STREAMED_FILE_SIZE) {
+            MIDDLEWARE_LOG_ERROR("Invalid file size: %zu bytes", mapped->size());
             return false;
         }
 
-        file.seekg(0, std::ios::beg);
-
-        std::vector<uint8_t> buffer;
-        buffer.resize(static_cast<size_t>(fileSize));
-
-        if (!file.read(reinterpret_cast<char*>(buffer.data()), fileSize)) {
-            MIDDLEWARE_LOG_ERROR("Failed to read file contents: %s", filePath.c_str());
-            return false;
-        }
+        mapped->prefetch(0, mapped->size());
 
         if (progressCallback) {
-            progressCallback(0.2f, "File loaded, processing USD");
+            progressCallback(0.2f, "File mapped, processing USD");
         }
 
-        // Use existing buffer processing
-        return LoadUSDBuffer(buffer, filePath, outMeshData, progressCallback);
+        return LoadUSDBuffer(mapped->data(), mapped->size(), filePath, outMeshData, progressCallback, cancelFlag);
 
     } catch (const std::exception& e) {
         MIDDLEWARE_LOG_ERROR("Exception in LoadUSDFromDisk: %s - %s", filePath.c_str(), e.what());
@@ -756,7 +1031,9 @@ int32_t UsdProcessor::getMaxRecursionDepth() const {
 void UsdProcessor::setMemoryLimit(size_t limitMB) {
     if (limitMB >= 1 && limitMB <= 4096) {
         memoryLimitMB.store(limitMB);
-        MIDDLEWARE_LOG_INFO("Memory limit set to %zu MB", limitMB);
+        pImpl->setLayerCacheBudget(layerCacheBudget(limitMB));
+        MIDDLEWARE_LOG_INFO("Memory limit set to %zu MB (layer cache %zu MB)",
+                            limitMB, limitMB / LAYER_CACHE_SHARE_DIVISOR);
     } else {
         MIDDLEWARE_LOG_ERROR("Invalid memory limit: %zu MB (must be 1-4096)", limitMB);
     }
@@ -775,12 +1052,104 @@ bool UsdProcessor::isReferenceResolutionEnabled() const {
     return referenceResolutionEnabled.load();
 }
 
+void UsdProcessor::setWorkerThreads(size_t threadCount) {
+    if (threadCount >= 1 && threadCount <= MAX_WORKER_THREADS) {
+        workerThreads.store(threadCount);
+        MIDDLEWARE_LOG_INFO("Mesh extraction threads set to %zu", threadCount);
+    } else {
+        MIDDLEWARE_LOG_ERROR("Invalid mesh extraction thread count: %zu (must be 1-%zu)",
+                             threadCount, MAX_WORKER_THREADS);
+    }
+}
+
+size_t UsdProcessor::getWorkerThreads() const {
+    return workerThreads.load();
+}
+
+void UsdProcessor::setInstancingEnabled(bool enable) {
+    instancingEnabled.store(enable);
+    // Cached layers were extracted under the previous layout
+    pImpl->clearLayerCache();
+    MIDDLEWARE_LOG_INFO("Instancing output %s", enable ? "enabled" : "disabled");
+}
+
+bool UsdProcessor::isInstancingEnabled() const {
+    return instancingEnabled.load();
+}
+
+void UsdProcessor::setLocalSpaceEnabled(bool enable) {
+    localSpaceEnabled.store(enable);
+    pImpl->clearLayerCache();
+    MIDDLEWARE_LOG_INFO("Local-space output %s", enable ? "enabled" : "disabled");
+}
+
+bool UsdProcessor::isLocalSpaceEnabled() const {
+    return localSpaceEnabled.load();
+}
+
+void UsdProcessor::setMeshOptimizationEnabled(bool enable) {
+    meshOptimizationEnabled.store(enable);
+    pImpl->clearLayerCache();
+    MIDDLEWARE_LOG_INFO("Mesh optimization %s", enable ? "enabled" : "disabled");
+}
+
+bool UsdProcessor::isMeshOptimizationEnabled() const {
+    return meshOptimizationEnabled.load();
+}
+
+void UsdProcessor::setWeldEpsilon(float epsilon) {
+    if (!std::isfinite(epsilon) || epsilon < 0.0f) {
+        MIDDLEWARE_LOG_ERROR("Invalid weld epsilon: %f (must be finite and >= 0)", epsilon);
+        return;
+    }
+    if (weldEpsilon.exchange(epsilon) != epsilon) {
+        pImpl->clearLayerCache();
+    }
+    MIDDLEWARE_LOG_DEBUG("Weld epsilon set to %g", epsilon);
+}
+
+void UsdProcessor::setTimeCode(double code) {
+    if (std::isinf(code)) {
+        MIDDLEWARE_LOG_ERROR("Invalid time code: %f (must be finite or NaN)", code);
+        return;
+    }
+    double previous = timeCode.exchange(code);
+    if (previous != code && !(std::isnan(previous) && std::isnan(code))) {
+        // Referenced layers are extracted at the time code in effect when they are parsed
+        pImpl->clearLayerCache();
+    }
+    MIDDLEWARE_LOG_DEBUG("Time code set to %f", code);
+}
+
+double UsdProcessor::getTimeCode() const {
+    return timeCode.load();
+}
+
+void UsdProcessor::setStageProfiler(profiling::StageProfiler* profiler) {
+    stageProfiler.store(profiler);
+}
+
 UsdProcessor::ProcessingStats::Snapshot UsdProcessor::getProcessingStats() const {
-    return stats.getSnapshot(); // Return copyable snapshot
+    ProcessingStats::Snapshot snapshot = stats.getSnapshot(); // Return copyable snapshot
+    const ScratchArenaPool::Stats arenas = pImpl->scratchArenas.getStats();
+    snapshot.arenaLeases = arenas.leases;
+    snapshot.arenaBytesAllocated = arenas.bytesAllocated;
+    snapshot.arenaPeakBytes = arenas.peakBytes;
+    snapshot.arenaChunkAllocations = arenas.chunkAllocations;
+    snapshot.arenaTimeUs = arenas.allocatorTimeNs / 1000;
+    snapshot.arenaRetainedBytes = arenas.retainedBytes;
+    return snapshot;
+}
+
+void UsdProcessor::clearLayerCache() {
+    pImpl->clearLayerCache();
+    pImpl->clearTransformStages();
+    MIDDLEWARE_LOG_INFO("Layer cache cleared");
 }
 
 void UsdProcessor::resetProcessingStats() {
     stats.reset();
+    pImpl->scratchArenas.resetStats();
     MIDDLEWARE_LOG_INFO("Processing statistics reset");
 }
 
@@ -833,9 +1202,10 @@ bool UsdProcessor::isSupportedExtension(const std::string& extension) {
 // Private helper methods implementation
 
 bool UsdProcessor::ProcessPrim(void* prim,
-                              std::vector<MeshData>& meshDataArray,
+                              std::vector<MeshWorkItem>& workItems,
                               const glm::mat4& parentTransform,
-                              int32_t depth) {
+                              int32_t depth,
+                              const std::atomic<bool>* cancelFlag) {
     MIDDLEWARE_VALIDATE_POINTER(prim, "ProcessPrim");
 
     // Check recursion depth limit
@@ -844,8 +1214,8 @@ bool UsdProcessor::ProcessPrim(void* prim,
         return false;
     }
 
-    if (shutdownRequested.load()) {
-        MIDDLEWARE_LOG_DEBUG("Processing aborted: shutdown requested");
+    if (isCancelled(cancelFlag)) {
+        MIDDLEWARE_LOG_DEBUG("Processing aborted: shutdown or cancellation requested");
         return false;
     }
 
@@ -858,7 +1228,7 @@ bool UsdProcessor::ProcessPrim(void* prim,
                            depth);
 
         // Get and validate local transform
-        glm::mat4 localTransform = GetLocalTransform(prim);
+        glm::mat4 localTransform = GetLocalTransform(prim, timeCode.load());
         if (!validateTransform(localTransform)) {
             MIDDLEWARE_LOG_WARNING("Invalid transform for prim: %s, using identity",
                                  usdPrim.element_name().c_str());
@@ -885,32 +1255,18 @@ bool UsdProcessor::ProcessPrim(void* prim,
                 return false;
             }
 
-            MeshData meshData;
-            meshData.elementName = usdPrim.element_name();
-            meshData.typeName = usdPrim.prim_type_name();
-
-            if (ExtractMeshData(const_cast<tinyusdz::GeomMesh*>(mesh), meshData, worldTransform)) {
-                if (meshData.isValid()) {
-                    meshDataArray.push_back(std::move(meshData));
-                    stats.meshesExtracted.fetch_add(1);
-                    MIDDLEWARE_LOG_DEBUG("Successfully extracted mesh: %s (%zu vertices, %zu triangles)",
-                                       meshData.elementName.c_str(),
-                                       meshData.getVertexCount(),
-                                       meshData.getTriangleCount());
-                } else {
-                    MIDDLEWARE_LOG_WARNING("Extracted mesh data is invalid: %s",
-                                         usdPrim.element_name().c_str());
-                }
-            } else {
-                MIDDLEWARE_LOG_WARNING("Failed to extract mesh data: %s",
-                                     usdPrim.element_name().c_str());
-            }
+            MeshWorkItem item;
+            item.mesh = const_cast<tinyusdz::GeomMesh*>(mesh);
+            item.elementName = usdPrim.element_name();
+            item.typeName = usdPrim.prim_type_name();
+            item.worldTransform = worldTransform;
+            workItems.push_back(std::move(item));
         }
 
         // Process children recursively
         for (const auto& child : usdPrim.children()) {
             if (!ProcessPrim(const_cast<tinyusdz::Prim*>(&child),
-                            meshDataArray, worldTransform, depth + 1)) {
+                            workItems, worldTransform, depth + 1, cancelFlag)) {
                 MIDDLEWARE_LOG_WARNING("Failed to process child prim: %s",
                                      child.element_name().c_str());
                 // Continue processing other children
@@ -926,9 +1282,302 @@ bool UsdProcessor::ProcessPrim(void* prim,
     }
 }
 
+void UsdProcessor::CollectTransforms(const void* prim,
+                                     const glm::mat4& parentTransform,
+                                     bool parentAnimated,
+                                     int32_t depth,
+                                     double timeCode,
+                                     std::unordered_map<const void*, glm::mat4>& staticWorld,
+                                     std::vector<PrimTransform>& outTransforms) {
+    if (depth >= maxRecursionDepth.load() || shutdownRequested.load()) {
+        return;
+    }
+
+    const tinyusdz::Prim& usdPrim = *static_cast<const tinyusdz::Prim*>(prim);
+
+    // A prim whose own ops and every ancestor's are untimed has the same world matrix at
+    // every time code, so only the animated part of the hierarchy is re-evaluated
+    bool animated = parentAnimated;
+    glm::mat4 worldTransform;
+    auto cached = parentAnimated ? staticWorld.end() : staticWorld.find(prim);
+    if (cached != staticWorld.end()) {
+        worldTransform = cached->second;
+    } else {
+        bool localAnimated = false;
+        glm::mat4 localTransform = GetLocalTransform(const_cast<void*>(prim), timeCode, &localAnimated);
+        if (!validateTransform(localTransform)) {
+            localTransform = glm::mat4(1.0f);
+        }
+        worldTransform = parentTransform * localTransform;
+        if (!validateTransform(worldTransform)) {
+            MIDDLEWARE_LOG_WARNING("Invalid world transform for prim: %s", usdPrim.element_name().c_str());
+            return;
+        }
+        animated = parentAnimated || localAnimated;
+        if (!animated) {
+            staticWorld.emplace(prim, worldTransform);
+        }
+    }
+
+    if (usdPrim.as<tinyusdz::GeomMesh>()) {
+        PrimTransform transform;
+        transform.elementName = usdPrim.element_name();
+        transform.worldTransform = worldTransform;
+        outTransforms.push_back(std::move(transform));
+    }
+
+    for (const auto& child : usdPrim.children()) {
+        CollectTransforms(&child, worldTransform, animated, depth + 1, timeCode, staticWorld, outTransforms);
+    }
+}
+
+bool UsdProcessor::isCancelled(const std::atomic<bool>* cancelFlag) const {
+    return shutdownRequested.load() || (cancelFlag && cancelFlag->load(std::memory_order_relaxed));
+}
+
+size_t UsdProcessor::ExtractMeshWorkItems(const std::vector<MeshWorkItem>& workItems,
+                                          std::vector<MeshData>& meshDataArray,
+                                          const std::atomic<bool>* cancelFlag,
+                                          const ProgressCallback& progressCallback) {
+    MeshSink append = [&meshDataArray](MeshData&& mesh) {
+        meshDataArray.push_back(std::move(mesh));
+        return true;
+    };
+    return ExtractMeshWorkItems(workItems, append, cancelFlag, progressCallback);
+}
+
+size_t UsdProcessor::ExtractMeshWorkItems(const std::vector<MeshWorkItem>& workItems,
+                                          const MeshSink& sink,
+                                          const std::atomic<bool>* cancelFlag,
+                                          const ProgressCallback& progressCallback,
+                                          bool* stopped) {
+    if (stopped) {
+        *stopped = false;
+    }
+    if (workItems.empty()) {
+        return 0;
+    }
+
+    // Instancing: every distinct GeomMesh is extracted once in local space and each
+    // occurrence contributes only its world transform
+    const bool instancing = instancingEnabled.load();
+    const bool localSpace = localSpaceEnabled.load();
+    const bool optimizeMeshes = meshOptimizationEnabled.load();
+    ScratchArenaPool::Lease scratch = pImpl->scratchArenas.acquire();
+    std::vector<MeshWorkItem> prototypes;
+    std::vector<std::vector<glm::mat4>> placements;
+    if (instancing) {
+        std::pmr::unordered_map<void*, size_t> prototypeIndex(scratch.resource());
+        for (const auto& item : workItems) {
+            auto inserted = prototypeIndex.emplace(item.mesh, prototypes.size());
+            if (inserted.second) {
+                prototypes.push_back(item);
+                prototypes.back().worldTransform = glm::mat4(1.0f);
+                placements.emplace_back();
+            }
+            placements[inserted.first->second].push_back(item.worldTransform);
+        }
+        MIDDLEWARE_LOG_DEBUG("Instancing: %zu mesh prims share %zu prototypes", workItems.size(), prototypes.size());
+    }
+    const std::vector<MeshWorkItem>& items = instancing ? prototypes : workItems;
+
+    // One slot per work item so every thread writes to its own element and the
+    // result keeps traversal order regardless of which thread finishes first
+    std::vector<MeshData> slots(items.size());
+    std::pmr::vector<uint8_t> extracted(items.size(), 0, scratch.resource());
+    std::atomic<size_t> nextItem{0};
+
+    // Without instancing a slot is handed on as soon as every earlier item is done, so
+    // only meshes still waiting on a slower thread are held. The sink is called under
+    // emitMutex, one mesh at a time.
+    std::mutex emitMutex;
+    std::pmr::vector<uint8_t> finished(items.size(), 0, scratch.resource());
+    size_t nextEmit = 0;
+    size_t accepted = 0;
+    std::atomic<bool> sinkStopped{false};
+    auto emitFinished = [&](size_t index) {
+        if (instancing) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(emitMutex);
+        finished[index] = 1;
+        for (; nextEmit < items.size() && finished[nextEmit]; ++nextEmit) {
+            MeshData mesh = std::move(slots[nextEmit]);
+            if (!extracted[nextEmit] || sinkStopped.load()) {
+                continue;
+            }
+            try {
+                if (sink(std::move(mesh))) {
+                    ++accepted;
+                    continue;
+                }
+            } catch (const std::exception& e) {
+                MIDDLEWARE_LOG_ERROR("Exception in mesh sink for %s: %s", items[nextEmit].elementName.c_str(), e.what());
+                stats.processingErrors.fetch_add(1);
+            }
+            sinkStopped.store(true);
+        }
+    };
+
+    // Progress is reported in whole percent steps, one caller at a time
+    std::mutex progressMutex;
+    size_t finishedItems = 0;
+    int reportedPercent = -1;
+    auto reportProgress = [&]() {
+        if (!progressCallback) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(progressMutex);
+        ++finishedItems;
+        const int percent = static_cast<int>(finishedItems * 100 / items.size());
+        if (percent != reportedPercent) {
+            reportedPercent = percent;
+            progressCallback(static_cast<float>(finishedItems) / static_cast<float>(items.size()), "Extracting meshes");
+        }
+    };
+
+    // Threads left over when there are fewer meshes than workers triangulate large meshes
+    const size_t workers = workerThreads.load();
+    const size_t threadCount = std::min(workers, items.size());
+    const size_t threadsPerMesh = std::max<size_t>(1, workers / std::max<size_t>(threadCount, 1));
+
+    auto extractWorker = [&]() {
+        // Per-mesh temporaries; the arena is rewound after every mesh
+        ScratchArenaPool::Lease meshScratch = pImpl->scratchArenas.acquire();
+        for (size_t i = nextItem.fetch_add(1); i < items.size(); i = nextItem.fetch_add(1)) {
+            if (isCancelled(cancelFlag) || sinkStopped.load()) {
+                return;
+            }
+
+            const MeshWorkItem& item = items[i];
+            MeshData& meshData = slots[i];
+            meshData.elementName = item.elementName;
+            meshData.typeName = item.typeName;
+
+            try {
+                // Local-space mode keeps the points as authored and reports the placement
+                // separately, so a moved prim changes only its transform
+                const glm::mat4 bakedTransform = localSpace ? glm::mat4(1.0f) : item.worldTransform;
+                const bool extractedMesh = ExtractMeshData(item.mesh, meshData, bakedTransform, threadsPerMesh,
+                                                           meshScratch.resource());
+                meshScratch.arena().reset();
+                if (!extractedMesh) {
+                    MIDDLEWARE_LOG_WARNING("Failed to extract mesh data: %s", item.elementName.c_str());
+                } else if (!meshData.isValid()) {
+                    MIDDLEWARE_LOG_WARNING("Extracted mesh data is invalid: %s", item.elementName.c_str());
+                } else {
+                    if (localSpace && !instancing) {
+                        meshData.instanceTransforms.assign(1, item.worldTransform);
+                    }
+                    if (optimizeMeshes) {
+                        optimizeMeshData(meshData);
+                    }
+                    extracted[i] = 1;
+                    MIDDLEWARE_LOG_DEBUG("Successfully extracted mesh: %s (%zu vertices, %zu triangles)",
+                                       meshData.elementName.c_str(),
+                                       meshData.getVertexCount(),
+                                       meshData.getTriangleCount());
+                }
+            } catch (const std::exception& e) {
+                MIDDLEWARE_LOG_ERROR("Exception extracting mesh %s: %s", item.elementName.c_str(), e.what());
+                stats.processingErrors.fetch_add(1);
+            }
+            emitFinished(i);
+            reportProgress();
+        }
+    };
+
+    if (threadCount <= 1) {
+        extractWorker();
+    } else {
+        MIDDLEWARE_LOG_DEBUG("Extracting %zu meshes on %zu threads", items.size(), threadCount);
+
+        // Each pool participant pulls items until none are left
+        WorkerPool::shared().parallelFor(threadCount, threadCount, [&](size_t) { extractWorker(); });
+    }
+
+    // Merging needs every prototype, so instanced meshes are only handed on at the end
+    if (instancing && !isCancelled(cancelFlag)) {
+        std::vector<MeshData> merged;
+        AppendInstancedMeshes(slots, extracted, placements, merged);
+        for (auto& mesh : merged) {
+            if (!sink(std::move(mesh))) {
+                sinkStopped.store(true);
+                break;
+            }
+            ++accepted;
+        }
+    }
+
+    if (stopped) {
+        *stopped = sinkStopped.load();
+    }
+    stats.meshesExtracted.fetch_add(accepted);
+    return accepted;
+}
+
+size_t UsdProcessor::AppendInstancedMeshes(std::vector<MeshData>& prototypes,
+                                           const std::pmr::vector<uint8_t>& extracted,
+                                           std::vector<std::vector<glm::mat4>>& placements,
+                                           std::vector<MeshData>& meshDataArray) {
+    // Distinct prims can still carry identical geometry (e.g. flattened references), so
+    // prototypes are merged on content as well; the fingerprint only narrows the exact compare
+    std::pmr::unordered_multimap<uint64_t, size_t> byFingerprint(extracted.get_allocator().resource());
+    const size_t firstAppended = meshDataArray.size();
+    uint64_t deduplicated = 0;
+
+    for (size_t i = 0; i < prototypes.size(); ++i) {
+        if (!extracted[i]) {
+            continue;
+        }
+
+        MeshData& mesh = prototypes[i];
+        uint64_t fingerprint = geometryFingerprint(mesh);
+        auto range = byFingerprint.equal_range(fingerprint);
+        auto match = std::find_if(range.first, range.second, [&](const auto& entry) {
+            return sameGeometry(meshDataArray[entry.second], mesh);
+        });
+
+        if (match != range.second) {
+            auto& transforms = meshDataArray[match->second].instanceTransforms;
+            transforms.insert(transforms.end(), placements[i].begin(), placements[i].end());
+            deduplicated += placements[i].size();
+            continue;
+        }
+
+        deduplicated += placements[i].size() - 1;
+        mesh.instanceTransforms = std::move(placements[i]);
+        byFingerprint.emplace(fingerprint, meshDataArray.size());
+        meshDataArray.push_back(std::move(mesh));
+    }
+
+    // A mesh placed once gains nothing from instancing; bake it like the flattening path
+    // unless local-space output asked for the placement to stay separate
+    for (size_t i = firstAppended; i < meshDataArray.size() && !localSpaceEnabled.load(); ++i) {
+        MeshData& mesh = meshDataArray[i];
+        if (mesh.instanceTransforms.size() == 1) {
+            const float* matrix = &mesh.instanceTransforms[0][0][0];
+            if (!mesh.points.empty()) {
+                kernels::transformPoints(matrix, &mesh.points[0].x, &mesh.points[0].x, mesh.points.size());
+            }
+            if (!mesh.normals.empty()) {
+                kernels::transformNormals(matrix, &mesh.normals[0].x, &mesh.normals[0].x, mesh.normals.size());
+            }
+            mesh.instanceTransforms.clear();
+        }
+    }
+
+    stats.instancesDeduplicated.fetch_add(deduplicated);
+    MIDDLEWARE_LOG_INFO("Instancing: %zu unique meshes, %llu placements deduplicated",
+                        meshDataArray.size() - firstAppended, static_cast<unsigned long long>(deduplicated));
+    return meshDataArray.size() - firstAppended;
+}
+
 bool UsdProcessor::ExtractMeshData(void* mesh,
                                   MeshData& outMeshData,
-                                  const glm::mat4& worldTransform) {
+                                  const glm::mat4& worldTransform,
+                                  size_t threads,
+                                  std::pmr::memory_resource* scratch) {
     MIDDLEWARE_VALIDATE_POINTER(mesh, "ExtractMeshData");
     if (!validateTransform(worldTransform)) {
         MIDDLEWARE_LOG_ERROR("Invalid world transform in ExtractMeshData");
@@ -953,29 +1602,55 @@ bool UsdProcessor::ExtractMeshData(void* mesh,
 
         MIDDLEWARE_LOG_DEBUG("Extracting mesh with %zu points", points.size());
 
+        static_assert(sizeof(points[0]) == sizeof(glm::vec3), "point3f must be three packed floats");
+        static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "glm::mat4 must be 16 packed floats");
+        const float* matrix = &worldTransform[0][0];
+
         // Transform and validate points
         outMeshData.points.clear();
-        outMeshData.points.reserve(points.size());
-        for (const auto& pt : points) {
-            // Validate input point
-            if (!std::isfinite(pt.x) || !std::isfinite(pt.y) || !std::isfinite(pt.z)) {
-                MIDDLEWARE_LOG_WARNING("Non-finite vertex detected, skipping");
-                continue;
+        const float* rawPoints = reinterpret_cast<const float*>(points.data());
+        if (kernels::allFinite(rawPoints, points.size() * 3)) {
+            // Fast path: transform the whole array in one batch, then repair any vertex the
+            // transform pushed out of range
+            outMeshData.points.resize(points.size());
+            float* transformed = &outMeshData.points[0].x;
+            kernels::transformPoints(matrix, rawPoints, transformed, points.size());
+
+            if (!kernels::allFinite(transformed, points.size() * 3)) {
+                size_t repaired = 0;
+                for (size_t i = 0; i < points.size(); ++i) {
+                    glm::vec3& vertex = outMeshData.points[i];
+                    if (!std::isfinite(vertex.x) || !std::isfinite(vertex.y) || !std::isfinite(vertex.z)) {
+                        vertex = glm::vec3(points[i].x, points[i].y, points[i].z);
+                        ++repaired;
+                    }
+                }
+                MIDDLEWARE_LOG_WARNING("Transform produced %zu non-finite vertices, using originals", repaired);
             }
+        } else {
+            // Slow path: skip non-finite input vertices one by one
+            outMeshData.points.reserve(points.size());
+            for (const auto& pt : points) {
+                // Validate input point
+                if (!std::isfinite(pt.x) || !std::isfinite(pt.y) || !std::isfinite(pt.z)) {
+                    MIDDLEWARE_LOG_WARNING("Non-finite vertex detected, skipping");
+                    continue;
+                }
 
-            glm::vec3 vertex(static_cast<float>(pt.x),
-                           static_cast<float>(pt.y),
-                           static_cast<float>(pt.z));
-            glm::vec4 transformedVertex = worldTransform * glm::vec4(vertex, 1.0f);
-
-            // Validate transformed vertex
-            if (!std::isfinite(transformedVertex.x) ||
-                !std::isfinite(transformedVertex.y) ||
-                !std::isfinite(transformedVertex.z)) {
-                MIDDLEWARE_LOG_WARNING("Transform produced non-finite vertex, using original");
-                outMeshData.points.push_back(vertex);
-            } else {
-                outMeshData.points.push_back(glm::vec3(transformedVertex));
+                glm::vec3 vertex(static_cast<float>(pt.x),
+                               static_cast<float>(pt.y),
+                               static_cast<float>(pt.z));
+                glm::vec4 transformedVertex = worldTransform * glm::vec4(vertex, 1.0f);
+
+                // Validate transformed vertex
+                if (!std::isfinite(transformedVertex.x) ||
+                    !std::isfinite(transformedVertex.y) ||
+                    !std::isfinite(transformedVertex.z)) {
+                    MIDDLEWARE_LOG_WARNING("Transform produced non-finite vertex, using original");
+                    outMeshData.points.push_back(vertex);
+                } else {
+                    outMeshData.points.push_back(glm::vec3(transformedVertex));
+                }
             }
         }
 
@@ -992,50 +1667,70 @@ bool UsdProcessor::ExtractMeshData(void* mesh,
             return false;
         }
 
-        // Triangulate with validation
-        std::vector<uint32_t> triangulatedIndices;
-        size_t indexOffset = 0;
-        for (size_t faceIdx = 0; faceIdx < faceVertexCounts.size(); faceIdx++) {
-            int32_t numVertsInFace = faceVertexCounts[faceIdx];
-            if (numVertsInFace < 3) {
-                MIDDLEWARE_LOG_WARNING("Face %zu has less than 3 vertices, skipping", faceIdx);
-                indexOffset += numVertsInFace;
-                continue;
-            }
-
-            if (numVertsInFace > 100) { // Reasonable polygon limit
-                MIDDLEWARE_LOG_WARNING("Face %zu has too many vertices (%d), skipping",
-                                     faceIdx, numVertsInFace);
-                indexOffset += numVertsInFace;
-                continue;
-            }
-
-            // Check bounds for face indices
-            if (indexOffset + numVertsInFace > faceVertexIndices.size()) {
-                MIDDLEWARE_LOG_ERROR("Face vertex indices out of bounds");
-                break;
-            }
-
-            // Triangulate this face
-            for (int32_t triIdx = 0; triIdx < numVertsInFace - 2; triIdx++) {
-                uint32_t idx0 = static_cast<uint32_t>(faceVertexIndices[indexOffset]);
-                uint32_t idx1 = static_cast<uint32_t>(faceVertexIndices[indexOffset + triIdx + 1]);
-                uint32_t idx2 = static_cast<uint32_t>(faceVertexIndices[indexOffset + triIdx + 2]);
-
-                // Validate indices
-                if (idx0 >= outMeshData.points.size() ||
-                    idx1 >= outMeshData.points.size() ||
-                    idx2 >= outMeshData.points.size()) {
-                    MIDDLEWARE_LOG_WARNING("Invalid triangle indices, skipping triangle");
-                    continue;
-                }
-
-                triangulatedIndices.push_back(idx0);
-                triangulatedIndices.push_back(idx1);
-                triangulatedIndices.push_back(idx2);
-            }
+        // Authored normals are used when they match the points; otherwise they are
+        // accumulated from the face normals in the triangulation sweep
+        auto normals = geomMesh->get_normals();
+        if (!normals.empty() && normals.size() != points.size()) {
+            MIDDLEWARE_LOG_WARNING("Normal count (%zu) doesn't match vertex count (%zu)",
+                                 normals.size(), points.size());
+        }
+        const bool computeNormals = normals.size() != points.size();
+
+        // Exact prefix sum first, so the index buffer is allocated once at its final size
+        // Face normals scatter into shared vertex sums, so the sweep is only split when the
+        // mesh authors its normals; per-range sums would cost a full normal buffer per range
+        const size_t faceCount = faceVertexCounts.size();
+        const size_t rangeCount = computeNormals
+            ? 1
+            : std::max<size_t>(1, std::min(threads, faceCount / PARALLEL_TRIANGULATION_FACES));
+        triangulate::Plan plan;
+        triangulate::planFaceRanges(faceVertexCounts.data(), faceCount, faceVertexIndices.size(), rangeCount, plan);
+        if (plan.skippedFaces > 0) {
+            MIDDLEWARE_LOG_WARNING("Skipped %zu faces with fewer than 3 or more than %d vertices",
+                                 plan.skippedFaces, triangulate::MAX_FACE_VERTICES);
+        }
+        if (plan.truncated) {
+            MIDDLEWARE_LOG_ERROR("Face vertex indices out of bounds");
+        }
+
+        if (plan.indexCount > safety::MAX_MESH_INDICES) {
+            MIDDLEWARE_LOG_ERROR("Too many indices generated: %zu (max: %zu)",
+                               plan.indexCount, safety::MAX_MESH_INDICES);
+            return false;
+        }
 
-            indexOffset += numVertsInFace;
+        // Triangulation, bounds validation and face-normal accumulation in one sweep per range
+        const size_t vertexCount = outMeshData.points.size();
+        const float* pointData = &outMeshData.points[0].x;
+        std::vector<uint32_t>& triangulatedIndices = outMeshData.indices;
+        triangulatedIndices.resize(plan.indexCount);
+        if (computeNormals) {
+            outMeshData.normals.assign(vertexCount, glm::vec3(0.0f));
+        }
+
+        std::pmr::memory_resource* temporaries = scratch ? scratch : std::pmr::get_default_resource();
+        const size_t ranges = plan.ranges.size();
+        std::pmr::vector<size_t> written(ranges, 0, temporaries);
+        if (ranges == 1) {
+            written[0] = triangulate::sweepFaceRange(faceVertexCounts.data(), faceVertexIndices.data(),
+                                                     plan.ranges[0], pointData, vertexCount,
+                                                     triangulatedIndices.data(),
+                                                     computeNormals ? &outMeshData.normals[0].x : nullptr);
+        } else if (ranges > 1) {
+            // Ranges write disjoint parts of the index buffer, so they need no synchronisation
+            WorkerPool::shared().parallelFor(ranges, ranges, [&](size_t r) {
+                written[r] = triangulate::sweepFaceRange(faceVertexCounts.data(), faceVertexIndices.data(),
+                                                         plan.ranges[r], pointData, vertexCount,
+                                                         triangulatedIndices.data(), nullptr);
+            });
+        }
+
+        const size_t validIndices = triangulate::compactRanges(triangulatedIndices.data(), plan.ranges.data(),
+                                                               written.data(), ranges);
+        if (validIndices < plan.indexCount) {
+            MIDDLEWARE_LOG_WARNING("Skipped %zu triangles with out-of-range indices",
+                                 (plan.indexCount - validIndices) / 3);
+            triangulatedIndices.resize(validIndices);
         }
 
         if (triangulatedIndices.empty()) {
@@ -1043,22 +1738,17 @@ bool UsdProcessor::ExtractMeshData(void* mesh,
             return false;
         }
 
-        if (triangulatedIndices.size() > safety::MAX_MESH_INDICES) {
-            MIDDLEWARE_LOG_ERROR("Too many indices generated: %zu (max: %zu)",
-                               triangulatedIndices.size(), safety::MAX_MESH_INDICES);
-            return false;
-        }
-
-        outMeshData.indices = std::move(triangulatedIndices);
+        if (computeNormals) {
+            triangulate::normalizeNormals(&outMeshData.normals[0].x, vertexCount);
+        } else {
+            outMeshData.normals.clear();
+            static_assert(sizeof(normals[0]) == sizeof(glm::vec3), "normal3f must be three packed floats");
+            const float* rawNormals = reinterpret_cast<const float*>(normals.data());
 
-        // Extract normals with validation
-        auto normals = geomMesh->get_normals();
-        if (!normals.empty()) {
-            if (normals.size() != points.size()) {
-                MIDDLEWARE_LOG_WARNING("Normal count (%zu) doesn't match vertex count (%zu)",
-                                     normals.size(), points.size());
+            if (kernels::allFinite(rawNormals, normals.size() * 3)) {
+                outMeshData.normals.resize(normals.size());
+                kernels::transformNormals(matrix, rawNormals, &outMeshData.normals[0].x, normals.size());
             } else {
-                outMeshData.normals.clear();
                 outMeshData.normals.reserve(normals.size());
                 glm::mat3 normalMatrix = glm::mat3(worldTransform);
 
@@ -1087,20 +1777,23 @@ bool UsdProcessor::ExtractMeshData(void* mesh,
             }
         }
 
-        // If no normals provided, calculate them
-        if (outMeshData.normals.empty()) {
-            if (!calculateMeshNormals(outMeshData.points, outMeshData.indices, outMeshData.normals)) {
-                MIDDLEWARE_LOG_WARNING("Failed to calculate normals for mesh: %s",
-                                     outMeshData.elementName.c_str());
-            }
-        }
-
         // Extract UV coordinates
         extractUVCoordinates(geomMesh, outMeshData);
 
         // ✅ NEW: Extract vertex colors from primvars:color.timeSamples
         extractVertexColors(geomMesh, outMeshData);
 
+        // Points are finite and indices bounds-checked by construction; only the attributes
+        // taken from the file still need the checks that isValid() would otherwise rescan
+        const size_t vertexTotal = outMeshData.points.size();
+        outMeshData.geometryValidated =
+            (outMeshData.normals.empty() ||
+             (outMeshData.normals.size() == vertexTotal &&
+              kernels::allFinite(&outMeshData.normals[0].x, vertexTotal * 3))) &&
+            (outMeshData.uvs.empty() ||
+             (outMeshData.uvs.size() == vertexTotal &&
+              kernels::allFinite(&outMeshData.uvs[0].x, vertexTotal * 2)));
+
         MIDDLEWARE_LOG_DEBUG("Successfully extracted mesh: %zu vertices, %zu triangles, %zu normals, %zu UVs, %zu colors",
                            outMeshData.points.size(),
                            outMeshData.indices.size() / 3,
@@ -1128,7 +1821,7 @@ bool UsdProcessor::ExtractMeshData(void* mesh,
         std::string primvarErr;
 
         // Try different color attribute names
-        const std::vector<std::string> colorNames = {
+        static const std::vector<std::string> colorNames = {
             "primvars:color", "color", "primvars:displayColor", "displayColor",
             "primvars:Cd", "Cd"  // Common in Houdini/Maya
         };
@@ -1147,20 +1840,28 @@ bool UsdProcessor::ExtractMeshData(void* mesh,
                     MIDDLEWARE_LOG_DEBUG("Found %zu RGBA vertex colors in primvar: %s",
                                        color4fValues.size(), name.c_str());
 
-                    meshData.vertex_colors.reserve(color4fValues.size());
-                    for (const auto& color : color4fValues) {
-                        // Validate color values
-                        if (std::isfinite(color.r) && std::isfinite(color.g) &&
-                            std::isfinite(color.b) && std::isfinite(color.a)) {
-                            meshData.vertex_colors.push_back(glm::vec4(
-                                static_cast<float>(color.r),
-                                static_cast<float>(color.g),
-                                static_cast<float>(color.b),
-                                static_cast<float>(color.a)
-                            ));
-                        } else {
-                            // Default white color for invalid values
-                            meshData.vertex_colors.push_back(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+                    static_assert(sizeof(tinyusdz::value::color4f) == sizeof(glm::vec4), "color4f must be four packed floats");
+                    const float* rawColors = reinterpret_cast<const float*>(color4fValues.data());
+                    if (kernels::allFinite(rawColors, color4fValues.size() * 4)) {
+                        // Same layout as glm::vec4, copy the whole array at once
+                        meshData.vertex_colors.resize(color4fValues.size());
+                        std::memcpy(meshData.vertex_colors.data(), rawColors, color4fValues.size() * sizeof(glm::vec4));
+                    } else {
+                        meshData.vertex_colors.reserve(color4fValues.size());
+                        for (const auto& color : color4fValues) {
+                            // Validate color values
+                            if (std::isfinite(color.r) && std::isfinite(color.g) &&
+                                std::isfinite(color.b) && std::isfinite(color.a)) {
+                                meshData.vertex_colors.push_back(glm::vec4(
+                                    static_cast<float>(color.r),
+                                    static_cast<float>(color.g),
+                                    static_cast<float>(color.b),
+                                    static_cast<float>(color.a)
+                                ));
+                            } else {
+                                // Default white color for invalid values
+                                meshData.vertex_colors.push_back(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+                            }
                         }
                     }
                     foundColors = true;
@@ -1269,7 +1970,7 @@ bool UsdProcessor::ExtractMeshData(void* mesh,
 }
 
 
-glm::mat4 UsdProcessor::GetLocalTransform(void* prim) {
+glm::mat4 UsdProcessor::GetLocalTransform(void* prim, double timeCode, bool* animated) {
     MIDDLEWARE_VALIDATE_POINTER(prim, "GetLocalTransform");
 
     try {
@@ -1285,11 +1986,14 @@ glm::mat4 UsdProcessor::GetLocalTransform(void* prim) {
                            xformable->xformOps.size(), usdPrim.element_name().c_str());
 
         for (const auto& op : xformable->xformOps) {
+            if (animated && op.is_timesamples()) {
+                *animated = true;
+            }
             try {
                 switch (op.op_type) {
                     case tinyusdz::XformOp::OpType::Translate: {
                         tinyusdz::value::double3 trans;
-                        if (op.get_interpolated_value(&trans)) {
+                        if (op.get_interpolated_value(&trans, timeCode)) {
                             // Validate translation values
                             if (std::isfinite(trans[0]) && std::isfinite(trans[1]) && std::isfinite(trans[2])) {
                                 glm::vec3 translation(static_cast<float>(trans[0]),
@@ -1307,7 +2011,7 @@ glm::mat4 UsdProcessor::GetLocalTransform(void* prim) {
 
                     case tinyusdz::XformOp::OpType::Scale: {
                         tinyusdz::value::double3 scale;
-                        if (op.get_interpolated_value(&scale)) {
+                        if (op.get_interpolated_value(&scale, timeCode)) {
                             if (std::isfinite(scale[0]) && std::isfinite(scale[1]) && std::isfinite(scale[2]) &&
                                 scale[0] > safety::EPSILON && scale[1] > safety::EPSILON && scale[2] > safety::EPSILON) {
                                 glm::vec3 scaleVec(static_cast<float>(scale[0]),
@@ -1325,7 +2029,7 @@ glm::mat4 UsdProcessor::GetLocalTransform(void* prim) {
 
                     case tinyusdz::XformOp::OpType::RotateXYZ: {
                         tinyusdz::value::double3 rot;
-                        if (op.get_interpolated_value(&rot)) {
+                        if (op.get_interpolated_value(&rot, timeCode)) {
                             if (std::isfinite(rot[0]) && std::isfinite(rot[1]) && std::isfinite(rot[2])) {
                                 // Apply rotations in XYZ order
                                 localTransform = glm::rotate(localTransform,
@@ -1372,7 +2076,7 @@ glm::mat4 UsdProcessor::GetLocalTransform(void* prim) {
 // MISSING METHOD IMPLEMENTATIONS - These were causing linker errors
 
 void UsdProcessor::ExtractReferencePaths(const tinyusdz::Stage& stage,
-                                        std::vector<std::string>& outReferencePaths) {
+                                        std::pmr::vector<std::pmr::string>& outReferencePaths) {
     MIDDLEWARE_LOG_INFO("Extracting reference paths from stage");
 
     // Process each root prim
@@ -1381,30 +2085,36 @@ void UsdProcessor::ExtractReferencePaths(const tinyusdz::Stage& stage,
     }
 }
 
-std::vector<std::string> UsdProcessor::ExtractClipsFromRawContent(const std::vector<uint8_t>& buffer) {
-    std::vector<std::string> clipPaths;
+void UsdProcessor::ExtractClipsFromRawContent(const std::vector<uint8_t>& buffer,
+                                              std::pmr::vector<std::pmr::string>& outClipPaths) {
+    ExtractClipsFromRawContent(buffer.data(), buffer.size(), outClipPaths);
+}
 
-    // Convert buffer to string for parsing
-    std::string content(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+void UsdProcessor::ExtractClipsFromRawContent(const uint8_t* data, size_t size,
+                                              std::pmr::vector<std::pmr::string>& outClipPaths) {
+    // Clip metadata in binary crates is not textual
+    const char* begin = reinterpret_cast<const char*>(data);
+    if (!data || UsdProcessorImpl::isBinaryUsd(std::string_view(begin, size))) {
+        return;
+    }
 
-    // Look for clips patterns in the raw USD content
-    std::regex clipsPattern(R"(asset\[\]\s+assetPaths\s*=\s*\[@([^@]+)@\])");
+    // Look for clips patterns in the raw USD content; compiling the pattern costs more than
+    // scanning a small layer, so it is built once
+    static const std::regex clipsPattern(R"(asset\[\]\s+assetPaths\s*=\s*\[@([^@]+)@\])");
 
-    std::sregex_iterator iter(content.begin(), content.end(), clipsPattern);
-    std::sregex_iterator end;
+    std::cregex_iterator iter(begin, begin + size, clipsPattern);
+    std::cregex_iterator end;
 
     while (iter != end) {
-        std::string clipPath = (*iter)[1].str();
-        MIDDLEWARE_LOG_INFO("Found clip asset path: %s", clipPath.c_str());
-        clipPaths.push_back(clipPath);
+        const auto& clipPath = (*iter)[1];
+        MIDDLEWARE_LOG_INFO("Found clip asset path: %.*s", static_cast<int>(clipPath.length()), clipPath.first);
+        outClipPaths.emplace_back(clipPath.first, clipPath.second);
         ++iter;
     }
-
-    return clipPaths;
 }
 
 void UsdProcessor::ExtractReferencePathsFromPrim(const tinyusdz::Prim& prim,
-                                                std::vector<std::string>& outReferencePaths) {
+                                                std::pmr::vector<std::pmr::string>& outReferencePaths) {
     // Check for references in this prim
     if (prim.metas().references.has_value()) {
         const auto& refs = prim.metas().references.value();
@@ -1414,10 +2124,10 @@ void UsdProcessor::ExtractReferencePathsFromPrim(const tinyusdz::Prim& prim,
 
         // For each reference in the vector
         for (const auto& ref : references) {
-            std::string assetPath = ref.asset_path.GetAssetPath();
+            const std::string& assetPath = ref.asset_path.GetAssetPath();
             if (!assetPath.empty()) {
                 MIDDLEWARE_LOG_INFO("Found reference: %s", assetPath.c_str());
-                outReferencePaths.push_back(assetPath);
+                outReferencePaths.emplace_back(assetPath);
             }
         }
     }
@@ -1431,10 +2141,10 @@ void UsdProcessor::ExtractReferencePathsFromPrim(const tinyusdz::Prim& prim,
 
         // For each payload in the vector
         for (const auto& payload : payloads) {
-            std::string assetPath = payload.asset_path.GetAssetPath();
+            const std::string& assetPath = payload.asset_path.GetAssetPath();
             if (!assetPath.empty()) {
                 MIDDLEWARE_LOG_INFO("Found payload: %s", assetPath.c_str());
-                outReferencePaths.push_back(assetPath);
+                outReferencePaths.emplace_back(assetPath);
             }
         }
     }
@@ -1510,7 +2220,12 @@ bool UsdProcessor::validateFilePath(const std::string& filePath, bool checkExist
 }
 
 std::vector<uint8_t> UsdProcessor::preprocessUsdContent(const std::vector<uint8_t>& buffer) {
-    return pImpl->preprocessUsdContent(buffer);
+    ScratchArenaPool::Lease scratch = pImpl->scratchArenas.acquire();
+    std::pmr::vector<uint8_t> patched(scratch.resource());
+    if (pImpl->preprocessUsdContent(buffer.data(), buffer.size(), patched)) {
+        return std::vector<uint8_t>(patched.begin(), patched.end());
+    }
+    return buffer;
 }
 
 bool UsdProcessor::checkMemoryLimit(size_t additionalBytes) const {
@@ -1531,87 +2246,91 @@ void UsdProcessor::normalizeUVCoordinates(std::vector<glm::vec2>& uvs) {
     }
 }
 
-bool UsdProcessor::validateMeshIndices(std::vector<uint32_t>& indices, size_t vertexCount) {
-    if (indices.empty()) {
-        return true; // Empty indices are valid
+bool UsdProcessor::optimizeMeshData(MeshData& meshData) {
+    const size_t vertexCount = meshData.points.size();
+    if (vertexCount == 0 || meshData.indices.empty()) {
+        return false;
     }
 
-    if (indices.size() % 3 != 0) {
-        MIDDLEWARE_LOG_ERROR("Index count is not a multiple of 3: %zu", indices.size());
+    // Welding and remapping move whole vertices, which is only meaningful when every
+    // attribute is indexed like the points
+    auto perVertex = [vertexCount](size_t count) { return count == 0 || count == vertexCount; };
+    if (!perVertex(meshData.normals.size()) || !perVertex(meshData.uvs.size()) ||
+        !perVertex(meshData.vertex_colors.size())) {
+        MIDDLEWARE_LOG_DEBUG("Skipping optimization of %s: attributes are not per-vertex",
+                             meshData.elementName.c_str());
         return false;
     }
 
-    // Validate all indices are within bounds
-    for (size_t i = 0; i < indices.size(); ++i) {
-        if (indices[i] >= vertexCount) {
-            MIDDLEWARE_LOG_ERROR("Index %u at position %zu exceeds vertex count %zu",
-                                indices[i], i, vertexCount);
-            return false;
-        }
+    std::vector<optimize::VertexStream> streams;
+    streams.push_back({&meshData.points[0].x, 3});
+    if (!meshData.normals.empty()) {
+        streams.push_back({&meshData.normals[0].x, 3});
+    }
+    if (!meshData.uvs.empty()) {
+        streams.push_back({&meshData.uvs[0].x, 2});
+    }
+    if (!meshData.vertex_colors.empty()) {
+        streams.push_back({&meshData.vertex_colors[0].x, 4});
     }
 
-    return true;
-}
+    std::vector<uint32_t>& indices = meshData.indices;
+    const size_t trianglesBefore = indices.size() / 3;
+    const size_t missesBefore = optimize::countCacheMisses(indices.data(), indices.size(), vertexCount);
 
-bool UsdProcessor::calculateMeshNormals(const std::vector<glm::vec3>& points,
-                                       const std::vector<uint32_t>& indices,
-                                       std::vector<glm::vec3>& outNormals) {
-    if (points.empty() || indices.empty() || indices.size() % 3 != 0) {
+    std::vector<uint32_t> remap(vertexCount);
+    size_t uniqueCount = optimize::weldVertices(streams.data(), streams.size(), vertexCount,
+                                                weldEpsilon.load(), remap.data());
+    if (uniqueCount == 0) {
         return false;
     }
-
-    try {
-        outNormals.clear();
-        outNormals.resize(points.size(), glm::vec3(0.0f));
-
-        // Calculate face normals and accumulate vertex normals
-        for (size_t i = 0; i < indices.size(); i += 3) {
-            uint32_t idx0 = indices[i];
-            uint32_t idx1 = indices[i + 1];
-            uint32_t idx2 = indices[i + 2];
-
-            // Validate indices
-            if (idx0 >= points.size() || idx1 >= points.size() || idx2 >= points.size()) {
-                continue;
-            }
-
-            const glm::vec3& v0 = points[idx0];
-            const glm::vec3& v1 = points[idx1];
-            const glm::vec3& v2 = points[idx2];
-
-            // Calculate face normal
-            glm::vec3 edge1 = v1 - v0;
-            glm::vec3 edge2 = v2 - v0;
-            glm::vec3 faceNormal = glm::cross(edge1, edge2);
-
-            // Validate face normal
-            float length = glm::length(faceNormal);
-            if (length > safety::EPSILON) {
-                faceNormal = faceNormal / length;
-
-                // Accumulate to vertex normals
-                outNormals[idx0] += faceNormal;
-                outNormals[idx1] += faceNormal;
-                outNormals[idx2] += faceNormal;
-            }
-        }
-
-        // Normalize vertex normals
-        for (auto& normal : outNormals) {
-            float length = glm::length(normal);
-            if (length > safety::EPSILON) {
-                normal = normal / length;
-            } else {
-                normal = glm::vec3(0.0f, 1.0f, 0.0f); // Default up vector
-            }
+    auto applyRemap = [&remap](auto& attribute, size_t newCount, size_t components) {
+        if (attribute.empty()) {
+            return;
+        }
+        std::remove_reference_t<decltype(attribute)> remapped(newCount);
+        optimize::remapVertexStream(&attribute[0].x, components, attribute.size(), remap.data(), &remapped[0].x);
+        attribute = std::move(remapped);
+    };
+    auto applyRemapAll = [&](size_t newCount) {
+        applyRemap(meshData.points, newCount, 3);
+        applyRemap(meshData.normals, newCount, 3);
+        applyRemap(meshData.uvs, newCount, 2);
+        applyRemap(meshData.vertex_colors, newCount, 4);
+    };
+
+    if (uniqueCount < vertexCount) {
+        optimize::remapIndices(indices.data(), indices.size(), remap.data());
+        indices.resize(optimize::removeDegenerateTriangles(indices.data(), indices.size()));
+        applyRemapAll(uniqueCount);
+        if (indices.empty()) {
+            MIDDLEWARE_LOG_WARNING("Mesh %s collapsed while welding", meshData.elementName.c_str());
+            return false;
         }
+    }
 
-        return true;
+    optimize::optimizeVertexCache(indices.data(), indices.size(), uniqueCount);
+    optimize::optimizeOverdraw(indices.data(), indices.size(), &meshData.points[0].x, uniqueCount);
 
-    } catch (const std::exception& e) {
-        MIDDLEWARE_LOG_ERROR("Exception in calculateMeshNormals: %s", e.what());
+    const size_t usedCount = optimize::optimizeVertexFetch(indices.data(), indices.size(), uniqueCount, remap.data());
+    if (usedCount == 0) {
         return false;
     }
+    applyRemapAll(usedCount);
+
+    const size_t missesAfter = optimize::countCacheMisses(indices.data(), indices.size(), usedCount);
+    stats.meshesOptimized.fetch_add(1);
+    stats.optimizedVerticesIn.fetch_add(vertexCount);
+    stats.optimizedVerticesOut.fetch_add(usedCount);
+    stats.optimizedTriangles.fetch_add(indices.size() / 3);
+    stats.cacheMissesBefore.fetch_add(missesBefore);
+    stats.cacheMissesAfter.fetch_add(missesAfter);
+
+    MIDDLEWARE_LOG_DEBUG("Optimized %s: %zu -> %zu vertices, ACMR %.3f -> %.3f",
+                         meshData.elementName.c_str(), vertexCount, usedCount,
+                         static_cast<double>(missesBefore) / trianglesBefore,
+                         static_cast<double>(missesAfter) / (indices.size() / 3));
+    return true;
 }
 
 void UsdProcessor::extractUVCoordinates(tinyusdz::GeomMesh* mesh, MeshData& meshData) {
@@ -1623,7 +2342,7 @@ void UsdProcessor::extractUVCoordinates(tinyusdz::GeomMesh* mesh, MeshData& mesh
         bool foundUVs = false;
 
         // Try different UV attribute names
-        const std::vector<std::string> uvNames = {
+        static const std::vector<std::string> uvNames = {
             "primvars:st", "st", "primvars:uv", "uv",
             "primvars:attribute0", "attribute0"
         };
@@ -1660,32 +2379,23 @@ void UsdProcessor::extractUVCoordinates(tinyusdz::GeomMesh* mesh, MeshData& mesh
 }
 
 // Helper methods for reference resolution
-bool UsdProcessor::hasEmptyGeometry(const std::vector<MeshData>& meshData) const {
-    for (const auto& mesh : meshData) {
-        if (mesh.points.empty()) {
-            return true;
-        }
-    }
-    return meshData.empty();
-}
-
 bool UsdProcessor::resolveReferences(const tinyusdz::Stage& stage,
-                                    const std::vector<uint8_t>& buffer,
+                                    const uint8_t* data,
+                                    size_t size,
                                     const std::string& fileName,
                                     std::vector<MeshData>& outMeshData,
-                                    ProgressCallback progressCallback) {
+                                    ProgressCallback progressCallback,
+                                    const std::atomic<bool>* cancelFlag,
+                                    std::pmr::memory_resource* scratch) {
     try {
         if (progressCallback) {
             progressCallback(0.0f, "Extracting reference paths");
         }
 
-        // Extract reference paths
-        std::vector<std::string> referencePaths;
+        // Extract reference paths, then clips from raw content
+        std::pmr::vector<std::pmr::string> referencePaths(scratch ? scratch : std::pmr::get_default_resource());
         ExtractReferencePaths(stage, referencePaths);
-
-        // Extract clips from raw content
-        std::vector<std::string> clipPaths = ExtractClipsFromRawContent(buffer);
-        referencePaths.insert(referencePaths.end(), clipPaths.begin(), clipPaths.end());
+        ExtractClipsFromRawContent(data, size, referencePaths);
 
         if (referencePaths.empty()) {
             MIDDLEWARE_LOG_INFO("No references or clips found to resolve");
@@ -1712,20 +2422,24 @@ bool UsdProcessor::resolveReferences(const tinyusdz::Stage& stage,
 
         // Process each reference
         size_t processedCount = 0;
+        size_t attemptedCount = 0;
         for (const auto& refPath : referencePaths) {
-            if (shutdownRequested.load()) {
+            if (isCancelled(cancelFlag)) {
                 break;
             }
 
-            std::string fullPath = baseDir + "/" + refPath;
+            std::string fullPath;
+            fullPath.reserve(baseDir.size() + 1 + refPath.size());
+            fullPath.append(baseDir).append("/").append(refPath.data(), refPath.size());
             if (std::filesystem::exists(fullPath)) {
                 if (loadReferencedFile(fullPath, outMeshData)) {
                     processedCount++;
                 }
             }
 
+            ++attemptedCount;
             if (progressCallback) {
-                float progress = static_cast<float>(processedCount) / static_cast<float>(referencePaths.size());
+                float progress = static_cast<float>(attemptedCount) / static_cast<float>(referencePaths.size());
                 progressCallback(progress * 0.8f + 0.2f, "Processing references");
             }
         }
@@ -1743,43 +2457,64 @@ bool UsdProcessor::resolveReferences(const tinyusdz::Stage& stage,
 
 bool UsdProcessor::loadReferencedFile(const std::string& filePath, std::vector<MeshData>& outMeshData) {
     try {
-        std::ifstream file(filePath, std::ios::binary);
-        if (!file.is_open()) {
-            return false;
-        }
-
-        std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)),
-                                   std::istreambuf_iterator<char>());
-
-        size_t initialMeshCount = outMeshData.size();
-
-        tinyusdz::Stage refStage;
-        std::string warnings, errors;
-        tinyusdz::USDLoadOptions options;
-        options.load_payloads = true;
-        options.load_references = true;
-        options.max_memory_limit_in_mb = static_cast<int>(memoryLimitMB.load());
-
-        bool result = tinyusdz::LoadUSDFromMemory(
-            buffer.data(), buffer.size(), filePath.c_str(),
-            &refStage, &warnings, &errors, options);
+        auto parse = [this, &filePath]() -> UsdProcessorImpl::CachedLayer {
+            std::shared_ptr<MappedFile> mapped = MappedFile::open(filePath);
+            if (!mapped) {
+                return nullptr;
+            }
+            mapped->prefetch(0, mapped->size());
+
+            tinyusdz::Stage refStage;
+            std::string warnings, errors;
+            tinyusdz::USDLoadOptions options;
+            options.load_payloads = true;
+            options.load_references = true;
+            options.max_memory_limit_in_mb = static_cast<int>(memoryLimitMB.load());
+
+            bool result = tinyusdz::LoadUSDFromMemory(
+                mapped->data(), mapped->size(), filePath.c_str(),
+                &refStage, &warnings, &errors, options);
+
+            if (!result) {
+                MIDDLEWARE_LOG_WARNING("Failed to load referenced file: %s - %s",
+                                     filePath.c_str(), errors.c_str());
+                return nullptr;
+            }
 
-        if (result) {
             glm::mat4 identity(1.0f);
+            std::vector<MeshWorkItem> workItems;
             for (const auto& rootPrim : refStage.root_prims()) {
                 ProcessPrim(const_cast<tinyusdz::Prim*>(&rootPrim),
-                           outMeshData, identity, 0);
+                           workItems, identity, 0);
             }
+            auto meshes = std::make_shared<std::vector<MeshData>>();
+            ExtractMeshWorkItems(workItems, *meshes);
+            return meshes;
+        };
 
-            size_t meshesAdded = outMeshData.size() - initialMeshCount;
-            if (meshesAdded > 0) {
-                MIDDLEWARE_LOG_INFO("Extracted %zu meshes from %s", meshesAdded, filePath.c_str());
-                stats.referencesResolved.fetch_add(1);
-                return true;
-            }
+        // Files that cannot be identified (e.g. vanished) are parsed without caching
+        UsdProcessorImpl::CachedLayer layer;
+        std::string key = layerCacheKey(filePath);
+        if (key.empty()) {
+            layer = parse();
         } else {
-            MIDDLEWARE_LOG_WARNING("Failed to load referenced file: %s - %s",
-                                 filePath.c_str(), errors.c_str());
+            bool hit = false;
+            layer = pImpl->acquireLayer(key, parse, hit);
+            (hit ? stats.layerCacheHits : stats.layerCacheMisses).fetch_add(1);
+            if (hit) {
+                MIDDLEWARE_LOG_DEBUG("Layer cache hit: %s", filePath.c_str());
+            }
+        }
+
+        if (!layer) {
+            return false;
+        }
+
+        outMeshData.insert(outMeshData.end(), layer->begin(), layer->end());
+        if (!layer->empty()) {
+            MIDDLEWARE_LOG_INFO("Extracted %zu meshes from %s", layer->size(), filePath.c_str());
+            stats.referencesResolved.fetch_add(1);
+            return true;
         }
 
         return false;
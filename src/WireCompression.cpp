@@ -0,0 +1,283 @@
+#include "WireCompression.h"
+#include "MiddlewareLogging.h"
+
+#include <cstdlib>
+#include <vector>
+
+#ifdef JUSYNC_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef JUSYNC_WITH_LZ4
+#include <lz4frame.h>
+#endif
+
+namespace anari_usd_middleware {
+namespace compression {
+
+namespace {
+
+// Block size used by StreamDecoder::decode between sink calls
+constexpr size_t SCRATCH_SIZE = 256 * 1024;
+
+} // namespace
+
+const char* codecName(Codec codec) {
+    switch (codec) {
+    case Codec::Zstd: return "zstd";
+    case Codec::Lz4: return "lz4";
+    default: return "none";
+    }
+}
+
+bool isCodecAvailable(Codec codec) {
+    switch (codec) {
+    case Codec::None: return true;
+#ifdef JUSYNC_WITH_ZSTD
+    case Codec::Zstd: return true;
+#endif
+#ifdef JUSYNC_WITH_LZ4
+    case Codec::Lz4: return true;
+#endif
+    default: return false;
+    }
+}
+
+std::string availableCodecList() {
+    std::string list;
+    for (Codec codec : {Codec::Zstd, Codec::Lz4}) {
+        if (isCodecAvailable(codec)) {
+            if (!list.empty()) {
+                list += ", ";
+            }
+            list += "\"";
+            list += codecName(codec);
+            list += "\"";
+        }
+    }
+    return list;
+}
+
+bool parseEncodingFrame(const std::string& frame, Codec& codec, uint64_t& rawSize) {
+    const size_t colon = frame.find(':');
+    if (colon == std::string::npos) {
+        return false;
+    }
+
+    const std::string name = frame.substr(0, colon);
+    if (name == "zstd") {
+        codec = Codec::Zstd;
+    } else if (name == "lz4") {
+        codec = Codec::Lz4;
+    } else if (name == "none") {
+        codec = Codec::None;
+    } else {
+        return false;
+    }
+
+    const std::string size = frame.substr(colon + 1);
+    if (size.empty() || size.size() > 19 || size.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    rawSize = std::strtoull(size.c_str(), nullptr, 10);
+    return rawSize > 0;
+}
+
+struct StreamDecoder::State {
+    Codec codec = Codec::None;
+    bool finished = false;
+    std::vector<uint8_t> scratch;
+#ifdef JUSYNC_WITH_ZSTD
+    ZSTD_DStream* zstd = nullptr;
+#endif
+#ifdef JUSYNC_WITH_LZ4
+    LZ4F_dctx* lz4 = nullptr;
+#endif
+
+    ~State() {
+#ifdef JUSYNC_WITH_ZSTD
+        if (zstd) {
+            ZSTD_freeDStream(zstd);
+        }
+#endif
+#ifdef JUSYNC_WITH_LZ4
+        if (lz4) {
+            LZ4F_freeDecompressionContext(lz4);
+        }
+#endif
+    }
+
+    /**
+     * One codec call: consumes part of the input and produces part of the output
+     * @return False on a codec error
+     */
+    bool step(const uint8_t*& in, size_t& inSize, uint8_t* out, size_t outCapacity, size_t& produced) {
+        produced = 0;
+#ifdef JUSYNC_WITH_ZSTD
+        if (codec == Codec::Zstd) {
+            ZSTD_inBuffer input{in, inSize, 0};
+            ZSTD_outBuffer output{out, outCapacity, 0};
+            size_t ret = ZSTD_decompressStream(zstd, &output, &input);
+            if (ZSTD_isError(ret)) {
+                MIDDLEWARE_LOG_ERROR("zstd decompression failed: %s", ZSTD_getErrorName(ret));
+                return false;
+            }
+            in += input.pos;
+            inSize -= input.pos;
+            produced = output.pos;
+            // A new frame may follow, so only the latest call decides
+            finished = (ret == 0);
+            return true;
+        }
+#endif
+#ifdef JUSYNC_WITH_LZ4
+        if (codec == Codec::Lz4) {
+            size_t dstSize = outCapacity;
+            size_t srcSize = inSize;
+            size_t hint = LZ4F_decompress(lz4, out, &dstSize, in, &srcSize, nullptr);
+            if (LZ4F_isError(hint)) {
+                MIDDLEWARE_LOG_ERROR("LZ4 decompression failed: %s", LZ4F_getErrorName(hint));
+                return false;
+            }
+            in += srcSize;
+            inSize -= srcSize;
+            produced = dstSize;
+            finished = (hint == 0);
+            return true;
+        }
+#endif
+#if !defined(JUSYNC_WITH_ZSTD) && !defined(JUSYNC_WITH_LZ4)
+        (void)in;
+        (void)inSize;
+        (void)out;
+        (void)outCapacity;
+#endif
+        MIDDLEWARE_LOG_ERROR("Decoder used without an active codec");
+        return false;
+    }
+};
+
+StreamDecoder::StreamDecoder() : state(std::make_unique<State>()) {}
+StreamDecoder::~StreamDecoder() = default;
+StreamDecoder::StreamDecoder(StreamDecoder&&) noexcept = default;
+StreamDecoder& StreamDecoder::operator=(StreamDecoder&&) noexcept = default;
+
+bool StreamDecoder::reset(Codec codec) {
+    if (!state) {
+        state = std::make_unique<State>();
+    }
+    state->codec = Codec::None;
+    state->finished = false;
+
+    if (!isCodecAvailable(codec) || codec == Codec::None) {
+        MIDDLEWARE_LOG_ERROR("Compression codec not available in this build: %s", codecName(codec));
+        return false;
+    }
+
+#ifdef JUSYNC_WITH_ZSTD
+    if (codec == Codec::Zstd) {
+        if (!state->zstd) {
+            state->zstd = ZSTD_createDStream();
+        }
+        if (!state->zstd || ZSTD_isError(ZSTD_initDStream(state->zstd))) {
+            MIDDLEWARE_LOG_ERROR("Failed to initialize zstd decoder");
+            return false;
+        }
+    }
+#endif
+#ifdef JUSYNC_WITH_LZ4
+    if (codec == Codec::Lz4) {
+        // Recreated rather than reset so older liblz4 releases work as well
+        if (state->lz4) {
+            LZ4F_freeDecompressionContext(state->lz4);
+            state->lz4 = nullptr;
+        }
+        if (LZ4F_isError(LZ4F_createDecompressionContext(&state->lz4, LZ4F_VERSION))) {
+            state->lz4 = nullptr;
+            MIDDLEWARE_LOG_ERROR("Failed to initialize LZ4 decoder");
+            return false;
+        }
+    }
+#endif
+
+    state->codec = codec;
+    return true;
+}
+
+bool StreamDecoder::decodeInto(const uint8_t* in, size_t inSize, uint8_t* out, size_t outCapacity,
+                               size_t& produced) {
+    produced = 0;
+    if (!state || state->codec == Codec::None) {
+        MIDDLEWARE_LOG_ERROR("Decoder used without an active codec");
+        return false;
+    }
+
+    while (inSize > 0) {
+        const size_t before = inSize;
+        size_t written = 0;
+        if (!state->step(in, inSize, out + produced, outCapacity - produced, written)) {
+            return false;
+        }
+        produced += written;
+        if (written == 0 && inSize == before) {
+            MIDDLEWARE_LOG_ERROR("Decompressed data exceeds the expected size");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StreamDecoder::decode(const uint8_t* in, size_t inSize, const Sink& sink) {
+    if (!state || state->codec == Codec::None) {
+        MIDDLEWARE_LOG_ERROR("Decoder used without an active codec");
+        return false;
+    }
+    if (state->scratch.size() != SCRATCH_SIZE) {
+        state->scratch.resize(SCRATCH_SIZE);
+    }
+
+    // A full scratch block means the codec may still hold buffered output
+    size_t written = 0;
+    do {
+        const size_t before = inSize;
+        if (!state->step(in, inSize, state->scratch.data(), state->scratch.size(), written)) {
+            return false;
+        }
+        if (written > 0 && !sink(state->scratch.data(), written)) {
+            return false;
+        }
+        if (written == 0 && inSize == before) {
+            break;
+        }
+    } while (inSize > 0 || written == state->scratch.size());
+
+    if (inSize > 0) {
+        MIDDLEWARE_LOG_ERROR("Decoder stopped with %zu bytes of input left", inSize);
+        return false;
+    }
+    return true;
+}
+
+bool StreamDecoder::finished() const {
+    return state && state->finished;
+}
+
+bool decompress(Codec codec, const uint8_t* in, size_t inSize, uint8_t* out, size_t outSize) {
+    StreamDecoder decoder;
+    if (!decoder.reset(codec)) {
+        return false;
+    }
+
+    size_t produced = 0;
+    if (!decoder.decodeInto(in, inSize, out, outSize, produced)) {
+        return false;
+    }
+    if (produced != outSize || !decoder.finished()) {
+        MIDDLEWARE_LOG_ERROR("Decompressed size mismatch: got %zu bytes, expected %zu%s",
+                             produced, outSize, decoder.finished() ? "" : " (stream incomplete)");
+        return false;
+    }
+    return true;
+}
+
+} // namespace compression
+} // namespace anari_usd_middleware
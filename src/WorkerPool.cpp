@@ -0,0 +1,148 @@
+#include "WorkerPool.h"
+#include "MiddlewareLogging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+
+namespace anari_usd_middleware {
+
+// State of one parallelFor() call. Queued helpers hold it by shared_ptr, so a helper
+// that is popped after the call returned only finds it closed and leaves.
+struct WorkerPool::Job {
+    const std::function<void(size_t)>* body = nullptr;
+    size_t count = 0;
+    std::atomic<size_t> next{0};
+
+    std::mutex mutex;
+    std::condition_variable idle;
+    size_t running = 0;     // Helpers inside runIndices()
+    bool closed = false;    // Set by the caller; no helper may join afterwards
+    std::exception_ptr error;
+
+    void runIndices() {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            try {
+                (*body)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next.store(count);
+            }
+        }
+    }
+};
+
+WorkerPool::WorkerPool(size_t threadCount) {
+    threadCount = std::min(std::max<size_t>(threadCount, 1), MAX_THREADS);
+    try {
+        threads.reserve(threadCount);
+        for (size_t t = 0; t < threadCount; ++t) {
+            threads.emplace_back(&WorkerPool::workerLoop, this);
+        }
+    } catch (const std::system_error& e) {
+        // Callers still do all the work themselves, just with less help
+        MIDDLEWARE_LOG_WARNING("Worker pool started only %zu of %zu threads: %s", threads.size(), threadCount,
+                               e.what());
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+WorkerPool& WorkerPool::shared() {
+    static WorkerPool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+void WorkerPool::workerLoop() {
+    std::shared_ptr<Job> job;
+    while (true) {
+        if (queue.tryPop(job)) {
+            help(*job);
+            job.reset();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (stopping) {
+            break;
+        }
+        available.wait(lock, [this] { return stopping || !queue.emptyApprox(); });
+    }
+}
+
+void WorkerPool::help(Job& job) {
+    {
+        std::lock_guard<std::mutex> lock(job.mutex);
+        if (job.closed) {
+            return;
+        }
+        ++job.running;
+    }
+    job.runIndices();
+    {
+        std::lock_guard<std::mutex> lock(job.mutex);
+        --job.running;
+    }
+    job.idle.notify_all();
+}
+
+void WorkerPool::parallelFor(size_t count, size_t maxParallelism, const std::function<void(size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    const size_t helpers = std::min({std::max<size_t>(maxParallelism, 1), count, threads.size() + 1}) - 1;
+    if (helpers == 0) {
+        for (size_t i = 0; i < count; ++i) {
+            body(i);
+        }
+        return;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->body = &body;
+    job->count = count;
+
+    // A full queue means the pool is saturated; the indices not taken are run below
+    size_t queued = 0;
+    for (; queued < helpers; ++queued) {
+        std::shared_ptr<Job> helper = job;
+        if (!queue.tryPush(std::move(helper))) {
+            break;
+        }
+    }
+    if (queued > 0) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        if (queued == 1) {
+            available.notify_one();
+        } else {
+            available.notify_all();
+        }
+    }
+
+    job->runIndices();
+
+    // body lives on this stack frame: no helper may still be using it when we return
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->closed = true;
+    job->idle.wait(lock, [&job] { return job->running == 0; });
+    if (job->error) {
+        std::rethrow_exception(job->error);
+    }
+}
+
+} // namespace anari_usd_middleware
@@ -1,7 +1,15 @@
 #include "ZmqConnector.h"
 #include "MiddlewareLogging.h"
+#include "HashVerifier.h"
+#include "MappedFile.h"
+#include "WireCompression.h"
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
 #include <regex>
+#include <sstream>
 #include <filesystem>
 #include <thread>
 
@@ -11,6 +19,10 @@ ZmqConnector::ZmqConnector() {
     MIDDLEWARE_LOG_INFO("ZmqConnector created with enhanced safety features");
     messageStats.reset();
     lastHealthCheck = std::chrono::steady_clock::now();
+
+    std::error_code ec;
+    auto tempDir = std::filesystem::temp_directory_path(ec);
+    chunkSpoolDirectory = ((ec ? std::filesystem::path(".") : tempDir) / "jusync-spool").string();
 }
 
 ZmqConnector::~ZmqConnector() {
@@ -18,7 +30,71 @@ ZmqConnector::~ZmqConnector() {
     disconnect(500); // Quick shutdown in destructor
 }
 
+namespace {
+
+// Split "tcp://*:5556, ipc:///tmp/jusync" into its endpoints
+std::vector<std::string> splitEndpoints(const std::string& list) {
+    std::vector<std::string> endpoints;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        const size_t first = item.find_first_not_of(" \t");
+        if (first != std::string::npos) {
+            endpoints.push_back(item.substr(first, item.find_last_not_of(" \t") - first + 1));
+        }
+    }
+    return endpoints;
+}
+
+// Readable form of a routing identity; ZeroMQ-generated identities are binary
+std::string describeIdentity(const zmq::message_t& identity) {
+    const auto* bytes = static_cast<const unsigned char*>(identity.data());
+    const bool printable = std::all_of(bytes, bytes + identity.size(), [](unsigned char c) {
+        return std::isprint(c) != 0;
+    });
+    if (printable) {
+        return std::string(reinterpret_cast<const char*>(bytes), identity.size());
+    }
+
+    static const char digits[] = "0123456789abcdef";
+    std::string hex = "0x";
+    for (size_t i = 0; i < identity.size(); ++i) {
+        hex += digits[bytes[i] >> 4];
+        hex += digits[bytes[i] & 0x0f];
+    }
+    return hex;
+}
+
+// Average rate over at least one second, so a single fresh message does not read as a spike
+double averageRate(uint64_t bytes, std::chrono::steady_clock::time_point since,
+                   std::chrono::steady_clock::time_point now) {
+    const double seconds = std::max(std::chrono::duration<double>(now - since).count(), 1.0);
+    return static_cast<double>(bytes) / seconds;
+}
+
+} // namespace
+
+struct ZmqConnector::BoundSocket {
+    std::string endpoint;
+    std::unique_ptr<zmq::socket_t> socket;
+    std::atomic<uint64_t> messages{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<int64_t> lastMessageTicks{0}; // steady_clock ticks, 0 before the first message
+};
+
+struct ZmqConnector::ClientTraffic {
+    std::string endpoint;
+    uint64_t messages = 0;
+    uint64_t bytes = 0;
+    std::chrono::steady_clock::time_point firstMessageTime;
+    std::chrono::steady_clock::time_point lastMessageTime;
+};
+
 bool ZmqConnector::initialize(const char* endpoint, int timeoutMs) {
+    return initialize(splitEndpoints(endpoint ? endpoint : "tcp://*:5556"), timeoutMs);
+}
+
+bool ZmqConnector::initialize(const std::vector<std::string>& endpoints, int timeoutMs) {
     std::lock_guard<std::mutex> lock(connectionMutex);
 
     if (connectionStatus.load() == ConnectionStatus::Connected) {
@@ -37,8 +113,22 @@ bool ZmqConnector::initialize(const char* endpoint, int timeoutMs) {
             return false;
         }
 
+        if (endpoints.empty() || endpoints.size() > MAX_ENDPOINTS) {
+            MIDDLEWARE_LOG_ERROR("Invalid endpoint count: %zu (must be 1-%zu)", endpoints.size(), MAX_ENDPOINTS);
+            connectionStatus.store(ConnectionStatus::Error);
+            return false;
+        }
+        for (size_t i = 0; i < endpoints.size(); ++i) {
+            if (std::find(endpoints.begin(), endpoints.begin() + i, endpoints[i]) != endpoints.begin() + i) {
+                MIDDLEWARE_LOG_ERROR("Endpoint listed twice: %s", endpoints[i].c_str());
+                connectionStatus.store(ConnectionStatus::Error);
+                return false;
+            }
+        }
+
         // Initialize ZMQ context with enhanced settings
-        zmqContext = std::make_unique<zmq::context_t>(1); // 1 I/O thread
+        const int threads = ioThreads.load();
+        zmqContext = std::make_unique<zmq::context_t>(threads);
         if (!zmqContext) {
             MIDDLEWARE_LOG_ERROR("Failed to create ZMQ context");
             connectionStatus.store(ConnectionStatus::Error);
@@ -47,64 +137,50 @@ bool ZmqConnector::initialize(const char* endpoint, int timeoutMs) {
 
         // Set context options for better performance and safety
         zmqContext->set(zmq::ctxopt::max_sockets, 1024);
-        zmqContext->set(zmq::ctxopt::io_threads, 1);
+        zmqContext->set(zmq::ctxopt::io_threads, threads);
 
-        // Create ROUTER socket with enhanced configuration
-        zmqSocket = std::make_unique<zmq::socket_t>(*zmqContext, zmq::socket_type::router);
-        if (!zmqSocket) {
-            MIDDLEWARE_LOG_ERROR("Failed to create ZMQ ROUTER socket");
-            cleanup();
-            connectionStatus.store(ConnectionStatus::Error);
-            return false;
+        // One ROUTER socket per endpoint, so traffic can be attributed and served fairly
+        for (const auto& endpoint : endpoints) {
+            bindEndpoint(endpoint, timeoutMs);
         }
-
-        // Set comprehensive socket options for safety and performance
-        zmqSocket->set(zmq::sockopt::linger, 0);                    // No lingering on close
-        zmqSocket->set(zmq::sockopt::sndhwm, 1000);                 // Send high water mark
-        zmqSocket->set(zmq::sockopt::rcvhwm, 1000);                 // Receive high water mark
-        zmqSocket->set(zmq::sockopt::sndtimeo, timeoutMs);          // Send timeout
-        zmqSocket->set(zmq::sockopt::rcvtimeo, timeoutMs);          // Receive timeout
-        zmqSocket->set(zmq::sockopt::maxmsgsize, static_cast<int64_t>(maxMessageSize.load())); // Max message size
-        zmqSocket->set(zmq::sockopt::router_mandatory, 1);          // Mandatory routing
-
-        // Determine endpoint
-        currentEndpoint = endpoint ? endpoint : "tcp://*:5556";
-
-        // Validate endpoint format
-        std::regex endpointPattern(R"(^(tcp|ipc|inproc)://[^:]+:\d+$|^(ipc|inproc)://[^:]+$)");
-        if (!std::regex_match(currentEndpoint, endpointPattern)) {
-            MIDDLEWARE_LOG_ERROR("Invalid endpoint format: %s", currentEndpoint.c_str());
+        if (boundSockets.empty()) {
+            MIDDLEWARE_LOG_ERROR("All binding attempts failed");
             cleanup();
             connectionStatus.store(ConnectionStatus::Error);
             return false;
         }
+        activeSocket = boundSockets.front()->socket.get();
+        activeSocketIndex = 0;
+        nextSocketIndex = 0;
 
-        // Try binding to the primary endpoint
-        try {
-            zmqSocket->bind(currentEndpoint);
-            MIDDLEWARE_LOG_INFO("ZMQ Router bound successfully to %s", currentEndpoint.c_str());
-
-        } catch (const zmq::error_t& e) {
-            MIDDLEWARE_LOG_WARNING("Failed to bind to primary endpoint %s: %s (errno: %d)",
-                                 currentEndpoint.c_str(), e.what(), e.num());
+        // Wakeup pair lets stopReceiving() interrupt a blocking poll immediately
+        if (!createWakeupPair()) {
+            MIDDLEWARE_LOG_WARNING("Wakeup socket unavailable, receiver will rely on poll timeouts");
+        }
 
-            // Try alternative endpoints
-            if (!tryAlternativeEndpoints(currentEndpoint)) {
-                MIDDLEWARE_LOG_ERROR("All binding attempts failed");
-                cleanup();
-                connectionStatus.store(ConnectionStatus::Error);
-                return false;
-            }
+        // Sockets first, wakeup last; rebuilt only here, so the receiver can reuse it per poll
+        pollItems.clear();
+        for (const auto& bound : boundSockets) {
+            pollItems.push_back({ bound->socket->handle(), 0, ZMQ_POLLIN, 0 });
+        }
+        if (wakeupReceiver) {
+            pollItems.push_back({ wakeupReceiver->handle(), 0, ZMQ_POLLIN, 0 });
         }
 
         // Reset statistics
         messageStats.reset();
+        {
+            std::lock_guard<std::mutex> clientLock(clientMutex);
+            clientTraffic.clear();
+            statsSince = std::chrono::steady_clock::now();
+        }
 
         // Mark as connected
         connectionStatus.store(ConnectionStatus::Connected);
         shutdownRequested.store(false);
 
-        MIDDLEWARE_LOG_INFO("ZmqConnector initialized successfully on %s", currentEndpoint.c_str());
+        MIDDLEWARE_LOG_INFO("ZmqConnector initialized successfully on %zu of %zu endpoint(s), %d I/O thread(s)",
+                            boundSockets.size(), endpoints.size(), threads);
         return true;
 
     } catch (const zmq::error_t& e) {
@@ -121,12 +197,57 @@ bool ZmqConnector::initialize(const char* endpoint, int timeoutMs) {
     }
 }
 
-bool ZmqConnector::receiveFile(std::string& filename, std::vector<uint8_t>& data,
+bool ZmqConnector::bindEndpoint(const std::string& endpoint, int timeoutMs) {
+    // Validate endpoint format
+    static const std::regex endpointPattern(R"(^(tcp|ipc|inproc)://[^:]+:\d+$|^(ipc|inproc)://[^:]+$)");
+    if (!std::regex_match(endpoint, endpointPattern)) {
+        MIDDLEWARE_LOG_ERROR("Invalid endpoint format: %s", endpoint.c_str());
+        return false;
+    }
+
+    // Create ROUTER socket with enhanced configuration
+    auto socket = std::make_unique<zmq::socket_t>(*zmqContext, zmq::socket_type::router);
+    const int hwm = highWaterMark.load();
+
+    // Set comprehensive socket options for safety and performance
+    socket->set(zmq::sockopt::linger, 0);                    // No lingering on close
+    socket->set(zmq::sockopt::sndhwm, hwm);                  // Send high water mark
+    socket->set(zmq::sockopt::rcvhwm, hwm);                  // Receive high water mark
+    socket->set(zmq::sockopt::sndtimeo, timeoutMs);          // Send timeout
+    socket->set(zmq::sockopt::rcvtimeo, timeoutMs);          // Receive timeout
+    socket->set(zmq::sockopt::maxmsgsize, static_cast<int64_t>(maxMessageSize.load())); // Max message size
+    socket->set(zmq::sockopt::router_mandatory, 1);          // Mandatory routing
+
+    std::string bound = endpoint;
+    try {
+        socket->bind(endpoint);
+        MIDDLEWARE_LOG_INFO("ZMQ Router bound successfully to %s", endpoint.c_str());
+
+    } catch (const zmq::error_t& e) {
+        MIDDLEWARE_LOG_WARNING("Failed to bind to endpoint %s: %s (errno: %d)",
+                               endpoint.c_str(), e.what(), e.num());
+
+        // Only tcp endpoints have a port to vary
+        bound = endpoint.rfind("tcp://", 0) == 0 ? tryAlternativeEndpoints(*socket, endpoint) : std::string();
+        if (bound.empty()) {
+            MIDDLEWARE_LOG_ERROR("Skipping endpoint %s, binding failed", endpoint.c_str());
+            return false;
+        }
+    }
+
+    auto entry = std::make_unique<BoundSocket>();
+    entry->endpoint = bound;
+    entry->socket = std::move(socket);
+    boundSockets.push_back(std::move(entry));
+    return true;
+}
+
+bool ZmqConnector::receiveFile(std::string& filename, FilePayload& data,
                                std::string& hash, int timeoutMs) {
     MIDDLEWARE_LOG_DEBUG("=== ZMQ RECEIVE FILE CALLED ===");
     MIDDLEWARE_LOG_DEBUG("Timeout: %d ms", timeoutMs);
 
-    if (connectionStatus.load() != ConnectionStatus::Connected || !zmqSocket) {
+    if (connectionStatus.load() != ConnectionStatus::Connected || !activeSocket) {
         MIDDLEWARE_LOG_ERROR("ZmqConnector not connected or socket invalid");
         return false;
     }
@@ -134,8 +255,7 @@ bool ZmqConnector::receiveFile(std::string& filename, std::vector<uint8_t>& data
     try {
         // Only poll if timeout > 0 (not already polled by caller)
         if (timeoutMs > 0) {
-            zmq::pollitem_t items[] = {{ zmqSocket->handle(), 0, ZMQ_POLLIN, 0 }};
-            int pollResult = zmq::poll(items, 1, std::chrono::milliseconds(timeoutMs));
+            int pollResult = pollSockets(timeoutMs);
 
             if (pollResult <= 0) {
                 return false; // Timeout or error
@@ -148,8 +268,7 @@ bool ZmqConnector::receiveFile(std::string& filename, std::vector<uint8_t>& data
 
         // Part 1: Receive client identity (automatic from ROUTER)
         zmq::message_t identityMsg;
-        auto identityRes = zmqSocket->recv(identityMsg, zmq::recv_flags::none);
-        if (!identityRes || identityRes.value() == 0) {
+        if (!receiveIdentity(identityMsg) || identityMsg.size() == 0) {
             return false;
         }
 
@@ -162,7 +281,7 @@ bool ZmqConnector::receiveFile(std::string& filename, std::vector<uint8_t>& data
 
         // Part 2: Receive filename
         zmq::message_t filenameMsg;
-        auto fileRes = zmqSocket->recv(filenameMsg, zmq::recv_flags::none);
+        auto fileRes = activeSocket->recv(filenameMsg, zmq::recv_flags::none);
         if (!fileRes || fileRes.value() == 0) {
             MIDDLEWARE_LOG_ERROR("Failed to receive filename");
             sendReply(clientIdentity, "ERROR: Missing filename");
@@ -181,21 +300,22 @@ bool ZmqConnector::receiveFile(std::string& filename, std::vector<uint8_t>& data
 
         // Part 3: Receive content
         zmq::message_t contentMsg;
-        auto contentRes = zmqSocket->recv(contentMsg, zmq::recv_flags::none);
+        auto contentRes = activeSocket->recv(contentMsg, zmq::recv_flags::none);
         if (!contentRes || contentRes.value() == 0) {
             MIDDLEWARE_LOG_ERROR("Failed to receive content");
             sendReply(clientIdentity, "ERROR: Missing content");
             return false;
         }
 
-        // Copy data efficiently (from your original)
-        const uint8_t* dataPtr = static_cast<const uint8_t*>(contentMsg.data());
-        data.assign(dataPtr, dataPtr + contentMsg.size());
+        // Keep the frame itself alive as the payload instead of copying it out
+        auto contentFrame = std::make_shared<zmq::message_t>(std::move(contentMsg));
+        data = FilePayload(contentFrame, static_cast<const uint8_t*>(contentFrame->data()),
+                           contentFrame->size());
         MIDDLEWARE_LOG_INFO("📦 Content: %zu bytes", data.size());
 
         // Part 4: Receive hash (final part)
         zmq::message_t hashMsg;
-        auto hashRes = zmqSocket->recv(hashMsg, zmq::recv_flags::none);
+        auto hashRes = activeSocket->recv(hashMsg, zmq::recv_flags::none);
         if (!hashRes || hashRes.value() == 0) {
             MIDDLEWARE_LOG_ERROR("Failed to receive hash");
             sendReply(clientIdentity, "ERROR: Missing hash");
@@ -326,7 +446,7 @@ bool ZmqConnector::validateHashFormatPermissive(const std::string& hash) const {
 
 bool ZmqConnector::receiveAnyMessage(int timeoutMs) {
     // Validate connection state
-    if (connectionStatus.load() != ConnectionStatus::Connected || !zmqSocket) {
+    if (connectionStatus.load() != ConnectionStatus::Connected || !activeSocket) {
         MIDDLEWARE_LOG_ERROR("ZmqConnector not connected for message receive");
         messageStats.failedReceives.fetch_add(1);
         return false;
@@ -339,14 +459,13 @@ bool ZmqConnector::receiveAnyMessage(int timeoutMs) {
 
     try {
         // Check for available messages
-        zmq::pollitem_t items[] = {{ zmqSocket->handle(), 0, ZMQ_POLLIN, 0 }};
-        int pollResult = zmq::poll(items, 1, std::chrono::milliseconds(timeoutMs));
+        int pollResult = pollSockets(timeoutMs);
 
         if (pollResult == 0) {
             return false; // Timeout
         }
 
-        if (pollResult < 0 || !(items[0].revents & ZMQ_POLLIN)) {
+        if (pollResult < 0) {
             MIDDLEWARE_LOG_ERROR("Poll error in receiveAnyMessage");
             messageStats.failedReceives.fetch_add(1);
             return false;
@@ -354,7 +473,7 @@ bool ZmqConnector::receiveAnyMessage(int timeoutMs) {
 
         // Receive identity
         zmq::message_t identityMsg;
-        if (!receiveMessagePart(identityMsg, timeoutMs, true)) {
+        if (!receiveIdentity(identityMsg) || !activeSocket->get(zmq::sockopt::rcvmore)) {
             MIDDLEWARE_LOG_ERROR("Failed to receive identity in receiveAnyMessage");
             messageStats.failedReceives.fetch_add(1);
             return false;
@@ -391,7 +510,7 @@ bool ZmqConnector::receiveAnyMessage(int timeoutMs) {
         }
 
         // Check for multi-part file message (should be handled by receiveFile)
-        if (zmqSocket->get(zmq::sockopt::rcvmore)) {
+        if (activeSocket->get(zmq::sockopt::rcvmore)) {
             MIDDLEWARE_LOG_DEBUG("Multi-part message detected, likely file transfer");
             drainRemainingParts();
             sendReply(clientIdentity, "RETRY_AS_FILE");
@@ -447,6 +566,664 @@ bool ZmqConnector::receiveAnyMessage(int timeoutMs) {
     }
 }
 
+ZmqConnector::ReceiveResult ZmqConnector::receiveNext(IncomingMessage& out) {
+    if (connectionStatus.load() != ConnectionStatus::Connected || !activeSocket) {
+        MIDDLEWARE_LOG_ERROR("ZmqConnector not connected for receive");
+        return ReceiveResult::Nothing;
+    }
+
+    if (shutdownRequested.load()) {
+        return ReceiveResult::Nothing;
+    }
+
+    try {
+        zmq::message_t identityMsg;
+        if (!receiveIdentity(identityMsg)) {
+            return ReceiveResult::Nothing; // Nothing queued
+        }
+
+        if (identityMsg.size() == 0 || identityMsg.size() > 256 || !activeSocket->get(zmq::sockopt::rcvmore)) {
+            MIDDLEWARE_LOG_ERROR("Invalid identity frame (%zu bytes)", identityMsg.size());
+            drainRemainingParts();
+            messageStats.failedReceives.fetch_add(1);
+            return ReceiveResult::Nothing;
+        }
+
+        // The rest of a multipart message is delivered atomically, so these reads never wait
+        std::vector<zmq::message_t> parts;
+        parts.reserve(MAX_MESSAGE_PARTS);
+        size_t messageBytes = 0;
+        while (activeSocket->get(zmq::sockopt::rcvmore)) {
+            if (parts.size() == MAX_MESSAGE_PARTS) {
+                MIDDLEWARE_LOG_ERROR("Message has more than %zu parts, discarding", MAX_MESSAGE_PARTS);
+                drainRemainingParts();
+                sendReply(identityMsg, "ERROR: Too many message parts");
+                messageStats.failedReceives.fetch_add(1);
+                return ReceiveResult::Nothing;
+            }
+            parts.emplace_back();
+            if (!activeSocket->recv(parts.back(), zmq::recv_flags::none)) {
+                MIDDLEWARE_LOG_ERROR("Failed to receive message part %zu", parts.size());
+                messageStats.failedReceives.fetch_add(1);
+                return ReceiveResult::Nothing;
+            }
+            messageBytes += parts.back().size();
+        }
+        recordTraffic(identityMsg, messageBytes);
+
+        const std::string tag = parts[0].size() <= 32 ? parts[0].to_string() : std::string();
+        if (tag == CHUNK_BEGIN_TAG || tag == CHUNK_DATA_TAG || tag == CHUNK_END_TAG || tag == CHUNK_ABORT_TAG) {
+            return handleChunkedMessage(identityMsg, parts, out);
+        }
+
+        if (parts.size() == 1 && tag == CAPABILITIES_TAG) {
+            if (!sendReply(identityMsg, "{\"status\": \"ok\", \"codecs\": [" +
+                                        compression::availableCodecList() + "]}")) {
+                MIDDLEWARE_LOG_WARNING("Failed to send capabilities reply");
+            }
+            return ReceiveResult::TransferProgress;
+        }
+
+        if (parts.size() == 1) {
+            std::string messageContent = parts[0].to_string();
+            if (messageContent.empty() || messageContent.size() > safety::MAX_STRING_SIZE) {
+                MIDDLEWARE_LOG_ERROR("Invalid message content size: %zu", messageContent.size());
+                sendReply(identityMsg, "ERROR: Invalid message");
+                messageStats.failedReceives.fetch_add(1);
+                return ReceiveResult::Nothing;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(messageMutex);
+                lastReceivedMessage = messageContent;
+            }
+
+            if (!sendReply(identityMsg, "{\"status\": \"ok\", \"message\": \"Message received\"}")) {
+                MIDDLEWARE_LOG_WARNING("Failed to send message reply");
+            }
+
+            messageStats.totalMessagesReceived.fetch_add(1);
+            messageStats.lastMessageTime = std::chrono::steady_clock::now();
+            out.text = std::move(messageContent);
+            return ReceiveResult::Message;
+        }
+
+        if (parts.size() == 3 || parts.size() == 4) {
+            std::string filename = parts[0].to_string();
+            if (filename.empty() || filename.size() > 255) {
+                MIDDLEWARE_LOG_ERROR("Invalid filename: %s", filename.c_str());
+                sendReply(identityMsg, "ERROR: Invalid filename");
+                messageStats.failedReceives.fetch_add(1);
+                return ReceiveResult::Nothing;
+            }
+            if (parts[1].size() == 0) {
+                MIDDLEWARE_LOG_ERROR("Missing content for file: %s", filename.c_str());
+                sendReply(identityMsg, "ERROR: Missing content");
+                messageStats.failedReceives.fetch_add(1);
+                return ReceiveResult::Nothing;
+            }
+            if (parts[2].size() == 0) {
+                MIDDLEWARE_LOG_ERROR("Missing hash for file: %s", filename.c_str());
+                sendReply(identityMsg, "ERROR: Missing hash");
+                messageStats.failedReceives.fetch_add(1);
+                return ReceiveResult::Nothing;
+            }
+
+            compression::Codec codec = compression::Codec::None;
+            uint64_t rawSize = 0;
+            if (parts.size() == 4) {
+                const std::string encoding = parts[3].size() <= 64 ? parts[3].to_string() : std::string();
+                if (!compression::parseEncodingFrame(encoding, codec, rawSize) ||
+                    rawSize > getMaxMessageSize()) {
+                    MIDDLEWARE_LOG_ERROR("Invalid encoding frame for file: %s", filename.c_str());
+                    sendReply(identityMsg, "ERROR: Invalid encoding");
+                    messageStats.failedReceives.fetch_add(1);
+                    return ReceiveResult::Nothing;
+                }
+                if (!compression::isCodecAvailable(codec)) {
+                    MIDDLEWARE_LOG_ERROR("Unsupported codec %s for file: %s",
+                                         compression::codecName(codec), filename.c_str());
+                    sendReply(identityMsg, std::string("ERROR: Unsupported codec ") + compression::codecName(codec));
+                    messageStats.failedReceives.fetch_add(1);
+                    return ReceiveResult::Nothing;
+                }
+            }
+
+            // Keep the frame itself alive as the payload instead of copying it out
+            auto contentFrame = std::make_shared<zmq::message_t>(std::move(parts[1]));
+            out.filename = std::move(filename);
+            out.data = FilePayload(contentFrame, static_cast<const uint8_t*>(contentFrame->data()),
+                                   contentFrame->size());
+            out.hash = parts[2].to_string();
+            out.hashVerified = false;
+            // Decoding is left to the caller's worker so the receive loop keeps draining the socket
+            out.codec = codec;
+            out.rawSize = rawSize;
+
+            if (!sendReply(identityMsg, "RECEIVED")) {
+                MIDDLEWARE_LOG_WARNING("Failed to send reply after file reception");
+            }
+
+            messageStats.totalFilesReceived.fetch_add(1);
+            messageStats.totalBytesReceived.fetch_add(out.data.size());
+            if (codec != compression::Codec::None) {
+                messageStats.compressedFilesReceived.fetch_add(1);
+                messageStats.compressedBytesReceived.fetch_add(out.data.size());
+            }
+            messageStats.lastMessageTime = std::chrono::steady_clock::now();
+            if (codec != compression::Codec::None) {
+                MIDDLEWARE_LOG_INFO("Received file: %s (%zu bytes, %s, %llu bytes decoded)", out.filename.c_str(),
+                                    out.data.size(), compression::codecName(codec),
+                                    static_cast<unsigned long long>(rawSize));
+            } else {
+                MIDDLEWARE_LOG_INFO("Received file: %s (%zu bytes)", out.filename.c_str(), out.data.size());
+            }
+            return ReceiveResult::File;
+        }
+
+        MIDDLEWARE_LOG_ERROR("Unrecognized message layout (%zu parts)", parts.size());
+        sendReply(identityMsg, "ERROR: Unrecognized message format");
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+
+    } catch (const zmq::error_t& e) {
+        if (e.num() == ETERM || e.num() == ENOTSOCK) {
+            MIDDLEWARE_LOG_INFO("ZMQ context terminated during receive");
+            connectionStatus.store(ConnectionStatus::Disconnected);
+        } else if (e.num() != EINTR && e.num() != EAGAIN) {
+            MIDDLEWARE_LOG_ERROR("ZeroMQ error in receiveNext: %s (errno: %d)", e.what(), e.num());
+        }
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+
+    } catch (const std::exception& e) {
+        MIDDLEWARE_LOG_ERROR("Exception in receiveNext: %s", e.what());
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+}
+
+bool ZmqConnector::decompressPayload(compression::Codec codec, uint64_t rawSize, FilePayload& data) {
+    if (codec == compression::Codec::None) {
+        return true;
+    }
+    if (rawSize == 0 || rawSize > getMaxMessageSize() || data.empty()) {
+        MIDDLEWARE_LOG_ERROR("Invalid compressed payload (%zu bytes, %llu announced)", data.size(),
+                             static_cast<unsigned long long>(rawSize));
+        messageStats.decompressionFailures.fetch_add(1);
+        return false;
+    }
+
+    try {
+        std::vector<uint8_t> decoded(static_cast<size_t>(rawSize));
+        if (!compression::decompress(codec, data.data(), data.size(), decoded.data(), decoded.size())) {
+            MIDDLEWARE_LOG_ERROR("Failed to decompress %s payload (%zu bytes)", compression::codecName(codec),
+                                 data.size());
+            messageStats.decompressionFailures.fetch_add(1);
+            return false;
+        }
+
+        MIDDLEWARE_LOG_DEBUG("Decompressed %s payload: %zu -> %zu bytes", compression::codecName(codec),
+                             data.size(), decoded.size());
+        messageStats.decompressedBytes.fetch_add(decoded.size());
+        data = FilePayload::fromVector(std::move(decoded));
+        return true;
+
+    } catch (const std::bad_alloc&) {
+        MIDDLEWARE_LOG_ERROR("Out of memory decompressing %llu bytes", static_cast<unsigned long long>(rawSize));
+        messageStats.decompressionFailures.fetch_add(1);
+        return false;
+    }
+}
+
+// Chunked transfer handling
+
+struct ZmqConnector::ChunkedTransfer {
+    std::string transferId;
+    std::string filename;
+    std::string expectedHash;   // Hash frame as sent
+    std::string expectedDigest; // Hex digest parsed from the frame
+    HashVerifier::HashAlgorithm algorithm = HashVerifier::HashAlgorithm::Sha256;
+    uint64_t totalSize = 0;
+    uint64_t chunkSize = 0;
+    uint64_t nextSeq = 0;
+    uint64_t bytesReceived = 0;
+    compression::Codec codec = compression::Codec::None; // Chunks carry a compressed stream unless None
+    uint64_t rawSize = 0;       // Decoded file size for compressed transfers
+    uint64_t rawBytesWritten = 0;
+    std::filesystem::path spoolPath;
+    std::ofstream spool;
+    HashVerifier::StreamingHash digest; // Over the decoded bytes
+    compression::StreamDecoder decoder;
+    std::chrono::steady_clock::time_point lastActivity;
+};
+
+namespace {
+
+bool parseUnsignedFrame(const zmq::message_t& frame, uint64_t& value) {
+    const char* begin = static_cast<const char*>(frame.data());
+    const char* end = begin + frame.size();
+    if (begin == end) {
+        return false;
+    }
+    auto result = std::from_chars(begin, end, value);
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+bool isValidTransferId(const std::string& transferId) {
+    if (transferId.empty() || transferId.size() > 128) {
+        return false;
+    }
+    // Used verbatim in JSON replies and spool file names
+    return std::all_of(transferId.begin(), transferId.end(), [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.';
+    });
+}
+
+std::string chunkStatusReply(const char* status, const std::string& transferId, uint64_t nextChunk) {
+    return std::string("{\"status\": \"") + status + "\", \"transfer_id\": \"" + transferId +
+           "\", \"next_chunk\": " + std::to_string(nextChunk) + "}";
+}
+
+std::string chunkErrorReply(const std::string& transferId, const char* message) {
+    return std::string("{\"status\": \"error\", \"transfer_id\": \"") + transferId +
+           "\", \"message\": \"" + message + "\"}";
+}
+
+} // namespace
+
+ZmqConnector::ReceiveResult ZmqConnector::handleChunkedMessage(zmq::message_t& identity,
+                                                               std::vector<zmq::message_t>& parts,
+                                                               IncomingMessage& out) {
+    const std::string tag = parts[0].to_string();
+    std::lock_guard<std::mutex> lock(transferMutex);
+
+    if (tag == CHUNK_DATA_TAG) {
+        return handleChunkData(identity, parts);
+    }
+    if (tag == CHUNK_BEGIN_TAG) {
+        return handleChunkBegin(identity, parts);
+    }
+    if (tag == CHUNK_END_TAG) {
+        return handleChunkEnd(identity, parts, out);
+    }
+    return handleChunkAbort(identity, parts);
+}
+
+ZmqConnector::ReceiveResult ZmqConnector::handleChunkBegin(zmq::message_t& identity,
+                                                           std::vector<zmq::message_t>& parts) {
+    if (parts.size() != 6 && parts.size() != 7) {
+        MIDDLEWARE_LOG_ERROR("Malformed chunked BEGIN (%zu parts)", parts.size());
+        sendReply(identity, chunkErrorReply("", "Malformed BEGIN"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    const std::string transferId = parts[1].to_string();
+    const std::string filename = parts[2].to_string();
+    const std::string hash = parts[4].to_string();
+    uint64_t totalSize = 0;
+    uint64_t chunkSize = 0;
+
+    if (!isValidTransferId(transferId)) {
+        MIDDLEWARE_LOG_ERROR("Invalid transfer id in chunked BEGIN");
+        sendReply(identity, chunkErrorReply("", "Invalid transfer id"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+    if (filename.empty() || filename.size() > 255) {
+        MIDDLEWARE_LOG_ERROR("Invalid filename in chunked BEGIN: %s", filename.c_str());
+        sendReply(identity, chunkErrorReply(transferId, "Invalid filename"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+    if (!parseUnsignedFrame(parts[3], totalSize) || totalSize == 0 || totalSize > MAX_CHUNKED_FILE_SIZE) {
+        MIDDLEWARE_LOG_ERROR("Invalid total size in chunked BEGIN for %s", filename.c_str());
+        sendReply(identity, chunkErrorReply(transferId, "Invalid total size"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+    if (!parseUnsignedFrame(parts[5], chunkSize) || chunkSize < MIN_CHUNK_SIZE || chunkSize > MAX_CHUNK_SIZE) {
+        MIDDLEWARE_LOG_ERROR("Invalid chunk size in chunked BEGIN for %s (must be %zu-%zu)",
+                            filename.c_str(), MIN_CHUNK_SIZE, MAX_CHUNK_SIZE);
+        sendReply(identity, chunkErrorReply(transferId, "Invalid chunk size"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+    HashVerifier::HashAlgorithm algorithm = HashVerifier::HashAlgorithm::Sha256;
+    std::string expectedDigest;
+    if (!HashVerifier::parseHashFrame(hash, algorithm, expectedDigest)) {
+        MIDDLEWARE_LOG_ERROR("Invalid hash frame in chunked BEGIN: %s", hash.c_str());
+        sendReply(identity, chunkErrorReply(transferId, "Invalid hash"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+    compression::Codec codec = compression::Codec::None;
+    uint64_t rawSize = totalSize;
+    if (parts.size() == 7) {
+        const std::string encoding = parts[6].size() <= 64 ? parts[6].to_string() : std::string();
+        if (!compression::parseEncodingFrame(encoding, codec, rawSize) || rawSize > MAX_CHUNKED_FILE_SIZE) {
+            MIDDLEWARE_LOG_ERROR("Invalid encoding frame in chunked BEGIN for %s", filename.c_str());
+            sendReply(identity, chunkErrorReply(transferId, "Invalid encoding"));
+            messageStats.failedReceives.fetch_add(1);
+            return ReceiveResult::Nothing;
+        }
+        if (!compression::isCodecAvailable(codec)) {
+            MIDDLEWARE_LOG_ERROR("Unsupported codec %s in chunked BEGIN for %s", compression::codecName(codec),
+                                 filename.c_str());
+            sendReply(identity, chunkErrorReply(transferId, "Unsupported codec"));
+            messageStats.failedReceives.fetch_add(1);
+            return ReceiveResult::Nothing;
+        }
+        if (codec == compression::Codec::None) {
+            rawSize = totalSize;
+        }
+    }
+
+    expireIdleTransfers();
+
+    auto existing = activeTransfers.find(transferId);
+    if (existing != activeTransfers.end()) {
+        ChunkedTransfer& transfer = *existing->second;
+        if (transfer.filename == filename && transfer.totalSize == totalSize &&
+            transfer.chunkSize == chunkSize && transfer.algorithm == algorithm &&
+            transfer.codec == codec && transfer.rawSize == rawSize &&
+            HashVerifier::compareHashes(transfer.expectedDigest, expectedDigest)) {
+            transfer.lastActivity = std::chrono::steady_clock::now();
+            messageStats.transfersResumed.fetch_add(1);
+            MIDDLEWARE_LOG_INFO("Resuming chunked transfer %s (%s) at chunk %llu",
+                               transferId.c_str(), filename.c_str(),
+                               static_cast<unsigned long long>(transfer.nextSeq));
+            std::string reply = chunkStatusReply("ready", transferId, transfer.nextSeq);
+            reply.insert(reply.size() - 1, ", \"credit\": " + std::to_string(chunkWindow.load()));
+            sendReply(identity, reply);
+            return ReceiveResult::TransferProgress;
+        }
+
+        // Same id, different file: the old state is useless
+        MIDDLEWARE_LOG_WARNING("Chunked transfer %s restarted with a different file", transferId.c_str());
+        discardTransfer(transferId);
+    }
+
+    if (activeTransfers.size() >= MAX_ACTIVE_TRANSFERS) {
+        MIDDLEWARE_LOG_ERROR("Too many active chunked transfers (%zu)", activeTransfers.size());
+        sendReply(identity, chunkErrorReply(transferId, "Too many active transfers"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    auto transfer = std::make_unique<ChunkedTransfer>();
+    transfer->transferId = transferId;
+    transfer->filename = filename;
+    transfer->expectedHash = hash;
+    transfer->expectedDigest = expectedDigest;
+    transfer->algorithm = algorithm;
+    transfer->totalSize = totalSize;
+    transfer->chunkSize = chunkSize;
+    transfer->codec = codec;
+    transfer->rawSize = rawSize;
+    transfer->lastActivity = std::chrono::steady_clock::now();
+
+    std::error_code ec;
+    std::filesystem::path spoolDir(chunkSpoolDirectory);
+    std::filesystem::create_directories(spoolDir, ec);
+    if (ec) {
+        MIDDLEWARE_LOG_ERROR("Cannot create spool directory %s: %s", chunkSpoolDirectory.c_str(), ec.message().c_str());
+        sendReply(identity, chunkErrorReply(transferId, "Spool directory unavailable"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    transfer->spoolPath = spoolDir / (transferId + ".part");
+    transfer->spool.open(transfer->spoolPath, std::ios::binary | std::ios::trunc);
+    if (!transfer->spool || !transfer->digest.reset(algorithm) ||
+        (codec != compression::Codec::None && !transfer->decoder.reset(codec))) {
+        MIDDLEWARE_LOG_ERROR("Cannot start chunked transfer %s: spool or digest setup failed", transferId.c_str());
+        transfer->spool.close();
+        std::filesystem::remove(transfer->spoolPath, ec);
+        sendReply(identity, chunkErrorReply(transferId, "Cannot create spool file"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    MIDDLEWARE_LOG_INFO("Starting chunked transfer %s: %s (%llu bytes, %llu byte chunks, %s)",
+                       transferId.c_str(), filename.c_str(),
+                       static_cast<unsigned long long>(totalSize), static_cast<unsigned long long>(chunkSize),
+                       compression::codecName(codec));
+    activeTransfers.emplace(transferId, std::move(transfer));
+
+    std::string reply = chunkStatusReply("ready", transferId, 0);
+    reply.insert(reply.size() - 1, ", \"credit\": " + std::to_string(chunkWindow.load()));
+    sendReply(identity, reply);
+    return ReceiveResult::TransferProgress;
+}
+
+ZmqConnector::ReceiveResult ZmqConnector::handleChunkData(zmq::message_t& identity,
+                                                          std::vector<zmq::message_t>& parts) {
+    if (parts.size() != 4) {
+        MIDDLEWARE_LOG_ERROR("Malformed chunk (%zu parts)", parts.size());
+        sendReply(identity, chunkErrorReply("", "Malformed chunk"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    const std::string transferId = parts[1].to_string();
+    auto it = isValidTransferId(transferId) ? activeTransfers.find(transferId) : activeTransfers.end();
+    if (it == activeTransfers.end()) {
+        // Sender re-sends BEGIN to recover
+        MIDDLEWARE_LOG_WARNING("Chunk for unknown transfer");
+        sendReply(identity, chunkErrorReply(isValidTransferId(transferId) ? transferId : "", "Unknown transfer"));
+        return ReceiveResult::Nothing;
+    }
+
+    ChunkedTransfer& transfer = *it->second;
+    uint64_t seq = 0;
+    if (!parseUnsignedFrame(parts[2], seq)) {
+        MIDDLEWARE_LOG_ERROR("Invalid chunk sequence number for transfer %s", transferId.c_str());
+        sendReply(identity, chunkStatusReply("nack", transferId, transfer.nextSeq));
+        return ReceiveResult::TransferProgress;
+    }
+
+    transfer.lastActivity = std::chrono::steady_clock::now();
+
+    if (seq < transfer.nextSeq) {
+        // Duplicate after a lost ack; already written
+        sendReply(identity, chunkStatusReply("ack", transferId, transfer.nextSeq));
+        return ReceiveResult::TransferProgress;
+    }
+    if (seq > transfer.nextSeq) {
+        MIDDLEWARE_LOG_DEBUG("Out-of-order chunk %llu for transfer %s (expected %llu)",
+                            static_cast<unsigned long long>(seq), transferId.c_str(),
+                            static_cast<unsigned long long>(transfer.nextSeq));
+        sendReply(identity, chunkStatusReply("nack", transferId, transfer.nextSeq));
+        return ReceiveResult::TransferProgress;
+    }
+
+    const uint64_t expectedBytes = std::min(transfer.chunkSize, transfer.totalSize - transfer.bytesReceived);
+    const zmq::message_t& payload = parts[3];
+    if (payload.size() != expectedBytes) {
+        MIDDLEWARE_LOG_ERROR("Chunk %llu of transfer %s has %zu bytes, expected %llu",
+                            static_cast<unsigned long long>(seq), transferId.c_str(), payload.size(),
+                            static_cast<unsigned long long>(expectedBytes));
+        sendReply(identity, chunkStatusReply("nack", transferId, transfer.nextSeq));
+        return ReceiveResult::TransferProgress;
+    }
+
+    // Spool and digest only ever see decoded bytes, so the assembled file needs no second pass
+    auto spoolBytes = [&transfer](const uint8_t* data, size_t size) {
+        if (size > transfer.rawSize - transfer.rawBytesWritten) {
+            MIDDLEWARE_LOG_ERROR("Transfer %s decodes past its announced size", transfer.transferId.c_str());
+            return false;
+        }
+        transfer.spool.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+        if (!transfer.spool || !transfer.digest.update(data, size)) {
+            return false;
+        }
+        transfer.rawBytesWritten += size;
+        return true;
+    };
+
+    const auto* bytes = static_cast<const uint8_t*>(payload.data());
+    const uint64_t rawBefore = transfer.rawBytesWritten;
+    const bool spooled = transfer.codec == compression::Codec::None
+                             ? spoolBytes(bytes, payload.size())
+                             : transfer.decoder.decode(bytes, payload.size(), spoolBytes);
+    if (!spooled) {
+        MIDDLEWARE_LOG_ERROR("Failed to spool chunk %llu of transfer %s",
+                            static_cast<unsigned long long>(seq), transferId.c_str());
+        if (transfer.codec != compression::Codec::None) {
+            messageStats.decompressionFailures.fetch_add(1);
+        }
+        discardTransfer(transferId);
+        sendReply(identity, chunkErrorReply(transferId, "Spool write failed"));
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    if (transfer.codec != compression::Codec::None) {
+        messageStats.compressedBytesReceived.fetch_add(payload.size());
+        messageStats.decompressedBytes.fetch_add(transfer.rawBytesWritten - rawBefore);
+    }
+    transfer.bytesReceived += payload.size();
+    transfer.nextSeq++;
+    messageStats.chunksReceived.fetch_add(1);
+    messageStats.totalBytesReceived.fetch_add(payload.size());
+    messageStats.lastMessageTime = transfer.lastActivity;
+
+    sendReply(identity, chunkStatusReply("ack", transferId, transfer.nextSeq));
+    return ReceiveResult::TransferProgress;
+}
+
+ZmqConnector::ReceiveResult ZmqConnector::handleChunkEnd(zmq::message_t& identity,
+                                                         std::vector<zmq::message_t>& parts,
+                                                         IncomingMessage& out) {
+    const std::string transferId = parts.size() == 2 ? parts[1].to_string() : std::string();
+    auto it = isValidTransferId(transferId) ? activeTransfers.find(transferId) : activeTransfers.end();
+    if (it == activeTransfers.end()) {
+        MIDDLEWARE_LOG_ERROR("Chunked END for unknown or malformed transfer");
+        sendReply(identity, "ERROR: Unknown transfer");
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    ChunkedTransfer& transfer = *it->second;
+    if (transfer.bytesReceived != transfer.totalSize) {
+        MIDDLEWARE_LOG_WARNING("Chunked END for incomplete transfer %s (%llu/%llu bytes)", transferId.c_str(),
+                              static_cast<unsigned long long>(transfer.bytesReceived),
+                              static_cast<unsigned long long>(transfer.totalSize));
+        sendReply(identity, chunkStatusReply("incomplete", transferId, transfer.nextSeq));
+        return ReceiveResult::TransferProgress;
+    }
+
+    if (transfer.rawBytesWritten != transfer.rawSize ||
+        (transfer.codec != compression::Codec::None && !transfer.decoder.finished())) {
+        MIDDLEWARE_LOG_ERROR("Chunked transfer %s decoded to %llu of %llu bytes", transferId.c_str(),
+                            static_cast<unsigned long long>(transfer.rawBytesWritten),
+                            static_cast<unsigned long long>(transfer.rawSize));
+        messageStats.decompressionFailures.fetch_add(1);
+        discardTransfer(transferId);
+        sendReply(identity, "ERROR: Decompression failed");
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    transfer.spool.close();
+    const std::string computedHash = transfer.digest.finalizeHex();
+    if (transfer.spool.fail() || computedHash.empty() ||
+        !HashVerifier::compareHashes(computedHash, transfer.expectedDigest)) {
+        MIDDLEWARE_LOG_ERROR("Hash mismatch for chunked transfer %s (%s)", transferId.c_str(),
+                            transfer.filename.c_str());
+        messageStats.hashMismatches.fetch_add(1);
+        discardTransfer(transferId);
+        sendReply(identity, "ERROR: Hash mismatch");
+        return ReceiveResult::Nothing;
+    }
+
+    // The mapping owns the spool file from here on and deletes it when the last payload goes away
+    auto mapped = MappedFile::open(transfer.spoolPath.string(), true);
+    if (!mapped || mapped->size() != transfer.rawSize) {
+        MIDDLEWARE_LOG_ERROR("Failed to map spooled file for transfer %s", transferId.c_str());
+        mapped.reset();
+        discardTransfer(transferId);
+        sendReply(identity, "ERROR: Cannot read assembled file");
+        messageStats.failedReceives.fetch_add(1);
+        return ReceiveResult::Nothing;
+    }
+
+    out.filename = transfer.filename;
+    out.hash = transfer.expectedHash;
+    out.data = FilePayload(mapped, mapped->data(), mapped->size());
+    out.hashVerified = true;
+    const bool wasCompressed = transfer.codec != compression::Codec::None;
+    activeTransfers.erase(it);
+
+    sendReply(identity, "RECEIVED");
+
+    messageStats.totalFilesReceived.fetch_add(1);
+    messageStats.chunkedFilesReceived.fetch_add(1);
+    if (wasCompressed) {
+        messageStats.compressedFilesReceived.fetch_add(1);
+    }
+    messageStats.lastMessageTime = std::chrono::steady_clock::now();
+    MIDDLEWARE_LOG_INFO("Completed chunked transfer %s: %s (%zu bytes)", transferId.c_str(),
+                       out.filename.c_str(), out.data.size());
+    return ReceiveResult::File;
+}
+
+ZmqConnector::ReceiveResult ZmqConnector::handleChunkAbort(zmq::message_t& identity,
+                                                           std::vector<zmq::message_t>& parts) {
+    const std::string transferId = parts.size() == 2 ? parts[1].to_string() : std::string();
+    if (!isValidTransferId(transferId)) {
+        sendReply(identity, chunkErrorReply("", "Malformed ABORT"));
+        return ReceiveResult::Nothing;
+    }
+
+    if (activeTransfers.count(transferId) != 0) {
+        MIDDLEWARE_LOG_INFO("Chunked transfer %s aborted by sender", transferId.c_str());
+        discardTransfer(transferId);
+    }
+    sendReply(identity, chunkStatusReply("aborted", transferId, 0));
+    return ReceiveResult::TransferProgress;
+}
+
+void ZmqConnector::discardTransfer(const std::string& transferId) {
+    auto it = activeTransfers.find(transferId);
+    if (it == activeTransfers.end()) {
+        return;
+    }
+
+    ChunkedTransfer& transfer = *it->second;
+    transfer.spool.close();
+    std::error_code ec;
+    std::filesystem::remove(transfer.spoolPath, ec);
+    if (ec) {
+        MIDDLEWARE_LOG_WARNING("Failed to remove spool file %s: %s", transfer.spoolPath.string().c_str(),
+                              ec.message().c_str());
+    }
+    activeTransfers.erase(it);
+}
+
+void ZmqConnector::expireIdleTransfers() {
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<std::string> expired;
+    for (const auto& entry : activeTransfers) {
+        if (now - entry.second->lastActivity > TRANSFER_IDLE_TIMEOUT) {
+            expired.push_back(entry.first);
+        }
+    }
+    for (const auto& transferId : expired) {
+        MIDDLEWARE_LOG_WARNING("Chunked transfer %s expired after inactivity", transferId.c_str());
+        discardTransfer(transferId);
+    }
+}
+
+void ZmqConnector::discardAllTransfers() {
+    std::lock_guard<std::mutex> lock(transferMutex);
+    while (!activeTransfers.empty()) {
+        discardTransfer(activeTransfers.begin()->first);
+    }
+}
+
 void ZmqConnector::disconnect(int gracefulTimeoutMs) {
     MIDDLEWARE_LOG_INFO("Disconnecting ZmqConnector (timeout: %dms)", gracefulTimeoutMs);
 
@@ -456,35 +1233,36 @@ void ZmqConnector::disconnect(int gracefulTimeoutMs) {
     std::lock_guard<std::mutex> lock(connectionMutex);
 
     try {
-        // Close socket first
-        if (zmqSocket) {
-            // Try graceful unbind if we have an endpoint
-            if (!currentEndpoint.empty()) {
-                try {
-                    zmqSocket->unbind(currentEndpoint);
-                    MIDDLEWARE_LOG_DEBUG("Unbound from %s", currentEndpoint.c_str());
-                } catch (const zmq::error_t& e) {
-                    MIDDLEWARE_LOG_WARNING("Error during unbind: %s (errno: %d)", e.what(), e.num());
-                }
+        closeWakeupPair();
+
+        // Close sockets first
+        for (auto& bound : boundSockets) {
+            // Try graceful unbind
+            try {
+                bound->socket->unbind(bound->endpoint);
+                MIDDLEWARE_LOG_DEBUG("Unbound from %s", bound->endpoint.c_str());
+            } catch (const zmq::error_t& e) {
+                MIDDLEWARE_LOG_WARNING("Error during unbind: %s (errno: %d)", e.what(), e.num());
             }
 
             // Set linger time for graceful shutdown
             try {
-                zmqSocket->set(zmq::sockopt::linger, gracefulTimeoutMs);
+                bound->socket->set(zmq::sockopt::linger, gracefulTimeoutMs);
             } catch (const zmq::error_t& e) {
                 MIDDLEWARE_LOG_WARNING("Failed to set linger time: %s", e.what());
             }
 
             // Close socket
             try {
-                zmqSocket->close();
+                bound->socket->close();
                 MIDDLEWARE_LOG_DEBUG("ZMQ socket closed");
             } catch (const zmq::error_t& e) {
                 MIDDLEWARE_LOG_WARNING("Error closing socket: %s (errno: %d)", e.what(), e.num());
             }
-
-            zmqSocket.reset();
         }
+        activeSocket = nullptr;
+        pollItems.clear();
+        boundSockets.clear();
 
         // Close context
         if (zmqContext) {
@@ -502,8 +1280,9 @@ void ZmqConnector::disconnect(int gracefulTimeoutMs) {
         MIDDLEWARE_LOG_ERROR("Exception during disconnect: %s", e.what());
     }
 
+    discardAllTransfers();
+
     // Clear state
-    currentEndpoint.clear();
     {
         std::lock_guard<std::mutex> msgLock(messageMutex);
         lastReceivedMessage.clear();
@@ -516,7 +1295,7 @@ void ZmqConnector::disconnect(int gracefulTimeoutMs) {
 // Getter methods with thread safety
 bool ZmqConnector::isConnected() const {
     return connectionStatus.load() == ConnectionStatus::Connected &&
-           zmqSocket != nullptr &&
+           activeSocket != nullptr &&
            !shutdownRequested.load();
 }
 
@@ -526,7 +1305,76 @@ ZmqConnector::ConnectionStatus ZmqConnector::getConnectionStatus() const {
 
 void* ZmqConnector::getSocket() const {
     std::lock_guard<std::mutex> lock(connectionMutex);
-    return zmqSocket ? zmqSocket->handle() : nullptr;
+    return boundSockets.empty() ? nullptr : boundSockets.front()->socket->handle();
+}
+
+ZmqConnector::WaitResult ZmqConnector::waitForMessage(int timeoutMs) {
+    if (connectionStatus.load() != ConnectionStatus::Connected || !activeSocket) {
+        return WaitResult::Disconnected;
+    }
+
+    try {
+        int pollResult = zmq::poll(pollItems, std::chrono::milliseconds(timeoutMs));
+        if (pollResult <= 0) {
+            return WaitResult::Timeout;
+        }
+
+        const size_t socketCount = boundSockets.size();
+        if (pollItems.size() > socketCount && (pollItems.back().revents & ZMQ_POLLIN)) {
+            // Consume every queued signal so the next wait blocks again
+            zmq::message_t signal;
+            while (wakeupReceiver->recv(signal, zmq::recv_flags::dontwait)) {
+            }
+            MIDDLEWARE_LOG_DEBUG("Receiver woken up by wakeup signal");
+        }
+
+        const bool ready = std::any_of(pollItems.begin(), pollItems.begin() + socketCount,
+                                       [](const zmq::pollitem_t& item) { return (item.revents & ZMQ_POLLIN) != 0; });
+        return ready ? WaitResult::Ready : WaitResult::Timeout;
+
+    } catch (const zmq::error_t& e) {
+        // Termination is reported once by the caller, which stops waiting
+        if (e.num() == ETERM || e.num() == ENOTSOCK) {
+            return WaitResult::Terminated;
+        }
+        if (e.num() != EINTR) {
+            MIDDLEWARE_LOG_ERROR("ZeroMQ error in waitForMessage: %s (errno: %d)", e.what(), e.num());
+        }
+        return WaitResult::Timeout;
+    }
+}
+
+void ZmqConnector::wakeup() {
+    std::lock_guard<std::mutex> lock(wakeupMutex);
+    if (!wakeupSender) {
+        return;
+    }
+
+    try {
+        zmq::message_t signal;
+        // Never block the caller; a full pipe already guarantees a pending wakeup
+        (void)wakeupSender->send(signal, zmq::send_flags::dontwait);
+    } catch (const zmq::error_t& e) {
+        MIDDLEWARE_LOG_WARNING("Failed to signal receiver wakeup: %s (errno: %d)", e.what(), e.num());
+    }
+}
+
+bool ZmqConnector::hasPendingMessage() const {
+    if (connectionStatus.load() != ConnectionStatus::Connected || !activeSocket) {
+        return false;
+    }
+
+    try {
+        for (const auto& bound : boundSockets) {
+            if (bound->socket->get(zmq::sockopt::events) & ZMQ_POLLIN) {
+                return true;
+            }
+        }
+        return false;
+    } catch (const zmq::error_t& e) {
+        MIDDLEWARE_LOG_DEBUG("Failed to query socket events: %s", e.what());
+        return false;
+    }
 }
 
 std::string ZmqConnector::getLastReceivedMessage() const {
@@ -536,7 +1384,63 @@ std::string ZmqConnector::getLastReceivedMessage() const {
 
 std::string ZmqConnector::getCurrentEndpoint() const {
     std::lock_guard<std::mutex> lock(connectionMutex);
-    return currentEndpoint;
+    return boundSockets.empty() ? std::string() : boundSockets.front()->endpoint;
+}
+
+std::vector<std::string> ZmqConnector::getEndpoints() const {
+    std::lock_guard<std::mutex> lock(connectionMutex);
+    std::vector<std::string> endpoints;
+    for (const auto& bound : boundSockets) {
+        endpoints.push_back(bound->endpoint);
+    }
+    return endpoints;
+}
+
+std::vector<ZmqConnector::ThroughputStats> ZmqConnector::getEndpointStats() const {
+    std::lock_guard<std::mutex> lock(connectionMutex);
+    std::chrono::steady_clock::time_point since;
+    {
+        std::lock_guard<std::mutex> clientLock(clientMutex);
+        since = statsSince;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<ThroughputStats> stats;
+    for (const auto& bound : boundSockets) {
+        ThroughputStats entry;
+        entry.name = bound->endpoint;
+        entry.messages = bound->messages.load();
+        entry.bytes = bound->bytes.load();
+        entry.bytesPerSecond = averageRate(entry.bytes, since, now);
+        entry.lastMessageTime = std::chrono::steady_clock::time_point(
+            std::chrono::steady_clock::duration(bound->lastMessageTicks.load()));
+        stats.push_back(std::move(entry));
+    }
+    return stats;
+}
+
+std::vector<ZmqConnector::ThroughputStats> ZmqConnector::getClientStats() const {
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<ThroughputStats> stats;
+    {
+        std::lock_guard<std::mutex> lock(clientMutex);
+        stats.reserve(clientTraffic.size());
+        for (const auto& [identity, traffic] : clientTraffic) {
+            ThroughputStats entry;
+            entry.name = identity;
+            entry.endpoint = traffic.endpoint;
+            entry.messages = traffic.messages;
+            entry.bytes = traffic.bytes;
+            entry.bytesPerSecond = averageRate(traffic.bytes, traffic.firstMessageTime, now);
+            entry.lastMessageTime = traffic.lastMessageTime;
+            stats.push_back(std::move(entry));
+        }
+    }
+
+    std::sort(stats.begin(), stats.end(), [](const ThroughputStats& a, const ThroughputStats& b) {
+        return a.bytes > b.bytes;
+    });
+    return stats;
 }
 
 
@@ -546,6 +1450,18 @@ std::string ZmqConnector::getCurrentEndpoint() const {
 
 void ZmqConnector::resetMessageStats() {
     messageStats.reset();
+    {
+        std::lock_guard<std::mutex> lock(connectionMutex);
+        for (auto& bound : boundSockets) {
+            bound->messages.store(0);
+            bound->bytes.store(0);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(clientMutex);
+        clientTraffic.clear();
+        statsSince = std::chrono::steady_clock::now();
+    }
     MIDDLEWARE_LOG_INFO("Message statistics reset");
 }
 
@@ -563,14 +1479,81 @@ size_t ZmqConnector::getMaxMessageSize() const {
     return maxMessageSize.load();
 }
 
+void ZmqConnector::setChunkSpoolDirectory(const std::string& directory) {
+    if (directory.empty()) {
+        MIDDLEWARE_LOG_ERROR("Invalid chunk spool directory: empty path");
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(transferMutex);
+    if (!activeTransfers.empty()) {
+        MIDDLEWARE_LOG_WARNING("Changing spool directory with %zu transfers in flight; they keep their old files",
+                              activeTransfers.size());
+    }
+    chunkSpoolDirectory = directory;
+    MIDDLEWARE_LOG_INFO("Chunk spool directory set to %s", directory.c_str());
+}
+
+std::string ZmqConnector::getChunkSpoolDirectory() const {
+    std::lock_guard<std::mutex> lock(transferMutex);
+    return chunkSpoolDirectory;
+}
+
+void ZmqConnector::setChunkWindow(size_t chunks) {
+    if (chunks > 0 && chunks <= MAX_CHUNK_WINDOW) {
+        chunkWindow.store(chunks);
+        MIDDLEWARE_LOG_INFO("Chunk window set to %zu", chunks);
+    } else {
+        MIDDLEWARE_LOG_ERROR("Invalid chunk window: %zu (must be 1-%zu)", chunks, MAX_CHUNK_WINDOW);
+    }
+}
+
+size_t ZmqConnector::getChunkWindow() const {
+    return chunkWindow.load();
+}
+
+void ZmqConnector::setIoThreads(int threads) {
+    if (threads < 1 || threads > MAX_IO_THREADS) {
+        MIDDLEWARE_LOG_ERROR("Invalid I/O thread count: %d (must be 1-%d)", threads, MAX_IO_THREADS);
+        return;
+    }
+    ioThreads.store(threads);
+    MIDDLEWARE_LOG_INFO("ZMQ I/O threads set to %d (takes effect on next initialize)", threads);
+}
+
+int ZmqConnector::getIoThreads() const {
+    return ioThreads.load();
+}
+
+void ZmqConnector::setHighWaterMark(int messages) {
+    if (messages < 1 || messages > MAX_HIGH_WATER_MARK) {
+        MIDDLEWARE_LOG_ERROR("Invalid high water mark: %d (must be 1-%d)", messages, MAX_HIGH_WATER_MARK);
+        return;
+    }
+    highWaterMark.store(messages);
+    MIDDLEWARE_LOG_INFO("ZMQ high water mark set to %d messages (takes effect on next initialize)", messages);
+}
+
+int ZmqConnector::getHighWaterMark() const {
+    return highWaterMark.load();
+}
+
+size_t ZmqConnector::getActiveTransferCount() const {
+    std::lock_guard<std::mutex> lock(transferMutex);
+    return activeTransfers.size();
+}
+
 // Private helper methods
 
 void ZmqConnector::cleanup() {
     try {
-        if (zmqSocket) {
-            zmqSocket->close();
-            zmqSocket.reset();
+        closeWakeupPair();
+        activeSocket = nullptr;
+        pollItems.clear();
+        for (auto& bound : boundSockets) {
+            bound->socket->close();
         }
+        boundSockets.clear();
         if (zmqContext) {
             zmqContext->close();
             zmqContext.reset();
@@ -579,15 +1562,59 @@ void ZmqConnector::cleanup() {
         MIDDLEWARE_LOG_ERROR("Exception during cleanup: %s", e.what());
     }
 
-    currentEndpoint.clear();
     {
         std::lock_guard<std::mutex> lock(messageMutex);
         lastReceivedMessage.clear();
     }
 }
 
+bool ZmqConnector::createWakeupPair() {
+    if (!zmqContext) {
+        return false;
+    }
+
+    try {
+        // Unique per connector so several middleware instances can share a process
+        const std::string wakeupEndpoint =
+            "inproc://jusync-wakeup-" + std::to_string(reinterpret_cast<std::uintptr_t>(this));
+
+        wakeupReceiver = std::make_unique<zmq::socket_t>(*zmqContext, zmq::socket_type::pair);
+        wakeupReceiver->set(zmq::sockopt::linger, 0);
+        wakeupReceiver->bind(wakeupEndpoint);
+
+        std::lock_guard<std::mutex> lock(wakeupMutex);
+        wakeupSender = std::make_unique<zmq::socket_t>(*zmqContext, zmq::socket_type::pair);
+        wakeupSender->set(zmq::sockopt::linger, 0);
+        wakeupSender->connect(wakeupEndpoint);
+        return true;
+
+    } catch (const zmq::error_t& e) {
+        MIDDLEWARE_LOG_ERROR("Failed to create wakeup socket pair: %s (errno: %d)", e.what(), e.num());
+        closeWakeupPair();
+        return false;
+    }
+}
+
+void ZmqConnector::closeWakeupPair() {
+    try {
+        {
+            std::lock_guard<std::mutex> lock(wakeupMutex);
+            if (wakeupSender) {
+                wakeupSender->close();
+                wakeupSender.reset();
+            }
+        }
+        if (wakeupReceiver) {
+            wakeupReceiver->close();
+            wakeupReceiver.reset();
+        }
+    } catch (const zmq::error_t& e) {
+        MIDDLEWARE_LOG_WARNING("Error closing wakeup sockets: %s (errno: %d)", e.what(), e.num());
+    }
+}
+
 bool ZmqConnector::sendReply(zmq::message_t& identity, const std::string& response, int timeoutMs) {
-    if (!zmqSocket || shutdownRequested.load()) {
+    if (!activeSocket || shutdownRequested.load()) {
         return false;
     }
 
@@ -599,7 +1626,7 @@ bool ZmqConnector::sendReply(zmq::message_t& identity, const std::string& respon
         }
 
         // Send identity frame
-        auto sendIdRes = zmqSocket->send(identity, zmq::send_flags::sndmore);
+        auto sendIdRes = activeSocket->send(identity, zmq::send_flags::sndmore);
         if (!sendIdRes) {
             MIDDLEWARE_LOG_ERROR("Failed to send identity in reply");
             return false;
@@ -607,7 +1634,7 @@ bool ZmqConnector::sendReply(zmq::message_t& identity, const std::string& respon
 
         // Send response frame
         zmq::message_t replyMsg(response.data(), response.size());
-        auto sendReplyRes = zmqSocket->send(replyMsg, zmq::send_flags::none);
+        auto sendReplyRes = activeSocket->send(replyMsg, zmq::send_flags::none);
         if (!sendReplyRes) {
             MIDDLEWARE_LOG_ERROR("Failed to send reply message");
             return false;
@@ -636,7 +1663,7 @@ bool ZmqConnector::validateMessageContent(const std::vector<uint8_t>& content, s
     return true;
 }
 
-bool ZmqConnector::tryAlternativeEndpoints(const std::string& primaryEndpoint) {
+std::string ZmqConnector::tryAlternativeEndpoints(zmq::socket_t& socket, const std::string& primaryEndpoint) {
     std::vector<std::string> alternatives;
 
     // Extract port from primary endpoint
@@ -664,10 +1691,9 @@ bool ZmqConnector::tryAlternativeEndpoints(const std::string& primaryEndpoint) {
     for (const auto& alt : alternatives) {
         try {
             MIDDLEWARE_LOG_INFO("Trying alternative endpoint: %s", alt.c_str());
-            zmqSocket->bind(alt);
-            currentEndpoint = alt;
+            socket.bind(alt);
             MIDDLEWARE_LOG_INFO("Successfully bound to alternative endpoint: %s", alt.c_str());
-            return true;
+            return alt;
 
         } catch (const zmq::error_t& e) {
             MIDDLEWARE_LOG_DEBUG("Alternative endpoint %s failed: %s", alt.c_str(), e.what());
@@ -675,16 +1701,68 @@ bool ZmqConnector::tryAlternativeEndpoints(const std::string& primaryEndpoint) {
         }
     }
 
+    return std::string();
+}
+
+int ZmqConnector::pollSockets(int timeoutMs) {
+    // The wakeup receiver is left out: legacy receive calls must not consume its signals
+    return zmq::poll(pollItems.data(), boundSockets.size(), std::chrono::milliseconds(timeoutMs));
+}
+
+bool ZmqConnector::receiveIdentity(zmq::message_t& identity) {
+    // Start after the socket served last, so a busy endpoint cannot starve the others;
+    // each ROUTER socket fair-queues its own peers
+    const size_t socketCount = boundSockets.size();
+    for (size_t n = 0; n < socketCount; ++n) {
+        const size_t index = (nextSocketIndex + n) % socketCount;
+        zmq::socket_t* socket = boundSockets[index]->socket.get();
+        if (socket->recv(identity, zmq::recv_flags::dontwait)) {
+            activeSocket = socket;
+            activeSocketIndex = index;
+            nextSocketIndex = (index + 1) % socketCount;
+            return true;
+        }
+    }
     return false;
 }
 
+void ZmqConnector::recordTraffic(const zmq::message_t& identity, size_t bytes) {
+    const auto now = std::chrono::steady_clock::now();
+    BoundSocket& bound = *boundSockets[activeSocketIndex];
+    bound.messages.fetch_add(1);
+    bound.bytes.fetch_add(bytes);
+    bound.lastMessageTicks.store(now.time_since_epoch().count());
+
+    std::string name = describeIdentity(identity);
+    std::lock_guard<std::mutex> lock(clientMutex);
+    auto it = clientTraffic.find(name);
+    if (it == clientTraffic.end()) {
+        // Reconnecting senders may pick new identities, so the table is bounded
+        if (clientTraffic.size() >= MAX_TRACKED_CLIENTS) {
+            auto oldest = std::min_element(clientTraffic.begin(), clientTraffic.end(),
+                                           [](const auto& a, const auto& b) {
+                                               return a.second.lastMessageTime < b.second.lastMessageTime;
+                                           });
+            clientTraffic.erase(oldest);
+        }
+        it = clientTraffic.emplace(std::move(name), ClientTraffic{}).first;
+        it->second.firstMessageTime = now;
+    }
+    if (it->second.endpoint != bound.endpoint) {
+        it->second.endpoint = bound.endpoint;
+    }
+    it->second.messages += 1;
+    it->second.bytes += bytes;
+    it->second.lastMessageTime = now;
+}
+
 int ZmqConnector::drainRemainingParts() {
     int drainedCount = 0;
 
     try {
         zmq::message_t drainMsg;
-        while (zmqSocket && zmqSocket->get(zmq::sockopt::rcvmore)) {
-            if (zmqSocket->recv(drainMsg, zmq::recv_flags::dontwait)) {
+        while (activeSocket && activeSocket->get(zmq::sockopt::rcvmore)) {
+            if (activeSocket->recv(drainMsg, zmq::recv_flags::dontwait)) {
                 drainedCount++;
                 if (drainedCount > 10) { // Prevent infinite loop
                     MIDDLEWARE_LOG_ERROR("Too many message parts to drain, stopping");
@@ -702,18 +1780,18 @@ int ZmqConnector::drainRemainingParts() {
 }
 
 bool ZmqConnector::receiveMessagePart(zmq::message_t& message, int timeoutMs, bool expectMore) {
-    if (!zmqSocket) {
+    if (!activeSocket) {
         return false;
     }
 
     try {
-        auto result = zmqSocket->recv(message, zmq::recv_flags::none);
+        auto result = activeSocket->recv(message, zmq::recv_flags::none);
         if (!result || result.value() == 0) {
             return false;
         }
 
         // Check if more parts are expected
-        bool hasMore = zmqSocket->get(zmq::sockopt::rcvmore);
+        bool hasMore = activeSocket->get(zmq::sockopt::rcvmore);
         if (expectMore && !hasMore) {
             MIDDLEWARE_LOG_ERROR("Expected more message parts but none available");
             return false;
@@ -0,0 +1,70 @@
+#include "BenchSender.h"
+
+#include <chrono>
+
+namespace anari_usd_middleware {
+namespace bench {
+
+BenchSender::~BenchSender() {
+    close();
+}
+
+bool BenchSender::connect(const std::string& endpoint) {
+    try {
+        close();
+        socket = zmq::socket_t(context, zmq::socket_type::dealer);
+        socket.set(zmq::sockopt::linger, 0);
+        socket.connect(endpoint);
+        return true;
+    } catch (const zmq::error_t&) {
+        close();
+        return false;
+    }
+}
+
+void BenchSender::close() {
+    if (socket) {
+        socket.close();
+    }
+}
+
+bool BenchSender::send(const std::string& filename, const uint8_t* data, size_t size, const std::string& hash,
+                       int timeoutMs) {
+    if (!socket) {
+        return false;
+    }
+    try {
+        socket.send(zmq::buffer(filename), zmq::send_flags::sndmore);
+        socket.send(zmq::const_buffer(data, size), zmq::send_flags::sndmore);
+        socket.send(zmq::buffer(hash), zmq::send_flags::none);
+
+        // Replies of earlier timed-out sends may still be queued; skip anything but the final answer
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (true) {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+            if (remaining.count() <= 0) {
+                reply.clear();
+                return false;
+            }
+            zmq::pollitem_t item{static_cast<void*>(socket), 0, ZMQ_POLLIN, 0};
+            if (zmq::poll(&item, 1, remaining) <= 0) {
+                continue;
+            }
+            zmq::message_t message;
+            if (!socket.recv(message, zmq::recv_flags::none)) {
+                continue;
+            }
+            reply = message.to_string();
+            if (reply == "RECEIVED" || reply.rfind("ERROR", 0) == 0) {
+                return reply == "RECEIVED";
+            }
+        }
+    } catch (const zmq::error_t&) {
+        reply.clear();
+        return false;
+    }
+}
+
+} // namespace bench
+} // namespace anari_usd_middleware
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <zmq.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace anari_usd_middleware {
+namespace bench {
+
+/**
+ * Minimal C++ counterpart of tools/Send data/file_sender.py: a DEALER socket that sends
+ * [filename][content][hash] and waits for the receiver's reply, so end-to-end runs need
+ * no Python interpreter in the timed loop.
+ */
+class BenchSender {
+public:
+    BenchSender() = default;
+    ~BenchSender();
+
+    BenchSender(const BenchSender&) = delete;
+    BenchSender& operator=(const BenchSender&) = delete;
+
+    /**
+     * Connect to a receive endpoint
+     * @param endpoint Endpoint the middleware binds (tcp:// or ipc://)
+     * @return True if the socket was connected
+     */
+    bool connect(const std::string& endpoint);
+
+    void close();
+
+    /**
+     * Send one file and wait for its reply
+     * @param filename File name frame; the receiver skips content it has already seen under the same name
+     * @param data File content
+     * @param size Size of data in bytes
+     * @param hash Hash frame of the content (SHA256 hex or "<algorithm>:<hex>")
+     * @param timeoutMs How long to wait for the reply
+     * @return True if the receiver answered RECEIVED
+     */
+    bool send(const std::string& filename, const uint8_t* data, size_t size, const std::string& hash,
+              int timeoutMs = 5000);
+
+    const std::string& lastReply() const { return reply; }
+
+private:
+    zmq::context_t context{1};
+    zmq::socket_t socket;
+    std::string reply;
+};
+
+} // namespace bench
+} // namespace anari_usd_middleware
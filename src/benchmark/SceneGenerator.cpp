@@ -0,0 +1,384 @@
+#include "SceneGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace anari_usd_middleware {
+namespace bench {
+
+namespace {
+
+// Distinct textures per scene; meshes share them round-robin like real material libraries
+constexpr size_t MAX_TEXTURES = 8;
+constexpr float GRID_SPACING = 0.1f;
+constexpr float HEIGHT_AMPLITUDE = 0.05f;
+
+/**
+ * xorshift32, so the scene does not depend on the standard library's distributions
+ */
+class Random {
+public:
+    explicit Random(uint32_t seed) : state(seed ? seed : 0x9E3779B9u) {}
+
+    uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    float unit() { return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f); }
+
+private:
+    uint32_t state;
+};
+
+class UsdaWriter {
+public:
+    explicit UsdaWriter(std::vector<uint8_t>& out) : out(out) {}
+
+    UsdaWriter& text(const char* value) {
+        while (*value) {
+            out.push_back(static_cast<uint8_t>(*value++));
+        }
+        return *this;
+    }
+
+    UsdaWriter& text(const std::string& value) {
+        out.insert(out.end(), value.begin(), value.end());
+        return *this;
+    }
+
+    UsdaWriter& number(float value) {
+        char buffer[32];
+        const int length = std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+        out.insert(out.end(), buffer, buffer + std::max(length, 0));
+        return *this;
+    }
+
+    UsdaWriter& number(size_t value) { return text(std::to_string(value)); }
+
+    UsdaWriter& tuple(const float* values, size_t count) {
+        text("(");
+        for (size_t i = 0; i < count; ++i) {
+            if (i > 0) {
+                text(", ");
+            }
+            number(values[i]);
+        }
+        return text(")");
+    }
+
+private:
+    std::vector<uint8_t>& out;
+};
+
+/**
+ * Body of a Mesh prim: topology, points, normals and UVs, one line per attribute
+ */
+void writeMeshBody(UsdaWriter& usda, const GridMesh& grid, const std::string& indent) {
+    usda.text(indent).text("int[] faceVertexCounts = [");
+    for (size_t f = 0; f < grid.faceCount(); ++f) {
+        usda.text(f > 0 ? ", " : "").number(static_cast<size_t>(grid.faceVertexCounts[f]));
+    }
+    usda.text("]\n");
+
+    usda.text(indent).text("int[] faceVertexIndices = [");
+    for (size_t i = 0; i < grid.faceVertexIndices.size(); ++i) {
+        usda.text(i > 0 ? ", " : "").number(static_cast<size_t>(grid.faceVertexIndices[i]));
+    }
+    usda.text("]\n");
+
+    const size_t vertexCount = grid.vertexCount();
+    usda.text(indent).text("point3f[] points = [");
+    for (size_t v = 0; v < vertexCount; ++v) {
+        usda.text(v > 0 ? ", " : "").tuple(&grid.points[v * 3], 3);
+    }
+    usda.text("]\n");
+
+    usda.text(indent).text("normal3f[] normals = [");
+    for (size_t v = 0; v < vertexCount; ++v) {
+        usda.text(v > 0 ? ", " : "").tuple(&grid.normals[v * 3], 3);
+    }
+    usda.text("] (\n").text(indent).text("    interpolation = \"vertex\"\n").text(indent).text(")\n");
+
+    usda.text(indent).text("texCoord2f[] primvars:st = [");
+    for (size_t v = 0; v < vertexCount; ++v) {
+        usda.text(v > 0 ? ", " : "").tuple(&grid.uvs[v * 2], 2);
+    }
+    usda.text("] (\n").text(indent).text("    interpolation = \"vertex\"\n").text(indent).text(")\n");
+    usda.text(indent).text("uniform token subdivisionScheme = \"none\"\n");
+}
+
+void writeTranslate(UsdaWriter& usda, size_t index, size_t meshCount, float extent, const std::string& indent) {
+    // Lay the meshes out on a square so their bounds do not overlap
+    const size_t columns = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(meshCount)))));
+    const float offset[3] = {static_cast<float>(index % columns) * extent, 0.0f,
+                             static_cast<float>(index / columns) * extent};
+    usda.text(indent).text("double3 xformOp:translate = ").tuple(offset, 3).text("\n");
+    usda.text(indent).text("uniform token[] xformOpOrder = [\"xformOp:translate\"]\n");
+}
+
+void writeMaterials(UsdaWriter& usda, size_t textureCount) {
+    usda.text("    def Scope \"Looks\"\n    {\n");
+    for (size_t t = 0; t < textureCount; ++t) {
+        const std::string name = "Material_" + std::to_string(t);
+        const std::string path = "/World/Looks/" + name;
+        usda.text("        def Material \"").text(name).text("\"\n        {\n");
+        usda.text("            token outputs:surface.connect = <").text(path).text("/Surface.outputs:surface>\n\n");
+        usda.text("            def Shader \"Surface\"\n            {\n");
+        usda.text("                uniform token info:id = \"UsdPreviewSurface\"\n");
+        usda.text("                color3f inputs:diffuseColor.connect = <").text(path).text("/Albedo.outputs:rgb>\n");
+        usda.text("                token outputs:surface\n            }\n\n");
+        usda.text("            def Shader \"Albedo\"\n            {\n");
+        usda.text("                uniform token info:id = \"UsdUVTexture\"\n");
+        usda.text("                asset inputs:file = @textures/albedo_").number(t).text(".png@\n");
+        usda.text("                float3 outputs:rgb\n            }\n        }\n");
+    }
+    usda.text("    }\n");
+}
+
+void writeHeader(UsdaWriter& usda, const char* defaultPrim) {
+    usda.text("#usda 1.0\n(\n    defaultPrim = \"").text(defaultPrim).text("\"\n    upAxis = \"Y\"\n)\n\n");
+}
+
+std::array<uint32_t, 256> makeCrcTable() {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t n = 0; n < 256; ++n) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[n] = c;
+    }
+    return table;
+}
+
+uint32_t crc32(const uint8_t* data, size_t size) {
+    static const std::array<uint32_t, 256> table = makeCrcTable();
+    uint32_t c = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        c = table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+uint32_t adler32(const std::vector<uint8_t>& data) {
+    uint32_t a = 1, b = 0;
+    for (uint8_t byte : data) {
+        a = (a + byte) % 65521u;
+        b = (b + a) % 65521u;
+    }
+    return (b << 16) | a;
+}
+
+void appendBigEndian(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 24));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void appendChunk(std::vector<uint8_t>& png, const char type[4], const std::vector<uint8_t>& payload) {
+    appendBigEndian(png, static_cast<uint32_t>(payload.size()));
+    const size_t typeOffset = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), payload.begin(), payload.end());
+    appendBigEndian(png, crc32(png.data() + typeOffset, png.size() - typeOffset));
+}
+
+} // namespace
+
+size_t Scene::totalBytes() const {
+    size_t total = root.size();
+    for (const auto& file : files) {
+        total += file.second.size();
+    }
+    return total;
+}
+
+GridMesh generateGrid(size_t verticesPerMesh, uint32_t seed) {
+    Random random(seed);
+    GridMesh grid;
+    grid.side = std::max<size_t>(2, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(verticesPerMesh)))));
+    const size_t side = grid.side;
+    const size_t vertexCount = side * side;
+    grid.points.reserve(vertexCount * 3);
+    grid.uvs.reserve(vertexCount * 2);
+
+    std::vector<float> heights(vertexCount);
+    for (float& height : heights) {
+        height = (random.unit() - 0.5f) * 2.0f * HEIGHT_AMPLITUDE;
+    }
+    for (size_t z = 0; z < side; ++z) {
+        for (size_t x = 0; x < side; ++x) {
+            grid.points.push_back(static_cast<float>(x) * GRID_SPACING);
+            grid.points.push_back(heights[z * side + x]);
+            grid.points.push_back(static_cast<float>(z) * GRID_SPACING);
+            grid.uvs.push_back(static_cast<float>(x) / static_cast<float>(side - 1));
+            grid.uvs.push_back(static_cast<float>(z) / static_cast<float>(side - 1));
+        }
+    }
+
+    // Central differences of the height field
+    grid.normals.reserve(vertexCount * 3);
+    for (size_t z = 0; z < side; ++z) {
+        for (size_t x = 0; x < side; ++x) {
+            const float left = heights[z * side + (x > 0 ? x - 1 : x)];
+            const float right = heights[z * side + (x + 1 < side ? x + 1 : x)];
+            const float back = heights[(z > 0 ? z - 1 : z) * side + x];
+            const float front = heights[(z + 1 < side ? z + 1 : z) * side + x];
+            const float nx = left - right;
+            const float nz = back - front;
+            const float ny = 2.0f * GRID_SPACING;
+            const float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+            grid.normals.push_back(nx / length);
+            grid.normals.push_back(ny / length);
+            grid.normals.push_back(nz / length);
+        }
+    }
+
+    const size_t faceCount = (side - 1) * (side - 1);
+    grid.faceVertexCounts.assign(faceCount, 4);
+    grid.faceVertexIndices.reserve(faceCount * 4);
+    for (size_t z = 0; z + 1 < side; ++z) {
+        for (size_t x = 0; x + 1 < side; ++x) {
+            const int32_t v = static_cast<int32_t>(z * side + x);
+            const int32_t row = static_cast<int32_t>(side);
+            grid.faceVertexIndices.insert(grid.faceVertexIndices.end(), {v, v + row, v + row + 1, v + 1});
+        }
+    }
+    return grid;
+}
+
+Scene generateScene(const SceneOptions& options) {
+    Scene scene;
+    Random random(options.seed);
+    const size_t textureCount = options.textures ? std::min(options.meshCount, MAX_TEXTURES) : 0;
+
+    scene.rootName = "bench_" + std::to_string(options.meshCount) + "x" + std::to_string(options.verticesPerMesh) +
+                     (options.references ? "_refs" : "") + (options.textures ? "_tex" : "") + ".usda";
+    scene.meshCount = options.meshCount;
+
+    UsdaWriter root(scene.root);
+    writeHeader(root, "World");
+    root.text("def Xform \"World\"\n{\n");
+
+    for (size_t m = 0; m < options.meshCount; ++m) {
+        const GridMesh grid = generateGrid(options.verticesPerMesh, random.next());
+        const float extent = static_cast<float>(grid.side) * GRID_SPACING * 1.25f;
+        const std::string name = "Mesh_" + std::to_string(m);
+        scene.vertexCount += grid.vertexCount();
+        scene.triangleCount += grid.faceCount() * 2;
+
+        if (options.references) {
+            const std::string layerPath = "meshes/mesh_" + std::to_string(m) + ".usda";
+            std::vector<uint8_t> layer;
+            UsdaWriter usda(layer);
+            writeHeader(usda, "Mesh");
+            usda.text("def Mesh \"Mesh\"\n{\n");
+            writeMeshBody(usda, grid, "    ");
+            usda.text("}\n");
+            scene.files.emplace_back(layerPath, std::move(layer));
+
+            root.text("    def \"").text(name).text("\" (\n        prepend references = @./").text(layerPath)
+                .text("@\n    )\n    {\n");
+        } else {
+            root.text("    def Mesh \"").text(name).text("\"\n    {\n");
+            writeMeshBody(root, grid, "        ");
+        }
+        writeTranslate(root, m, options.meshCount, extent, "        ");
+        if (textureCount > 0) {
+            root.text("        rel material:binding = </World/Looks/Material_").number(m % textureCount).text(">\n");
+        }
+        root.text("    }\n\n");
+    }
+
+    if (textureCount > 0) {
+        writeMaterials(root, textureCount);
+        for (size_t t = 0; t < textureCount; ++t) {
+            scene.files.emplace_back("textures/albedo_" + std::to_string(t) + ".png",
+                                     generatePng(options.textureSize, options.textureSize,
+                                                 options.seed + static_cast<uint32_t>(t)));
+        }
+    }
+    root.text("}\n");
+    return scene;
+}
+
+std::string writeScene(const Scene& scene, const std::string& directory) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    const fs::path base(directory);
+
+    auto writeFile = [&](const fs::path& path, const std::vector<uint8_t>& content) {
+        fs::create_directories(path.parent_path(), ec);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+        return static_cast<bool>(file);
+    };
+
+    for (const auto& entry : scene.files) {
+        if (!writeFile(base / entry.first, entry.second)) {
+            return {};
+        }
+    }
+    const fs::path rootPath = base / scene.rootName;
+    if (!writeFile(rootPath, scene.root)) {
+        return {};
+    }
+    return rootPath.string();
+}
+
+std::vector<uint8_t> generatePng(uint32_t width, uint32_t height, uint32_t seed) {
+    Random random(seed);
+    width = std::max<uint32_t>(width, 1);
+    height = std::max<uint32_t>(height, 1);
+
+    // Filter type 0 on every row; noise keeps the decoder from seeing trivially uniform data
+    std::vector<uint8_t> raw;
+    raw.reserve(static_cast<size_t>(height) * (static_cast<size_t>(width) * 4 + 1));
+    for (uint32_t y = 0; y < height; ++y) {
+        raw.push_back(0);
+        for (uint32_t x = 0; x < width; ++x) {
+            const uint8_t noise = static_cast<uint8_t>(random.next() & 0x1F);
+            raw.push_back(static_cast<uint8_t>((x * 255u) / width) ^ noise);
+            raw.push_back(static_cast<uint8_t>((y * 255u) / height) ^ noise);
+            raw.push_back(static_cast<uint8_t>(((x + y) * 127u) / (width + height)));
+            raw.push_back(255);
+        }
+    }
+
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    constexpr size_t MAX_STORED_BLOCK = 65535;
+    for (size_t offset = 0; offset < raw.size(); offset += MAX_STORED_BLOCK) {
+        const size_t length = std::min(MAX_STORED_BLOCK, raw.size() - offset);
+        const bool final = offset + length == raw.size();
+        zlib.push_back(final ? 1 : 0);
+        zlib.push_back(static_cast<uint8_t>(length));
+        zlib.push_back(static_cast<uint8_t>(length >> 8));
+        zlib.push_back(static_cast<uint8_t>(~length));
+        zlib.push_back(static_cast<uint8_t>(~length >> 8));
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+    }
+    appendBigEndian(zlib, adler32(raw));
+
+    std::vector<uint8_t> header;
+    appendBigEndian(header, width);
+    appendBigEndian(header, height);
+    header.insert(header.end(), {8, 6, 0, 0, 0}); // 8-bit RGBA, deflate, adaptive filtering, no interlace
+
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    appendChunk(png, "IHDR", header);
+    appendChunk(png, "IDAT", zlib);
+    appendChunk(png, "IEND", {});
+    return png;
+}
+
+} // namespace bench
+} // namespace anari_usd_middleware
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace anari_usd_middleware {
+
+/**
+ * Deterministic synthetic scenes for the benchmarks. The same options always produce the
+ * same bytes on every platform, so results stay comparable between releases.
+ */
+namespace bench {
+
+struct SceneOptions {
+    size_t meshCount = 16;
+    size_t verticesPerMesh = 1024; ///< Rounded up to a square grid of quads
+    bool references = false;       ///< Each mesh in its own layer, referenced from the root layer
+    bool textures = false;         ///< A UsdPreviewSurface material with a PNG albedo texture
+    uint32_t textureSize = 256;    ///< Texture width and height
+    uint32_t seed = 1;
+};
+
+struct Scene {
+    std::string rootName;          ///< File name of the root layer
+    std::vector<uint8_t> root;     ///< Root layer (USDA)
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> files; ///< Referenced layers and textures, by relative path
+    size_t meshCount = 0;
+    size_t vertexCount = 0;
+    size_t triangleCount = 0;
+
+    /**
+     * @return Size of the root layer and every file it uses
+     */
+    size_t totalBytes() const;
+};
+
+/**
+ * One height-field grid of quads, as the arrays a Mesh prim authors
+ */
+struct GridMesh {
+    size_t side = 0;                        ///< Vertices per row and column
+    std::vector<float> points;              ///< xyz
+    std::vector<float> normals;             ///< xyz, per vertex
+    std::vector<float> uvs;                 ///< st, per vertex
+    std::vector<int32_t> faceVertexCounts;  ///< All 4
+    std::vector<int32_t> faceVertexIndices;
+
+    size_t vertexCount() const { return points.size() / 3; }
+    size_t faceCount() const { return faceVertexCounts.size(); }
+};
+
+/**
+ * Build one grid, e.g. to drive the extraction stages without parsing
+ * @param verticesPerMesh Vertex count, rounded up to a square grid (at least 2x2)
+ * @param seed Height noise seed
+ * @return Generated grid
+ */
+GridMesh generateGrid(size_t verticesPerMesh, uint32_t seed);
+
+/**
+ * Build a scene of meshCount height-field grids in USDA
+ * @param options Scene shape
+ * @return Generated scene
+ */
+Scene generateScene(const SceneOptions& options);
+
+/**
+ * Write a scene to disk, e.g. for loads that resolve references
+ * @param scene Scene from generateScene()
+ * @param directory Target directory, created if missing
+ * @return Path of the root layer, empty on failure
+ */
+std::string writeScene(const Scene& scene, const std::string& directory);
+
+/**
+ * Encode a noisy gradient as an RGBA PNG (stored deflate blocks, no compression library)
+ * @param width Image width
+ * @param height Image height
+ * @param seed Noise seed
+ * @return PNG file content
+ */
+std::vector<uint8_t> generatePng(uint32_t width, uint32_t height, uint32_t seed);
+
+} // namespace bench
+} // namespace anari_usd_middleware
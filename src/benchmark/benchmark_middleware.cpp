@@ -0,0 +1,630 @@
+// Performance benchmarks for the middleware. Every case reports bytes_per_second (MB/s of
+// input), meshes_per_second where meshes are produced, and p50_ms / p99_ms of the
+// per-iteration latency. Run through the run_benchmarks target for the JSON record.
+
+#include "AnariUsdMiddleware.h"
+#include "AnariUsdMiddleware_C.h"
+#include "HashVerifier.h"
+#include "MeshKernels.h"
+#include "MeshOptimizer.h"
+#include "MeshTriangulator.h"
+#include "UsdProcessor.h"
+
+#include "BenchSender.h"
+#include "SceneGenerator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using namespace anari_usd_middleware;
+using namespace anari_usd_middleware::bench;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Collects per-iteration latencies and reports their percentiles as counters
+ */
+class LatencyRecorder {
+public:
+    explicit LatencyRecorder(benchmark::State& state) : state(state) {
+        samples.reserve(1024);
+    }
+
+    ~LatencyRecorder() {
+        if (samples.empty()) {
+            return;
+        }
+        std::sort(samples.begin(), samples.end());
+        state.counters["p50_ms"] = percentile(0.50) * 1e3;
+        state.counters["p99_ms"] = percentile(0.99) * 1e3;
+    }
+
+    /**
+     * Time one iteration; work outside the body is excluded (benchmarks use UseManualTime)
+     */
+    template <class Body>
+    void measure(Body&& body) {
+        const auto start = Clock::now();
+        body();
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        state.SetIterationTime(seconds);
+        samples.push_back(seconds);
+    }
+
+private:
+    double percentile(double p) const {
+        const size_t rank = static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+        return samples[std::min(rank, samples.size() - 1)];
+    }
+
+    benchmark::State& state;
+    std::vector<double> samples;
+};
+
+void reportThroughput(benchmark::State& state, size_t bytesPerIteration, size_t meshesPerIteration) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytesPerIteration));
+    if (meshesPerIteration > 0) {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(meshesPerIteration));
+        state.counters["meshes_per_second"] = benchmark::Counter(
+            static_cast<double>(state.iterations()) * static_cast<double>(meshesPerIteration),
+            benchmark::Counter::kIsRate);
+    }
+}
+
+std::filesystem::path benchDirectory() {
+    std::error_code ec;
+#ifdef _WIN32
+    const std::string suffix = "jusync_bench";
+#else
+    const std::string suffix = "jusync_bench_" + std::to_string(::getpid());
+#endif
+    const auto dir = std::filesystem::temp_directory_path(ec) / suffix;
+    std::filesystem::create_directories(dir, ec);
+    return dir;
+}
+
+bool readFile(const std::string& path, std::vector<uint8_t>& out) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    out.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(out.data()), static_cast<std::streamsize>(out.size()));
+    return static_cast<bool>(file);
+}
+
+/**
+ * TCP port for the middleware instances; JUSYNC_BENCH_PORT moves the range if it is taken
+ */
+int benchPort(int offset) {
+    const char* base = std::getenv("JUSYNC_BENCH_PORT");
+    return (base ? std::atoi(base) : 55600) + offset;
+}
+
+SceneOptions sceneFromArgs(const benchmark::State& state) {
+    SceneOptions options;
+    options.meshCount = static_cast<size_t>(state.range(0));
+    options.verticesPerMesh = static_cast<size_t>(state.range(1));
+    return options;
+}
+
+// Scene shapes: {meshes, vertices per mesh}
+const std::vector<std::pair<int64_t, int64_t>> SCENE_SHAPES = {
+    {1, 1024}, {64, 1024}, {512, 1024}, {1, 65536}, {16, 65536}, {1, 262144}};
+
+void sceneArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"meshes", "vertices"});
+    for (const auto& shape : SCENE_SHAPES) {
+        b->Args({shape.first, shape.second});
+    }
+}
+
+// ------------------------------------------------------------------------------------------
+// USD loading
+// ------------------------------------------------------------------------------------------
+
+void BM_LoadUSDBuffer_Usda(benchmark::State& state) {
+    SceneOptions options = sceneFromArgs(state);
+    options.textures = state.range(2) != 0;
+    const Scene scene = generateScene(options);
+
+    UsdProcessor processor;
+    LatencyRecorder latency(state);
+    std::vector<UsdProcessor::MeshData> meshes;
+    for (auto _ : state) {
+        // Parsed layers are cached by content; every iteration parses from scratch
+        processor.clearLayerCache();
+        latency.measure([&] {
+            if (!processor.LoadUSDBuffer(scene.root, scene.rootName, meshes)) {
+                state.SkipWithError("LoadUSDBuffer failed");
+            }
+        });
+        benchmark::DoNotOptimize(meshes.data());
+    }
+    reportThroughput(state, scene.root.size(), meshes.size());
+}
+BENCHMARK(BM_LoadUSDBuffer_Usda)
+    ->Apply([](benchmark::internal::Benchmark* b) {
+        b->ArgNames({"meshes", "vertices", "textures"});
+        for (const auto& shape : SCENE_SHAPES) {
+            b->Args({shape.first, shape.second, 0});
+        }
+        b->Args({64, 1024, 1});
+        b->Args({16, 65536, 1});
+    })
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+void BM_LoadUSDFromDisk_References(benchmark::State& state) {
+    SceneOptions options = sceneFromArgs(state);
+    options.references = true;
+    options.textures = state.range(2) != 0;
+    const Scene scene = generateScene(options);
+    const std::string rootPath = writeScene(scene, (benchDirectory() / "references").string());
+    if (rootPath.empty()) {
+        state.SkipWithError("Cannot write the scene");
+        return;
+    }
+
+    UsdProcessor processor;
+    processor.setReferenceResolutionEnabled(true);
+    LatencyRecorder latency(state);
+    std::vector<UsdProcessor::MeshData> meshes;
+    for (auto _ : state) {
+        processor.clearLayerCache();
+        latency.measure([&] {
+            if (!processor.LoadUSDFromDisk(rootPath, meshes)) {
+                state.SkipWithError("LoadUSDFromDisk failed");
+            }
+        });
+        benchmark::DoNotOptimize(meshes.data());
+    }
+    reportThroughput(state, scene.totalBytes(), meshes.size());
+}
+BENCHMARK(BM_LoadUSDFromDisk_References)
+    ->ArgNames({"meshes", "vertices", "textures"})
+    ->Args({16, 1024, 0})
+    ->Args({256, 1024, 0})
+    ->Args({16, 65536, 0})
+    ->Args({64, 1024, 1})
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+// tinyusdz cannot write crate files reliably, so USDC input comes from a file supplied by the user
+void BM_LoadUSDBuffer_Usdc(benchmark::State& state) {
+    const char* path = std::getenv("JUSYNC_BENCH_USDC");
+    std::vector<uint8_t> buffer;
+    if (!path || !readFile(path, buffer)) {
+        state.SkipWithError("Set JUSYNC_BENCH_USDC to a .usdc file");
+        return;
+    }
+    const std::string fileName = std::filesystem::path(path).filename().string();
+
+    UsdProcessor processor;
+    LatencyRecorder latency(state);
+    std::vector<UsdProcessor::MeshData> meshes;
+    for (auto _ : state) {
+        processor.clearLayerCache();
+        latency.measure([&] {
+            if (!processor.LoadUSDBuffer(buffer, fileName, meshes)) {
+                state.SkipWithError("LoadUSDBuffer failed");
+            }
+        });
+        benchmark::DoNotOptimize(meshes.data());
+    }
+    reportThroughput(state, buffer.size(), meshes.size());
+}
+BENCHMARK(BM_LoadUSDBuffer_Usdc)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+// ------------------------------------------------------------------------------------------
+// ExtractMeshData stages, driven directly so parsing does not dominate
+// ------------------------------------------------------------------------------------------
+
+void BM_Stage_Triangulate(benchmark::State& state) {
+    const GridMesh grid = generateGrid(static_cast<size_t>(state.range(0)), 1);
+    const size_t rangeCount = static_cast<size_t>(state.range(1));
+
+    triangulate::Plan plan;
+    std::vector<uint32_t> indices;
+    std::vector<float> normals;
+    std::vector<size_t> written;
+    LatencyRecorder latency(state);
+    for (auto _ : state) {
+        latency.measure([&] {
+            triangulate::planFaceRanges(grid.faceVertexCounts.data(), grid.faceCount(),
+                                        grid.faceVertexIndices.size(), rangeCount, plan);
+            indices.resize(plan.indexCount);
+            normals.assign(grid.points.size(), 0.0f);
+            written.resize(plan.ranges.size());
+            // Ranges run back to back here; this measures the sweep, not thread scaling
+            for (size_t r = 0; r < plan.ranges.size(); ++r) {
+                written[r] = triangulate::sweepFaceRange(grid.faceVertexCounts.data(), grid.faceVertexIndices.data(),
+                                                         plan.ranges[r], grid.points.data(), grid.vertexCount(),
+                                                         indices.data(), normals.data());
+            }
+            triangulate::compactRanges(indices.data(), plan.ranges.data(), written.data(), plan.ranges.size());
+            triangulate::normalizeNormals(normals.data(), grid.vertexCount());
+        });
+        benchmark::DoNotOptimize(indices.data());
+        benchmark::DoNotOptimize(normals.data());
+    }
+    reportThroughput(state, grid.faceVertexIndices.size() * sizeof(int32_t) + grid.points.size() * sizeof(float), 1);
+}
+BENCHMARK(BM_Stage_Triangulate)
+    ->ArgNames({"vertices", "ranges"})
+    ->ArgsProduct({{16384, 1048576}, {1, 8}})
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_Stage_Transform(benchmark::State& state) {
+    const GridMesh grid = generateGrid(static_cast<size_t>(state.range(0)), 2);
+    // Column-major rotation about Y by 90 degrees plus a translation
+    const float matrix[16] = {0, 0, -1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 2, 3, 4, 1};
+    std::vector<float> points(grid.points.size());
+    std::vector<float> normals(grid.normals.size());
+
+    LatencyRecorder latency(state);
+    for (auto _ : state) {
+        latency.measure([&] {
+            kernels::transformPoints(matrix, grid.points.data(), points.data(), grid.vertexCount());
+            kernels::transformNormals(matrix, grid.normals.data(), normals.data(), grid.vertexCount());
+            bool finite = kernels::allFinite(points.data(), points.size());
+            benchmark::DoNotOptimize(finite);
+        });
+        benchmark::DoNotOptimize(points.data());
+        benchmark::DoNotOptimize(normals.data());
+    }
+    state.SetLabel(kernels::instructionSetName(kernels::activeInstructionSet()));
+    reportThroughput(state, (grid.points.size() + grid.normals.size()) * sizeof(float), 1);
+}
+BENCHMARK(BM_Stage_Transform)
+    ->ArgName("vertices")
+    ->Arg(16384)
+    ->Arg(1048576)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_Stage_Optimize(benchmark::State& state) {
+    const GridMesh grid = generateGrid(static_cast<size_t>(state.range(0)), 3);
+    triangulate::Plan plan;
+    triangulate::planFaceRanges(grid.faceVertexCounts.data(), grid.faceCount(), grid.faceVertexIndices.size(), 1, plan);
+    std::vector<uint32_t> triangulated(plan.indexCount);
+    triangulate::sweepFaceRange(grid.faceVertexCounts.data(), grid.faceVertexIndices.data(), plan.ranges[0],
+                                grid.points.data(), grid.vertexCount(), triangulated.data(), nullptr);
+
+    const size_t vertexCount = grid.vertexCount();
+    const optimize::VertexStream streams[] = {{grid.points.data(), 3}, {grid.normals.data(), 3}, {grid.uvs.data(), 2}};
+    std::vector<uint32_t> indices;
+    std::vector<uint32_t> remap(vertexCount);
+
+    LatencyRecorder latency(state);
+    for (auto _ : state) {
+        indices = triangulated;
+        latency.measure([&] {
+            optimize::weldVertices(streams, 3, vertexCount, 0.0f, remap.data());
+            optimize::optimizeVertexCache(indices.data(), indices.size(), vertexCount);
+            optimize::optimizeOverdraw(indices.data(), indices.size(), grid.points.data(), vertexCount);
+            optimize::optimizeVertexFetch(indices.data(), indices.size(), vertexCount, remap.data());
+        });
+        benchmark::DoNotOptimize(indices.data());
+    }
+    state.counters["acmr"] = static_cast<double>(optimize::countCacheMisses(indices.data(), indices.size(), vertexCount)) /
+                             static_cast<double>(indices.size() / 3);
+    reportThroughput(state, triangulated.size() * sizeof(uint32_t), 1);
+}
+BENCHMARK(BM_Stage_Optimize)
+    ->ArgName("vertices")
+    ->Arg(16384)
+    ->Arg(262144)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+// ------------------------------------------------------------------------------------------
+// Hashing
+// ------------------------------------------------------------------------------------------
+
+HashVerifier::HashAlgorithm algorithmFromArg(int64_t arg) {
+    return arg == 0 ? HashVerifier::HashAlgorithm::Sha256 : HashVerifier::HashAlgorithm::Blake2b512;
+}
+
+std::vector<uint8_t> hashInput(size_t size) {
+    std::vector<uint8_t> data(size);
+    uint32_t state = 0x12345678u;
+    for (uint8_t& byte : data) {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+void hashArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"bytes", "blake2b"})->ArgsProduct({{64 << 10, 1 << 20, 64 << 20}, {0, 1}});
+}
+
+void BM_HashVerifier_Calculate(benchmark::State& state) {
+    const std::vector<uint8_t> data = hashInput(static_cast<size_t>(state.range(0)));
+    const auto algorithm = algorithmFromArg(state.range(1));
+    LatencyRecorder latency(state);
+    for (auto _ : state) {
+        latency.measure([&] {
+            std::string digest = HashVerifier::calculateHash(data.data(), data.size(), algorithm);
+            benchmark::DoNotOptimize(digest);
+        });
+    }
+    state.SetLabel(HashVerifier::algorithmName(algorithm));
+    reportThroughput(state, data.size(), 0);
+}
+BENCHMARK(BM_HashVerifier_Calculate)->Apply(hashArgs)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+void BM_HashVerifier_Verify(benchmark::State& state) {
+    const std::vector<uint8_t> data = hashInput(static_cast<size_t>(state.range(0)));
+    const auto algorithm = algorithmFromArg(state.range(1));
+    const std::string frame = HashVerifier::formatHashFrame(
+        algorithm, HashVerifier::calculateHash(data.data(), data.size(), algorithm));
+    LatencyRecorder latency(state);
+    for (auto _ : state) {
+        latency.measure([&] {
+            if (!HashVerifier::verifyHash(data.data(), data.size(), frame)) {
+                state.SkipWithError("verifyHash failed");
+            }
+        });
+    }
+    state.SetLabel(HashVerifier::algorithmName(algorithm));
+    reportThroughput(state, data.size(), 0);
+}
+BENCHMARK(BM_HashVerifier_Verify)->Apply(hashArgs)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+void BM_HashVerifier_Digest(benchmark::State& state) {
+    const std::vector<uint8_t> data = hashInput(static_cast<size_t>(state.range(0)));
+    ContentDigest digest{};
+    LatencyRecorder latency(state);
+    for (auto _ : state) {
+        latency.measure([&] {
+            HashVerifier::calculateDigest(data.data(), data.size(), digest);
+        });
+        benchmark::DoNotOptimize(digest.data());
+    }
+    reportThroughput(state, data.size(), 0);
+}
+BENCHMARK(BM_HashVerifier_Digest)
+    ->ArgName("bytes")
+    ->Arg(64 << 10)
+    ->Arg(64 << 20)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+// ------------------------------------------------------------------------------------------
+// C API
+// ------------------------------------------------------------------------------------------
+
+/**
+ * The C API keeps one global instance, which binds a socket; it is shared by all C API cases
+ */
+bool ensureCApi() {
+    static const bool initialized = [] {
+        const std::string endpoint = "tcp://127.0.0.1:" + std::to_string(benchPort(0));
+        return InitializeMiddleware_C(endpoint.c_str()) == 1;
+    }();
+    return initialized;
+}
+
+void cApiLoad(benchmark::State& state, bool warm) {
+    if (!ensureCApi()) {
+        state.SkipWithError("InitializeMiddleware_C failed (is the port free? see JUSYNC_BENCH_PORT)");
+        return;
+    }
+    const Scene scene = generateScene(sceneFromArgs(state));
+    CMeshData* meshes = nullptr;
+    size_t count = 0;
+    if (warm) {
+        // Fill the mesh cache, so iterations measure only the conversion into C structures
+        if (LoadUSDBuffer_C(scene.root.data(), scene.root.size(), scene.rootName.c_str(), &meshes, &count)) {
+            FreeMeshData_C(meshes, count);
+        }
+    }
+
+    LatencyRecorder latency(state);
+    for (auto _ : state) {
+        if (!warm) {
+            ClearCaches_C();
+        }
+        latency.measure([&] {
+            if (!LoadUSDBuffer_C(scene.root.data(), scene.root.size(), scene.rootName.c_str(), &meshes, &count)) {
+                state.SkipWithError("LoadUSDBuffer_C failed");
+                return;
+            }
+            FreeMeshData_C(meshes, count);
+        });
+    }
+    reportThroughput(state, scene.root.size(), count);
+}
+
+void BM_CApi_LoadUSDBuffer_Warm(benchmark::State& state) {
+    cApiLoad(state, true);
+}
+BENCHMARK(BM_CApi_LoadUSDBuffer_Warm)->Apply(sceneArgs)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+void BM_CApi_LoadUSDBuffer_Cold(benchmark::State& state) {
+    cApiLoad(state, false);
+}
+BENCHMARK(BM_CApi_LoadUSDBuffer_Cold)->Apply(sceneArgs)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+// ------------------------------------------------------------------------------------------
+// Textures
+// ------------------------------------------------------------------------------------------
+
+void BM_CreateTextureFromBuffer(benchmark::State& state) {
+    const uint32_t size = static_cast<uint32_t>(state.range(0));
+    const std::vector<uint8_t> png = generatePng(size, size, 7);
+    UsdProcessor processor;
+    LatencyRecorder latency(state);
+    for (auto _ : state) {
+        latency.measure([&] {
+            const UsdProcessor::TextureData texture = processor.CreateTextureFromBuffer(png.data(), png.size());
+            if (!texture.isValid()) {
+                state.SkipWithError("CreateTextureFromBuffer failed");
+            }
+        });
+    }
+    reportThroughput(state, png.size(), 0);
+}
+BENCHMARK(BM_CreateTextureFromBuffer)
+    ->ArgName("size")
+    ->Arg(256)
+    ->Arg(2048)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+// ------------------------------------------------------------------------------------------
+// End to end: sender -> ZeroMQ -> receive thread -> hash check -> callback -> LoadUSDBuffer
+// ------------------------------------------------------------------------------------------
+
+/**
+ * A middleware instance receiving on its own endpoint and a sender connected to it. The
+ * callback hands the latest file over to the benchmark thread.
+ */
+class Link {
+public:
+    bool open(const std::string& endpoint) {
+        if (!middleware.initialize(endpoint.c_str())) {
+            return false;
+        }
+        middleware.registerUpdateCallback([this](const AnariUsdMiddleware::FileData& file) {
+            std::lock_guard<std::mutex> lock(mutex);
+            received = file;
+            ++receivedCount;
+            ready.notify_all();
+        });
+        return middleware.startReceiving() && sender.connect(endpoint);
+    }
+
+    ~Link() {
+        sender.close();
+        middleware.shutdown();
+    }
+
+    /**
+     * Send a file under a name never used before, so the receiver does not drop it as a
+     * duplicate, and wait until the callback has seen it
+     */
+    bool roundTrip(const Scene& scene, const std::string& hash, AnariUsdMiddleware::FileData& out) {
+        const std::string name = "e2e_" + std::to_string(sent) + "_" + scene.rootName;
+        if (!sender.send(name, scene.root.data(), scene.root.size(), hash)) {
+            return false;
+        }
+        const uint64_t expected = ++sent;
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!ready.wait_for(lock, std::chrono::seconds(10), [&] { return receivedCount >= expected; })) {
+            return false;
+        }
+        out = received;
+        return true;
+    }
+
+    AnariUsdMiddleware middleware;
+    BenchSender sender;
+
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    AnariUsdMiddleware::FileData received;
+    uint64_t receivedCount = 0;
+    uint64_t sent = 0;
+};
+
+/**
+ * Links live for the whole run: the benchmark function is entered several times per case
+ */
+std::map<std::string, std::unique_ptr<Link>>& links() {
+    static std::map<std::string, std::unique_ptr<Link>> open;
+    return open;
+}
+
+Link* linkFor(const std::string& endpoint) {
+    auto& open = links();
+    auto it = open.find(endpoint);
+    if (it == open.end()) {
+        auto link = std::make_unique<Link>();
+        if (!link->open(endpoint)) {
+            return nullptr;
+        }
+        it = open.emplace(endpoint, std::move(link)).first;
+    }
+    return it->second.get();
+}
+
+void BM_EndToEnd(benchmark::State& state, const std::string& endpoint) {
+    Link* link = linkFor(endpoint);
+    if (!link) {
+        state.SkipWithError(("Cannot open " + endpoint).c_str());
+        return;
+    }
+    const Scene scene = generateScene(sceneFromArgs(state));
+    const std::string hash = HashVerifier::calculateHash(scene.root.data(), scene.root.size());
+
+    LatencyRecorder latency(state);
+    std::vector<AnariUsdMiddleware::MeshData> meshes;
+    AnariUsdMiddleware::FileData file;
+    for (auto _ : state) {
+        // Reloads of the same content would be served from the mesh cache
+        link->middleware.clearCaches();
+        latency.measure([&] {
+            if (!link->roundTrip(scene, hash, file)) {
+                state.SkipWithError(("No reply: " + link->sender.lastReply()).c_str());
+                return;
+            }
+            if (!link->middleware.LoadUSDBuffer(file.data.data(), file.data.size(), file.filename, meshes)) {
+                state.SkipWithError("LoadUSDBuffer failed");
+            }
+        });
+    }
+    reportThroughput(state, scene.root.size(), meshes.size());
+}
+
+void endToEndArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"meshes", "vertices"})->Args({1, 1024})->Args({64, 1024})->Args({16, 65536});
+    b->UseManualTime()->Unit(benchmark::kMillisecond);
+}
+
+// inproc:// needs the receiver's ZeroMQ context, which ZmqConnector keeps private; ipc:// is
+// the closest same-host transport
+BENCHMARK_CAPTURE(BM_EndToEnd, tcp, "tcp://127.0.0.1:" + std::to_string(benchPort(1)))->Apply(endToEndArgs);
+#ifndef _WIN32
+BENCHMARK_CAPTURE(BM_EndToEnd, ipc, "ipc://" + (benchDirectory() / "e2e.ipc").string())->Apply(endToEndArgs);
+#endif
+
+} // namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    links().clear();
+    ShutdownMiddleware_C();
+
+    std::error_code ec;
+    std::filesystem::remove_all(benchDirectory(), ec);
+    return 0;
+}
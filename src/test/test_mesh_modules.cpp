@@ -0,0 +1,536 @@
+#include "MeshKernels.h"
+#include "MeshTriangulator.h"
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include "MeshContainer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Self-checking tests of the mesh processing modules; exits non-zero if any check fails
+
+using namespace anari_usd_middleware;
+
+namespace {
+
+int failedChecks = 0;
+int passedChecks = 0;
+
+void check(bool condition, const std::string& what) {
+    if (condition) {
+        ++passedChecks;
+    } else {
+        ++failedChecks;
+        std::cerr << "❌ " << what << std::endl;
+    }
+}
+
+bool nearlyEqual(float a, float b, float tolerance = 1e-5f) {
+    return std::fabs(a - b) <= tolerance * std::max(1.0f, std::max(std::fabs(a), std::fabs(b)));
+}
+
+// Regular grid in the xy plane: (cells + 1)^2 vertices, two triangles per cell
+struct GridMesh {
+    std::vector<float> points;
+    std::vector<uint32_t> indices;
+
+    explicit GridMesh(uint32_t cells) {
+        for (uint32_t y = 0; y <= cells; ++y) {
+            for (uint32_t x = 0; x <= cells; ++x) {
+                points.insert(points.end(), {static_cast<float>(x), static_cast<float>(y), 0.0f});
+            }
+        }
+        for (uint32_t y = 0; y < cells; ++y) {
+            for (uint32_t x = 0; x < cells; ++x) {
+                const uint32_t v = y * (cells + 1) + x;
+                indices.insert(indices.end(), {v, v + 1, v + cells + 2, v, v + cells + 2, v + cells + 1});
+            }
+        }
+    }
+
+    size_t vertexCount() const { return points.size() / 3; }
+};
+
+std::vector<std::array<uint32_t, 3>> sortedTriangles(const uint32_t* indices, size_t indexCount) {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (size_t i = 0; i + 2 < indexCount; i += 3) {
+        triangles.push_back({indices[i], indices[i + 1], indices[i + 2]});
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+// ---------------------------------------------------------------------------
+// MeshKernels: every SIMD variant against the scalar reference
+// ---------------------------------------------------------------------------
+
+void testKernels() {
+    std::cout << "Testing MeshKernels..." << std::endl;
+    const kernels::InstructionSet original = kernels::activeInstructionSet();
+
+    check(kernels::setInstructionSet(kernels::InstructionSet::Scalar), "scalar kernels are always available");
+    check(kernels::activeInstructionSet() == kernels::InstructionSet::Scalar, "dispatch switches to scalar");
+    check(std::string(kernels::instructionSetName(kernels::InstructionSet::Avx2)) == "AVX2",
+          "instruction set names");
+
+    // Counts around every vector width, so the remainder loops are covered too
+    constexpr size_t MAX_COUNT = 37;
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> values(-4.0f, 4.0f);
+    std::uniform_real_distribution<float> channels(-0.5f, 1.5f);
+
+    std::vector<float> vectors(MAX_COUNT * 3);
+    std::vector<float> colors(MAX_COUNT * 4);
+    for (float& v : vectors) v = values(random);
+    for (float& c : colors) c = channels(random);
+    colors[5] = std::numeric_limits<float>::quiet_NaN();
+
+    const float matrix[16] = {0.8f, 0.1f, -0.3f, 0.0f,  -0.2f, 1.2f, 0.4f, 0.0f,
+                              0.5f, -0.6f, 0.9f, 0.0f,  3.0f, -2.0f, 7.5f, 1.0f};
+
+    // Scalar reference for every count, plus in-place (out == in) for the largest
+    std::vector<std::vector<float>> refPoints(MAX_COUNT + 1), refNormals(MAX_COUNT + 1);
+    std::vector<std::vector<uint8_t>> refRgba(MAX_COUNT + 1), refBgra(MAX_COUNT + 1);
+    for (size_t n = 0; n <= MAX_COUNT; ++n) {
+        refPoints[n].assign(n * 3, 0.0f);
+        refNormals[n].assign(n * 3, 0.0f);
+        refRgba[n].assign(n * 4, 0);
+        refBgra[n].assign(n * 4, 0);
+        kernels::transformPoints(matrix, vectors.data(), refPoints[n].data(), n);
+        kernels::transformNormals(matrix, vectors.data(), refNormals[n].data(), n);
+        kernels::packColors(colors.data(), refRgba[n].data(), n, kernels::ColorOrder::Rgba);
+        kernels::packColors(colors.data(), refBgra[n].data(), n, kernels::ColorOrder::Bgra);
+    }
+    check(refRgba[MAX_COUNT][5] == 0, "NaN channel packs to 0");
+    check(refBgra[MAX_COUNT][0] == refRgba[MAX_COUNT][2] && refBgra[MAX_COUNT][2] == refRgba[MAX_COUNT][0],
+          "BGRA swaps red and blue");
+
+    const kernels::InstructionSet variants[] = {kernels::InstructionSet::Scalar, kernels::InstructionSet::Sse2,
+                                                kernels::InstructionSet::Avx2, kernels::InstructionSet::Neon};
+    for (kernels::InstructionSet isa : variants) {
+        if (!kernels::setInstructionSet(isa)) {
+            std::cout << "  " << kernels::instructionSetName(isa) << ": not supported, skipped" << std::endl;
+            continue;
+        }
+        const std::string name = kernels::instructionSetName(isa);
+        check(kernels::activeInstructionSet() == isa, name + ": dispatch table selected");
+
+        bool pointsMatch = true, normalsMatch = true, colorsMatch = true, finiteMatch = true;
+        for (size_t n = 0; n <= MAX_COUNT; ++n) {
+            std::vector<float> points(n * 3), normals(n * 3);
+            std::vector<uint8_t> rgba(n * 4), bgra(n * 4);
+            kernels::transformPoints(matrix, vectors.data(), points.data(), n);
+            kernels::transformNormals(matrix, vectors.data(), normals.data(), n);
+            kernels::packColors(colors.data(), rgba.data(), n, kernels::ColorOrder::Rgba);
+            kernels::packColors(colors.data(), bgra.data(), n, kernels::ColorOrder::Bgra);
+            for (size_t i = 0; i < n * 3; ++i) {
+                pointsMatch &= nearlyEqual(points[i], refPoints[n][i]);
+                normalsMatch &= nearlyEqual(normals[i], refNormals[n][i]);
+            }
+            colorsMatch &= rgba == refRgba[n] && bgra == refBgra[n];
+
+            // A single non-finite value anywhere, including in the tail, must be found
+            std::vector<float> finite(vectors.begin(), vectors.begin() + n * 3);
+            finiteMatch &= kernels::allFinite(finite.data(), finite.size());
+            for (size_t i = 0; i < finite.size(); ++i) {
+                const float saved = finite[i];
+                finite[i] = (i % 2) ? std::numeric_limits<float>::infinity()
+                                    : std::numeric_limits<float>::quiet_NaN();
+                finiteMatch &= !kernels::allFinite(finite.data(), finite.size());
+                finite[i] = saved;
+            }
+        }
+        check(pointsMatch, name + ": transformPoints matches scalar for counts 0-37");
+        check(normalsMatch, name + ": transformNormals matches scalar for counts 0-37");
+        check(colorsMatch, name + ": packColors matches scalar for counts 0-37");
+        check(finiteMatch, name + ": allFinite finds every non-finite position");
+
+        std::vector<float> inPlace(vectors);
+        kernels::transformPoints(matrix, inPlace.data(), inPlace.data(), MAX_COUNT);
+        bool inPlaceMatch = true;
+        for (size_t i = 0; i < inPlace.size(); ++i) {
+            inPlaceMatch &= nearlyEqual(inPlace[i], refPoints[MAX_COUNT][i]);
+        }
+        check(inPlaceMatch, name + ": transformPoints in place");
+
+        const float zero[3] = {0.0f, 0.0f, 0.0f};
+        float collapsed[3];
+        kernels::transformNormals(matrix, zero, collapsed, 1);
+        check(collapsed[0] == 0.0f && collapsed[1] == 1.0f && collapsed[2] == 0.0f,
+              name + ": zero-length normal becomes (0, 1, 0)");
+    }
+
+    kernels::setInstructionSet(original);
+}
+
+// ---------------------------------------------------------------------------
+// MeshTriangulator
+// ---------------------------------------------------------------------------
+
+// Triangulate with the given number of ranges, the way ExtractMeshData does
+std::vector<uint32_t> triangulateAll(const std::vector<int32_t>& counts, const std::vector<int32_t>& corners,
+                                     size_t vertexCount, size_t rangeCount, triangulate::Plan& plan) {
+    triangulate::planFaceRanges(counts.data(), counts.size(), corners.size(), rangeCount, plan);
+    std::vector<uint32_t> indices(plan.indexCount);
+    std::vector<size_t> written(plan.ranges.size());
+    for (size_t r = 0; r < plan.ranges.size(); ++r) {
+        written[r] = triangulate::sweepFaceRange(counts.data(), corners.data(), plan.ranges[r], nullptr,
+                                                 vertexCount, indices.data(), nullptr);
+    }
+    indices.resize(triangulate::compactRanges(indices.data(), plan.ranges.data(), written.data(),
+                                              plan.ranges.size()));
+    return indices;
+}
+
+void testTriangulator() {
+    std::cout << "Testing MeshTriangulator..." << std::endl;
+
+    // Triangle, quad, a 2-corner face (skipped), a pentagon, a 101-corner face (skipped), a triangle
+    std::vector<int32_t> counts = {3, 4, 2, 5, triangulate::MAX_FACE_VERTICES + 1, 3};
+    std::vector<int32_t> corners = {0, 1, 2,  1, 3, 4, 2,  5, 6,  0, 2, 4, 6, 8};
+    corners.insert(corners.end(), triangulate::MAX_FACE_VERTICES + 1, 0);
+    corners.insert(corners.end(), {7, 8, 9});
+    const size_t vertexCount = 10;
+
+    triangulate::Plan plan;
+    std::vector<uint32_t> single = triangulateAll(counts, corners, vertexCount, 1, plan);
+    check(plan.skippedFaces == 2, "faces with fewer than 3 or too many corners are skipped");
+    check(!plan.truncated, "complete corner data is not truncated");
+    check(plan.indexCount == 3 + 6 + 9 + 3, "plan sizes the index buffer exactly");
+    const std::vector<uint32_t> expected = {0, 1, 2,  1, 3, 4,  1, 4, 2,  0, 2, 4,  0, 4, 6,  0, 6, 8,  7, 8, 9};
+    check(single == expected, "fan triangulation of every valid face");
+
+    for (size_t rangeCount : {2, 3, 6, 64}) {
+        std::vector<uint32_t> split = triangulateAll(counts, corners, vertexCount, rangeCount, plan);
+        check(split == expected && !plan.ranges.empty() && plan.ranges.size() <= rangeCount,
+              "split into " + std::to_string(rangeCount) + " ranges gives the same triangles");
+    }
+
+    // Out-of-range corners drop only the triangles that use them, and compaction closes the gaps
+    std::vector<int32_t> badCorners = corners;
+    badCorners[6] = 99;   // Last quad corner: only the second quad triangle uses it
+    badCorners[9] = -1;   // First pentagon corner: every pentagon triangle uses it
+    std::vector<uint32_t> filtered = triangulateAll(counts, badCorners, vertexCount, 3, plan);
+    check(plan.indexCount == expected.size(), "bounds filtering does not change the plan");
+    check(filtered == std::vector<uint32_t>({0, 1, 2,  1, 3, 4,  7, 8, 9}),
+          "triangles with out-of-range or negative indices are dropped and compacted");
+
+    // Corner data ending mid-face drops that face and all later ones
+    std::vector<int32_t> shortCorners(corners.begin(), corners.begin() + 12);
+    std::vector<uint32_t> truncated = triangulateAll(counts, shortCorners, vertexCount, 2, plan);
+    check(plan.truncated, "short corner data is reported as truncated");
+    check(truncated == std::vector<uint32_t>({0, 1, 2,  1, 3, 4,  1, 4, 2}),
+          "faces before the truncation are kept");
+
+    triangulate::planFaceRanges(counts.data(), 0, corners.size(), 4, plan);
+    check(plan.ranges.empty() && plan.indexCount == 0, "no faces give an empty plan");
+
+    // Normals of a unit quad in the xy plane; vertex 4 is unreferenced
+    const std::vector<float> points = {0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0,  5, 5, 5};
+    const std::vector<int32_t> quadCounts = {4};
+    const std::vector<int32_t> quadCorners = {0, 1, 2, 3};
+    triangulate::planFaceRanges(quadCounts.data(), 1, quadCorners.size(), 1, plan);
+    std::vector<uint32_t> quadIndices(plan.indexCount);
+    std::vector<float> normals(points.size(), 0.0f);
+    triangulate::sweepFaceRange(quadCounts.data(), quadCorners.data(), plan.ranges[0], points.data(), 5,
+                                quadIndices.data(), normals.data());
+    triangulate::normalizeNormals(normals.data(), 5);
+    bool facingUp = true;
+    for (size_t v = 0; v < 4; ++v) {
+        facingUp &= nearlyEqual(normals[v * 3], 0.0f) && nearlyEqual(normals[v * 3 + 1], 0.0f) &&
+                    nearlyEqual(normals[v * 3 + 2], 1.0f);
+    }
+    check(facingUp, "accumulated normals of a counter-clockwise quad point along +z");
+    check(normals[12] == 0.0f && normals[13] == 1.0f && normals[14] == 0.0f,
+          "unreferenced vertex gets the (0, 1, 0) fallback normal");
+}
+
+// ---------------------------------------------------------------------------
+// MeshSimplifier
+// ---------------------------------------------------------------------------
+
+void testSimplifier() {
+    std::cout << "Testing MeshSimplifier..." << std::endl;
+
+    GridMesh grid(64);
+    std::vector<float> colors(grid.vertexCount() * 4, 0.5f);
+    lod::MeshView view;
+    view.points = grid.points.data();
+    view.vertexCount = grid.vertexCount();
+    view.indices = grid.indices.data();
+    view.indexCount = grid.indices.size();
+    view.colors = colors.data();
+
+    lod::SimplifiedMesh coarse;
+    check(lod::simplifyToTarget(view, 512, coarse), "simplifyToTarget succeeds on a grid");
+    const size_t inputTriangles = grid.indices.size() / 3;
+    check(coarse.triangleCount() > 0 && coarse.triangleCount() < inputTriangles,
+          "simplified mesh has fewer triangles than the input");
+    check(coarse.triangleCount() <= 512 * 4 && coarse.triangleCount() >= 512 / 4,
+          "simplified triangle count is near the target");
+    check(coarse.colors.size() == coarse.vertexCount() * 4 && coarse.normals.empty() && coarse.uvs.empty(),
+          "only the attributes present in the input are produced");
+
+    bool indicesValid = true;
+    for (uint32_t index : coarse.indices) {
+        indicesValid &= index < coarse.vertexCount();
+    }
+    check(indicesValid, "simplified indices are in range");
+
+    bool insideBounds = true, colorsAveraged = true, noCollapsed = true;
+    for (size_t v = 0; v < coarse.vertexCount(); ++v) {
+        insideBounds &= coarse.points[v * 3] >= 0.0f && coarse.points[v * 3] <= 64.0f &&
+                        coarse.points[v * 3 + 1] >= 0.0f && coarse.points[v * 3 + 1] <= 64.0f &&
+                        coarse.points[v * 3 + 2] == 0.0f;
+    }
+    for (float c : coarse.colors) {
+        colorsAveraged &= nearlyEqual(c, 0.5f);
+    }
+    for (size_t t = 0; t < coarse.triangleCount(); ++t) {
+        const uint32_t* tri = &coarse.indices[t * 3];
+        noCollapsed &= tri[0] != tri[1] && tri[1] != tri[2] && tri[0] != tri[2];
+    }
+    check(insideBounds, "clustered vertices stay within the input bounds");
+    check(colorsAveraged, "cluster attributes are the average of their members");
+    check(noCollapsed, "triangles collapsed inside a cell are dropped");
+
+    lod::SimplifiedMesh coarser;
+    check(lod::clusterVertices(view, 4, coarser) && coarser.triangleCount() < coarse.triangleCount(),
+          "a coarser grid gives fewer triangles");
+
+    lod::MeshView invalid = view;
+    invalid.points = nullptr;
+    check(!lod::clusterVertices(invalid, 8, coarser), "missing points are rejected");
+    check(!lod::clusterVertices(view, 1, coarser), "grid resolution below 2 is rejected");
+}
+
+// ---------------------------------------------------------------------------
+// MeshOptimizer
+// ---------------------------------------------------------------------------
+
+void testOptimizer() {
+    std::cout << "Testing MeshOptimizer..." << std::endl;
+
+    GridMesh grid(32);
+    const size_t vertexCount = grid.vertexCount();
+
+    // Shuffle the triangles so the cache order has something to improve
+    std::vector<uint32_t> shuffled = grid.indices;
+    {
+        std::vector<size_t> order(shuffled.size() / 3);
+        for (size_t t = 0; t < order.size(); ++t) order[t] = t;
+        std::shuffle(order.begin(), order.end(), std::mt19937(42));
+        for (size_t t = 0; t < order.size(); ++t) {
+            std::copy_n(&grid.indices[order[t] * 3], 3, &shuffled[t * 3]);
+        }
+    }
+    const auto originalTriangles = sortedTriangles(shuffled.data(), shuffled.size());
+    const size_t missesBefore = optimize::countCacheMisses(shuffled.data(), shuffled.size(), vertexCount);
+
+    std::vector<uint32_t> optimized = shuffled;
+    check(optimize::optimizeVertexCache(optimized.data(), optimized.size(), vertexCount),
+          "optimizeVertexCache succeeds");
+    check(sortedTriangles(optimized.data(), optimized.size()) == originalTriangles,
+          "Tipsify keeps every triangle and its winding");
+    const size_t missesAfter = optimize::countCacheMisses(optimized.data(), optimized.size(), vertexCount);
+    check(missesAfter < missesBefore, "Tipsify reduces simulated cache misses");
+
+    check(optimize::optimizeOverdraw(optimized.data(), optimized.size(), grid.points.data(), vertexCount),
+          "optimizeOverdraw succeeds");
+    check(sortedTriangles(optimized.data(), optimized.size()) == originalTriangles,
+          "overdraw ordering keeps the triangle set");
+
+    std::vector<uint32_t> badIndices = shuffled;
+    badIndices[4] = static_cast<uint32_t>(vertexCount);
+    const std::vector<uint32_t> untouched = badIndices;
+    check(!optimize::optimizeVertexCache(badIndices.data(), badIndices.size(), vertexCount) &&
+              badIndices == untouched,
+          "out-of-range index is rejected and the buffer left unchanged");
+
+    // Welding: the two copies of each corner of a split quad merge, and +0/-0 are equal
+    const std::vector<float> points = {0, 0, 0,  1, 0, 0,  1, 1, 0,  1, 1, 0,  -0.0f, 1, 0,  0, 0, 0};
+    const optimize::VertexStream stream{points.data(), 3};
+    std::vector<uint32_t> remap(6);
+    check(optimize::weldVertices(&stream, 1, 6, 0.0f, remap.data()) == 4, "weldVertices finds 4 unique vertices");
+    check(remap == std::vector<uint32_t>({0, 1, 2, 2, 3, 0}), "welded indices follow first occurrence");
+
+    std::vector<uint32_t> quad = {0, 1, 2,  3, 4, 5,  0, 2, 3};
+    optimize::remapIndices(quad.data(), quad.size(), remap.data());
+    check(optimize::removeDegenerateTriangles(quad.data(), quad.size()) == 6,
+          "triangles that collapse after welding are removed");
+
+    std::vector<uint32_t> fetch = {4, 2, 7, 2, 7, 9};
+    std::vector<uint32_t> fetchRemap(10);
+    check(optimize::optimizeVertexFetch(fetch.data(), fetch.size(), 10, fetchRemap.data()) == 4,
+          "optimizeVertexFetch counts referenced vertices");
+    check(fetch == std::vector<uint32_t>({0, 1, 2, 1, 2, 3}) && fetchRemap[0] == optimize::INVALID_INDEX &&
+              fetchRemap[9] == 3,
+          "vertices are renumbered in order of first use");
+}
+
+// ---------------------------------------------------------------------------
+// MeshContainer
+// ---------------------------------------------------------------------------
+
+template <typename T>
+void writeAt(std::vector<uint8_t>& data, size_t offset, T value) {
+    std::memcpy(data.data() + offset, &value, sizeof(value));
+}
+
+template <typename T>
+T readAt(const std::vector<uint8_t>& data, size_t offset) {
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+void testContainer() {
+    std::cout << "Testing MeshContainer..." << std::endl;
+
+    GridMesh grid(3);
+    std::vector<float> normals(grid.vertexCount() * 3, 0.0f);
+    std::vector<float> uvs(grid.vertexCount() * 2, 0.25f);
+    std::vector<float> colors(grid.vertexCount() * 4, 1.0f);
+    std::vector<float> instances(2 * 16, 0.0f);
+    for (size_t v = 0; v < grid.vertexCount(); ++v) normals[v * 3 + 2] = 1.0f;
+    for (size_t i = 0; i < 2; ++i) instances[i * 16] = instances[i * 16 + 5] = instances[i * 16 + 10] =
+                                                   instances[i * 16 + 15] = 1.0f;
+
+    const std::vector<float> trianglePoints = {0, 0, 0,  1, 0, 0,  0, 1, 0};
+    const std::vector<uint32_t> triangleIndices = {0, 1, 2};
+
+    container::MeshView meshes[2];
+    meshes[0].elementName = "/World/Grid";
+    meshes[0].typeName = "Mesh";
+    meshes[0].points = grid.points.data();
+    meshes[0].vertexCount = grid.vertexCount();
+    meshes[0].indices = grid.indices.data();
+    meshes[0].indexCount = grid.indices.size();
+    meshes[0].normals = normals.data();
+    meshes[0].uvs = uvs.data();
+    meshes[0].colors = colors.data();
+    meshes[0].instanceTransforms = instances.data();
+    meshes[0].instanceCount = 2;
+    meshes[1].elementName = "/World/Triangle";
+    meshes[1].points = trianglePoints.data();
+    meshes[1].vertexCount = 3;
+    meshes[1].indices = triangleIndices.data();
+    meshes[1].indexCount = 3;
+
+    std::vector<uint8_t> encoded;
+    check(container::encode(meshes, 2, encoded), "encode succeeds");
+    check(encoded.size() == container::encodedSize(meshes, 2), "encodedSize matches the encoded buffer");
+    check(container::isContainer(encoded.data(), encoded.size()), "encoded buffer is detected as a container");
+
+    std::vector<container::MeshView> parsed;
+    check(container::parse(encoded.data(), encoded.size(), parsed) && parsed.size() == 2, "encoded buffer parses");
+    if (parsed.size() == 2) {
+        const container::MeshView& g = parsed[0];
+        check(g.elementName == "/World/Grid" && g.typeName == "Mesh", "names round-trip");
+        check(g.vertexCount == grid.vertexCount() && g.indexCount == grid.indices.size() && g.instanceCount == 2,
+              "counts round-trip");
+        check(std::equal(grid.points.begin(), grid.points.end(), g.points) &&
+                  std::equal(grid.indices.begin(), grid.indices.end(), g.indices) &&
+                  std::equal(normals.begin(), normals.end(), g.normals) &&
+                  std::equal(uvs.begin(), uvs.end(), g.uvs) &&
+                  std::equal(colors.begin(), colors.end(), g.colors) &&
+                  std::equal(instances.begin(), instances.end(), g.instanceTransforms),
+              "attribute blocks round-trip exactly");
+        check(reinterpret_cast<uintptr_t>(g.points) % container::BLOCK_ALIGNMENT ==
+                  reinterpret_cast<uintptr_t>(encoded.data()) % container::BLOCK_ALIGNMENT,
+              "blocks are aligned within the container");
+        const container::MeshView& t = parsed[1];
+        check(t.elementName == "/World/Triangle" && t.typeName.empty() && !t.normals && !t.uvs && !t.colors &&
+                  !t.instanceTransforms && t.instanceCount == 0,
+              "absent attributes stay absent");
+    }
+
+    std::vector<uint8_t> small(encoded.size() - 1);
+    check(container::encode(meshes, 2, small.data(), small.size()) == 0, "encode refuses too small a buffer");
+
+    container::MeshView unnamed = meshes[1];
+    unnamed.elementName = {};
+    check(container::encodedSize(&unnamed, 1) == 0, "encode refuses a mesh without a name");
+    container::MeshView partial = meshes[1];
+    partial.indexCount = 2;
+    check(container::encodedSize(&partial, 1) == 0, "encode refuses a partial triangle");
+
+    // Malformed containers must be rejected, never read out of bounds
+    auto rejects = [&](std::vector<uint8_t> data, const std::string& what) {
+        std::vector<container::MeshView> out;
+        check(!container::parse(data.data(), data.size(), out) && out.empty(), "parse rejects " + what);
+    };
+
+    std::vector<uint8_t> badMagic = encoded;
+    badMagic[0] = 'X';
+    check(!container::isContainer(badMagic.data(), badMagic.size()), "bad magic is not a container");
+    rejects(badMagic, "a bad magic");
+
+    std::vector<uint8_t> badVersion = encoded;
+    writeAt<uint16_t>(badVersion, 4, container::VERSION + 1);
+    rejects(badVersion, "an unsupported version");
+
+    rejects(std::vector<uint8_t>(encoded.begin(), encoded.end() - 1), "a truncated buffer");
+    rejects(std::vector<uint8_t>(encoded.begin(), encoded.begin() + container::HEADER_SIZE / 2),
+            "a truncated header");
+
+    std::vector<uint8_t> smallHeader = encoded;
+    writeAt<uint16_t>(smallHeader, 6, static_cast<uint16_t>(container::HEADER_SIZE - 8));
+    rejects(smallHeader, "a short header size");
+
+    std::vector<uint8_t> manyMeshes = encoded;
+    writeAt<uint32_t>(manyMeshes, 8, 1000);
+    rejects(manyMeshes, "a mesh count beyond the table");
+
+    std::vector<uint8_t> badTable = encoded;
+    writeAt<uint64_t>(badTable, 24, encoded.size() + 64);
+    rejects(badTable, "a table offset past the end");
+
+    const uint64_t tableOffset = readAt<uint64_t>(encoded, 24);
+    std::vector<uint8_t> badPoints = encoded;
+    writeAt<uint64_t>(badPoints, tableOffset + 48, encoded.size() - 4);
+    rejects(badPoints, "a points block past the end");
+
+    std::vector<uint8_t> oddIndices = encoded;
+    writeAt<uint64_t>(oddIndices, tableOffset + 32, readAt<uint64_t>(encoded, tableOffset + 32) - 1);
+    rejects(oddIndices, "an index count that is not a multiple of 3");
+
+    std::vector<uint8_t> badIndex = encoded;
+    const uint64_t indicesOffset = readAt<uint64_t>(encoded, tableOffset + 56);
+    writeAt<uint32_t>(badIndex, indicesOffset, static_cast<uint32_t>(grid.vertexCount()));
+    rejects(badIndex, "an index at the vertex count");
+
+    std::vector<uint8_t> badName = encoded;
+    writeAt<uint32_t>(badName, tableOffset + 8, static_cast<uint32_t>(container::MAX_NAME_LENGTH + 1));
+    rejects(badName, "an over-long name");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Mesh module tests ===" << std::endl;
+    std::cout << "Kernel dispatch: " << kernels::instructionSetName(kernels::activeInstructionSet()) << std::endl;
+
+    testKernels();
+    testTriangulator();
+    testSimplifier();
+    testOptimizer();
+    testContainer();
+
+    std::cout << std::endl;
+    if (failedChecks > 0) {
+        std::cerr << "❌ " << failedChecks << " of " << (failedChecks + passedChecks) << " checks failed"
+                  << std::endl;
+        return 1;
+    }
+    std::cout << "✅ All " << passedChecks << " checks passed" << std::endl;
+    return 0;
+}
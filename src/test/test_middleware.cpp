@@ -3,6 +3,7 @@
 #include <fstream>
 #include <filesystem>
 #include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <thread>
 #include <iomanip>
@@ -25,6 +26,10 @@ public:
         std::filesystem::create_directories(saveDirectory);
     }
 
+    void setReceiveIoThreads(int threads) {
+        middleware.setReceiveIoThreads(threads);
+    }
+
     bool initialize(const char* endpoint) {
         std::cout << "=== ANARI USD Middleware Processor ===" << std::endl;
         std::cout << "Initializing ZMQ connection..." << std::endl;
@@ -133,7 +138,7 @@ private:
         std::string filename = std::filesystem::path(fileData.filename).filename().string();
         std::string savePath = saveDirectory + "/" + timestamp + "_" + filename;
 
-        if (saveFileToPath(fileData.data, savePath)) {
+        if (saveFileToPath(fileData.data.data(), fileData.data.size(), savePath)) {
             std::cout << "💾 Saved to: " << savePath << std::endl;
         } else {
             std::cerr << "❌ Failed to save file: " << savePath << std::endl;
@@ -170,9 +175,11 @@ private:
         std::cout << "\n🔧 PROCESSING USD FILE" << std::endl;
         std::cout << std::string(30, '-') << std::endl;
 
+        // LoadUSDBuffer takes owned storage, so this is the one place the payload is copied
+        std::vector<uint8_t> buffer = fileData.data.toVector();
         std::vector<AnariUsdMiddleware::MeshData> meshData;
         auto startTime = std::chrono::high_resolution_clock::now();
-        bool success = middleware.LoadUSDBuffer(fileData.data, filename, meshData);
+        bool success = middleware.LoadUSDBuffer(buffer, filename, meshData);
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
 
@@ -188,7 +195,7 @@ private:
         } else {
             std::cerr << "❌ Failed to extract mesh data from: " << filename << std::endl;
             std::cerr << "⏱️ Failed after: " << duration.count() << "ms" << std::endl;
-            diagnoseUSDFile(fileData.data, filename);
+            diagnoseUSDFile(buffer, filename);
         }
     }
     void processImageFile(const AnariUsdMiddleware::FileData& fileData,
@@ -197,7 +204,8 @@ private:
         std::cout << std::string(30, '-') << std::endl;
 
         // Create texture data
-        auto textureData = middleware.CreateTextureFromBuffer(fileData.data);
+        std::vector<uint8_t> buffer = fileData.data.toVector();
+        auto textureData = middleware.CreateTextureFromBuffer(buffer);
         if (!textureData.data.empty()) {
             std::cout << "✅ Texture created successfully!" << std::endl;
             std::cout << "📐 Dimensions: " << textureData.width << "x" << textureData.height << std::endl;
@@ -206,13 +214,13 @@ private:
 
         // Extract gradient line as PNG
         std::vector<uint8_t> pngBuffer;
-        bool success = middleware.GetGradientLineAsPNGBuffer(fileData.data, pngBuffer);
+        bool success = middleware.GetGradientLineAsPNGBuffer(buffer, pngBuffer);
 
         if (success) {
             std::cout << "✅ Generated gradient PNG: " << formatBytes(pngBuffer.size()) << std::endl;
 
             std::string gradientPngPath = saveDirectory + "/" + timestamp + "_gradient_" + filename;
-            if (saveFileToPath(pngBuffer, gradientPngPath)) {
+            if (saveFileToPath(pngBuffer.data(), pngBuffer.size(), gradientPngPath)) {
                 std::cout << "💾 Saved gradient PNG: " << gradientPngPath << std::endl;
             }
         } else {
@@ -426,10 +434,10 @@ private:
         return ss.str();
     }
 
-    bool saveFileToPath(const std::vector<uint8_t>& data, const std::string& path) {
+    bool saveFileToPath(const uint8_t* data, size_t size, const std::string& path) {
         std::ofstream outfile(path, std::ios::binary);
         if (outfile.is_open()) {
-            outfile.write(reinterpret_cast<const char*>(data.data()), data.size());
+            outfile.write(reinterpret_cast<const char*>(data), size);
             outfile.close();
             return true;
         }
@@ -456,6 +464,7 @@ int main(int argc, char** argv) {
     std::string diskFilePath;
     const char* endpoint = nullptr;
     std::string saveDir = "received";
+    int ioThreads = 0;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -466,12 +475,15 @@ int main(int argc, char** argv) {
             endpoint = argv[++i];
         } else if (arg == "--save-dir" && i + 1 < argc) {
             saveDir = argv[++i];
+        } else if (arg == "--io-threads" && i + 1 < argc) {
+            ioThreads = std::atoi(argv[++i]);
         } else if (arg == "--help") {
             std::cout << "ANARI USD Middleware Test Application" << std::endl;
             std::cout << "Usage: " << argv[0] << " [options]" << std::endl;
             std::cout << "Options:" << std::endl;
             std::cout << "  --disk <file>         Test disk loading with specified USD file" << std::endl;
-            std::cout << "  --endpoint <address>  ZMQ endpoint (default: tcp://*:5556)" << std::endl;
+            std::cout << "  --endpoint <address>  ZMQ endpoint, or several separated by commas (default: tcp://*:5556)" << std::endl;
+            std::cout << "  --io-threads <n>      ZMQ I/O threads (default: 1)" << std::endl;
             std::cout << "  --save-dir <path>     Directory to save received files (default: received)" << std::endl;
             std::cout << "  --help                Show this help message" << std::endl;
             return 0;
@@ -498,6 +510,9 @@ int main(int argc, char** argv) {
     }
 
     // Network mode
+    if (ioThreads > 0) {
+        processor.setReceiveIoThreads(ioThreads);
+    }
     if (!processor.initialize(endpoint)) {
         std::cerr << "❌ Failed to initialize processor" << std::endl;
         return 1;
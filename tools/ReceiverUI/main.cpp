@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <string>
@@ -44,6 +45,8 @@ private:
 
     // UI state
     char endpointBuffer[256] = "tcp://localhost:13456";
+    char tracePathBuffer[256] = "jusync_trace.json";
+    bool traceCapture = false;
     std::vector<std::string> logMessages;
 
     // OpenGL/ImGui state
@@ -260,11 +263,67 @@ private:
             const char* statusInfo = GetStatusInfo_C();
             ImGui::SeparatorText("Middleware Status");
             ImGui::TextWrapped("%s", statusInfo);
+
+            renderStageStats();
         }
 
         ImGui::End();
     }
 
+    void renderStageStats() {
+        ImGui::SeparatorText("Stage Latency (ms)");
+
+        CStageStats stages[32] = {};
+        const size_t count = std::min<size_t>(GetStageStats_C(stages, 32), 32);
+        if (ImGui::BeginTable("StageStats", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Stage");
+            ImGui::TableSetupColumn("Count");
+            ImGui::TableSetupColumn("Mean");
+            ImGui::TableSetupColumn("p50");
+            ImGui::TableSetupColumn("p95");
+            ImGui::TableSetupColumn("p99");
+            ImGui::TableSetupColumn("Max");
+            ImGui::TableHeadersRow();
+            for (size_t i = 0; i < count; ++i) {
+                const CStageStats& stage = stages[i];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(stage.name);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(stage.count));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", stage.count > 0 ? stage.total_ns / 1e6 / stage.count : 0.0);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", stage.p50_ns / 1e6);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", stage.p95_ns / 1e6);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", stage.p99_ns / 1e6);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", stage.max_ns / 1e6);
+            }
+            ImGui::EndTable();
+        }
+
+        if (ImGui::Button("Reset Stage Stats")) {
+            ResetStageStats_C();
+        }
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Capture Trace", &traceCapture)) {
+            SetTraceCapture_C(traceCapture ? 1 : 0, 0);
+        }
+
+        ImGui::InputText("Trace File", tracePathBuffer, sizeof(tracePathBuffer));
+        ImGui::SameLine();
+        if (ImGui::Button("Write Trace")) {
+            if (WriteTrace_C(tracePathBuffer)) {
+                addLog("Stage trace written to " + std::string(tracePathBuffer) + " (open in ui.perfetto.dev)");
+            } else {
+                addLog("Failed to write stage trace to " + std::string(tracePathBuffer));
+            }
+        }
+    }
+
     void renderFileListWindow() {
         ImGui::Begin("Received Files");
 
@@ -461,8 +520,8 @@ static void fileReceivedCallback(const CFileData* file_data) {
     g_app->filesReceived.fetch_add(1);
     g_app->totalBytesReceived.fetch_add(dataSize);
 
-    // Try to process as USD if it's a USD file
-    if (fileType == "USD" || filename.find(".usd") != std::string::npos) {
+    // Try to process as USD if it's a USD file or a binary mesh container
+    if (fileType == "USD" || fileType == "MESH" || filename.find(".usd") != std::string::npos) {
         CMeshData* meshes = nullptr;
         size_t meshCount = 0;
 
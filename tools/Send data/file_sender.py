@@ -10,14 +10,188 @@ import os
 import sys
 import time
 import json
+import math
+import struct
+import tempfile
+from array import array
 from pathlib import Path
 
+# Optional codecs: pip install zstandard lz4
+try:
+    import zstandard
+except ImportError:
+    zstandard = None
+try:
+    import lz4.frame
+except ImportError:
+    lz4 = None
+
+# Chunked transfer protocol tags (must match ZmqConnector)
+CHUNK_BEGIN_TAG = "JUSYNC_CHUNK_BEGIN"
+CHUNK_DATA_TAG = "JUSYNC_CHUNK"
+CHUNK_END_TAG = "JUSYNC_CHUNK_END"
+CHUNK_ABORT_TAG = "JUSYNC_CHUNK_ABORT"
+CAPABILITIES_TAG = "JUSYNC_CAPABILITIES"
+
+DEFAULT_CHUNK_SIZE = 4 * 1024 * 1024  # 4 MB
+MIN_CHUNK_SIZE = 4096
+MAX_CHUNK_SIZE = 64 * 1024 * 1024
+
+# Digests the receiver understands. SHA-256 is sent untagged for older receivers;
+# BLAKE2b is much faster and meant for trusted networks.
+HASH_ALGORITHMS = {
+    "sha256": (hashlib.sha256, ""),
+    "blake2b": (hashlib.blake2b, "blake2b512:"),
+}
+
+# Codecs in order of preference; "auto" asks the receiver which ones it can decode
+CODEC_PREFERENCE = ["zstd", "lz4"]
+COMPRESSION_CHOICES = ["auto"] + CODEC_PREFERENCE + ["none"]
+MIN_COMPRESS_SIZE = 64 * 1024  # Smaller files are sent as they are
+ZSTD_LEVEL = 3
+
+
+def local_codecs():
+    """Codecs this Python installation can encode"""
+    available = {"zstd": zstandard is not None, "lz4": lz4 is not None}
+    return [codec for codec in CODEC_PREFERENCE if available[codec]]
+
+
+def compress_bytes(codec, data):
+    if codec == "zstd":
+        return zstandard.ZstdCompressor(level=ZSTD_LEVEL).compress(data)
+    return lz4.frame.compress(data)
+
+
+def compress_file(codec, src, dst, block_size=1024 * 1024):
+    """Stream-compress an open file into another open file"""
+    if codec == "zstd":
+        zstandard.ZstdCompressor(level=ZSTD_LEVEL).copy_stream(src, dst)
+        return
+    compressor = lz4.frame.LZ4FrameCompressor()
+    dst.write(compressor.begin())
+    for block in iter(lambda: src.read(block_size), b''):
+        dst.write(compressor.compress(block))
+    dst.write(compressor.flush())
+
+
+# Binary mesh container (".jmesh"), see include/MeshContainer.h for the layout
+MESH_MAGIC = b"JMSH"
+MESH_VERSION = 1
+MESH_HEADER_SIZE = 64
+MESH_RECORD_SIZE = 128
+MESH_BLOCK_ALIGNMENT = 16
+MESH_HEADER = struct.Struct("<4sHHIIQQ32x")
+MESH_RECORD = struct.Struct("<QIIQQQQQQQQQQ32x")
+
+
+def _mesh_block(values, typecode):
+    block = array(typecode, values)
+    if sys.byteorder != "little":
+        block.byteswap()
+    return block.tobytes()
+
+
+def encode_mesh_container(meshes):
+    """
+    Encode meshes into a .jmesh container. Each mesh is a dict with "name", "points"
+    (flat xyz) and "indices" (three per triangle), and optionally "type_name", "normals",
+    "uvs", "colors" (rgba) and "instance_transforms" (16 floats per instance).
+    """
+    records = []
+    names = bytearray()
+    table_end = MESH_HEADER_SIZE + len(meshes) * MESH_RECORD_SIZE
+    for mesh in meshes:
+        name = mesh["name"].encode("utf-8")
+        type_name = mesh.get("type_name", "").encode("utf-8")
+        if not name or len(mesh["points"]) % 3 or not mesh["indices"] or len(mesh["indices"]) % 3:
+            raise ValueError(f"Mesh {mesh['name']!r} needs a name, points and triangles")
+        vertex_count = len(mesh["points"]) // 3
+        if max(mesh["indices"]) >= vertex_count:
+            raise ValueError(f"Mesh {mesh['name']!r} has indices out of range")
+        for key, components in (("normals", 3), ("uvs", 2), ("colors", 4)):
+            if mesh.get(key) and len(mesh[key]) != vertex_count * components:
+                raise ValueError(f"Mesh {mesh['name']!r} has {len(mesh[key])} {key} values, expected "
+                                 f"{vertex_count * components}")
+        records.append((table_end + len(names), name, type_name))
+        names += name + type_name
+
+    blocks = bytearray()
+    offset = table_end + len(names)
+    table = bytearray()
+
+    def place(data):
+        nonlocal offset
+        if not data:
+            return 0
+        padding = -offset % MESH_BLOCK_ALIGNMENT
+        blocks.extend(b"\0" * padding)
+        start = offset + padding
+        blocks.extend(data)
+        offset = start + len(data)
+        return start
+
+    for mesh, (name_offset, name, type_name) in zip(meshes, records):
+        instances = mesh.get("instance_transforms") or []
+        if len(instances) % 16:
+            raise ValueError(f"Mesh {mesh['name']!r} has a partial instance transform")
+        points_offset = place(_mesh_block(mesh["points"], "f"))
+        indices_offset = place(_mesh_block(mesh["indices"], "I"))
+        normals_offset = place(_mesh_block(mesh.get("normals") or [], "f"))
+        uvs_offset = place(_mesh_block(mesh.get("uvs") or [], "f"))
+        colors_offset = place(_mesh_block(mesh.get("colors") or [], "f"))
+        instances_offset = place(_mesh_block(instances, "f"))
+        table += MESH_RECORD.pack(name_offset, len(name), len(type_name), name_offset + len(name),
+                                  len(mesh["points"]) // 3, len(mesh["indices"]), len(instances) // 16,
+                                  points_offset, indices_offset, normals_offset, uvs_offset,
+                                  colors_offset, instances_offset)
+
+    blocks.extend(b"\0" * (-offset % MESH_BLOCK_ALIGNMENT))
+    total = offset + (-offset % MESH_BLOCK_ALIGNMENT)
+    header = MESH_HEADER.pack(MESH_MAGIC, MESH_VERSION, MESH_HEADER_SIZE, len(meshes), 0, total, MESH_HEADER_SIZE)
+    return bytes(header + table + names + blocks)
+
+
+def make_test_sphere(segments=32, name="TestSphere"):
+    """UV sphere with normals and uvs, as an encode_mesh_container() mesh"""
+    rings = max(segments // 2, 2)
+    points, normals, uvs, indices = [], [], [], []
+    for ring in range(rings + 1):
+        theta = math.pi * ring / rings
+        for segment in range(segments + 1):
+            phi = 2.0 * math.pi * segment / segments
+            normal = (math.sin(theta) * math.cos(phi), math.cos(theta), math.sin(theta) * math.sin(phi))
+            points.extend(100.0 * c for c in normal)
+            normals.extend(normal)
+            uvs.extend((segment / segments, ring / rings))
+    stride = segments + 1
+    for ring in range(rings):
+        for segment in range(segments):
+            a = ring * stride + segment
+            b = a + stride
+            indices.extend((a, b, a + 1, a + 1, b, b + 1))
+    return {"name": name, "type_name": "Mesh", "points": points, "indices": indices,
+            "normals": normals, "uvs": uvs}
+
+
+class TransferInterrupted(Exception):
+    """Raised when a chunked transfer should be resumed on a fresh connection"""
+
+
 class ANARIUSDClient:
-    def __init__(self, endpoint="tcp://localhost:5556"):
+    def __init__(self, endpoint="tcp://localhost:5556", hash_algorithm="sha256", compression="auto"):
+        if hash_algorithm not in HASH_ALGORITHMS:
+            raise ValueError(f"Unsupported hash algorithm: {hash_algorithm}")
+        if compression not in COMPRESSION_CHOICES:
+            raise ValueError(f"Unsupported compression: {compression}")
         self.endpoint = endpoint
+        self.hash_algorithm = hash_algorithm
+        self.compression = compression
+        self.negotiated_codec = None  # Cached result of the capabilities query
         self.context = zmq.Context()
         self.socket = None
         self.connected = False
+        self.reconnect_count = 0
         
     def connect(self):
         """Connect to the ANARI USD Middleware server"""
@@ -29,7 +203,7 @@ class ANARIUSDClient:
             self.socket.setsockopt(zmq.SNDTIMEO, 5000)  # 5 second send timeout
             
             # Set identity for debugging (optional)
-            identity = f"client_{os.getpid()}_{int(time.time())}"
+            identity = f"client_{os.getpid()}_{int(time.time())}_{self.reconnect_count}"
             self.socket.setsockopt_string(zmq.IDENTITY, identity)
             
             print(f"🔌 Connecting to {self.endpoint}...")
@@ -51,14 +225,63 @@ class ANARIUSDClient:
         self.connected = False
         print("🔌 Disconnected")
     
+    def reconnect(self):
+        """Replace the socket with a fresh one, dropping any replies still in flight"""
+        if self.socket:
+            self.socket.close(linger=0)
+            self.socket = None
+        self.connected = False
+        self.reconnect_count += 1
+        return self.connect()
+
     def calculate_sha256(self, data):
         """Calculate SHA256 hash of data"""
         return hashlib.sha256(data).hexdigest()
+
+    def calculate_hash_frame(self, data):
+        """Hash data with the selected algorithm and return the frame to send"""
+        factory, prefix = HASH_ALGORITHMS[self.hash_algorithm]
+        return prefix + factory(data).hexdigest()
+
+    def calculate_hash_frame_file(self, file_path, block_size=1024 * 1024):
+        """Like calculate_hash_frame, but reads the file in blocks instead of all at once"""
+        factory, prefix = HASH_ALGORITHMS[self.hash_algorithm]
+        digest = factory()
+        with open(file_path, 'rb') as f:
+            for block in iter(lambda: f.read(block_size), b''):
+                digest.update(block)
+        return prefix + digest.hexdigest()
     
+    def query_capabilities(self):
+        """Ask the server which codecs it decodes; older servers answer without a codec list"""
+        try:
+            self.socket.send_string(CAPABILITIES_TAG)
+            return self._recv_json().get("codecs", [])
+        except zmq.Again:
+            # A late reply would be mistaken for the next answer, so start over
+            self.reconnect()
+            return []
+
+    def select_codec(self):
+        """Resolve the --compress choice to a codec both sides support, or None"""
+        if self.compression == "none":
+            return None
+        if self.compression != "auto":
+            if self.compression not in local_codecs():
+                print(f"⚠️ Python module for {self.compression} not installed, sending uncompressed")
+                return None
+            return self.compression
+        if self.negotiated_codec is None:
+            remote = self.query_capabilities()
+            shared = [codec for codec in local_codecs() if codec in remote]
+            self.negotiated_codec = shared[0] if shared else ""
+            print(f"🗜️ Compression: {self.negotiated_codec or 'none'} (server supports: {', '.join(remote) or 'none'})")
+        return self.negotiated_codec or None
+
     def send_file(self, file_path):
         """
         Send a file to the middleware server
-        Expected message format: [Filename] [Content] [Hash]
+        Expected message format: [Filename] [Content] [Hash] ([Encoding])
         """
         if not self.connected:
             print("❌ Not connected to server")
@@ -73,20 +296,55 @@ class ANARIUSDClient:
                 
             with open(file_path, 'rb') as f:
                 file_data = f.read()
-            
+            return self.send_file_data(file_path.name, file_data)
+
+        except Exception as e:
+            print(f"❌ Error sending file: {e}")
+            return False
+
+    def send_meshes(self, filename, meshes):
+        """Encode meshes (see encode_mesh_container) and send them as a .jmesh file"""
+        if not filename.endswith(".jmesh"):
+            filename += ".jmesh"
+        try:
+            data = encode_mesh_container(meshes)
+        except (KeyError, ValueError) as e:
+            print(f"❌ Cannot encode meshes: {e}")
+            return False
+        return self.send_file_data(filename, data)
+
+    def send_file_data(self, filename, file_data):
+        """Send in-memory file content as [Filename] [Content] [Hash] ([Encoding])"""
+        if not self.connected:
+            print("❌ Not connected to server")
+            return False
+
+        try:
             # Calculate hash
-            file_hash = self.calculate_sha256(file_data)
-            filename = file_path.name
+            file_hash = self.calculate_hash_frame(file_data)
             
             print(f"\n📤 SENDING FILE")
             print(f"📄 Filename: {filename}")
             print(f"📊 Size: {self.format_bytes(len(file_data))}")
             print(f"🔐 Hash: {file_hash[:16]}...")
             
-            # Send multi-part message: [Filename] [Content] [Hash]
+            # The hash always covers the uncompressed bytes
+            codec = self.select_codec() if len(file_data) >= MIN_COMPRESS_SIZE else None
+            payload = compress_bytes(codec, file_data) if codec else file_data
+            if codec and len(payload) >= len(file_data):
+                codec, payload = None, file_data
+            if codec:
+                print(f"🗜️ {codec}: {self.format_bytes(len(payload))} on the wire "
+                      f"({len(payload) / len(file_data):.1%})")
+
+            # Send multi-part message: [Filename] [Content] [Hash] ([Encoding])
             self.socket.send_string(filename, zmq.SNDMORE)
-            self.socket.send(file_data, zmq.SNDMORE)
-            self.socket.send_string(file_hash)
+            self.socket.send(payload, zmq.SNDMORE)
+            if codec:
+                self.socket.send_string(file_hash, zmq.SNDMORE)
+                self.socket.send_string(f"{codec}:{len(file_data)}")
+            else:
+                self.socket.send_string(file_hash)
             
             print("📤 File sent, waiting for reply...")
             
@@ -103,6 +361,178 @@ class ANARIUSDClient:
             print(f"❌ Error sending file: {e}")
             return False
     
+    def send_file_chunked(self, file_path, chunk_size=DEFAULT_CHUNK_SIZE, max_retries=5):
+        """
+        Send a file as a sequence of chunks that the server spools to disk.
+        Interrupted transfers are resumed from the last acknowledged chunk.
+        Protocol: BEGIN -> CHUNK* (windowed, acked) -> END
+        """
+        if not self.connected:
+            print("❌ Not connected to server")
+            return False
+
+        file_path = Path(file_path)
+        if not file_path.exists():
+            print(f"❌ File not found: {file_path}")
+            return False
+
+        if chunk_size < MIN_CHUNK_SIZE or chunk_size > MAX_CHUNK_SIZE:
+            print(f"❌ Chunk size must be between {MIN_CHUNK_SIZE} and {MAX_CHUNK_SIZE} bytes")
+            return False
+
+        total_size = file_path.stat().st_size
+        if total_size == 0:
+            print("❌ Cannot send an empty file")
+            return False
+
+        file_hash = self.calculate_hash_frame_file(file_path)
+        filename = file_path.name
+        # Deterministic, so a restarted sender resumes the same transfer
+        transfer_id = f"{file_hash.split(':')[-1][:32]}-{total_size}"
+
+        # Compressed once up front; chunks then slice the compressed stream
+        raw_size = total_size
+        encoding = None
+        send_path = file_path
+        temp_path = None
+        codec = self.select_codec() if total_size >= MIN_COMPRESS_SIZE else None
+        if codec:
+            with open(file_path, 'rb') as src, tempfile.NamedTemporaryFile(suffix=f".{codec}", delete=False) as dst:
+                temp_path = Path(dst.name)
+                compress_file(codec, src, dst)
+            compressed_size = temp_path.stat().st_size
+            if compressed_size < total_size:
+                encoding = f"{codec}:{raw_size}"
+                send_path = temp_path
+                total_size = compressed_size
+                transfer_id += f"-{codec}"
+                print(f"🗜️ {codec}: {self.format_bytes(total_size)} on the wire ({total_size / raw_size:.1%})")
+
+        total_chunks = (total_size + chunk_size - 1) // chunk_size
+
+        print(f"\n📤 SENDING FILE (chunked)")
+        print(f"📄 Filename: {filename}")
+        print(f"📊 Size: {self.format_bytes(total_size)} in {total_chunks} chunks of {self.format_bytes(chunk_size)}")
+        print(f"🔐 Hash: {file_hash[:16]}...")
+
+        try:
+            return self._send_chunks(send_path, transfer_id, filename, total_size, file_hash,
+                                     chunk_size, total_chunks, encoding, max_retries)
+        finally:
+            if temp_path:
+                temp_path.unlink(missing_ok=True)
+
+    def _send_chunks(self, send_path, transfer_id, filename, total_size, file_hash, chunk_size,
+                     total_chunks, encoding, max_retries):
+        with open(send_path, 'rb') as f:
+            for attempt in range(max_retries + 1):
+                try:
+                    return self._run_chunked_transfer(f, transfer_id, filename, total_size,
+                                                      file_hash, chunk_size, total_chunks, encoding)
+                except (TransferInterrupted, zmq.Again, zmq.ZMQError) as e:
+                    if attempt == max_retries:
+                        print(f"❌ Giving up after {max_retries} retries: {e}")
+                        return False
+                    delay = min(0.5 * (2 ** attempt), 10.0)
+                    print(f"⚠️ Transfer interrupted ({e}), resuming in {delay:.1f}s...")
+                    time.sleep(delay)
+                    if not self.reconnect():
+                        continue
+                except Exception as e:
+                    print(f"❌ Error sending file: {e}")
+                    return False
+        return False
+
+    def abort_chunked_transfer(self, transfer_id):
+        """Tell the server to discard a partially received transfer"""
+        self.socket.send_string(CHUNK_ABORT_TAG, zmq.SNDMORE)
+        self.socket.send_string(transfer_id)
+        return self._recv_json()
+
+    def _recv_json(self):
+        reply = self.socket.recv_string()
+        try:
+            return json.loads(reply)
+        except json.JSONDecodeError:
+            return {"status": "error", "message": reply}
+
+    def _run_chunked_transfer(self, f, transfer_id, filename, total_size, file_hash, chunk_size, total_chunks,
+                              encoding=None):
+        # BEGIN (also used to resume): the server answers with the first chunk it still needs
+        self.socket.send_string(CHUNK_BEGIN_TAG, zmq.SNDMORE)
+        self.socket.send_string(transfer_id, zmq.SNDMORE)
+        self.socket.send_string(filename, zmq.SNDMORE)
+        self.socket.send_string(str(total_size), zmq.SNDMORE)
+        self.socket.send_string(file_hash, zmq.SNDMORE)
+        if encoding:
+            self.socket.send_string(str(chunk_size), zmq.SNDMORE)
+            self.socket.send_string(encoding)
+        else:
+            self.socket.send_string(str(chunk_size))
+
+        reply = self._recv_json()
+        if reply.get("status") != "ready":
+            print(f"❌ Server refused transfer: {reply.get('message', reply)}")
+            return False
+
+        acked = int(reply.get("next_chunk", 0))
+        credit = max(1, int(reply.get("credit", 1)))
+        if acked > 0:
+            print(f"🔁 Resuming at chunk {acked}/{total_chunks}")
+
+        next_to_send = acked
+        in_flight = 0
+        start_time = time.time()
+
+        while acked < total_chunks:
+            # Keep up to `credit` chunks in flight
+            while in_flight < credit and next_to_send < total_chunks:
+                f.seek(next_to_send * chunk_size)
+                data = f.read(chunk_size)
+                self.socket.send_string(CHUNK_DATA_TAG, zmq.SNDMORE)
+                self.socket.send_string(transfer_id, zmq.SNDMORE)
+                self.socket.send_string(str(next_to_send), zmq.SNDMORE)
+                self.socket.send(data, copy=False)
+                next_to_send += 1
+                in_flight += 1
+
+            reply = self._recv_json()
+            in_flight -= 1
+            status = reply.get("status")
+
+            if status == "ack":
+                acked = max(acked, int(reply["next_chunk"]))
+            elif status == "nack":
+                # Collect the replies for chunks already sent, then rewind to what the server expects
+                while in_flight > 0:
+                    self._recv_json()
+                    in_flight -= 1
+                acked = int(reply["next_chunk"])
+                next_to_send = acked
+            elif reply.get("message") == "Unknown transfer":
+                raise TransferInterrupted("server lost transfer state")
+            else:
+                print(f"❌ Server error: {reply.get('message', reply)}")
+                return False
+
+            elapsed = max(time.time() - start_time, 1e-6)
+            sent_bytes = min(acked * chunk_size, total_size)
+            print(f"\r📦 {acked}/{total_chunks} chunks ({self.format_bytes(sent_bytes)}, "
+                  f"{self.format_bytes(sent_bytes / elapsed)}/s)", end="", flush=True)
+
+        print()
+        self.socket.send_string(CHUNK_END_TAG, zmq.SNDMORE)
+        self.socket.send_string(transfer_id)
+        reply = self.socket.recv_string()
+
+        if reply == "RECEIVED":
+            print(f"✅ Server reply: {reply}")
+            return True
+        if '"incomplete"' in reply:
+            raise TransferInterrupted("server reports missing chunks")
+        print(f"❌ Server reply: {reply}")
+        return False
+
     def send_message(self, message):
         """Send a simple text message"""
         if not self.connected:
@@ -153,9 +583,15 @@ Usage:
 
 Options:
     --endpoint <addr>    ZMQ endpoint (default: tcp://localhost:5556)
+    --hash <algorithm>   File digest: sha256 (default) or blake2b (faster, trusted networks)
+    --compress <codec>   auto (default, negotiated with the server), zstd, lz4 or none
 
 Commands:
     send-file <path>     Send a USD file or image
+    send-file-chunked <path> [--chunk-size <bytes>]
+                         Send a large file in resumable chunks
+    send-test-mesh [segments]
+                         Send a generated sphere as a binary .jmesh container
     send-message <text>  Send a text message
     send-json <file>     Send JSON from file
     test                 Send test messages
@@ -164,6 +600,9 @@ Commands:
 Examples:
     python3 zmq_client.py send-file model.usd
     python3 zmq_client.py send-file texture.png
+    python3 zmq_client.py send-file-chunked large_scene.usdc --chunk-size 8388608
+    python3 zmq_client.py --compress zstd send-file large_scene.usdc
+    python3 zmq_client.py send-test-mesh 256
     python3 zmq_client.py --endpoint tcp://192.168.1.100:5556 send-file scene.usda
     python3 zmq_client.py send-message "Hello from Python client"
     python3 zmq_client.py test
@@ -202,7 +641,7 @@ def run_test_sequence(client):
 def interactive_mode(client):
     """Interactive mode for sending messages"""
     print("\n🎮 Interactive mode - Type 'quit' to exit")
-    print("Commands: file <path>, message <text>, json <data>, quit")
+    print("Commands: file <path>, chunked <path>, message <text>, json <data>, quit")
     
     while True:
         try:
@@ -218,6 +657,8 @@ def interactive_mode(client):
             
             if command == 'file' and len(parts) > 1:
                 client.send_file(parts[1])
+            elif command == 'chunked' and len(parts) > 1:
+                client.send_file_chunked(parts[1])
             elif command == 'message' and len(parts) > 1:
                 client.send_message(parts[1])
             elif command == 'json' and len(parts) > 1:
@@ -227,7 +668,7 @@ def interactive_mode(client):
                 except json.JSONDecodeError:
                     print("❌ Invalid JSON format")
             else:
-                print("❌ Unknown command. Use: file <path>, message <text>, json <data>, quit")
+                print("❌ Unknown command. Use: file <path>, chunked <path>, message <text>, json <data>, quit")
                 
         except KeyboardInterrupt:
             break
@@ -255,6 +696,26 @@ def main():
             print("❌ --endpoint requires an address")
             return 1
     
+    hash_algorithm = "sha256"
+    if "--hash" in args:
+        idx = args.index("--hash")
+        if idx + 1 < len(args) and args[idx + 1] in HASH_ALGORITHMS:
+            hash_algorithm = args[idx + 1]
+            args = args[:idx] + args[idx + 2:]
+        else:
+            print(f"❌ --hash requires one of: {', '.join(HASH_ALGORITHMS)}")
+            return 1
+
+    compression = "auto"
+    if "--compress" in args:
+        idx = args.index("--compress")
+        if idx + 1 < len(args) and args[idx + 1] in COMPRESSION_CHOICES:
+            compression = args[idx + 1]
+            args = args[:idx] + args[idx + 2:]
+        else:
+            print(f"❌ --compress requires one of: {', '.join(COMPRESSION_CHOICES)}")
+            return 1
+
     if not args:
         print_usage()
         return 1
@@ -262,7 +723,7 @@ def main():
     command = args[0]
     
     # Create and connect client
-    client = ANARIUSDClient(endpoint)
+    client = ANARIUSDClient(endpoint, hash_algorithm, compression)
     if not client.connect():
         return 1
     
@@ -273,7 +734,34 @@ def main():
                 return 1
             success = client.send_file(args[1])
             return 0 if success else 1
-            
+
+        elif command == "send-file-chunked":
+            if len(args) < 2:
+                print("❌ send-file-chunked requires a file path")
+                return 1
+            chunk_size = DEFAULT_CHUNK_SIZE
+            if "--chunk-size" in args:
+                idx = args.index("--chunk-size")
+                try:
+                    chunk_size = int(args[idx + 1])
+                except (IndexError, ValueError):
+                    print("❌ --chunk-size requires a byte count")
+                    return 1
+            success = client.send_file_chunked(args[1], chunk_size)
+            return 0 if success else 1
+
+        elif command == "send-test-mesh":
+            try:
+                segments = int(args[1]) if len(args) > 1 else 32
+            except ValueError:
+                print("❌ send-test-mesh takes a segment count")
+                return 1
+            if segments < 3:
+                print("❌ send-test-mesh needs at least 3 segments")
+                return 1
+            success = client.send_meshes("test_sphere", [make_test_sphere(segments)])
+            return 0 if success else 1
+
         elif command == "send-message":
             if len(args) < 2:
                 print("❌ send-message requires a message")